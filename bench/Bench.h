@@ -0,0 +1,39 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+
+#include "Jitter.h"
+#include "Jitter_CodeGen_x86.h"
+#include "offsetof_def.h"
+#include "MemoryFunction.h"
+
+class CBench
+{
+public:
+	typedef CMemoryFunction FunctionType;
+
+	virtual ~CBench() = default;
+
+	virtual void Run() = 0;
+
+protected:
+	//Returns the best time (in microseconds) out of a few runs
+	template <typename Function>
+	static double MeasureBestTime(const Function& function, unsigned int runCount = 5)
+	{
+		double bestTime = std::numeric_limits<double>::max();
+		for(unsigned int i = 0; i < runCount; i++)
+		{
+			auto startTime = std::chrono::high_resolution_clock::now();
+			function();
+			auto endTime = std::chrono::high_resolution_clock::now();
+			double time = std::chrono::duration<double, std::micro>(endTime - startTime).count();
+			bestTime = std::min(bestTime, time);
+		}
+		return bestTime;
+	}
+};
@@ -0,0 +1,120 @@
+#include "ConstantCacheBench.h"
+#include "MemStream.h"
+#include "Jitter_CodeGen_x86_32.h"
+#include "Jitter_CodeGen_x86_64.h"
+
+#define ITERATION_COUNT (1000000)
+
+void CConstantCacheBench::Run()
+{
+#if defined(_M_X64) || defined(__x86_64__)
+	static const bool isHost64 = true;
+#else
+	static const bool isHost64 = false;
+#endif
+
+	printf("Constant cache (%d iterations of a clamp heavy kernel, time is only measured for the host's code generator)\n", ITERATION_COUNT);
+
+	for(unsigned int enabled = 0; enabled < 2; enabled++)
+	{
+		for(unsigned int is64 = 0; is64 < 2; is64++)
+		{
+			auto codeGen = CreateCodeGen(is64 != 0);
+			codeGen->SetConstantCacheEnabled(enabled != 0);
+
+			size_t codeSize = 0;
+			auto function = Compile(codeGen, codeSize);
+			printf("  %-9s %-8s size: %4d bytes", enabled ? "Enabled" : "Disabled", is64 ? "x86-64" : "x86-32", static_cast<int>(codeSize));
+			if((is64 != 0) == isHost64)
+			{
+				CONTEXT context;
+				double time = MeasureBestTime(
+				    [&]() {
+					    context = CONTEXT();
+					    for(unsigned int i = 0; i < VALUE_COUNT; i++)
+					    {
+						    for(unsigned int j = 0; j < 4; j++)
+						    {
+							    context.src[i][j] = static_cast<float>(i + j + 1) * 0.25f;
+						    }
+					    }
+					    context.counter = ITERATION_COUNT;
+					    function(&context);
+				    });
+				if(context.counter != 0)
+				{
+					printf("Invalid result, aborting.\n");
+					std::abort();
+				}
+				printf(", time: %8.0fus", time);
+			}
+			printf("\n");
+		}
+	}
+}
+
+Jitter::CCodeGen_x86* CConstantCacheBench::CreateCodeGen(bool is64)
+{
+	if(is64)
+	{
+		auto codeGen = new Jitter::CCodeGen_x86_64();
+#if defined(_WIN32)
+		codeGen->SetPlatformAbi(Jitter::CCodeGen_x86_64::PLATFORM_ABI_WIN32);
+#endif
+		return codeGen;
+	}
+	else
+	{
+		auto codeGen = new Jitter::CCodeGen_x86_32();
+#if !defined(_WIN32)
+		codeGen->SetImplicitRetValueParamFixUpRequired(true);
+#endif
+		return codeGen;
+	}
+}
+
+CBench::FunctionType CConstantCacheBench::Compile(Jitter::CCodeGen_x86* codeGen, size_t& codeSize)
+{
+	Jitter::CJitter jitter(codeGen);
+
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		auto loopLabel = jitter.CreateLabel();
+		jitter.MarkLabel(loopLabel);
+
+		//Every result gets clamped, as is commonly done when emulating non IEEE 754 compliant FPUs
+		for(unsigned int i = 0; i < VALUE_COUNT; i++)
+		{
+			jitter.MD_PushRel(offsetof(CONTEXT, src) + (i * 0x10));
+			jitter.MD_ClampS();
+			jitter.MD_PushRel(offsetof(CONTEXT, src) + (((i + 1) % VALUE_COUNT) * 0x10));
+			jitter.MD_ClampS();
+			jitter.MD_MulS();
+			jitter.MD_ClampS();
+			jitter.MD_PushRel(offsetof(CONTEXT, dst) + (i * 0x10));
+			jitter.MD_AddS();
+			jitter.MD_ClampS();
+			jitter.MD_PullRel(offsetof(CONTEXT, dst) + (i * 0x10));
+		}
+
+		jitter.PushRel(offsetof(CONTEXT, counter));
+		jitter.PushCst(1);
+		jitter.Sub();
+		jitter.PullRel(offsetof(CONTEXT, counter));
+
+		jitter.PushRel(offsetof(CONTEXT, counter));
+		jitter.PushCst(0);
+		jitter.BeginIf(Jitter::CONDITION_NE);
+		{
+			jitter.Goto(loopLabel);
+		}
+		jitter.EndIf();
+	}
+	jitter.End();
+
+	codeSize = codeStream.GetSize();
+	return FunctionType(codeStream.GetBuffer(), codeStream.GetSize());
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Bench.h"
+
+class CConstantCacheBench : public CBench
+{
+public:
+	void Run() override;
+
+private:
+	enum
+	{
+		VALUE_COUNT = 4,
+	};
+
+	struct alignas(16) CONTEXT
+	{
+		float src[VALUE_COUNT][4];
+		float dst[VALUE_COUNT][4];
+
+		uint32 counter;
+	};
+
+	static Jitter::CCodeGen_x86* CreateCodeGen(bool);
+	static FunctionType Compile(Jitter::CCodeGen_x86*, size_t&);
+};
@@ -0,0 +1,113 @@
+#include "FpDependencyBench.h"
+#include "MemStream.h"
+#if defined(_M_X64) || defined(__x86_64__)
+#include "Jitter_CodeGen_x86_64.h"
+#else
+#include "Jitter_CodeGen_x86_32.h"
+#endif
+
+#define ITERATION_COUNT (2000000)
+
+void CFpDependencyBench::Run()
+{
+	struct CONFIG
+	{
+		const char* name;
+		CX86CpuFeatures features;
+	};
+
+	auto hostFeatures = CX86CpuFeatures::AutoDetect();
+
+	auto sseFeatures = hostFeatures;
+	sseFeatures.hasAvx = false;
+	sseFeatures.hasAvx2 = false;
+	sseFeatures.hasFma = false;
+	sseFeatures.hasAvx512 = false;
+
+	const CONFIG configs[] =
+	    {
+	        {"SSE", sseFeatures},
+	        {"Host", hostFeatures},
+	    };
+
+	printf("FP dependency chains (%d iterations, independent sqrt/conversion per iteration)\n", ITERATION_COUNT);
+
+	for(const auto& config : configs)
+	{
+		size_t codeSize = 0;
+		auto function = Compile(config.features, codeSize);
+		CONTEXT context;
+		double time = MeasureBestTime(
+		    [&]() {
+			    context = CONTEXT();
+			    context.counter = ITERATION_COUNT;
+			    context.value = 2.0f;
+			    function(&context);
+		    });
+		if(context.counter != 0)
+		{
+			printf("Invalid result, aborting.\n");
+			std::abort();
+		}
+		printf("  %-44s time: %8.0fus, size: %4d bytes\n",
+		       config.name, time, static_cast<int>(codeSize));
+	}
+}
+
+CBench::FunctionType CFpDependencyBench::Compile(const CX86CpuFeatures& features, size_t& codeSize)
+{
+#if defined(_M_X64) || defined(__x86_64__)
+	auto codeGen = new Jitter::CCodeGen_x86_64(features);
+#if defined(_WIN32)
+	codeGen->SetPlatformAbi(Jitter::CCodeGen_x86_64::PLATFORM_ABI_WIN32);
+#endif
+#else
+	auto codeGen = new Jitter::CCodeGen_x86_32(features);
+#if !defined(_WIN32)
+	codeGen->SetImplicitRetValueParamFixUpRequired(true);
+#endif
+#endif
+
+	Jitter::CJitter jitter(codeGen);
+
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		auto loopLabel = jitter.CreateLabel();
+		jitter.MarkLabel(loopLabel);
+
+		//Operations that only write the low lane of their destination, each iteration is
+		//independent from the previous one unless a false dependency is carried over
+		jitter.FP_PushRel32(offsetof(CONTEXT, value));
+		jitter.FP_SqrtS();
+		jitter.FP_PullRel32(offsetof(CONTEXT, root));
+
+		jitter.FP_PushRel32(offsetof(CONTEXT, counter));
+		jitter.FP_ToSingleI32();
+		jitter.FP_PullRel32(offsetof(CONTEXT, converted));
+
+		jitter.FP_PushRel32(offsetof(CONTEXT, root));
+		jitter.FP_PushRel32(offsetof(CONTEXT, converted));
+		jitter.FP_AddS();
+		jitter.FP_PullRel32(offsetof(CONTEXT, total));
+
+		jitter.PushRel(offsetof(CONTEXT, counter));
+		jitter.PushCst(1);
+		jitter.Sub();
+		jitter.PullRel(offsetof(CONTEXT, counter));
+
+		jitter.PushRel(offsetof(CONTEXT, counter));
+		jitter.PushCst(0);
+		jitter.BeginIf(Jitter::CONDITION_NE);
+		{
+			jitter.Goto(loopLabel);
+		}
+		jitter.EndIf();
+	}
+	jitter.End();
+
+	codeSize = codeStream.GetSize();
+	return FunctionType(codeStream.GetBuffer(), codeStream.GetSize());
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Bench.h"
+
+class CFpDependencyBench : public CBench
+{
+public:
+	void Run() override;
+
+private:
+	struct CONTEXT
+	{
+		uint32 counter = 0;
+		float value = 0;
+		float root = 0;
+		float converted = 0;
+		float total = 0;
+	};
+
+	static FunctionType Compile(const CX86CpuFeatures&, size_t&);
+};
@@ -0,0 +1,127 @@
+#include "LoopAlignmentBench.h"
+#include "Jitter_CodeGenFactory.h"
+#include "MemStream.h"
+
+#define ITERATION_COUNT (4000000)
+
+void CLoopAlignmentBench::Run()
+{
+	struct CONFIG
+	{
+		const char* name;
+		uint32 loopAlignment;
+		bool jccErratumPadding;
+	};
+
+	static const CONFIG configs[] =
+	    {
+	        {"Default", 0, false},
+	        {"Loop alignment (32)", 32, false},
+	        {"Loop alignment (64)", 64, false},
+	        {"JCC erratum padding", 0, true},
+	        {"Loop alignment (32) + JCC erratum padding", 32, true},
+	    };
+
+	printf("Loop alignment (%d iterations, loop head moved by %d different filler sizes)\n", ITERATION_COUNT, MAX_FILLER_COUNT);
+
+	for(const auto& config : configs)
+	{
+		double minTime = std::numeric_limits<double>::max();
+		double maxTime = 0;
+		double totalTime = 0;
+		size_t totalSize = 0;
+		for(unsigned int fillerCount = 0; fillerCount < MAX_FILLER_COUNT; fillerCount++)
+		{
+			size_t codeSize = 0;
+			auto function = Compile(config.loopAlignment, config.jccErratumPadding, fillerCount, codeSize);
+			CONTEXT context;
+			double time = MeasureBestTime(
+			    [&]() {
+				    context = CONTEXT();
+				    context.counter = ITERATION_COUNT;
+				    function(&context);
+			    });
+			if((context.odd + context.even) != ITERATION_COUNT)
+			{
+				printf("Invalid result, aborting.\n");
+				std::abort();
+			}
+			minTime = std::min(minTime, time);
+			maxTime = std::max(maxTime, time);
+			totalTime += time;
+			totalSize += codeSize;
+		}
+		printf("  %-44s min: %8.0fus, max: %8.0fus, avg: %8.0fus, avg size: %4d bytes\n",
+		       config.name, minTime, maxTime, totalTime / MAX_FILLER_COUNT,
+		       static_cast<int>(totalSize / MAX_FILLER_COUNT));
+	}
+}
+
+CBench::FunctionType CLoopAlignmentBench::Compile(uint32 loopAlignment, bool jccErratumPadding, unsigned int fillerCount, size_t& codeSize)
+{
+	auto codeGen = static_cast<Jitter::CCodeGen_x86*>(Jitter::CreateCodeGen());
+	codeGen->SetLoopAlignment(loopAlignment);
+	codeGen->SetJccErratumPaddingEnabled(jccErratumPadding);
+
+	Jitter::CJitter jitter(codeGen);
+
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		//Moves the loop head around
+		for(unsigned int i = 0; i < fillerCount; i++)
+		{
+			jitter.PushCst(i);
+			jitter.PullRel(offsetof(CONTEXT, filler) + (i * 4));
+		}
+
+		auto loopLabel = jitter.CreateLabel();
+		jitter.MarkLabel(loopLabel);
+
+		jitter.PushRel(offsetof(CONTEXT, counter));
+		jitter.PushCst(1);
+		jitter.And();
+		jitter.PushCst(0);
+		jitter.BeginIf(Jitter::CONDITION_NE);
+		{
+			jitter.PushRel(offsetof(CONTEXT, odd));
+			jitter.PushCst(1);
+			jitter.Add();
+			jitter.PullRel(offsetof(CONTEXT, odd));
+		}
+		jitter.Else();
+		{
+			jitter.PushRel(offsetof(CONTEXT, even));
+			jitter.PushCst(1);
+			jitter.Add();
+			jitter.PullRel(offsetof(CONTEXT, even));
+		}
+		jitter.EndIf();
+
+		jitter.PushRel(offsetof(CONTEXT, total));
+		jitter.PushRel(offsetof(CONTEXT, counter));
+		jitter.Xor();
+		jitter.PushCst(3);
+		jitter.Add();
+		jitter.PullRel(offsetof(CONTEXT, total));
+
+		jitter.PushRel(offsetof(CONTEXT, counter));
+		jitter.PushCst(1);
+		jitter.Sub();
+		jitter.PullRel(offsetof(CONTEXT, counter));
+
+		jitter.PushRel(offsetof(CONTEXT, counter));
+		jitter.PushCst(0);
+		jitter.BeginIf(Jitter::CONDITION_NE);
+		{
+			jitter.Goto(loopLabel);
+		}
+		jitter.EndIf();
+	}
+	jitter.End();
+
+	codeSize = codeStream.GetSize();
+	return FunctionType(codeStream.GetBuffer(), codeStream.GetSize());
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Bench.h"
+
+#define MAX_FILLER_COUNT (8)
+
+class CLoopAlignmentBench : public CBench
+{
+public:
+	void Run() override;
+
+private:
+	struct CONTEXT
+	{
+		uint32 counter = 0;
+		uint32 total = 0;
+		uint32 odd = 0;
+		uint32 even = 0;
+		uint32 filler[MAX_FILLER_COUNT] = {};
+	};
+
+	static FunctionType Compile(uint32, bool, unsigned int, size_t&);
+};
@@ -0,0 +1,29 @@
+#include <functional>
+#include <memory>
+
+#include "ConstantCacheBench.h"
+#include "FpDependencyBench.h"
+#include "LoopAlignmentBench.h"
+#include "MdKernelBench.h"
+
+typedef std::function<CBench*()> BenchFactoryFunction;
+
+// clang-format off
+static const BenchFactoryFunction s_factories[] =
+{
+	[] () { return new CLoopAlignmentBench(); },
+	[] () { return new CFpDependencyBench(); },
+	[] () { return new CMdKernelBench(); },
+	[] () { return new CConstantCacheBench(); },
+};
+// clang-format on
+
+int main(int argc, const char** argv)
+{
+	for(const auto& factory : s_factories)
+	{
+		std::unique_ptr<CBench> bench(factory());
+		bench->Run();
+	}
+	return 0;
+}
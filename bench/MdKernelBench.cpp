@@ -0,0 +1,196 @@
+#include "MdKernelBench.h"
+#include "MemStream.h"
+#include "Jitter_CodeGen_x86_32.h"
+#include "Jitter_CodeGen_x86_64.h"
+
+#define ITERATION_COUNT (1000000)
+
+#define SRC_OFFSET(i) (offsetof(CONTEXT, src) + ((i) * 0x10))
+#define DST_OFFSET(i) (offsetof(CONTEXT, dst) + ((i) * 0x10))
+
+void CMdKernelBench::Run()
+{
+	struct KERNEL
+	{
+		const char* name;
+		KernelEmitter emitter;
+	};
+
+	static const KERNEL kernels[] =
+	    {
+	        {"MdAdd", &CMdKernelBench::EmitAddKernel},
+	        {"MdFp", &CMdKernelBench::EmitFpKernel},
+	        {"MdLive", &CMdKernelBench::EmitLiveKernel},
+	        {"MdLiveSat", &CMdKernelBench::EmitLiveSatKernel},
+	    };
+
+#if defined(_M_X64) || defined(__x86_64__)
+	static const bool isHost64 = true;
+#else
+	static const bool isHost64 = false;
+#endif
+
+	printf("MD kernels (%d iterations, time is only measured for the host's code generator)\n", ITERATION_COUNT);
+
+	for(const auto& kernel : kernels)
+	{
+		for(unsigned int is64 = 0; is64 < 2; is64++)
+		{
+			Jitter::CCodeGen* codeGen = nullptr;
+			if(is64)
+			{
+				auto codeGen64 = new Jitter::CCodeGen_x86_64();
+#if defined(_WIN32)
+				codeGen64->SetPlatformAbi(Jitter::CCodeGen_x86_64::PLATFORM_ABI_WIN32);
+#endif
+				codeGen = codeGen64;
+			}
+			else
+			{
+				auto codeGen32 = new Jitter::CCodeGen_x86_32();
+#if !defined(_WIN32)
+				codeGen32->SetImplicitRetValueParamFixUpRequired(true);
+#endif
+				codeGen = codeGen32;
+			}
+
+			size_t codeSize = 0;
+			auto function = Compile(codeGen, kernel.emitter, codeSize);
+			printf("  %-10s %-8s size: %4d bytes", kernel.name, is64 ? "x86-64" : "x86-32", static_cast<int>(codeSize));
+			if((is64 != 0) == isHost64)
+			{
+				CONTEXT context;
+				double time = MeasureBestTime(
+				    [&]() {
+					    context = CONTEXT();
+					    for(unsigned int i = 0; i < 4; i++)
+					    {
+						    float value = static_cast<float>(i + 1);
+						    memcpy(&context.src[0][i], &value, sizeof(float));
+						    context.src[1][i] = 0x40000000 + (i << 20);
+						    context.src[2][i] = 0x3F800000 - (i << 16);
+						    context.src[3][i] = 0xC0400000 + (i << 20);
+						    context.src[4][i] = 0x3F000000 + (i << 20);
+						    context.src[5][i] = 0x3E800000 + (i << 20);
+					    }
+					    context.counter = ITERATION_COUNT;
+					    function(&context);
+				    });
+				if(context.counter != 0)
+				{
+					printf("Invalid result, aborting.\n");
+					std::abort();
+				}
+				printf(", time: %8.0fus", time);
+			}
+			printf("\n");
+		}
+	}
+}
+
+void CMdKernelBench::EmitOp(Jitter::CJitter& jitter, JitterOp op, size_t src0Offset, size_t src1Offset, size_t dstOffset)
+{
+	jitter.MD_PushRel(src0Offset);
+	jitter.MD_PushRel(src1Offset);
+	(jitter.*op)();
+	jitter.MD_PullRel(dstOffset);
+}
+
+//Same operations as MdAddTest
+void CMdKernelBench::EmitAddKernel(Jitter::CJitter& jitter)
+{
+	EmitOp(jitter, &Jitter::CJitter::MD_AddB, SRC_OFFSET(1), SRC_OFFSET(1), DST_OFFSET(0));
+	EmitOp(jitter, &Jitter::CJitter::MD_AddBUS, SRC_OFFSET(1), SRC_OFFSET(1), DST_OFFSET(1));
+	EmitOp(jitter, &Jitter::CJitter::MD_AddBSS, SRC_OFFSET(1), SRC_OFFSET(1), DST_OFFSET(2));
+	EmitOp(jitter, &Jitter::CJitter::MD_AddH, SRC_OFFSET(1), SRC_OFFSET(1), DST_OFFSET(3));
+	EmitOp(jitter, &Jitter::CJitter::MD_AddHUS, SRC_OFFSET(1), SRC_OFFSET(1), DST_OFFSET(4));
+	EmitOp(jitter, &Jitter::CJitter::MD_AddHSS, SRC_OFFSET(1), SRC_OFFSET(1), DST_OFFSET(5));
+	EmitOp(jitter, &Jitter::CJitter::MD_AddW, SRC_OFFSET(1), SRC_OFFSET(1), DST_OFFSET(6));
+	EmitOp(jitter, &Jitter::CJitter::MD_AddWUS, SRC_OFFSET(2), SRC_OFFSET(3), DST_OFFSET(7));
+	EmitOp(jitter, &Jitter::CJitter::MD_AddWSS, SRC_OFFSET(1), SRC_OFFSET(1), DST_OFFSET(8));
+}
+
+//Same operations as MdFpTest
+void CMdKernelBench::EmitFpKernel(Jitter::CJitter& jitter)
+{
+	EmitOp(jitter, &Jitter::CJitter::MD_AddS, SRC_OFFSET(0), SRC_OFFSET(1), DST_OFFSET(0));
+	EmitOp(jitter, &Jitter::CJitter::MD_SubS, SRC_OFFSET(0), SRC_OFFSET(1), DST_OFFSET(1));
+	EmitOp(jitter, &Jitter::CJitter::MD_MulS, SRC_OFFSET(0), SRC_OFFSET(1), DST_OFFSET(2));
+	EmitOp(jitter, &Jitter::CJitter::MD_DivS, SRC_OFFSET(0), SRC_OFFSET(1), DST_OFFSET(3));
+
+	jitter.MD_PushRel(DST_OFFSET(1));
+	jitter.MD_AbsS();
+	jitter.MD_PullRel(DST_OFFSET(4));
+
+	jitter.MD_PushRel(DST_OFFSET(1));
+	jitter.MD_NegS();
+	jitter.MD_PullRel(DST_OFFSET(5));
+
+	EmitOp(jitter, &Jitter::CJitter::MD_MinS, SRC_OFFSET(0), SRC_OFFSET(1), DST_OFFSET(6));
+	EmitOp(jitter, &Jitter::CJitter::MD_MaxS, SRC_OFFSET(0), SRC_OFFSET(1), DST_OFFSET(7));
+	EmitOp(jitter, &Jitter::CJitter::MD_CmpLtS, SRC_OFFSET(0), SRC_OFFSET(1), DST_OFFSET(8));
+	EmitOp(jitter, &Jitter::CJitter::MD_CmpGtS, SRC_OFFSET(0), SRC_OFFSET(1), DST_OFFSET(9));
+
+	jitter.MD_PushRel(SRC_OFFSET(2));
+	jitter.MD_ToInt32TruncateS();
+	jitter.MD_PullRel(DST_OFFSET(10));
+
+	jitter.MD_PushRel(DST_OFFSET(10));
+	jitter.MD_ToSingleI32();
+	jitter.MD_PullRel(DST_OFFSET(11));
+}
+
+//Keeps six vectors live through the whole kernel
+void CMdKernelBench::EmitLiveKernel(Jitter::CJitter& jitter)
+{
+	for(unsigned int i = 0; i < 12; i++)
+	{
+		EmitOp(jitter, &Jitter::CJitter::MD_MulS, SRC_OFFSET(i % 6), SRC_OFFSET((i + 1) % 6), DST_OFFSET(i));
+		EmitOp(jitter, &Jitter::CJitter::MD_MaxS, DST_OFFSET(i), SRC_OFFSET((i + 2) % 6), DST_OFFSET(i));
+		EmitOp(jitter, &Jitter::CJitter::MD_AddW, DST_OFFSET(i), SRC_OFFSET((i + 3) % 6), DST_OFFSET(i));
+	}
+}
+
+//Same as above, but with operations that need temporary registers
+void CMdKernelBench::EmitLiveSatKernel(Jitter::CJitter& jitter)
+{
+	for(unsigned int i = 0; i < 12; i++)
+	{
+		EmitOp(jitter, &Jitter::CJitter::MD_MulS, SRC_OFFSET(i % 6), SRC_OFFSET((i + 1) % 6), DST_OFFSET(i));
+		EmitOp(jitter, &Jitter::CJitter::MD_MaxS, DST_OFFSET(i), SRC_OFFSET((i + 2) % 6), DST_OFFSET(i));
+		EmitOp(jitter, &Jitter::CJitter::MD_AddWSS, DST_OFFSET(i), SRC_OFFSET((i + 3) % 6), DST_OFFSET(i));
+	}
+}
+
+CBench::FunctionType CMdKernelBench::Compile(Jitter::CCodeGen* codeGen, KernelEmitter emitter, size_t& codeSize)
+{
+	Jitter::CJitter jitter(codeGen);
+
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		auto loopLabel = jitter.CreateLabel();
+		jitter.MarkLabel(loopLabel);
+
+		emitter(jitter);
+
+		jitter.PushRel(offsetof(CONTEXT, counter));
+		jitter.PushCst(1);
+		jitter.Sub();
+		jitter.PullRel(offsetof(CONTEXT, counter));
+
+		jitter.PushRel(offsetof(CONTEXT, counter));
+		jitter.PushCst(0);
+		jitter.BeginIf(Jitter::CONDITION_NE);
+		{
+			jitter.Goto(loopLabel);
+		}
+		jitter.EndIf();
+	}
+	jitter.End();
+
+	codeSize = codeStream.GetSize();
+	return FunctionType(codeStream.GetBuffer(), codeStream.GetSize());
+}
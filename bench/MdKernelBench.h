@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Bench.h"
+
+class CMdKernelBench : public CBench
+{
+public:
+	void Run() override;
+
+private:
+	typedef void (*KernelEmitter)(Jitter::CJitter&);
+	typedef void (Jitter::CJitter::*JitterOp)();
+
+	struct alignas(16) CONTEXT
+	{
+		uint32 src[6][4];
+
+		uint32 dst[13][4];
+
+		uint32 counter;
+	};
+
+	static void EmitAddKernel(Jitter::CJitter&);
+	static void EmitFpKernel(Jitter::CJitter&);
+	static void EmitLiveKernel(Jitter::CJitter&);
+	static void EmitLiveSatKernel(Jitter::CJitter&);
+	static void EmitOp(Jitter::CJitter&, JitterOp, size_t, size_t, size_t);
+
+	static FunctionType Compile(Jitter::CCodeGen*, KernelEmitter, size_t&);
+};
@@ -225,6 +225,7 @@ public:
 	void Ldrh(REGISTER, REGISTER, const LdrAddress&);
 	void Ldr_Pc(REGISTER, int32);
 	void Ldrd(REGISTER, REGISTER, const LdrAddress&);
+	void Mla(REGISTER, REGISTER, REGISTER, REGISTER);
 	void Mov(REGISTER, REGISTER);
 	void Mov(REGISTER, const RegisterAluOperand&);
 	void Mov(REGISTER, const ImmediateAluOperand&);
@@ -232,11 +233,14 @@ public:
 	void MovCc(CONDITION, REGISTER, const ImmediateAluOperand&);
 	void Movw(REGISTER, uint16);
 	void Movt(REGISTER, uint16);
+	void Mul(REGISTER, REGISTER, REGISTER);
 	void Mvn(REGISTER, REGISTER);
 	void Mvn(REGISTER, const ImmediateAluOperand&);
 	void Or(REGISTER, REGISTER, REGISTER);
 	void Or(REGISTER, REGISTER, const ImmediateAluOperand&);
 	void Or(CONDITION, REGISTER, REGISTER, const ImmediateAluOperand&);
+	void Rbit(REGISTER, REGISTER);
+	void Rev(REGISTER, REGISTER);
 	void Rsb(REGISTER, REGISTER, const ImmediateAluOperand&);
 	void Sbc(REGISTER, REGISTER, REGISTER);
 	void Sdiv(REGISTER, REGISTER, REGISTER);
@@ -256,29 +260,37 @@ public:
 
 	//VFP/NEON
 	void Vldr(SINGLE_REGISTER, REGISTER, const LdrAddress&);
+	void Vldr(DOUBLE_REGISTER, REGISTER, const LdrAddress&);
 	void Vld1_32x2(DOUBLE_REGISTER, REGISTER);
 	void Vld1_32x4(QUAD_REGISTER, REGISTER);
 	void Vld1_32x4_u(QUAD_REGISTER, REGISTER);
 	void Vstr(SINGLE_REGISTER, REGISTER, const LdrAddress&);
+	void Vstr(DOUBLE_REGISTER, REGISTER, const LdrAddress&);
 	void Vst1_32x4(QUAD_REGISTER, REGISTER);
 	void Vmov(DOUBLE_REGISTER, REGISTER, uint8);
 	void Vmov(REGISTER, DOUBLE_REGISTER, uint8);
+	void VmovCc_F64(CONDITION, DOUBLE_REGISTER, DOUBLE_REGISTER);
 	void Vmovn_I16(DOUBLE_REGISTER, QUAD_REGISTER);
 	void Vmovn_I32(DOUBLE_REGISTER, QUAD_REGISTER);
+	void Vmovn_I64(DOUBLE_REGISTER, QUAD_REGISTER);
 	void Vdup(QUAD_REGISTER, REGISTER);
 	void Vdup_32(QUAD_REGISTER, DOUBLE_REGISTER, uint8);
 	void Vzip_I8(DOUBLE_REGISTER, DOUBLE_REGISTER);
 	void Vzip_I16(DOUBLE_REGISTER, DOUBLE_REGISTER);
 	void Vzip_I32(QUAD_REGISTER, QUAD_REGISTER);
+	void Vuzp_I16(QUAD_REGISTER, QUAD_REGISTER);
 	void Vtbl(DOUBLE_REGISTER, DOUBLE_REGISTER, DOUBLE_REGISTER);
 	void Vadd_F32(SINGLE_REGISTER, SINGLE_REGISTER, SINGLE_REGISTER);
 	void Vadd_F32(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
+	void Vadd_F64(DOUBLE_REGISTER, DOUBLE_REGISTER, DOUBLE_REGISTER);
 	void Vadd_I8(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
 	void Vadd_I16(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
 	void Vadd_I32(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
+	void Vpadd_F32(DOUBLE_REGISTER, DOUBLE_REGISTER, DOUBLE_REGISTER);
 	void Vpaddl_U8(QUAD_REGISTER, QUAD_REGISTER);
 	void Vpaddl_U16(QUAD_REGISTER, QUAD_REGISTER);
 	void Vpaddl_U32(QUAD_REGISTER, QUAD_REGISTER);
+	void Vcnt_I8(QUAD_REGISTER, QUAD_REGISTER);
 	void Vqadd_U8(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
 	void Vqadd_U16(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
 	void Vqadd_U32(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
@@ -287,6 +299,7 @@ public:
 	void Vqadd_I32(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
 	void Vsub_F32(SINGLE_REGISTER, SINGLE_REGISTER, SINGLE_REGISTER);
 	void Vsub_F32(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
+	void Vsub_F64(DOUBLE_REGISTER, DOUBLE_REGISTER, DOUBLE_REGISTER);
 	void Vsub_I8(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
 	void Vsub_I16(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
 	void Vsub_I32(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
@@ -298,7 +311,9 @@ public:
 	void Vqsub_I32(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
 	void Vmul_F32(SINGLE_REGISTER, SINGLE_REGISTER, SINGLE_REGISTER);
 	void Vmul_F32(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
+	void Vmul_F64(DOUBLE_REGISTER, DOUBLE_REGISTER, DOUBLE_REGISTER);
 	void Vdiv_F32(SINGLE_REGISTER, SINGLE_REGISTER, SINGLE_REGISTER);
+	void Vdiv_F64(DOUBLE_REGISTER, DOUBLE_REGISTER, DOUBLE_REGISTER);
 	void Vand(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
 	void Vorn(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
 	void Vorr(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
@@ -312,9 +327,12 @@ public:
 	void Vshr_I32(QUAD_REGISTER, QUAD_REGISTER, uint8);
 	void Vabs_F32(SINGLE_REGISTER, SINGLE_REGISTER);
 	void Vabs_F32(QUAD_REGISTER, QUAD_REGISTER);
+	void Vabs_F64(DOUBLE_REGISTER, DOUBLE_REGISTER);
 	void Vneg_F32(SINGLE_REGISTER, SINGLE_REGISTER);
 	void Vneg_F32(QUAD_REGISTER, QUAD_REGISTER);
+	void Vneg_F64(DOUBLE_REGISTER, DOUBLE_REGISTER);
 	void Vsqrt_F32(SINGLE_REGISTER, SINGLE_REGISTER);
+	void Vsqrt_F64(DOUBLE_REGISTER, DOUBLE_REGISTER);
 	void Vceq_I8(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
 	void Vceq_I16(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
 	void Vceq_I32(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
@@ -327,10 +345,15 @@ public:
 	void Vcltz_I32(QUAD_REGISTER, QUAD_REGISTER);
 	void Vcmp_F32(SINGLE_REGISTER, SINGLE_REGISTER);
 	void Vcmpz_F32(SINGLE_REGISTER);
+	void Vcmp_F64(DOUBLE_REGISTER, DOUBLE_REGISTER);
 	void Vcvt_F32_S32(SINGLE_REGISTER, SINGLE_REGISTER);
 	void Vcvt_F32_S32(QUAD_REGISTER, QUAD_REGISTER);
 	void Vcvt_S32_F32(SINGLE_REGISTER, SINGLE_REGISTER);
 	void Vcvt_S32_F32(QUAD_REGISTER, QUAD_REGISTER);
+	void Vcvt_F64_F32(DOUBLE_REGISTER, SINGLE_REGISTER);
+	void Vcvt_F32_F64(SINGLE_REGISTER, DOUBLE_REGISTER);
+	void Vcvt_F64_S32(DOUBLE_REGISTER, SINGLE_REGISTER);
+	void Vcvt_S32_F64(SINGLE_REGISTER, DOUBLE_REGISTER);
 	void Vmrs(REGISTER);
 
 	void Vrecpe_F32(QUAD_REGISTER, QUAD_REGISTER);
@@ -344,6 +367,12 @@ public:
 	void Vmax_F32(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
 	void Vmax_I16(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
 	void Vmax_I32(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
+	void Vmul_I16(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
+	void Vmul_I32(QUAD_REGISTER, QUAD_REGISTER, QUAD_REGISTER);
+	void Vmull_S16(QUAD_REGISTER, DOUBLE_REGISTER, DOUBLE_REGISTER);
+	void Vmull_U16(QUAD_REGISTER, DOUBLE_REGISTER, DOUBLE_REGISTER);
+	void Vmull_S32(QUAD_REGISTER, DOUBLE_REGISTER, DOUBLE_REGISTER);
+	void Vmull_U32(QUAD_REGISTER, DOUBLE_REGISTER, DOUBLE_REGISTER);
 
 	static LdrAddress MakeImmediateLdrAddress(int32);
 	static LdrAddress MakeRegisterLdrAddress(REGISTER, SHIFT = SHIFT_LSL, uint8 = 0);
@@ -99,6 +99,7 @@ public:
 	void Add_4s(REGISTERMD, REGISTERMD, REGISTERMD);
 	void Add_8h(REGISTERMD, REGISTERMD, REGISTERMD);
 	void Add_16b(REGISTERMD, REGISTERMD, REGISTERMD);
+	void Adr(REGISTER64, LABEL);
 	void And(REGISTER32, REGISTER32, REGISTER32);
 	void And(REGISTER64, REGISTER64, REGISTER64);
 	void And(REGISTER32, REGISTER32, uint8, uint8, uint8);
@@ -131,40 +132,63 @@ public:
 	void Cmp(REGISTER64, REGISTER64);
 	void Cmp(REGISTER32, uint16, ADDSUB_IMM_SHIFT_TYPE);
 	void Cmp(REGISTER64, uint16, ADDSUB_IMM_SHIFT_TYPE);
+	void Cnt_16b(REGISTERMD, REGISTERMD);
 	void Csel(REGISTER32, REGISTER32, REGISTER32, CONDITION);
+	void Csel(REGISTER64, REGISTER64, REGISTER64, CONDITION);
 	void Cset(REGISTER32, CONDITION);
 	void Dup_4s(REGISTERMD, REGISTER32);
 	void Dup_4s(REGISTERMD, REGISTERMD, uint8);
 	void Eor(REGISTER32, REGISTER32, REGISTER32);
+	void Eor(REGISTER64, REGISTER64, REGISTER64);
 	void Eor(REGISTER32, REGISTER32, uint8, uint8, uint8);
 	void Eor_16b(REGISTERMD, REGISTERMD, REGISTERMD);
 	void Fabs_1s(REGISTERMD, REGISTERMD);
+	void Fabs_1d(REGISTERMD, REGISTERMD);
 	void Fabs_4s(REGISTERMD, REGISTERMD);
 	void Fadd_1s(REGISTERMD, REGISTERMD, REGISTERMD);
+	void Fadd_1d(REGISTERMD, REGISTERMD, REGISTERMD);
 	void Fadd_4s(REGISTERMD, REGISTERMD, REGISTERMD);
+	void Faddp_4s(REGISTERMD, REGISTERMD, REGISTERMD);
 	void Fcmeqz_4s(REGISTERMD, REGISTERMD);
 	void Fcmge_4s(REGISTERMD, REGISTERMD, REGISTERMD);
 	void Fcmgt_4s(REGISTERMD, REGISTERMD, REGISTERMD);
 	void Fcmltz_4s(REGISTERMD, REGISTERMD);
 	void Fcmp_1s(REGISTERMD, REGISTERMD);
+	void Fcmp_1d(REGISTERMD, REGISTERMD);
+	void Fcvt_1d_1s(REGISTERMD, REGISTERMD);
+	void Fcvt_1s_1d(REGISTERMD, REGISTERMD);
 	void Fcvtzs_1s(REGISTERMD, REGISTERMD);
+	void Fcvtzs_1d(REGISTERMD, REGISTERMD);
+	void Fcvtzs_1d(REGISTER32, REGISTERMD);
 	void Fcvtzs_4s(REGISTERMD, REGISTERMD);
 	void Fdiv_1s(REGISTERMD, REGISTERMD, REGISTERMD);
+	void Fdiv_1d(REGISTERMD, REGISTERMD, REGISTERMD);
 	void Fdiv_4s(REGISTERMD, REGISTERMD, REGISTERMD);
+	void Fmadd_1s(REGISTERMD, REGISTERMD, REGISTERMD, REGISTERMD);
+	void Fmla_4s(REGISTERMD, REGISTERMD, REGISTERMD);
 	void Fmov_1s(REGISTERMD, REGISTER32);
 	void Fmov_1s(REGISTERMD, uint8);
+	void Fmov_1d(REGISTERMD, REGISTER64);
 	void Fmov_4s(REGISTERMD, uint8);
 	void Fmul_1s(REGISTERMD, REGISTERMD, REGISTERMD);
+	void Fmul_1d(REGISTERMD, REGISTERMD, REGISTERMD);
 	void Fmul_4s(REGISTERMD, REGISTERMD, REGISTERMD);
 	void Fmax_1s(REGISTERMD, REGISTERMD, REGISTERMD);
+	void Fmax_1d(REGISTERMD, REGISTERMD, REGISTERMD);
 	void Fmax_4s(REGISTERMD, REGISTERMD, REGISTERMD);
 	void Fneg_1s(REGISTERMD, REGISTERMD);
+	void Fneg_1d(REGISTERMD, REGISTERMD);
 	void Fneg_4s(REGISTERMD, REGISTERMD);
 	void Fmin_1s(REGISTERMD, REGISTERMD, REGISTERMD);
+	void Fmin_1d(REGISTERMD, REGISTERMD, REGISTERMD);
 	void Fmin_4s(REGISTERMD, REGISTERMD, REGISTERMD);
 	void Fsqrt_1s(REGISTERMD, REGISTERMD);
+	void Fsqrt_1d(REGISTERMD, REGISTERMD);
+	void Fsqrt_4s(REGISTERMD, REGISTERMD);
 	void Fsub_1s(REGISTERMD, REGISTERMD, REGISTERMD);
+	void Fsub_1d(REGISTERMD, REGISTERMD, REGISTERMD);
 	void Fsub_4s(REGISTERMD, REGISTERMD, REGISTERMD);
+	void Ins_1s(REGISTERMD, uint8, REGISTER32);
 	void Ins_1s(REGISTERMD, uint8, REGISTERMD, uint8);
 	void Ins_1d(REGISTERMD, uint8, REGISTER64);
 	void Ins_1d(REGISTERMD, uint8, REGISTERMD, uint8);
@@ -181,6 +205,7 @@ public:
 	void Ldr_Pc(REGISTER64, uint32);
 	void Ldr_Pc(REGISTERMD, const LITERAL128&);
 	void Ldr_1s(REGISTERMD, REGISTER64, uint32);
+	void Ldr_1d(REGISTERMD, REGISTER64, uint32);
 	void Ldr_1q(REGISTERMD, REGISTER64, uint32);
 	void Ldr_1q(REGISTERMD, REGISTER64, REGISTER64, bool);
 	void Lsl(REGISTER32, REGISTER32, uint8);
@@ -204,17 +229,32 @@ public:
 	void Mrs_Fpcr(REGISTER64);
 	void Msr_Fpcr(REGISTER64);
 	void Msub(REGISTER32, REGISTER32, REGISTER32, REGISTER32);
+	void Mul(REGISTER64, REGISTER64, REGISTER64);
+	void Mul_4s(REGISTERMD, REGISTERMD, REGISTERMD);
+	void Mul_8h(REGISTERMD, REGISTERMD, REGISTERMD);
 	void Mvn(REGISTER32, REGISTER32);
+	void Mvn(REGISTER64, REGISTER64);
 	void Mvn_16b(REGISTERMD, REGISTERMD);
 	void Mvni_4s(REGISTERMD, uint8, MOVI_4S_IMM_SHIFT_TYPE);
 	void Orn_16b(REGISTERMD, REGISTERMD, REGISTERMD);
 	void Orr(REGISTER32, REGISTER32, REGISTER32);
+	void Orr(REGISTER64, REGISTER64, REGISTER64);
 	void Orr(REGISTER32, REGISTER32, uint8, uint8, uint8);
 	void Orr_16b(REGISTERMD, REGISTERMD, REGISTERMD);
+	void Rbit(REGISTER32, REGISTER32);
 	void Ret(REGISTER64 = x30);
+	void Rev(REGISTER32, REGISTER32);
+	void Rev(REGISTER64, REGISTER64);
+	void Ror(REGISTER32, REGISTER32, uint8);
+	void Ror(REGISTER64, REGISTER64, uint8);
+	void Rorv(REGISTER32, REGISTER32, REGISTER32);
+	void Rorv(REGISTER64, REGISTER64, REGISTER64);
 	void Scvtf_1s(REGISTERMD, REGISTERMD);
+	void Scvtf_1d(REGISTERMD, REGISTERMD);
+	void Scvtf_1d(REGISTERMD, REGISTER32);
 	void Scvtf_4s(REGISTERMD, REGISTERMD);
 	void Sdiv(REGISTER32, REGISTER32, REGISTER32);
+	void Sdiv(REGISTER64, REGISTER64, REGISTER64);
 	void Shl_4s(REGISTERMD, REGISTERMD, uint8);
 	void Shl_8h(REGISTERMD, REGISTERMD, uint8);
 	void Smax_4s(REGISTERMD, REGISTERMD, REGISTERMD);
@@ -222,6 +262,9 @@ public:
 	void Smin_4s(REGISTERMD, REGISTERMD, REGISTERMD);
 	void Smin_8h(REGISTERMD, REGISTERMD, REGISTERMD);
 	void Smull(REGISTER64, REGISTER32, REGISTER32);
+	void Smull_2d(REGISTERMD, REGISTERMD, REGISTERMD);
+	void Smull_4s(REGISTERMD, REGISTERMD, REGISTERMD);
+	void Smull2_4s(REGISTERMD, REGISTERMD, REGISTERMD);
 	void Sshr_4s(REGISTERMD, REGISTERMD, uint8);
 	void Sshr_8h(REGISTERMD, REGISTERMD, uint8);
 	void Sqadd_4s(REGISTERMD, REGISTERMD, REGISTERMD);
@@ -242,6 +285,7 @@ public:
 	void Strh(REGISTER32, REGISTER64, uint32);
 	void Strh(REGISTER32, REGISTER64, REGISTER64, bool);
 	void Str_1s(REGISTERMD, REGISTER64, uint32);
+	void Str_1d(REGISTERMD, REGISTER64, uint32);
 	void Str_1q(REGISTERMD, REGISTER64, uint32);
 	void Str_1q(REGISTERMD, REGISTER64, REGISTER64, bool);
 	void Sub(REGISTER32, REGISTER32, REGISTER32);
@@ -257,9 +301,13 @@ public:
 	void Uaddlv_8h(REGISTERMD, REGISTERMD);
 	void Uaddlv_16b(REGISTERMD, REGISTERMD);
 	void Udiv(REGISTER32, REGISTER32, REGISTER32);
+	void Udiv(REGISTER64, REGISTER64, REGISTER64);
 	void Umin_4s(REGISTERMD, REGISTERMD, REGISTERMD);
 	void Umov_1s(REGISTER32, REGISTERMD, uint8);
 	void Umull(REGISTER64, REGISTER32, REGISTER32);
+	void Umull_2d(REGISTERMD, REGISTERMD, REGISTERMD);
+	void Umull_4s(REGISTERMD, REGISTERMD, REGISTERMD);
+	void Umull2_4s(REGISTERMD, REGISTERMD, REGISTERMD);
 	void Uqadd_4s(REGISTERMD, REGISTERMD, REGISTERMD);
 	void Uqadd_8h(REGISTERMD, REGISTERMD, REGISTERMD);
 	void Uqadd_16b(REGISTERMD, REGISTERMD, REGISTERMD);
@@ -268,6 +316,8 @@ public:
 	void Uqsub_16b(REGISTERMD, REGISTERMD, REGISTERMD);
 	void Ushr_4s(REGISTERMD, REGISTERMD, uint8);
 	void Ushr_8h(REGISTERMD, REGISTERMD, uint8);
+	void Uzp2_8h(REGISTERMD, REGISTERMD, REGISTERMD);
+	void Xtn1_2s(REGISTERMD, REGISTERMD);
 	void Xtn1_4h(REGISTERMD, REGISTERMD);
 	void Xtn1_8b(REGISTERMD, REGISTERMD);
 	void Xtn2_8h(REGISTERMD, REGISTERMD);
@@ -285,6 +335,7 @@ private:
 		size_t offset = 0;
 		bool cbz = false;
 		bool cbz64 = false;
+		bool adr = false;
 		REGISTER32 cbRegister = w0;
 		CONDITION condition;
 	};
@@ -304,6 +355,7 @@ private:
 	void CreateBranchLabelReference(LABEL, CONDITION);
 	void CreateCompareBranchLabelReference(LABEL, CONDITION, REGISTER32);
 	void CreateCompareBranchLabelReference(LABEL, CONDITION, REGISTER64);
+	void CreateAddressLabelReference(LABEL, REGISTER64);
 
 	void WriteAddSubOpImm(uint32, uint32 shift, uint32 imm, uint32 rn, uint32 rd);
 	void WriteDataProcOpReg2(uint32, uint32 rm, uint32 rn, uint32 rd);
@@ -5,6 +5,7 @@
 #include <list>
 #include <map>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <stack>
 #include <cstdint>
@@ -58,6 +59,7 @@ namespace Jitter
 		LABEL CreateLabel();
 		void MarkLabel(LABEL);
 		void Goto(LABEL);
+		void Switch(const std::vector<LABEL>&, LABEL);
 
 		void PushCtx();
 		void PushCst(uint32);
@@ -75,6 +77,8 @@ namespace Jitter
 		void Add();
 		void And();
 		void Break();
+		void Bswap();
+		void Bswap16();
 		void Call(void*, unsigned int, RETURN_VALUE_TYPE);
 		void Cmp(CONDITION);
 		void Div();
@@ -87,6 +91,11 @@ namespace Jitter
 		void MultS();
 		void Not();
 		void Or();
+		void Popcnt();
+		void Rotl();
+		void Rotl(uint8);
+		void Rotr();
+		void Rotr(uint8);
 		void Select();
 		void SignExt();
 		void SignExt8();
@@ -98,6 +107,7 @@ namespace Jitter
 		void Srl();
 		void Srl(uint8);
 		void Sub();
+		void Tzc();
 		void Xor();
 
 		//Memory operations
@@ -140,13 +150,25 @@ namespace Jitter
 		void Add64();
 		void Sub64();
 		void And64();
+		void Or64();
+		void Xor64();
+		void Not64();
+		void Mult64();
+		void Div64();
+		void DivS64();
 		void Cmp64(CONDITION);
+		void Select64();
 		void Srl64();
 		void Srl64(uint8);
 		void Sra64();
 		void Sra64(uint8);
 		void Shl64();
 		void Shl64(uint8);
+		void Rotl64();
+		void Rotl64(uint8);
+		void Rotr64();
+		void Rotr64(uint8);
+		void Bswap64();
 
 		//FPU
 		virtual void FP_PushRel32(size_t);
@@ -160,6 +182,7 @@ namespace Jitter
 		void FP_MinS();
 		void FP_MulS();
 		void FP_DivS();
+		void FP_MulAddS();
 		void FP_CmpS(CONDITION);
 		void FP_NegS();
 		void FP_RcplS();
@@ -173,6 +196,28 @@ namespace Jitter
 
 		void FP_SetRoundingMode(ROUNDINGMODE);
 
+		virtual void FP_PushRel64(size_t);
+		virtual void FP_PullRel64(size_t);
+		virtual void FP_PushCst64(double);
+
+		void FP_AddD();
+		void FP_AbsD();
+		void FP_SubD();
+		void FP_MaxD();
+		void FP_MinD();
+		void FP_MulD();
+		void FP_DivD();
+		void FP_CmpD(CONDITION);
+		void FP_NegD();
+		void FP_SqrtD();
+
+		void FP_ToDoubleS();
+		void FP_ToSingleD();
+		void FP_ToInt32TruncateD();
+		void FP_ToDoubleI32();
+		void FP_ToInt64TruncateD();
+		void FP_ToDoubleI64();
+
 		//SIMD (128-bits only)
 		void MD_PushRel(size_t);
 		void MD_PushRelElementExpandW(size_t, uint32);
@@ -211,7 +256,12 @@ namespace Jitter
 		void MD_CmpLtS();
 		void MD_CmpGtS();
 		void MD_DivS();
+		void MD_DotS(uint8);
 		void MD_ExpandW();
+		void MD_ExtractS(uint8);
+		void MD_ExtractW(uint8);
+		void MD_HaddS();
+		void MD_InsertW(uint8);
 		void MD_MakeClip();
 		void MD_MakeSignZero();
 		void MD_MaxH();
@@ -220,14 +270,26 @@ namespace Jitter
 		void MD_MinH();
 		void MD_MinW();
 		void MD_MinS();
+		void MD_MulH();
+		void MD_MulHiHS();
+		void MD_MulHiHU();
+		void MD_MulW();
+		void MD_MulWDS();
+		void MD_MulWDU();
 		void MD_MulS();
+		void MD_MulAddS();
 		void MD_NegS();
 		void MD_Not();
 		void MD_Or();
 		void MD_PackHB();
 		void MD_PackWH();
+		void MD_RcplS();
+		void MD_RsqrtS();
+		void MD_ShuffleB(uint64, uint64);
+		void MD_ShuffleW(uint8);
 		void MD_SllH(uint8);
 		void MD_SllW(uint8);
+		void MD_SqrtS();
 		void MD_SraH(uint8);
 		void MD_SraW(uint8);
 		void MD_SrlH(uint8);
@@ -256,6 +318,7 @@ namespace Jitter
 		CCodeGen* GetCodeGen();
 
 		void SetStream(Framework::CStream*);
+		void SetFpContractionEnabled(bool);
 
 	private:
 		struct SYMBOL_REGALLOCINFO
@@ -266,6 +329,7 @@ namespace Jitter
 			unsigned int firstDef = -1;
 			unsigned int lastDef = -1;
 			bool aliased = false;
+			bool callParam = false;
 			SYM_TYPE registerType = SYM_REGISTER;
 			unsigned int registerId = -1;
 		};
@@ -277,6 +341,33 @@ namespace Jitter
 		typedef std::unordered_map<SymbolPtr, SYMBOL_REGALLOCINFO, SymbolHasher, SymbolComparator> SymbolRegAllocInfo;
 		typedef std::unordered_map<CSymbol*, unsigned int> SymbolUseCountMap;
 		typedef std::stack<uint32> IntStack;
+		typedef std::unordered_map<CSymbol*, StatementList::iterator> DefinitionMap;
+
+		enum ALGEBRAIC_OPERAND
+		{
+			OPERAND_ANY,
+			OPERAND_ZERO,
+			OPERAND_ONES,
+			OPERAND_SAME,
+		};
+
+		enum ALGEBRAIC_RESULT
+		{
+			RESULT_SRC1,
+			RESULT_SRC2,
+			RESULT_ZERO,
+			RESULT_ONES,
+		};
+
+		struct ALGEBRAIC_RULE
+		{
+			OPERATION op;
+			ALGEBRAIC_OPERAND src1;
+			ALGEBRAIC_OPERAND src2;
+			ALGEBRAIC_RESULT result;
+		};
+
+		static const ALGEBRAIC_RULE g_algebraicRules[];
 
 		class CRelativeVersionManager
 		{
@@ -314,6 +405,9 @@ namespace Jitter
 		void InsertBinary64Statement(Jitter::OPERATION);
 		void InsertUnaryFp32Statement(Jitter::OPERATION);
 		void InsertBinaryFp32Statement(Jitter::OPERATION);
+		void InsertUnaryFp64Statement(Jitter::OPERATION);
+		void InsertBinaryFp64Statement(Jitter::OPERATION);
+		void InsertFpConversionStatement(Jitter::OPERATION, SYM_TYPE);
 		void InsertUnaryMdStatement(Jitter::OPERATION);
 		void InsertBinaryMdStatement(Jitter::OPERATION);
 
@@ -323,9 +417,13 @@ namespace Jitter
 		bool ConstantPropagation(StatementList&);
 		bool CopyPropagation(StatementList&);
 		bool ReorderAdd(StatementList&);
+		bool StrengthReduction(StatementList&);
+		bool AlgebraicSimplification(StatementList&);
+		bool AddressModeFolding(StatementList&);
 		bool CommonExpressionElimination(VERSIONED_STATEMENT_LIST&);
 		bool ClampingElimination(StatementList&);
 		bool MergeCmpSelectOps(StatementList&);
+		bool ContractMulAddOps(StatementList&);
 		bool DeadcodeElimination(VERSIONED_STATEMENT_LIST&);
 
 		void FixFlowControl(StatementList&);
@@ -335,10 +433,21 @@ namespace Jitter
 		bool FoldConstant6432Operation(STATEMENT&);
 		bool FoldConstant12832Operation(STATEMENT&);
 
+		static SymbolUseCountMap CountTemporaryDefinitions(const StatementList&);
+		ALGEBRAIC_OPERAND ClassifyOperand(const SymbolRefPtr&, const DefinitionMap&) const;
+		void SetStatementToConstant(STATEMENT&, uint32);
+		bool ApplyAlgebraicRules(STATEMENT&, const DefinitionMap&);
+		bool ApplyPeepholeRules(StatementList::iterator, const DefinitionMap&);
+
 		BASIC_BLOCK ConcatBlocks(const BasicBlockList&);
 		bool MergeBlocks();
 		bool PruneBlocks();
 		void HarmonizeBlocks();
+		bool IfConversion();
+		bool HoistLoopInvariants();
+		StatementList CollectLoopInvariants(BasicBlockList::iterator, BasicBlockList::iterator);
+		bool IsCrossBlockTemporary(const CSymbol*) const;
+		unsigned int AllocateCrossBlockTemporaries(unsigned int);
 		void MergeBasicBlocks(BASIC_BLOCK&, const BASIC_BLOCK&);
 
 		void StartBlock(uint32);
@@ -360,10 +469,11 @@ namespace Jitter
 		void PruneSymbols(BASIC_BLOCK&) const;
 
 		void AllocateRegisters(BASIC_BLOCK&);
-		static AllocationRangeArray ComputeAllocationRanges(const BASIC_BLOCK&);
+		AllocationRangeArray ComputeAllocationRanges(const BASIC_BLOCK&) const;
 		void ComputeLivenessForRange(const BASIC_BLOCK&, const AllocationRange&, SymbolRegAllocInfo&) const;
 		void MarkAliasedSymbols(const BASIC_BLOCK&, const AllocationRange&, SymbolRegAllocInfo&) const;
-		void AssociateSymbolsToRegisters(SymbolRegAllocInfo&) const;
+		void AssociateSymbolsToRegisters(SymbolRegAllocInfo&, unsigned int) const;
+		unsigned int GetMdTempRegisterCount(const BASIC_BLOCK&, const AllocationRange&) const;
 
 		void NormalizeStatements(BASIC_BLOCK&);
 		unsigned int AllocateStack(BASIC_BLOCK&);
@@ -383,7 +493,14 @@ namespace Jitter
 		unsigned int m_nextLabelId = 1;
 		LabelMapType m_labels;
 
+		//Temporaries that need to live across blocks (hoisted loop invariants, lowered switch indices)
+		std::unordered_set<uint32> m_crossBlockTemporaries;
+
 		bool m_codeGenSupportsCmpSelect = false;
+		bool m_codeGenSupportsJumpTables = false;
+		bool m_codeGenSupportsTestJumps = false;
+		bool m_codeGenSupportsFma = false;
+		bool m_fpContractionEnabled = false;
 	};
 
 }
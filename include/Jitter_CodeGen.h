@@ -2,6 +2,7 @@
 
 #include "Stream.h"
 #include "Jitter_Statement.h"
+#include "Literal128.h"
 #include <map>
 #include <functional>
 
@@ -28,11 +29,23 @@ namespace Jitter
 
 		virtual void GenerateCode(const StatementList&, unsigned int) = 0;
 		virtual unsigned int GetAvailableRegisterCount() const = 0;
+		//Registers not preserved across calls, numbered after the ones above
+		virtual unsigned int GetAvailableCallerSavedRegisterCount() const = 0;
 		virtual unsigned int GetAvailableMdRegisterCount() const = 0;
+		//MD registers an operation borrows from the ones above for temporary values
+		virtual unsigned int GetMdTempRegisterCount(const STATEMENT&) const = 0;
+		//Operations emitted as calls to helper functions that clobber allocatable registers
+		virtual bool IsHelperCall(const STATEMENT&) const = 0;
 		virtual bool Has128BitsCallOperands() const = 0;
 		virtual bool CanHold128BitsReturnValueInRegisters() const = 0;
+		virtual bool Has64BitsRegisters() const = 0;
 		virtual bool SupportsExternalJumps() const = 0;
 		virtual bool SupportsCmpSelect() const = 0;
+		virtual bool SupportsJumpTables() const = 0;
+		virtual bool SupportsTestJumps() const = 0;
+		//Checks if indexed memory accesses of the specified size can scale their index by the specified amount
+		virtual bool SupportsIndexScale(uint32, uint32) const = 0;
+		virtual bool SupportsFma() const = 0;
 		virtual void RegisterExternalSymbols(CObjectFile*) const = 0;
 		virtual uint32 GetPointerSize() const = 0;
 
@@ -63,6 +76,8 @@ namespace Jitter
 			MATCH_TEMPORARY64,
 			MATCH_CONSTANT64,
 			MATCH_MEMORY64,
+			MATCH_REGISTER64,
+			MATCH_VARIABLE64, //Either relative or temporary or register
 
 			MATCH_REGISTER128,
 			MATCH_RELATIVE128,
@@ -77,6 +92,12 @@ namespace Jitter
 			MATCH_FP_TEMPORARY32,
 			MATCH_FP_MEMORY32,
 			MATCH_FP_VARIABLE32,
+
+			MATCH_FP_REGISTER64,
+			MATCH_FP_RELATIVE64,
+			MATCH_FP_TEMPORARY64,
+			MATCH_FP_MEMORY64,
+			MATCH_FP_VARIABLE64,
 		};
 
 		typedef std::function<void(const STATEMENT&)> CodeEmitterType;
@@ -95,6 +116,9 @@ namespace Jitter
 
 		bool SymbolMatches(MATCHTYPE, const SymbolRefPtr&);
 		static uint32 GetRegisterUsage(const StatementList&);
+		static LITERAL128 MakeMdLaneMaskLiteral(uint8);
+		static LITERAL128 MakeMdShuffleBLiteral(uint64, uint64);
+		static LITERAL128 MakeMdShuffleWLiteral(uint8);
 
 		MatcherMapType m_matchers;
 		ExternalSymbolReferencedHandler m_externalSymbolReferencedHandler;
@@ -26,11 +26,19 @@ namespace Jitter
 		void SetStream(Framework::CStream*) override;
 		void RegisterExternalSymbols(CObjectFile*) const override;
 		unsigned int GetAvailableRegisterCount() const override;
+		unsigned int GetAvailableCallerSavedRegisterCount() const override;
 		unsigned int GetAvailableMdRegisterCount() const override;
+		unsigned int GetMdTempRegisterCount(const STATEMENT&) const override;
+		bool IsHelperCall(const STATEMENT&) const override;
 		bool CanHold128BitsReturnValueInRegisters() const override;
+		bool Has64BitsRegisters() const override;
 		bool Has128BitsCallOperands() const override;
 		bool SupportsExternalJumps() const override;
 		bool SupportsCmpSelect() const override;
+		bool SupportsJumpTables() const override;
+		bool SupportsTestJumps() const override;
+		bool SupportsIndexScale(uint32, uint32) const override;
+		bool SupportsFma() const override;
 		uint32 GetPointerSize() const override;
 
 	private:
@@ -124,6 +132,9 @@ namespace Jitter
 		void LoadTemporaryFp32InRegister(CTempRegisterContext&, CAArch32Assembler::SINGLE_REGISTER, CSymbol*);
 		void StoreRegisterInTemporaryFp32(CTempRegisterContext&, CSymbol*, CAArch32Assembler::SINGLE_REGISTER);
 
+		void LoadMemoryFp64InRegister(CTempRegisterContext&, CAArch32Assembler::DOUBLE_REGISTER, CSymbol*);
+		void StoreRegisterInMemoryFp64(CTempRegisterContext&, CSymbol*, CAArch32Assembler::DOUBLE_REGISTER);
+
 		void LoadMemory128AddressInRegister(CAArch32Assembler::REGISTER, CSymbol*, uint32 = 0);
 		void LoadRelative128AddressInRegister(CAArch32Assembler::REGISTER, CSymbol*, uint32);
 		void LoadTemporary128AddressInRegister(CAArch32Assembler::REGISTER, CSymbol*, uint32);
@@ -227,6 +238,16 @@ namespace Jitter
 			typedef void (CAArch32Assembler::*OpRegType)(CAArch32Assembler::QUAD_REGISTER, CAArch32Assembler::QUAD_REGISTER, CAArch32Assembler::QUAD_REGISTER);
 		};
 
+		struct FPU64OP_BASE2
+		{
+			typedef void (CAArch32Assembler::*OpRegType)(CAArch32Assembler::DOUBLE_REGISTER, CAArch32Assembler::DOUBLE_REGISTER);
+		};
+
+		struct FPU64OP_BASE3
+		{
+			typedef void (CAArch32Assembler::*OpRegType)(CAArch32Assembler::DOUBLE_REGISTER, CAArch32Assembler::DOUBLE_REGISTER, CAArch32Assembler::DOUBLE_REGISTER);
+		};
+
 		struct FPUOP_ABS : public FPUOP_BASE2
 		{
 			static OpRegType OpReg() { return &CAArch32Assembler::Vabs_F32; }
@@ -262,6 +283,41 @@ namespace Jitter
 			static OpRegType OpReg() { return &CAArch32Assembler::Vdiv_F32; }
 		};
 
+		struct FPU64OP_ABS : public FPU64OP_BASE2
+		{
+			static OpRegType OpReg() { return &CAArch32Assembler::Vabs_F64; }
+		};
+
+		struct FPU64OP_NEG : public FPU64OP_BASE2
+		{
+			static OpRegType OpReg() { return &CAArch32Assembler::Vneg_F64; }
+		};
+
+		struct FPU64OP_SQRT : public FPU64OP_BASE2
+		{
+			static OpRegType OpReg() { return &CAArch32Assembler::Vsqrt_F64; }
+		};
+
+		struct FPU64OP_ADD : public FPU64OP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch32Assembler::Vadd_F64; }
+		};
+
+		struct FPU64OP_SUB : public FPU64OP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch32Assembler::Vsub_F64; }
+		};
+
+		struct FPU64OP_MUL : public FPU64OP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch32Assembler::Vmul_F64; }
+		};
+
+		struct FPU64OP_DIV : public FPU64OP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch32Assembler::Vdiv_F64; }
+		};
+
 		struct FPUMDOP_MIN : public FPUMDOP_BASE3
 		{
 			static OpRegType OpReg() { return &CAArch32Assembler::Vmin_F32; }
@@ -433,6 +489,16 @@ namespace Jitter
 			static OpRegType OpReg() { return &CAArch32Assembler::Vmax_I32; }
 		};
 
+		struct MDOP_MULH : public MDOP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch32Assembler::Vmul_I16; }
+		};
+
+		struct MDOP_MULW : public MDOP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch32Assembler::Vmul_I32; }
+		};
+
 		struct MDOP_AND : public MDOP_BASE3
 		{
 			static OpRegType OpReg() { return &CAArch32Assembler::Vand; }
@@ -529,6 +595,10 @@ namespace Jitter
 		template <CAArch32Assembler::SHIFT>
 		void Emit_Shift_Generic(const STATEMENT&);
 
+		//ROTL/ROTR
+		template <bool>
+		void Emit_Rotate_Generic(const STATEMENT&);
+
 		//PARAM
 		void Emit_Param_Ctx(const STATEMENT&);
 		void Emit_Param_Reg(const STATEMENT&);
@@ -579,6 +649,16 @@ namespace Jitter
 		//LZC
 		void Emit_Lzc_VarVar(const STATEMENT&);
 
+		//TZC
+		void Emit_Tzc_VarVar(const STATEMENT&);
+
+		//POPCNT
+		void Emit_Popcnt_VarVar(const STATEMENT&);
+
+		//BSWAP
+		void Emit_Bswap_VarVar(const STATEMENT&);
+		void Emit_Bswap16_VarVar(const STATEMENT&);
+
 		//NOP
 		void Emit_Nop(const STATEMENT&);
 
@@ -599,7 +679,7 @@ namespace Jitter
 
 		void Emit_Select_VarVarAnyAny(const STATEMENT&);
 
-		void Emit_CmpSelectP1_AnyVar(const STATEMENT&);
+		void Emit_CmpSelectP1_AnyAny(const STATEMENT&);
 		void Emit_CmpSelectP2_VarAnyAny(const STATEMENT&);
 
 		//JMP
@@ -610,6 +690,10 @@ namespace Jitter
 		void Emit_CondJmp_VarVar(const STATEMENT&);
 		void Emit_CondJmp_VarCst(const STATEMENT&);
 		void Emit_CondJmp_Ref_VarCst(const STATEMENT&);
+		void Emit_TestJmp_AnyAny(const STATEMENT&);
+
+		//JMPTABLE
+		void Emit_JmpTable_Var(const STATEMENT&);
 
 		//NOT
 		void Emit_Not_RegReg(const STATEMENT&);
@@ -628,6 +712,7 @@ namespace Jitter
 		//LOADFROMREF
 		void Emit_LoadFromRef_VarVar(const STATEMENT&);
 		void Emit_LoadFromRef_VarVarAny(const STATEMENT&);
+		void Emit_Lookup_VarCstAny(const STATEMENT&);
 		void Emit_LoadFromRef_Ref_VarVar(const STATEMENT&);
 		void Emit_LoadFromRef_Ref_VarVarAny(const STATEMENT&);
 		void Emit_LoadFromRef_64_MemVar(const STATEMENT&);
@@ -671,6 +756,26 @@ namespace Jitter
 		//AND64
 		void Emit_And64_MemMemMem(const STATEMENT&);
 
+		//OR64/XOR64
+		template <typename>
+		void Emit_Logic64_MemAnyAny(const STATEMENT&);
+
+		//NOT64
+		void Emit_Not64_MemMem(const STATEMENT&);
+
+		//BSWAP64
+		void Emit_Bswap64_MemMem(const STATEMENT&);
+
+		//MUL64
+		void Emit_Mul64_MemAnyAny(const STATEMENT&);
+
+		//DIV64
+		template <bool>
+		void Emit_Div64_MemAnyAny(const STATEMENT&);
+
+		//SELECT64
+		void Emit_Select64_MemVarAnyAny(const STATEMENT&);
+
 		//SLL64
 		void Emit_Sl64Var_MemMem(CSymbol*, CSymbol*, CAArch32Assembler::REGISTER);
 		void Emit_Sll64_MemMemVar(const STATEMENT&);
@@ -688,6 +793,10 @@ namespace Jitter
 		void Emit_Sra64_MemMemVar(const STATEMENT&);
 		void Emit_Sra64_MemMemCst(const STATEMENT&);
 
+		//ROTL64/ROTR64
+		template <bool>
+		void Emit_Rotate64_MemMemAny(const STATEMENT&);
+
 		//CMP64
 		void Cmp64_RegSymLo(CAArch32Assembler::REGISTER, CSymbol*, CAArch32Assembler::REGISTER);
 		void Cmp64_RegSymHi(CAArch32Assembler::REGISTER, CSymbol*, CAArch32Assembler::REGISTER);
@@ -711,6 +820,21 @@ namespace Jitter
 		void Emit_Fp_LdCst_TmpCst(const STATEMENT&);
 		void Emit_Fp_SetRoundingMode_Cst(const STATEMENT&);
 
+		template <typename>
+		void Emit_Fpu64_MemMem(const STATEMENT&);
+		template <typename>
+		void Emit_Fpu64_MemMemMem(const STATEMENT&);
+		template <bool>
+		void Emit_Fp_MinMaxD_MemMemMem(const STATEMENT&);
+		void Emit_Fp_CmpD_AnyMemMem(const STATEMENT&);
+		void Emit_Fp_ToDoubleS_MemMem(const STATEMENT&);
+		void Emit_Fp_ToSingleD_MemMem(const STATEMENT&);
+		void Emit_Fp_ToInt32TruncD_MemMem(const STATEMENT&);
+		void Emit_Fp_ToDoubleI32_MemMem(const STATEMENT&);
+		void Emit_Fp_ToInt64TruncD_MemMem(const STATEMENT&);
+		void Emit_Fp_ToDoubleI64_MemMem(const STATEMENT&);
+		void Emit_Fp64_LdCst_TmpCst(const STATEMENT&);
+
 		//MDOP
 		template <typename>
 		void Emit_Md_MemMem(const STATEMENT&);
@@ -723,6 +847,11 @@ namespace Jitter
 
 		void Emit_Md_Mov_MemMem(const STATEMENT&);
 		void Emit_Md_DivS_MemMemMem(const STATEMENT&);
+		void Emit_Md_SqrtS_MemMem(const STATEMENT&);
+		void Emit_Md_RsqrtS_MemMem(const STATEMENT&);
+		void Emit_Md_RcplS_MemMem(const STATEMENT&);
+		void Emit_Md_DotS_MemMemMem(const STATEMENT&);
+		void Emit_Md_HaddS_MemMemMem(const STATEMENT&);
 
 		void Emit_Md_Srl256_MemMemVar(const STATEMENT&);
 		void Emit_Md_Srl256_MemMemCst(const STATEMENT&);
@@ -739,6 +868,13 @@ namespace Jitter
 		void Emit_Md_ExpandW_MemMem(const STATEMENT&);
 		void Emit_Md_ExpandW_MemCst(const STATEMENT&);
 		void Emit_Md_ExpandW_VarVarCst(const STATEMENT&);
+		void Emit_Md_Shuffle(CSymbol*, CSymbol*, const LITERAL128&);
+		void Emit_Md_ShuffleW_MemMemCst(const STATEMENT&);
+		void Emit_Md_ShuffleB_MemMemCstCst(const STATEMENT&);
+		void Emit_Md_InsertW_MemMemAnyCst(const STATEMENT&);
+		void Emit_Md_InsertW_MemMemFpmemCst(const STATEMENT&);
+		void Emit_Md_ExtractW_VarMemCst(const STATEMENT&);
+		void Emit_Md_ExtractW_FpmemMemCst(const STATEMENT&);
 
 		void Emit_Md_ClampS_MemMem(const STATEMENT&);
 
@@ -747,6 +883,10 @@ namespace Jitter
 
 		void Emit_Md_PackHB_MemMemMem(const STATEMENT&);
 		void Emit_Md_PackWH_MemMemMem(const STATEMENT&);
+		template <bool>
+		void Emit_Md_MulHiH_MemMemMem(const STATEMENT&);
+		template <bool>
+		void Emit_Md_MulWD_MemMemMem(const STATEMENT&);
 
 		template <uint32>
 		void Emit_Md_UnpackBH_MemMemMem(const STATEMENT&);
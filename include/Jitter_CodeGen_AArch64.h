@@ -19,11 +19,19 @@ namespace Jitter
 		void SetStream(Framework::CStream*) override;
 		void RegisterExternalSymbols(CObjectFile*) const override;
 		unsigned int GetAvailableRegisterCount() const override;
+		unsigned int GetAvailableCallerSavedRegisterCount() const override;
 		unsigned int GetAvailableMdRegisterCount() const override;
+		unsigned int GetMdTempRegisterCount(const STATEMENT&) const override;
+		bool IsHelperCall(const STATEMENT&) const override;
 		bool Has128BitsCallOperands() const override;
 		bool CanHold128BitsReturnValueInRegisters() const override;
+		bool Has64BitsRegisters() const override;
 		bool SupportsExternalJumps() const override;
 		bool SupportsCmpSelect() const override;
+		bool SupportsJumpTables() const override;
+		bool SupportsTestJumps() const override;
+		bool SupportsIndexScale(uint32, uint32) const override;
+		bool SupportsFma() const override;
 		uint32 GetPointerSize() const override;
 
 	private:
@@ -118,6 +126,9 @@ namespace Jitter
 		void LoadMemoryFp32InRegister(CAArch64Assembler::REGISTERMD, CSymbol*);
 		void StoreRegisterInMemoryFp32(CSymbol*, CAArch64Assembler::REGISTERMD);
 
+		void LoadMemoryFp64InRegister(CAArch64Assembler::REGISTERMD, CSymbol*);
+		void StoreRegisterInMemoryFp64(CSymbol*, CAArch64Assembler::REGISTERMD);
+
 		void LoadMemory128InRegister(CAArch64Assembler::REGISTERMD, CSymbol*);
 		void StoreRegisterInMemory128(CSymbol*, CAArch64Assembler::REGISTERMD);
 
@@ -135,6 +146,10 @@ namespace Jitter
 		CAArch64Assembler::REGISTER64 PrepareSymbolRegisterUseRef(CSymbol*, CAArch64Assembler::REGISTER64);
 		void CommitSymbolRegisterRef(CSymbol*, CAArch64Assembler::REGISTER64);
 
+		CAArch64Assembler::REGISTER64 PrepareSymbolRegisterDef64(CSymbol*, CAArch64Assembler::REGISTER64);
+		CAArch64Assembler::REGISTER64 PrepareSymbolRegisterUse64(CSymbol*, CAArch64Assembler::REGISTER64);
+		void CommitSymbolRegister64(CSymbol*, CAArch64Assembler::REGISTER64);
+
 		CAArch64Assembler::REGISTERMD PrepareSymbolRegisterDefFp(CSymbol*);
 		CAArch64Assembler::REGISTERMD PrepareSymbolRegisterUseFp(CSymbol*);
 		void CommitSymbolRegisterFp(CSymbol*, CAArch64Assembler::REGISTERMD);
@@ -181,6 +196,12 @@ namespace Jitter
 			static OpImmType    OpImm()    { return &CAArch64Assembler::Lsr; }
 			static OpRegType    OpReg()    { return &CAArch64Assembler::Lsrv; }
 		};
+
+		struct SHIFTOP_ROR : public SHIFTOP_BASE
+		{
+			static OpImmType    OpImm()    { return &CAArch64Assembler::Ror; }
+			static OpRegType    OpReg()    { return &CAArch64Assembler::Rorv; }
+		};
 		
 		//LOGICOP ----------------------------------------------------------
 		struct LOGICOP_BASE
@@ -228,6 +249,37 @@ namespace Jitter
 			static OpImmType    OpImmRev()    { return &CAArch64Assembler::Add; }
 		};
 
+		//ALU64OP ----------------------------------------------------------
+		struct ALU64OP_BASE
+		{
+			typedef void (CAArch64Assembler::*OpRegType)(CAArch64Assembler::REGISTER64, CAArch64Assembler::REGISTER64, CAArch64Assembler::REGISTER64);
+		};
+
+		struct ALU64OP_OR : public ALU64OP_BASE
+		{
+			static OpRegType    OpReg()    { return &CAArch64Assembler::Orr; }
+		};
+
+		struct ALU64OP_XOR : public ALU64OP_BASE
+		{
+			static OpRegType    OpReg()    { return &CAArch64Assembler::Eor; }
+		};
+
+		struct ALU64OP_MUL : public ALU64OP_BASE
+		{
+			static OpRegType    OpReg()    { return &CAArch64Assembler::Mul; }
+		};
+
+		struct ALU64OP_UDIV : public ALU64OP_BASE
+		{
+			static OpRegType    OpReg()    { return &CAArch64Assembler::Udiv; }
+		};
+
+		struct ALU64OP_SDIV : public ALU64OP_BASE
+		{
+			static OpRegType    OpReg()    { return &CAArch64Assembler::Sdiv; }
+		};
+
 		//SHIFT64OP ----------------------------------------------------------
 		struct SHIFT64OP_BASE
 		{
@@ -253,6 +305,12 @@ namespace Jitter
 			static OpRegType    OpReg()    { return &CAArch64Assembler::Lsrv; }
 		};
 
+		struct SHIFT64OP_ROR : public SHIFT64OP_BASE
+		{
+			static OpImmType    OpImm()    { return &CAArch64Assembler::Ror; }
+			static OpRegType    OpReg()    { return &CAArch64Assembler::Rorv; }
+		};
+
 		//FPUOP ----------------------------------------------------------
 		struct FPUOP_BASE2
 		{
@@ -309,6 +367,51 @@ namespace Jitter
 			static OpRegType OpReg() { return &CAArch64Assembler::Fsqrt_1s; }
 		};
 		
+		struct FPUOP_ADD_D : public FPUOP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Fadd_1d; }
+		};
+
+		struct FPUOP_SUB_D : public FPUOP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Fsub_1d; }
+		};
+
+		struct FPUOP_MUL_D : public FPUOP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Fmul_1d; }
+		};
+
+		struct FPUOP_DIV_D : public FPUOP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Fdiv_1d; }
+		};
+
+		struct FPUOP_MIN_D : public FPUOP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Fmin_1d; }
+		};
+
+		struct FPUOP_MAX_D : public FPUOP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Fmax_1d; }
+		};
+
+		struct FPUOP_ABS_D : public FPUOP_BASE2
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Fabs_1d; }
+		};
+
+		struct FPUOP_NEG_D : public FPUOP_BASE2
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Fneg_1d; }
+		};
+
+		struct FPUOP_SQRT_D : public FPUOP_BASE2
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Fsqrt_1d; }
+		};
+
 		//MDOP -----------------------------------------------------------
 		struct MDOP_BASE2
 		{
@@ -464,6 +567,16 @@ namespace Jitter
 		{
 			static OpRegType OpReg() { return &CAArch64Assembler::Smax_4s; }
 		};
+
+		struct MDOP_MULH : public MDOP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Mul_8h; }
+		};
+
+		struct MDOP_MULW : public MDOP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Mul_4s; }
+		};
 		
 		struct MDOP_ADDS : public MDOP_BASE3
 		{
@@ -504,6 +617,16 @@ namespace Jitter
 		{
 			static OpRegType OpReg() { return &CAArch64Assembler::Fmax_4s; }
 		};
+
+		struct MDOP_SQRTS : public MDOP_BASE2
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Fsqrt_4s; }
+		};
+
+		struct MDOP_HADDS : public MDOP_BASE3
+		{
+			static OpRegType OpReg() { return &CAArch64Assembler::Faddp_4s; }
+		};
 		
 		struct MDOP_CMPGTS : public MDOP_BASE3
 		{
@@ -633,19 +756,29 @@ namespace Jitter
 
 		void Emit_Not_VarVar(const STATEMENT&);
 		void Emit_Lzc_VarVar(const STATEMENT&);
+		void Emit_Tzc_VarVar(const STATEMENT&);
+		void Emit_Popcnt_VarVar(const STATEMENT&);
+		void Emit_Bswap_VarVar(const STATEMENT&);
+		void Emit_Bswap16_VarVar(const STATEMENT&);
+		void Emit_Rotl_VarAnyVar(const STATEMENT&);
+		void Emit_Rotl_VarVarCst(const STATEMENT&);
 
-		void Emit_Mov_Mem64Mem64(const STATEMENT&);
-		void Emit_Mov_Mem64Cst64(const STATEMENT&);
+		void Emit_Mov_Var64Var64(const STATEMENT&);
+		void Emit_Mov_Var64Cst64(const STATEMENT&);
 
 		void Emit_ExtLow64VarMem64(const STATEMENT&);
+		void Emit_ExtLow64VarReg64(const STATEMENT&);
 		void Emit_ExtHigh64VarMem64(const STATEMENT&);
+		void Emit_ExtHigh64VarReg64(const STATEMENT&);
 		void Emit_MergeTo64_Mem64AnyAny(const STATEMENT&);
+		void Emit_MergeTo64_Reg64AnyAny(const STATEMENT&);
 
 		void Emit_RelToRef_VarCst(const STATEMENT&);
 		void Emit_AddRef_VarVarAny(const STATEMENT&);
 		void Emit_IsRefNull_VarVar(const STATEMENT&);
 		void Emit_LoadFromRef_VarVar(const STATEMENT&);
 		void Emit_LoadFromRef_VarVarAny(const STATEMENT&);
+		void Emit_Lookup_VarCstAny(const STATEMENT&);
 		void Emit_LoadFromRef_Ref_VarVar(const STATEMENT&);
 		void Emit_LoadFromRef_Ref_VarVarAny(const STATEMENT&);
 		void Emit_StoreAtRef_VarAny(const STATEMENT&);
@@ -661,8 +794,8 @@ namespace Jitter
 		void Emit_Store16AtRef_VarAny(const STATEMENT&);
 		void Emit_Store16AtRef_VarAnyAny(const STATEMENT&);
 
-		void Emit_LoadFromRef_64_MemVar(const STATEMENT&);
-		void Emit_LoadFromRef_64_MemVarAny(const STATEMENT&);
+		void Emit_LoadFromRef_64_VarVar(const STATEMENT&);
+		void Emit_LoadFromRef_64_VarVarAny(const STATEMENT&);
 		void Emit_StoreAtRef_64_VarAny(const STATEMENT&);
 		void Emit_StoreAtRef_64_VarAnyAny(const STATEMENT&);
 
@@ -670,6 +803,7 @@ namespace Jitter
 		void Emit_Param_Reg(const STATEMENT&);
 		void Emit_Param_Mem(const STATEMENT&);
 		void Emit_Param_Cst(const STATEMENT&);
+		void Emit_Param_Reg64(const STATEMENT&);
 		void Emit_Param_Mem64(const STATEMENT&);
 		void Emit_Param_Cst64(const STATEMENT&);
 		void Emit_Param_Reg128(const STATEMENT&);
@@ -678,6 +812,7 @@ namespace Jitter
 		void Emit_Call(const STATEMENT&);
 		void Emit_RetVal_Reg(const STATEMENT&);
 		void Emit_RetVal_Tmp(const STATEMENT&);
+		void Emit_RetVal_Reg64(const STATEMENT&);
 		void Emit_RetVal_Mem64(const STATEMENT&);
 		void Emit_RetVal_Reg128(const STATEMENT&);
 		void Emit_RetVal_Mem128(const STATEMENT&);
@@ -693,25 +828,40 @@ namespace Jitter
 
 		void Emit_CondJmp_Ref_VarCst(const STATEMENT&);
 
+		void Emit_TestJmp_AnyAny(const STATEMENT&);
+
+		void Emit_JmpTable_Var(const STATEMENT&);
+
 		void Cmp_GetFlag(CAArch64Assembler::REGISTER32, Jitter::CONDITION);
 		void Emit_Cmp_VarAnyVar(const STATEMENT&);
 		void Emit_Cmp_VarVarCst(const STATEMENT&);
 
 		void Emit_Select_VarVarAnyAny(const STATEMENT&);
 
-		void Emit_CmpSelectP1_AnyVar(const STATEMENT&);
+		void Emit_CmpSelectP1_AnyAny(const STATEMENT&);
 		void Emit_CmpSelectP2_VarAnyAny(const STATEMENT&);
 
-		void Emit_Add64_MemMemMem(const STATEMENT&);
-		void Emit_Add64_MemMemCst(const STATEMENT&);
+		void Emit_Add64_VarVarVar(const STATEMENT&);
+		void Emit_Add64_VarVarCst(const STATEMENT&);
+
+		void Emit_Sub64_VarAnyVar(const STATEMENT&);
+		void Emit_Sub64_VarVarCst(const STATEMENT&);
+
+		void Emit_Cmp64_VarAnyVar(const STATEMENT&);
+		void Emit_Cmp64_VarVarCst(const STATEMENT&);
 
-		void Emit_Sub64_MemAnyMem(const STATEMENT&);
-		void Emit_Sub64_MemMemCst(const STATEMENT&);
+		void Emit_And64_VarVarVar(const STATEMENT&);
 
-		void Emit_Cmp64_VarAnyMem(const STATEMENT&);
-		void Emit_Cmp64_VarMemCst(const STATEMENT&);
+		void Emit_Not64_VarVar(const STATEMENT&);
+		void Emit_Bswap64_VarVar(const STATEMENT&);
+		void Emit_Rotl64_VarVarVar(const STATEMENT&);
+		void Emit_Rotl64_VarVarCst(const STATEMENT&);
 
-		void Emit_And64_MemMemMem(const STATEMENT&);
+		void Emit_Select64_VarVarAnyAny(const STATEMENT&);
+
+		//ALU64
+		template <typename>
+		void Emit_Alu64_VarAnyAny(const STATEMENT&);
 
 		//ADDSUB
 		template <typename>
@@ -733,17 +883,17 @@ namespace Jitter
 
 		//MUL
 		template <bool>
-		void Emit_Mul_Tmp64AnyAny(const STATEMENT&);
+		void Emit_Mul_Var64AnyAny(const STATEMENT&);
 
 		//DIV
 		template <bool>
-		void Emit_Div_Tmp64AnyAny(const STATEMENT&);
+		void Emit_Div_Var64AnyAny(const STATEMENT&);
 
 		//SHIFT64
 		template <typename>
-		void Emit_Shift64_MemMemVar(const STATEMENT&);
+		void Emit_Shift64_VarVarVar(const STATEMENT&);
 		template <typename>
-		void Emit_Shift64_MemMemCst(const STATEMENT&);
+		void Emit_Shift64_VarVarCst(const STATEMENT&);
 
 		//FPU
 		template <typename>
@@ -763,6 +913,19 @@ namespace Jitter
 		void Emit_Fp_Clamp_VarVar(const STATEMENT&);
 		void Emit_Fp_ToSingleI32_VarVar(const STATEMENT&);
 		void Emit_Fp_ToInt32TruncS_VarVar(const STATEMENT&);
+		void Emit_Fp_FmaS_VarVarVarVar(const STATEMENT&);
+
+		void Emit_Fp64_Mov_RegMem(const STATEMENT&);
+		void Emit_Fp64_Mov_MemReg(const STATEMENT&);
+		void Emit_Fp64_LdCst_RegCst(const STATEMENT&);
+		void Emit_Fp64_LdCst_TmpCst(const STATEMENT&);
+		void Emit_Fp_CmpD_AnyVarVar(const STATEMENT&);
+		void Emit_Fp_ToDoubleS_VarVar(const STATEMENT&);
+		void Emit_Fp_ToSingleD_VarVar(const STATEMENT&);
+		void Emit_Fp_ToInt32TruncD_VarVar(const STATEMENT&);
+		void Emit_Fp_ToDoubleI32_VarVar(const STATEMENT&);
+		void Emit_Fp_ToInt64TruncD_VarVar(const STATEMENT&);
+		void Emit_Fp_ToDoubleI64_VarVar(const STATEMENT&);
 
 		//MD
 		template <typename>
@@ -792,13 +955,27 @@ namespace Jitter
 		void Emit_Md_StoreAtRefMasked_VarAnyVar(const STATEMENT&);
 
 		void Emit_Md_MovMasked_VarVarVar(const STATEMENT&);
+		void Emit_Md_FmaS_VarVarVarVar(const STATEMENT&);
+		void Emit_Md_RsqrtS_VarVar(const STATEMENT&);
+		void Emit_Md_RcplS_VarVar(const STATEMENT&);
+		void Emit_Md_DotS_VarVarVar(const STATEMENT&);
 		void Emit_Md_ExpandW_VarReg(const STATEMENT&);
 		void Emit_Md_ExpandW_VarMem(const STATEMENT&);
 		void Emit_Md_ExpandW_VarCst(const STATEMENT&);
 		void Emit_Md_ExpandW_VarVarCst(const STATEMENT&);
+		void Emit_Md_ShuffleW_VarVarCst(const STATEMENT&);
+		void Emit_Md_ShuffleB_VarVarCstCst(const STATEMENT&);
+		void Emit_Md_InsertW_VarVarAnyCst(const STATEMENT&);
+		void Emit_Md_InsertW_VarVarFpvarCst(const STATEMENT&);
+		void Emit_Md_ExtractW_VarVarCst(const STATEMENT&);
+		void Emit_Md_ExtractW_FpvarVarCst(const STATEMENT&);
 
 		void Emit_Md_PackHB_VarVarVar(const STATEMENT&);
 		void Emit_Md_PackWH_VarVarVar(const STATEMENT&);
+		template <bool>
+		void Emit_Md_MulHiH_VarVarVar(const STATEMENT&);
+		template <bool>
+		void Emit_Md_MulWD_VarVarVar(const STATEMENT&);
 
 		void Emit_MergeTo256_MemVarVar(const STATEMENT&);
 		void Emit_Md_Srl256_VarMemVar(const STATEMENT&);
@@ -34,11 +34,19 @@ namespace Jitter
 		void RegisterExternalSymbols(CObjectFile*) const override;
 
 		unsigned int GetAvailableRegisterCount() const override;
+		unsigned int GetAvailableCallerSavedRegisterCount() const override;
 		unsigned int GetAvailableMdRegisterCount() const override;
+		unsigned int GetMdTempRegisterCount(const STATEMENT&) const override;
+		bool IsHelperCall(const STATEMENT&) const override;
 		bool Has128BitsCallOperands() const override;
 		bool CanHold128BitsReturnValueInRegisters() const override;
+		bool Has64BitsRegisters() const override;
 		bool SupportsExternalJumps() const override;
 		bool SupportsCmpSelect() const override;
+		bool SupportsJumpTables() const override;
+		bool SupportsTestJumps() const override;
+		bool SupportsIndexScale(uint32, uint32) const override;
+		bool SupportsFma() const override;
 		uint32 GetPointerSize() const override;
 
 	private:
@@ -102,6 +110,11 @@ namespace Jitter
 		void PushTemporaryFp32(CSymbol*);
 		void PullTemporaryFp32(CSymbol*);
 
+		void PushRelativeFp64(CSymbol*);
+
+		void PushTemporaryFp64(CSymbol*);
+		void PullTemporaryFp64(CSymbol*);
+
 		void PushRelative128(CSymbol*);
 
 		void PushTemporary128(CSymbol*);
@@ -125,6 +138,8 @@ namespace Jitter
 		void Emit_AddRef_AnyAnyAny(const STATEMENT&);
 		void Emit_IsRefNull_VarVar(const STATEMENT&);
 
+		template <uint32>
+		void Emit_Generic_Unary_MemAny(const STATEMENT&);
 		template <uint32>
 		void Emit_Generic_Binary_MemAnyAny(const STATEMENT&);
 
@@ -142,6 +157,7 @@ namespace Jitter
 
 		void Emit_LoadFromRef_VarVar(const STATEMENT&);
 		void Emit_LoadFromRef_VarVarAny(const STATEMENT&);
+		void Emit_Lookup_VarCstAny(const STATEMENT&);
 
 		void Emit_StoreAtRef_VarAny(const STATEMENT&);
 		void Emit_StoreAtRef_VarAnyAny(const STATEMENT&);
@@ -163,6 +179,8 @@ namespace Jitter
 
 		void Emit_Not_AnyAny(const STATEMENT&);
 		void Emit_Lzc_AnyAny(const STATEMENT&);
+		void Emit_Bswap_AnyAny(const STATEMENT&);
+		void Emit_Bswap16_AnyAny(const STATEMENT&);
 
 		template <uint32>
 		void Emit_Alu64_MemAnyAny(const STATEMENT&);
@@ -170,6 +188,8 @@ namespace Jitter
 		void Emit_Shift64_MemAnyAny(const STATEMENT&);
 
 		void Emit_Mov64_MemAny(const STATEMENT&);
+		void Emit_Not64_MemMem(const STATEMENT&);
+		void Emit_Bswap64_MemMem(const STATEMENT&);
 		void Emit_Cmp64_MemAnyAny(const STATEMENT&);
 
 		void Emit_RetVal_Tmp64(const STATEMENT&);
@@ -199,6 +219,12 @@ namespace Jitter
 		void Emit_Fp_ToInt32TruncS_MemMem(const STATEMENT&);
 		void Emit_Fp_LdCst_TmpCst(const STATEMENT&);
 		void Emit_Fp_SetRoundingMode_Cst(const STATEMENT&);
+		void Emit_Fp_CmpD_AnyMemMem(const STATEMENT&);
+		void Emit_Fp_ToInt32TruncD_MemMem(const STATEMENT&);
+		void Emit_Fp_ToDoubleI32_MemMem(const STATEMENT&);
+		void Emit_Fp_ToInt64TruncD_MemMem(const STATEMENT&);
+		void Emit_Fp_ToDoubleI64_MemMem(const STATEMENT&);
+		void Emit_Fp64_LdCst_TmpCst(const STATEMENT&);
 
 		//MD
 		template <uint32>
@@ -209,12 +235,20 @@ namespace Jitter
 		void Emit_Md_Shift_MemMemCst(const STATEMENT&);
 		template <const uint8*>
 		void Emit_Md_Unpack_MemMemMemRev(const STATEMENT&);
+		template <uint32, uint32>
+		void Emit_Md_MulHiH_MemMemMem(const STATEMENT&);
+		template <uint32>
+		void Emit_Md_MulWD_MemMemMem(const STATEMENT&);
 		void Emit_Md_Mov_MemMem(const STATEMENT&);
 		void Emit_Md_AddSSW_MemMemMem(const STATEMENT&);
 		void Emit_Md_AddUSW_MemMemMem(const STATEMENT&);
 		void Emit_Md_SubSSW_MemMemMem(const STATEMENT&);
 		void Emit_Md_SubUSW_MemMemMem(const STATEMENT&);
 		void Emit_Md_ClampS_MemMem(const STATEMENT&);
+		void Emit_Md_RsqrtS_MemMem(const STATEMENT&);
+		void Emit_Md_RcplS_MemMem(const STATEMENT&);
+		void Emit_Md_DotS_MemMemMem(const STATEMENT&);
+		void Emit_Md_HaddS_MemMemMem(const STATEMENT&);
 		void Emit_Md_MakeClip_MemMemMemMem(const STATEMENT&);
 		void Emit_Md_MakeSz_MemMem(const STATEMENT&);
 		void Emit_Md_LoadFromRef_MemMem(const STATEMENT&);
@@ -226,6 +260,12 @@ namespace Jitter
 		void Emit_Md_MovMasked_MemMemMem(const STATEMENT&);
 		void Emit_Md_ExpandW_MemAny(const STATEMENT&);
 		void Emit_Md_ExpandW_MemMemCst(const STATEMENT&);
+		void Emit_Md_ShuffleW_MemMemCst(const STATEMENT&);
+		void Emit_Md_ShuffleB_MemMemCstCst(const STATEMENT&);
+		template <uint32>
+		void Emit_Md_InsertW_MemMemAnyCst(const STATEMENT&);
+		template <uint32>
+		void Emit_Md_ExtractW_MemMemCst(const STATEMENT&);
 		void Emit_Md_Srl256_MemMemVar(const STATEMENT&);
 		void Emit_Md_Srl256_MemMemCst(const STATEMENT&);
 		void Emit_MergeTo256_MemMemMem(const STATEMENT&);
@@ -240,6 +280,7 @@ namespace Jitter
 		uint32 m_localI32Count = 0;
 		uint32 m_localI64Count = 0;
 		uint32 m_localF32Count = 0;
+		uint32 m_localF64Count = 0;
 		uint32 m_localV128Count = 0;
 		bool m_isInsideBlock = false;
 		bool m_isInsideLoop = false;
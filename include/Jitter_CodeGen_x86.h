@@ -1,6 +1,8 @@
 #pragma once
 
 #include <array>
+#include <set>
+#include <vector>
 #include "Jitter_CodeGen.h"
 #include "X86Assembler.h"
 #include "X86CpuFeatures.h"
@@ -20,9 +22,23 @@ namespace Jitter
 		bool Has128BitsCallOperands() const override;
 		bool SupportsExternalJumps() const override;
 		bool SupportsCmpSelect() const override;
+		bool SupportsJumpTables() const override;
+		bool SupportsTestJumps() const override;
+		bool SupportsIndexScale(uint32, uint32) const override;
+		bool SupportsFma() const override;
+		unsigned int GetMdTempRegisterCount(const STATEMENT&) const override;
+
+		//Aligns the target of backward jumps (loop heads) on the specified boundary, 0 to disable.
+		//Offsets are relative to the start of the generated code, which needs to be aligned as well to benefit from this.
+		//CMemoryFunction blocks are page aligned, except on Win32 where they are only aligned on 32 bytes
+		void SetLoopAlignment(uint32);
+		void SetJccErratumPaddingEnabled(bool);
+		//Keeps 128-bit constants used more than once in MD registers left free by the register allocator
+		void SetConstantCacheEnabled(bool);
 
 	protected:
 		typedef std::map<uint32, CX86Assembler::LABEL> LabelMapType;
+		typedef std::set<uint32> LoopHeadSet;
 		typedef std::vector<std::pair<uintptr_t, CX86Assembler::LABEL>> SymbolReferenceLabelArray;
 
 		// clang-format off
@@ -68,24 +84,42 @@ namespace Jitter
 		{
 			typedef void (CX86Assembler::*OpCstType)(const CX86Assembler::CAddress&, uint8);
 			typedef void (CX86Assembler::*OpVarType)(const CX86Assembler::CAddress&);
+			typedef void (CX86Assembler::*OpVarBmi2Type)(CX86Assembler::REGISTER, const CX86Assembler::CAddress&, CX86Assembler::REGISTER);
 		};
 
 		struct SHIFTOP_SRL : public SHIFTOP_BASE
 		{
 			static OpCstType OpCst() { return &CX86Assembler::ShrEd; }
 			static OpVarType OpVar() { return &CX86Assembler::ShrEd; }
+			static OpVarBmi2Type OpVarBmi2() { return &CX86Assembler::ShrxEd; }
 		};
 
 		struct SHIFTOP_SRA : public SHIFTOP_BASE
 		{
 			static OpCstType OpCst() { return &CX86Assembler::SarEd; }
 			static OpVarType OpVar() { return &CX86Assembler::SarEd; }
+			static OpVarBmi2Type OpVarBmi2() { return &CX86Assembler::SarxEd; }
 		};
 
 		struct SHIFTOP_SLL : public SHIFTOP_BASE
 		{
 			static OpCstType OpCst() { return &CX86Assembler::ShlEd; }
 			static OpVarType OpVar() { return &CX86Assembler::ShlEd; }
+			static OpVarBmi2Type OpVarBmi2() { return &CX86Assembler::ShlxEd; }
+		};
+
+		struct SHIFTOP_ROL : public SHIFTOP_BASE
+		{
+			static OpCstType OpCst() { return &CX86Assembler::RolEd; }
+			static OpVarType OpVar() { return &CX86Assembler::RolEd; }
+			static uint8 RorxAmount(uint8 amount) { return (32 - amount) & 0x1F; }
+		};
+
+		struct SHIFTOP_ROR : public SHIFTOP_BASE
+		{
+			static OpCstType OpCst() { return &CX86Assembler::RorEd; }
+			static OpVarType OpVar() { return &CX86Assembler::RorEd; }
+			static uint8 RorxAmount(uint8 amount) { return amount & 0x1F; }
 		};
 
 		//FP32OP -----------------------------------------------------------
@@ -137,6 +171,55 @@ namespace Jitter
 			static OpEdAvxType OpEdAvx() { return &CX86Assembler::VsqrtssEd; }
 		};
 
+		//FP64OP -----------------------------------------------------------
+		struct FP64OP_BASE
+		{
+			typedef void (CX86Assembler::*OpEdType)(CX86Assembler::XMMREGISTER, const CX86Assembler::CAddress&);
+			typedef void (CX86Assembler::*OpEdAvxType)(CX86Assembler::XMMREGISTER, CX86Assembler::XMMREGISTER, const CX86Assembler::CAddress&);
+		};
+
+		struct FP64OP_ADD : public FP64OP_BASE
+		{
+			static OpEdType OpEd() { return &CX86Assembler::AddsdEd; }
+			static OpEdAvxType OpEdAvx() { return &CX86Assembler::VaddsdEd; }
+		};
+
+		struct FP64OP_SUB : public FP64OP_BASE
+		{
+			static OpEdType OpEd() { return &CX86Assembler::SubsdEd; }
+			static OpEdAvxType OpEdAvx() { return &CX86Assembler::VsubsdEd; }
+		};
+
+		struct FP64OP_MUL : public FP64OP_BASE
+		{
+			static OpEdType OpEd() { return &CX86Assembler::MulsdEd; }
+			static OpEdAvxType OpEdAvx() { return &CX86Assembler::VmulsdEd; }
+		};
+
+		struct FP64OP_DIV : public FP64OP_BASE
+		{
+			static OpEdType OpEd() { return &CX86Assembler::DivsdEd; }
+			static OpEdAvxType OpEdAvx() { return &CX86Assembler::VdivsdEd; }
+		};
+
+		struct FP64OP_MAX : public FP64OP_BASE
+		{
+			static OpEdType OpEd() { return &CX86Assembler::MaxsdEd; }
+			static OpEdAvxType OpEdAvx() { return &CX86Assembler::VmaxsdEd; }
+		};
+
+		struct FP64OP_MIN : public FP64OP_BASE
+		{
+			static OpEdType OpEd() { return &CX86Assembler::MinsdEd; }
+			static OpEdAvxType OpEdAvx() { return &CX86Assembler::VminsdEd; }
+		};
+
+		struct FP64OP_SQRT : public FP64OP_BASE
+		{
+			static OpEdType OpEd() { return &CX86Assembler::SqrtsdEd; }
+			static OpEdAvxType OpEdAvx() { return &CX86Assembler::VsqrtsdEd; }
+		};
+
 		//MDOP -----------------------------------------------------------
 		struct MDOP_BASE
 		{
@@ -288,6 +371,42 @@ namespace Jitter
 			static OpVoAvxType OpVoAvx() { return &CX86Assembler::VpmaxsdVo; }
 		};
 
+		struct MDOP_MULH : public MDOP_BASE
+		{
+			static OpVoType OpVo() { return &CX86Assembler::PmullwVo; }
+			static OpVoAvxType OpVoAvx() { return &CX86Assembler::VpmullwVo; }
+		};
+
+		struct MDOP_MULHSH : public MDOP_BASE
+		{
+			static OpVoType OpVo() { return &CX86Assembler::PmulhwVo; }
+			static OpVoAvxType OpVoAvx() { return &CX86Assembler::VpmulhwVo; }
+		};
+
+		struct MDOP_MULHUH : public MDOP_BASE
+		{
+			static OpVoType OpVo() { return &CX86Assembler::PmulhuwVo; }
+			static OpVoAvxType OpVoAvx() { return &CX86Assembler::VpmulhuwVo; }
+		};
+
+		struct MDOP_MULW : public MDOP_BASE
+		{
+			static OpVoType OpVo() { return &CX86Assembler::PmulldVo; }
+			static OpVoAvxType OpVoAvx() { return &CX86Assembler::VpmulldVo; }
+		};
+
+		struct MDOP_MULSWD : public MDOP_BASE
+		{
+			static OpVoType OpVo() { return &CX86Assembler::PmuldqVo; }
+			static OpVoAvxType OpVoAvx() { return &CX86Assembler::VpmuldqVo; }
+		};
+
+		struct MDOP_MULUWD : public MDOP_BASE
+		{
+			static OpVoType OpVo() { return &CX86Assembler::PmuludqVo; }
+			static OpVoAvxType OpVoAvx() { return &CX86Assembler::VpmuludqVo; }
+		};
+
 		struct MDOP_AND : public MDOP_BASE
 		{
 			static OpVoType OpVo() { return &CX86Assembler::PandVo; }
@@ -390,6 +509,18 @@ namespace Jitter
 			static OpVoAvxType OpVoAvx() { return &CX86Assembler::VmaxpsVo; }
 		};
 
+		struct MDOP_SQRTS : public MDOP_BASE
+		{
+			static OpVoType OpVo() { return &CX86Assembler::SqrtpsVo; }
+			static OpVoType OpVoAvx() { return &CX86Assembler::VsqrtpsVo; }
+		};
+
+		struct MDOP_HADDS : public MDOP_BASE
+		{
+			static OpVoType OpVo() { return &CX86Assembler::HaddpsVo; }
+			static OpVoAvxType OpVoAvx() { return &CX86Assembler::VhaddpsVo; }
+		};
+
 		struct MDOP_TOINT32_TRUNC_S : public MDOP_BASE
 		{
 			static OpVoType OpVo() { return &CX86Assembler::Cvttps2dqVo; }
@@ -473,12 +604,32 @@ namespace Jitter
 		};
 		// clang-format on
 
+		enum
+		{
+			MAX_MDTEMPREGISTERS = 2,
+			MAX_CONSTANTCACHEREGISTERS = 2,
+		};
+
+		struct CONSTANTCACHEENTRY
+		{
+			CX86Assembler::XMMREGISTER registerId = CX86Assembler::xMM0;
+			LITERAL128 value = LITERAL128(0, 0);
+			bool valid = false;
+		};
+		typedef std::vector<CONSTANTCACHEENTRY> ConstantCache;
+		typedef std::map<LITERAL128, unsigned int> ConstantUseCountMap;
+
 		virtual void Emit_Prolog(const StatementList&, unsigned int) = 0;
 		virtual void Emit_Epilog() = 0;
 
-		virtual CX86Assembler::CAddress MakeConstant128Address(const LITERAL128&) = 0;
+		virtual CX86Assembler::CAddress MakeConstant128MemoryAddress(const LITERAL128&) = 0;
+		CX86Assembler::CAddress MakeConstant128Address(const LITERAL128&);
+		ConstantCache GetConstantCache(const StatementList&) const;
+		void InvalidateConstantCache();
 
 		CX86Assembler::LABEL GetLabel(uint32);
+		static LoopHeadSet GetLoopHeads(const StatementList&);
+		CX86Assembler::XMMREGISTER GetMdTempRegister(unsigned int);
 
 		CX86Assembler::CAddress MakeRelativeSymbolAddress(CSymbol*);
 		CX86Assembler::CAddress MakeTemporarySymbolAddress(CSymbol*);
@@ -508,6 +659,12 @@ namespace Jitter
 		CX86Assembler::CAddress MakeVariableFp32SymbolAddress(CSymbol*);
 		CX86Assembler::CAddress MakeMemoryFp32SymbolAddress(CSymbol*);
 
+		CX86Assembler::CAddress MakeRelativeFp64SymbolAddress(CSymbol*);
+		CX86Assembler::CAddress MakeTemporaryFp64SymbolAddress(CSymbol*);
+
+		CX86Assembler::CAddress MakeVariableFp64SymbolAddress(CSymbol*);
+		CX86Assembler::CAddress MakeMemoryFp64SymbolAddress(CSymbol*);
+
 		CX86Assembler::CAddress MakeRelative128SymbolElementAddress(CSymbol*, unsigned int);
 		CX86Assembler::CAddress MakeTemporary128SymbolElementAddress(CSymbol*, unsigned int);
 
@@ -518,6 +675,7 @@ namespace Jitter
 		CX86Assembler::CAddress MakeTemporary256SymbolElementAddress(CSymbol*, unsigned int);
 
 		void MdSseBlendVariables(const CX86Assembler::CAddress&, const CX86Assembler::CAddress&, const CX86Assembler::CAddress&, uint8);
+		CX86Assembler::CAddress MakeMdInsertValueAddress(CSymbol*);
 
 		//LABEL
 		void MarkLabel(const STATEMENT&);
@@ -598,6 +756,11 @@ namespace Jitter
 		template <typename>
 		void Emit_Shift_MemCstMem(const STATEMENT&);
 
+		template <typename>
+		void Emit_Shift_Bmi2_VarAnyVar(const STATEMENT&);
+		template <typename>
+		void Emit_Rotate_Bmi2_VarVarCst(const STATEMENT&);
+
 		//NOT
 		void Emit_Not_RegReg(const STATEMENT&);
 		void Emit_Not_RegMem(const STATEMENT&);
@@ -609,6 +772,16 @@ namespace Jitter
 		void Emit_Lzc_RegVar(const STATEMENT&);
 		void Emit_Lzc_MemVar(const STATEMENT&);
 
+		//TZC
+		void Emit_Tzc_VarVar(const STATEMENT&);
+
+		//POPCNT
+		void Emit_Popcnt_VarVar(const STATEMENT&);
+
+		//BSWAP
+		void Emit_Bswap_VarVar(const STATEMENT&);
+		void Emit_Bswap16_VarVar(const STATEMENT&);
+
 		//CMP
 		void Cmp_GetFlag(const CX86Assembler::CAddress&, CONDITION);
 
@@ -642,15 +815,25 @@ namespace Jitter
 		void Emit_CondJmp_RegReg(const STATEMENT&);
 		void Emit_CondJmp_RegMem(const STATEMENT&);
 		void Emit_CondJmp_RegCst(const STATEMENT&);
+		void Emit_CondJmp_MemReg(const STATEMENT&);
 		void Emit_CondJmp_MemMem(const STATEMENT&);
 		void Emit_CondJmp_MemCst(const STATEMENT&);
 
+		//TESTJMP
+		void Emit_TestJmp_RegReg(const STATEMENT&);
+		void Emit_TestJmp_RegMem(const STATEMENT&);
+		void Emit_TestJmp_RegCst(const STATEMENT&);
+		void Emit_TestJmp_MemReg(const STATEMENT&);
+		void Emit_TestJmp_MemMem(const STATEMENT&);
+		void Emit_TestJmp_MemCst(const STATEMENT&);
+
 		//SELECT
 		void Select_Generic(Jitter::CONDITION, CSymbol*, CSymbol*, CSymbol*);
 		void Emit_Select_VarVarAnyAny(const STATEMENT&);
 
 		//CMPSELECT
 		void Emit_CmpSelectP1_AnyVar(const STATEMENT&);
+		void Emit_CmpSelectP1_AnyCst(const STATEMENT&);
 		void Emit_CmpSelectP2_VarAnyAny(const STATEMENT&);
 
 		//MERGETO64
@@ -659,6 +842,7 @@ namespace Jitter
 		void Emit_MergeTo64_Mem64RegCst(const STATEMENT&);
 		void Emit_MergeTo64_Mem64MemReg(const STATEMENT&);
 		void Emit_MergeTo64_Mem64MemMem(const STATEMENT&);
+		void Emit_MergeTo64_Mem64MemCst(const STATEMENT&);
 		void Emit_MergeTo64_Mem64CstReg(const STATEMENT&);
 		void Emit_MergeTo64_Mem64CstMem(const STATEMENT&);
 
@@ -671,6 +855,7 @@ namespace Jitter
 		//LOADFROMREF
 		void Emit_LoadFromRef_VarVar(const STATEMENT&);
 		void Emit_LoadFromRef_VarVarAny(const STATEMENT&);
+		void Emit_Lookup_VarCstAny(const STATEMENT&);
 
 		//LOAD8FROMREF
 		void Emit_Load8FromRef_VarVar(const STATEMENT&);
@@ -738,6 +923,23 @@ namespace Jitter
 		void Emit_Fp_ToInt32TruncS_RegVar(const STATEMENT&);
 		void Emit_Fp_ToInt32TruncS_MemVar(const STATEMENT&);
 
+		template <typename>
+		void Emit_Fp64_VarVar(const STATEMENT&);
+		template <typename>
+		void Emit_Fp64_VarVarVar(const STATEMENT&);
+
+		void Emit_Fp64_Mov_RegMem(const STATEMENT&);
+		void Emit_Fp64_Mov_MemReg(const STATEMENT&);
+		void Emit_Fp64_LdCst_VarCst(const STATEMENT&);
+
+		void Emit_Fp_CmpD_VarVarVar(const STATEMENT&);
+		void Emit_Fp_AbsD_VarVar(const STATEMENT&);
+		void Emit_Fp_NegD_VarVar(const STATEMENT&);
+		void Emit_Fp_ToDoubleS_VarVar(const STATEMENT&);
+		void Emit_Fp_ToSingleD_VarVar(const STATEMENT&);
+		void Emit_Fp_ToInt32TruncD_VarVar(const STATEMENT&);
+		void Emit_Fp_ToDoubleI32_VarVar(const STATEMENT&);
+
 		//MDOP
 		template <typename>
 		void Emit_Md_RegVar(const STATEMENT&);
@@ -769,8 +971,15 @@ namespace Jitter
 		void Emit_Md_SubUSW_VarVarVar(const STATEMENT&);
 		void Emit_Md_MinW_VarVarVar(const STATEMENT&);
 		void Emit_Md_MaxW_VarVarVar(const STATEMENT&);
+		void Emit_Md_MulW_VarVarVar(const STATEMENT&);
+		void Emit_Md_MulSWD_VarVarVar(const STATEMENT&);
 		void Emit_Md_ClampS_RegVar(const STATEMENT&);
 		void Emit_Md_ClampS_MemVar(const STATEMENT&);
+		void Emit_Md_RsqrtS_VarVar(const STATEMENT&);
+		void Emit_Md_RcplS_VarVar(const STATEMENT&);
+		void Emit_Md_DotS_VarVarVar(const STATEMENT&);
+		void Emit_Md_DotS_Sse41_VarVarVar(const STATEMENT&);
+		void Emit_Md_HaddS_VarVarVar(const STATEMENT&);
 		void Emit_Md_PackHB_VarVarVar(const STATEMENT&);
 		void Emit_Md_PackWH_VarVarVar(const STATEMENT&);
 		void Emit_Md_Mov_RegVar(const STATEMENT&);
@@ -786,6 +995,17 @@ namespace Jitter
 		void Emit_Md_ExpandW_VarMem(const STATEMENT&);
 		void Emit_Md_ExpandW_VarCst(const STATEMENT&);
 		void Emit_Md_ExpandW_VarVarCst(const STATEMENT&);
+		void Emit_Md_ShuffleW_VarVarCst(const STATEMENT&);
+		void Emit_Md_ShuffleB_VarVarCstCst(const STATEMENT&);
+		void Emit_Md_ShuffleB_Ssse3_VarVarCstCst(const STATEMENT&);
+		void Emit_Md_InsertW(CSymbol*, CSymbol*, uint8, CX86Assembler::XMMREGISTER);
+		void Emit_Md_InsertW_VarVarAnyCst(const STATEMENT&);
+		void Emit_Md_InsertW_VarVarFpvarCst(const STATEMENT&);
+		void Emit_Md_InsertW_Sse41_VarVarAnyCst(const STATEMENT&);
+		void Emit_Md_InsertW_Sse41_VarVarFpvarCst(const STATEMENT&);
+		void Emit_Md_ExtractW_VarVarCst(const STATEMENT&);
+		void Emit_Md_ExtractW_Sse41_VarVarCst(const STATEMENT&);
+		void Emit_Md_ExtractW_FpvarVarCst(const STATEMENT&);
 
 		void Emit_MergeTo256_MemVarVar(const STATEMENT&);
 
@@ -829,8 +1049,27 @@ namespace Jitter
 		void Emit_Fp_Avx_ClampS_VarVar(const STATEMENT&);
 		void Emit_Fp_Avx_ToSingleI32_VarReg(const STATEMENT&);
 		void Emit_Fp_Avx_ToSingleI32_VarMem(const STATEMENT&);
-		void Emit_Fp_Avx_ToInt32TruncS_RegVar(const STATEMENT&);
+		void Emit_Fp_Avx_ToInt32TruncS_RegReg(const STATEMENT&);
+		void Emit_Fp_Avx_ToInt32TruncS_RegMem(const STATEMENT&);
 		void Emit_Fp_Avx_ToInt32TruncS_MemVar(const STATEMENT&);
+		void Emit_Fp_Fma_FmaS_VarVarVarVar(const STATEMENT&);
+
+		template <typename>
+		void Emit_Fp64_Avx_VarVar(const STATEMENT&);
+		template <typename>
+		void Emit_Fp64_Avx_VarVarVar(const STATEMENT&);
+
+		void Emit_Fp64_Avx_Mov_RegMem(const STATEMENT&);
+		void Emit_Fp64_Avx_Mov_MemReg(const STATEMENT&);
+		void Emit_Fp64_Avx_LdCst_VarCst(const STATEMENT&);
+
+		void Emit_Fp_Avx_CmpD_VarVarVar(const STATEMENT&);
+		void Emit_Fp_Avx_AbsD_VarVar(const STATEMENT&);
+		void Emit_Fp_Avx_NegD_VarVar(const STATEMENT&);
+		void Emit_Fp_Avx_ToDoubleS_VarVar(const STATEMENT&);
+		void Emit_Fp_Avx_ToSingleD_VarVar(const STATEMENT&);
+		void Emit_Fp_Avx_ToInt32TruncD_VarVar(const STATEMENT&);
+		void Emit_Fp_Avx_ToDoubleI32_VarVar(const STATEMENT&);
 
 		//MDOP AVX
 		template <typename>
@@ -855,6 +1094,10 @@ namespace Jitter
 		void Emit_Md_Avx_SubSSW_VarVarVar(const STATEMENT&);
 		void Emit_Md_Avx_SubUSW_VarVarVar(const STATEMENT&);
 		void Emit_Md_Avx_ClampS_VarVar(const STATEMENT&);
+		void Emit_Md_Avx_RsqrtS_VarVar(const STATEMENT&);
+		void Emit_Md_Avx_RcplS_VarVar(const STATEMENT&);
+		void Emit_Md_Avx_DotS_VarVarVar(const STATEMENT&);
+		void Emit_Md_Fma_FmaS_VarVarVarVar(const STATEMENT&);
 
 		void Emit_Md_Avx_PackHB_VarVarVar(const STATEMENT&);
 		void Emit_Md_Avx_PackWH_VarVarVar(const STATEMENT&);
@@ -865,6 +1108,12 @@ namespace Jitter
 		void Emit_Md_Avx_ExpandW_VarVar(const STATEMENT&);
 		void Emit_Md_Avx_ExpandW_VarCst(const STATEMENT&);
 		void Emit_Md_Avx_ExpandW_VarVarCst(const STATEMENT&);
+		void Emit_Md_Avx_ShuffleW_VarVarCst(const STATEMENT&);
+		void Emit_Md_Avx_ShuffleB_VarVarCstCst(const STATEMENT&);
+		void Emit_Md_Avx_InsertW_VarVarAnyCst(const STATEMENT&);
+		void Emit_Md_Avx_InsertW_VarVarFpvarCst(const STATEMENT&);
+		void Emit_Md_Avx_ExtractW_VarVarCst(const STATEMENT&);
+		void Emit_Md_Avx_ExtractW_FpvarVarCst(const STATEMENT&);
 
 		void Emit_Md_Avx2_ExpandW_VarReg(const STATEMENT&);
 		void Emit_Md_Avx2_ExpandW_VarMem(const STATEMENT&);
@@ -886,6 +1135,12 @@ namespace Jitter
 		void Emit_Md_Avx_LoadFromRefMasked_VarVarAnyVar(const STATEMENT&);
 		void Emit_Md_Avx_StoreAtRefMasked_VarAnyVar(const STATEMENT&);
 
+		//AVX-512
+		void Emit_Md_Avx512_AddSSW_VarVarVar(const STATEMENT&);
+		void Emit_Md_Avx512_SubSSW_VarVarVar(const STATEMENT&);
+		void Emit_Md_Avx512_Not_VarVar(const STATEMENT&);
+		void Emit_Md_Avx512_StoreAtRefMasked_VarAnyVar(const STATEMENT&);
+
 		static CX86Assembler::REGISTER g_baseRegister;
 
 		CX86Assembler::REGISTER PrepareSymbolRegisterDef(CSymbol*, CX86Assembler::REGISTER);
@@ -897,6 +1152,16 @@ namespace Jitter
 		CX86Assembler::XMMREGISTER PrepareSymbolRegisterUseFp32Avx(CSymbol*, CX86Assembler::XMMREGISTER);
 		void CommitSymbolRegisterFp32Sse(CSymbol*, CX86Assembler::XMMREGISTER);
 		void CommitSymbolRegisterFp32Avx(CSymbol*, CX86Assembler::XMMREGISTER);
+		void LoadSymbolFp32Sse(CX86Assembler::XMMREGISTER, CSymbol*);
+
+		CX86Assembler::XMMREGISTER PrepareSymbolRegisterDefFp64(CSymbol*, CX86Assembler::XMMREGISTER);
+		CX86Assembler::XMMREGISTER PrepareSymbolRegisterUseFp64Avx(CSymbol*, CX86Assembler::XMMREGISTER);
+		void CommitSymbolRegisterFp64Sse(CSymbol*, CX86Assembler::XMMREGISTER);
+		void CommitSymbolRegisterFp64Avx(CSymbol*, CX86Assembler::XMMREGISTER);
+		void LoadSymbolFp64Sse(CX86Assembler::XMMREGISTER, CSymbol*);
+
+		void BreakFpDependencySse(CX86Assembler::XMMREGISTER, CSymbol* = nullptr);
+		CX86Assembler::XMMREGISTER PrepareFpMergeRegisterAvx(CSymbol* = nullptr);
 
 		CX86Assembler::XMMREGISTER PrepareSymbolRegisterDefMd(CSymbol*, CX86Assembler::XMMREGISTER);
 		CX86Assembler::XMMREGISTER PrepareSymbolRegisterUseMdSse(CSymbol*, CX86Assembler::XMMREGISTER);
@@ -915,13 +1180,20 @@ namespace Jitter
 		static const LITERAL128 g_fpClampMask1;
 		static const LITERAL128 g_fpClampMask2;
 		static const std::array<uint8, 4> g_mdExpandShufPatterns;
+		static std::vector<std::pair<int32, LITERAL128>> GetMdShuffleBShiftMasks(uint64, uint64);
 		static const std::array<uint32, 4> g_fpMxcsrRoundBits;
 		static constexpr uint32 MXCSR_ROUND_MASK = 0x6000;
 
 		CX86Assembler m_assembler;
 		CX86Assembler::REGISTER* m_registers = nullptr;
 		CX86Assembler::XMMREGISTER* m_mdRegisters = nullptr;
+		CX86Assembler::XMMREGISTER* m_mdTempRegisters = nullptr;
 		LabelMapType m_labels;
+		LoopHeadSet m_loopHeads;
+		uint32 m_loopAlignment = 0;
+		bool m_constantCacheEnabled = true;
+		ConstantCache m_constantCache;
+		ConstantUseCountMap m_constantUseCounts;
 		SymbolReferenceLabelArray m_symbolReferenceLabels;
 		uint32 m_stackLevel = 0;
 		uint32 m_registerUsage = 0;
@@ -944,10 +1216,12 @@ namespace Jitter
 		void InsertMatchers(const CONSTMATCHER*);
 
 		static CONSTMATCHER g_constMatchers[];
+		static CONSTMATCHER g_bmi2ConstMatchers[];
 
 		static CONSTMATCHER g_fpuConstMatchers[];
 		static CONSTMATCHER g_fpuSseConstMatchers[];
 		static CONSTMATCHER g_fpuAvxConstMatchers[];
+		static CONSTMATCHER g_fpuFmaConstMatchers[];
 
 		//SSE SIMD matchers
 		static CONSTMATCHER g_mdSseConstMatchers[];
@@ -963,5 +1237,9 @@ namespace Jitter
 
 		static CONSTMATCHER g_mdNoAvx2ConstMatchers[];
 		static CONSTMATCHER g_mdAvx2ConstMatchers[];
+
+		static CONSTMATCHER g_mdFmaConstMatchers[];
+
+		static CONSTMATCHER g_mdAvx512ConstMatchers[];
 	};
 }
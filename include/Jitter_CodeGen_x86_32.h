@@ -14,8 +14,11 @@ namespace Jitter
 		void SetImplicitRetValueParamFixUpRequired(bool);
 
 		unsigned int GetAvailableRegisterCount() const override;
+		unsigned int GetAvailableCallerSavedRegisterCount() const override;
 		unsigned int GetAvailableMdRegisterCount() const override;
+		bool IsHelperCall(const STATEMENT&) const override;
 		bool CanHold128BitsReturnValueInRegisters() const override;
+		bool Has64BitsRegisters() const override;
 		uint32 GetPointerSize() const override;
 
 	protected:
@@ -28,7 +31,7 @@ namespace Jitter
 		void Emit_Prolog(const StatementList&, unsigned int) override;
 		void Emit_Epilog() override;
 
-		CX86Assembler::CAddress MakeConstant128Address(const LITERAL128&) override;
+		CX86Assembler::CAddress MakeConstant128MemoryAddress(const LITERAL128&) override;
 
 		//PARAM
 		void Emit_Param_Ctx(const STATEMENT&);
@@ -72,6 +75,27 @@ namespace Jitter
 		//AND64
 		void Emit_And64_MemMemMem(const STATEMENT&);
 
+		//OR64/XOR64
+		template <typename>
+		void Emit_Logic64_MemMemAny(const STATEMENT&);
+
+		//NOT64
+		void Emit_Not64_MemMem(const STATEMENT&);
+
+		//MUL64
+		void Emit_Mul64_MemMemAny(const STATEMENT&);
+
+		//DIV64
+		template <bool>
+		void Emit_Div64_MemAnyAny(const STATEMENT&);
+
+		//SELECT64
+		void Emit_Select64_MemVarAnyAny(const STATEMENT&);
+
+		//FP64 <-> INT64
+		void Emit_Fp_ToInt64TruncD_VarVar(const STATEMENT&);
+		void Emit_Fp_ToDoubleI64_VarVar(const STATEMENT&);
+
 		//SR64
 		void Emit_Sr64Var_MemMem(CSymbol*, CSymbol*, CX86Assembler::REGISTER, SHIFTRIGHT_TYPE);
 		void Emit_Sr64Cst_MemMem(CSymbol*, CSymbol*, uint32, SHIFTRIGHT_TYPE);
@@ -92,6 +116,13 @@ namespace Jitter
 		void Emit_Sll64_MemMemMem(const STATEMENT&);
 		void Emit_Sll64_MemMemCst(const STATEMENT&);
 
+		//ROTL64/ROTR64
+		template <bool>
+		void Emit_Rot64_MemMemAny(const STATEMENT&);
+
+		//BSWAP64
+		void Emit_Bswap64_MemMem(const STATEMENT&);
+
 		//CMP
 		void Emit_Cmp_VarVarVar(const STATEMENT&);
 		void Emit_Cmp_VarVarCst(const STATEMENT&);
@@ -136,6 +167,9 @@ namespace Jitter
 		//CONDJMP
 		void Emit_CondJmp_Ref_VarCst(const STATEMENT&);
 
+		//JMPTABLE
+		void Emit_JmpTable_Var(const STATEMENT&);
+
 	private:
 		struct CALL_STATE
 		{
@@ -163,7 +197,7 @@ namespace Jitter
 		enum MAX_REGISTERS
 		{
 			MAX_REGISTERS = 3,
-			MAX_MDREGISTERS = 4,
+			MAX_MDREGISTERS = 6,
 		};
 
 		CX86Assembler::REGISTER PrepareRefSymbolRegisterDef(CSymbol*, CX86Assembler::REGISTER);
@@ -182,6 +216,7 @@ namespace Jitter
 		uint32 m_literalStackAlloc = 0;
 		uint32 m_literalBase = 0;
 		LiteralOffsets m_literalOffsets;
+		bool m_stackAligned = false;
 		bool m_hasImplicitRetValueParam = false;
 		bool m_implicitRetValueParamFixUpRequired = false;
 	};
@@ -20,8 +20,11 @@ namespace Jitter
 		void SetPlatformAbi(PLATFORM_ABI);
 
 		unsigned int GetAvailableRegisterCount() const override;
+		unsigned int GetAvailableCallerSavedRegisterCount() const override;
 		unsigned int GetAvailableMdRegisterCount() const override;
+		bool IsHelperCall(const STATEMENT&) const override;
 		bool CanHold128BitsReturnValueInRegisters() const override;
+		bool Has64BitsRegisters() const override;
 		uint32 GetPointerSize() const override;
 
 	protected:
@@ -51,42 +54,73 @@ namespace Jitter
 			static OpEqType OpEq() { return &CX86Assembler::AndEq; }
 		};
 
+		struct ALUOP64_OR : public ALUOP64_BASE
+		{
+			static OpIqType OpIq() { return &CX86Assembler::OrIq; }
+			static OpEqType OpEq() { return &CX86Assembler::OrEq; }
+		};
+
+		struct ALUOP64_XOR : public ALUOP64_BASE
+		{
+			static OpIqType OpIq() { return &CX86Assembler::XorIq; }
+			static OpEqType OpEq() { return &CX86Assembler::XorEq; }
+		};
+
 		//SHIFTOP64 ----------------------------------------------------------
 		struct SHIFTOP64_BASE
 		{
 			typedef void (CX86Assembler::*OpCstType)(const CX86Assembler::CAddress&, uint8);
 			typedef void (CX86Assembler::*OpVarType)(const CX86Assembler::CAddress&);
+			typedef void (CX86Assembler::*OpVarBmi2Type)(CX86Assembler::REGISTER, const CX86Assembler::CAddress&, CX86Assembler::REGISTER);
 		};
 
 		struct SHIFTOP64_SLL : public SHIFTOP64_BASE
 		{
 			static OpCstType OpCst() { return &CX86Assembler::ShlEq; }
 			static OpVarType OpVar() { return &CX86Assembler::ShlEq; }
+			static OpVarBmi2Type OpVarBmi2() { return &CX86Assembler::ShlxEq; }
 		};
 
 		struct SHIFTOP64_SRL : public SHIFTOP64_BASE
 		{
 			static OpCstType OpCst() { return &CX86Assembler::ShrEq; }
 			static OpVarType OpVar() { return &CX86Assembler::ShrEq; }
+			static OpVarBmi2Type OpVarBmi2() { return &CX86Assembler::ShrxEq; }
 		};
 
 		struct SHIFTOP64_SRA : public SHIFTOP64_BASE
 		{
 			static OpCstType OpCst() { return &CX86Assembler::SarEq; }
 			static OpVarType OpVar() { return &CX86Assembler::SarEq; }
+			static OpVarBmi2Type OpVarBmi2() { return &CX86Assembler::SarxEq; }
+		};
+
+		struct SHIFTOP64_ROL : public SHIFTOP64_BASE
+		{
+			static OpCstType OpCst() { return &CX86Assembler::RolEq; }
+			static OpVarType OpVar() { return &CX86Assembler::RolEq; }
+			static uint8 RorxAmount(uint8 amount) { return (64 - amount) & 0x3F; }
+		};
+
+		struct SHIFTOP64_ROR : public SHIFTOP64_BASE
+		{
+			static OpCstType OpCst() { return &CX86Assembler::RorEq; }
+			static OpVarType OpVar() { return &CX86Assembler::RorEq; }
+			static uint8 RorxAmount(uint8 amount) { return amount & 0x3F; }
 		};
 		// clang-format on
 
 		void Emit_Prolog(const StatementList&, unsigned int) override;
 		void Emit_Epilog() override;
 
-		CX86Assembler::CAddress MakeConstant128Address(const LITERAL128&) override;
+		CX86Assembler::CAddress MakeConstant128MemoryAddress(const LITERAL128&) override;
 
 		//PARAM
 		void Emit_Param_Ctx(const STATEMENT&);
 		void Emit_Param_Reg(const STATEMENT&);
 		void Emit_Param_Mem(const STATEMENT&);
 		void Emit_Param_Cst(const STATEMENT&);
+		void Emit_Param_Reg64(const STATEMENT&);
 		void Emit_Param_Mem64(const STATEMENT&);
 		void Emit_Param_Cst64(const STATEMENT&);
 		void Emit_Param_Reg128(const STATEMENT&);
@@ -98,6 +132,7 @@ namespace Jitter
 		//RETURNVALUE
 		void Emit_RetVal_Reg(const STATEMENT&);
 		void Emit_RetVal_Mem(const STATEMENT&);
+		void Emit_RetVal_Reg64(const STATEMENT&);
 		void Emit_RetVal_Mem64(const STATEMENT&);
 		void Emit_RetVal_Reg128(const STATEMENT&);
 		void Emit_RetVal_Mem128(const STATEMENT&);
@@ -106,34 +141,67 @@ namespace Jitter
 		void Emit_ExternJmp(const STATEMENT&);
 
 		//MOV
-		void Emit_Mov_Mem64Mem64(const STATEMENT&);
-		void Emit_Mov_Rel64Cst64(const STATEMENT&);
+		void Emit_Mov_Var64Var64(const STATEMENT&);
+		void Emit_Mov_Var64Cst64(const STATEMENT&);
 		void Emit_Mov_RegRefMemRef(const STATEMENT&);
 		void Emit_Mov_MemRefRegRef(const STATEMENT&);
 
 		//ALU64
 		template <typename>
-		void Emit_Alu64_MemMemMem(const STATEMENT&);
+		void Emit_Alu64_VarVarVar(const STATEMENT&);
 		template <typename>
-		void Emit_Alu64_MemMemCst(const STATEMENT&);
+		void Emit_Alu64_VarVarCst(const STATEMENT&);
 		template <typename>
-		void Emit_Alu64_MemCstMem(const STATEMENT&);
+		void Emit_Alu64_VarCstVar(const STATEMENT&);
+
+		//NOT64
+		void Emit_Not64_VarVar(const STATEMENT&);
+
+		//BSWAP64
+		void Emit_Bswap64_VarVar(const STATEMENT&);
+
+		//MUL64
+		void Emit_Mul64_VarVarAny(const STATEMENT&);
+
+		//DIV64
+		template <bool>
+		void Emit_Div64_VarAnyAny(const STATEMENT&);
+
+		//SELECT64
+		void Emit_Select64_VarVarAnyAny(const STATEMENT&);
+
+		//FP64 <-> INT64
+		void Emit_Fp_ToInt64TruncD_VarVar(const STATEMENT&);
+		void Emit_Fp_ToDoubleI64_VarVar(const STATEMENT&);
 
 		//SHIFT64
 		template <typename>
-		void Emit_Shift64_RelRelReg(const STATEMENT&);
+		void Emit_Shift64_VarVarVar(const STATEMENT&);
 		template <typename>
-		void Emit_Shift64_RelRelMem(const STATEMENT&);
+		void Emit_Shift64_VarVarCst(const STATEMENT&);
 		template <typename>
-		void Emit_Shift64_RelRelCst(const STATEMENT&);
+		void Emit_Shift64_Bmi2_VarVarVar(const STATEMENT&);
+		template <typename>
+		void Emit_Rotate64_Bmi2_VarVarCst(const STATEMENT&);
+
+		//MUL/DIV (32-bit operands, 64-bit result)
+		template <bool>
+		void Emit_Mul_Reg64AnyAny(const STATEMENT&);
+		template <bool>
+		void Emit_Div_Reg64AnyAny(const STATEMENT&);
+
+		//EXTLOW64/EXTHIGH64/MERGETO64
+		void Emit_ExtLow64VarReg64(const STATEMENT&);
+		void Emit_ExtHigh64VarReg64(const STATEMENT&);
+		void Emit_MergeTo64_Reg64AnyAny(const STATEMENT&);
 
 		//CMP
 		void Emit_Cmp_VarVarVar(const STATEMENT&);
 		void Emit_Cmp_VarVarCst(const STATEMENT&);
 
 		//CMP64
-		void Emit_Cmp64_VarMemMem(const STATEMENT&);
-		void Emit_Cmp64_VarMemCst(const STATEMENT&);
+		void Emit_Cmp64_VarVarVar(const STATEMENT&);
+		void Emit_Cmp64_VarVarCst(const STATEMENT&);
 
 		//RELTOREF
 		void Emit_RelToRef_VarCst(const STATEMENT&);
@@ -146,15 +214,15 @@ namespace Jitter
 		void Emit_IsRefNull_VarVar(const STATEMENT&);
 
 		//LOADFROMREF
-		void Emit_LoadFromRef_64_MemVar(const STATEMENT&);
-		void Emit_LoadFromRef_64_MemVarAny(const STATEMENT&);
+		void Emit_LoadFromRef_64_VarVar(const STATEMENT&);
+		void Emit_LoadFromRef_64_VarVarAny(const STATEMENT&);
 		void Emit_LoadFromRef_Ref_VarVar(const STATEMENT&);
 		void Emit_LoadFromRef_Ref_VarVarAny(const STATEMENT&);
 
 		//STOREATREF
-		void Emit_StoreAtRef_64_VarMem(const STATEMENT&);
+		void Emit_StoreAtRef_64_VarVar(const STATEMENT&);
 		void Emit_StoreAtRef_64_VarCst(const STATEMENT&);
-		void Emit_StoreAtRef_64_VarAnyMem(const STATEMENT&);
+		void Emit_StoreAtRef_64_VarAnyVar(const STATEMENT&);
 		void Emit_StoreAtRef_64_VarAnyCst(const STATEMENT&);
 
 		//STORE8ATREF
@@ -164,9 +232,20 @@ namespace Jitter
 		//CONDJMP
 		void Emit_CondJmp_Ref_VarCst(const STATEMENT&);
 
+		//JMPTABLE
+		void Emit_JmpTable_Var(const STATEMENT&);
+
 	private:
 		typedef void (CCodeGen_x86_64::*ConstCodeEmitterType)(const STATEMENT&);
 
+		void LoadSymbol64InRegister(CX86Assembler::REGISTER, CSymbol*);
+		CX86Assembler::CAddress MakeSymbol64Address(CSymbol*, CX86Assembler::REGISTER);
+		CX86Assembler::CAddress MakeVariable64SymbolAddress(CSymbol*);
+
+		CX86Assembler::REGISTER PrepareSymbol64RegisterDef(CSymbol*, CX86Assembler::REGISTER);
+		CX86Assembler::REGISTER PrepareSymbol64RegisterUse(CSymbol*, CX86Assembler::REGISTER);
+		void CommitSymbol64Register(CSymbol*, CX86Assembler::REGISTER);
+
 		typedef std::function<uint32(CX86Assembler::REGISTER, uint32)> ParamEmitterFunction;
 		typedef std::deque<ParamEmitterFunction> ParamStack;
 
@@ -185,6 +264,11 @@ namespace Jitter
 			SYSTEMV_MAX_REGISTERS = 5,
 		};
 
+		enum SYSTEMV_MAX_CALLER_SAVED_REGISTERS
+		{
+			SYSTEMV_MAX_CALLER_SAVED_REGISTERS = 6,
+		};
+
 		enum SYSTEMV_MAX_PARAMS
 		{
 			SYSTEMV_MAX_PARAMS = 6,
@@ -195,6 +279,11 @@ namespace Jitter
 			WIN32_MAX_REGISTERS = 7,
 		};
 
+		enum WIN32_MAX_CALLER_SAVED_REGISTERS
+		{
+			WIN32_MAX_CALLER_SAVED_REGISTERS = 4,
+		};
+
 		enum WIN32_MAX_PARAMS
 		{
 			WIN32_MAX_PARAMS = 4,
@@ -211,15 +300,20 @@ namespace Jitter
 
 		void WriteConstant64ToAddress(const CX86Assembler::CAddress&, CX86Assembler::REGISTER, uint64);
 
+		void InsertMatchers(const CONSTMATCHER*);
+
 		static CONSTMATCHER g_constMatchers[];
-		static CX86Assembler::REGISTER g_systemVRegisters[SYSTEMV_MAX_REGISTERS];
+		static CONSTMATCHER g_bmi2ConstMatchers[];
+		static CX86Assembler::REGISTER g_systemVRegisters[SYSTEMV_MAX_REGISTERS + SYSTEMV_MAX_CALLER_SAVED_REGISTERS];
 		static CX86Assembler::REGISTER g_systemVParamRegs[SYSTEMV_MAX_PARAMS];
-		static CX86Assembler::REGISTER g_win32Registers[WIN32_MAX_REGISTERS];
+		static CX86Assembler::REGISTER g_win32Registers[WIN32_MAX_REGISTERS + WIN32_MAX_CALLER_SAVED_REGISTERS];
 		static CX86Assembler::REGISTER g_win32ParamRegs[WIN32_MAX_PARAMS];
 		static CX86Assembler::XMMREGISTER g_mdRegisters[MAX_MDREGISTERS];
+		static CX86Assembler::XMMREGISTER g_mdTempRegisters[MAX_MDTEMPREGISTERS];
 
 		PLATFORM_ABI m_platformAbi = PLATFORM_ABI_SYSTEMV;
 		uint32 m_maxRegisters = 0;
+		uint32 m_maxCallerSavedRegisters = 0;
 		uint32 m_maxParams = 0;
 		bool m_hasMdRegRetValues = false;
 		CX86Assembler::REGISTER* m_paramRegs = nullptr;
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <list>
+#include <memory>
+#include <vector>
 #include <functional>
 #include "Jitter_SymbolRef.h"
 
@@ -34,6 +36,14 @@ namespace Jitter
 		OP_DIVS,
 
 		OP_LZC,
+		OP_TZC,
+		OP_POPCNT,
+
+		OP_ROTL,
+		OP_ROTR,
+
+		OP_BSWAP16,
+		OP_BSWAP,
 
 		OP_RELTOREF,
 		OP_ADDREF,
@@ -45,9 +55,18 @@ namespace Jitter
 		OP_STORE8ATREF,
 		OP_STORE16ATREF,
 
+		OP_LOOKUP, //Reads a 32-bit entry from a constant table (src1) at index src2, same as an indexed load with the table address as base
+
 		OP_ADD64,
 		OP_SUB64,
 		OP_AND64,
+		OP_OR64,
+		OP_XOR64,
+		OP_NOT64,
+		OP_MUL64,
+		OP_DIV64,
+		OP_DIVS64,
+		OP_SELECT64,
 		OP_CMP64,
 		OP_MERGETO64,
 		OP_EXTLOW64,
@@ -55,6 +74,9 @@ namespace Jitter
 		OP_SRA64,
 		OP_SRL64,
 		OP_SLL64,
+		OP_ROTL64,
+		OP_ROTR64,
+		OP_BSWAP64,
 
 		OP_MERGETO256,
 
@@ -100,6 +122,13 @@ namespace Jitter
 		OP_MD_MAX_H,
 		OP_MD_MAX_W,
 
+		OP_MD_MUL_H,
+		OP_MD_MULHS_H,
+		OP_MD_MULHU_H,
+		OP_MD_MUL_W,
+		OP_MD_MULS_WD,
+		OP_MD_MULU_WD,
+
 		OP_MD_AND,
 		OP_MD_OR,
 		OP_MD_XOR,
@@ -122,6 +151,10 @@ namespace Jitter
 		OP_MD_TOSINGLE_I32,
 
 		OP_MD_EXPAND_W,
+		OP_MD_SHUFFLE_W,
+		OP_MD_SHUFFLE_B,
+		OP_MD_INSERT_W,
+		OP_MD_EXTRACT_W,
 
 		OP_MD_UNPACK_LOWER_BH,
 		OP_MD_UNPACK_LOWER_HW,
@@ -142,6 +175,12 @@ namespace Jitter
 		OP_MD_NEG_S,
 		OP_MD_MIN_S,
 		OP_MD_MAX_S,
+		OP_MD_FMA_S,
+		OP_MD_SQRT_S,
+		OP_MD_RSQRT_S,
+		OP_MD_RCPL_S,
+		OP_MD_DOT_S,
+		OP_MD_HADD_S,
 
 		OP_MD_CMPLT_S,
 		OP_MD_CMPGT_S,
@@ -150,6 +189,7 @@ namespace Jitter
 		OP_FP_SUB_S,
 		OP_FP_MUL_S,
 		OP_FP_DIV_S,
+		OP_FP_FMA_S,
 		OP_FP_SQRT_S,
 		OP_FP_RSQRT_S,
 		OP_FP_RCPL_S,
@@ -163,6 +203,24 @@ namespace Jitter
 		OP_FP_TOINT32_TRUNC_S,
 		OP_FP_TOSINGLE_I32,
 
+		OP_FP_ADD_D,
+		OP_FP_SUB_D,
+		OP_FP_MUL_D,
+		OP_FP_DIV_D,
+		OP_FP_SQRT_D,
+		OP_FP_ABS_D,
+		OP_FP_NEG_D,
+		OP_FP_MAX_D,
+		OP_FP_MIN_D,
+		OP_FP_CMP_D,
+
+		OP_FP_TODOUBLE_S,
+		OP_FP_TOSINGLE_D,
+		OP_FP_TOINT32_TRUNC_D,
+		OP_FP_TODOUBLE_I32,
+		OP_FP_TOINT64_TRUNC_D,
+		OP_FP_TODOUBLE_I64,
+
 		OP_FP_SETROUNDINGMODE,
 
 		OP_FP_LDCST, //This is needed to avoid propagation of constants to fp operations.
@@ -173,9 +231,12 @@ namespace Jitter
 		OP_RETVAL,
 		OP_JMP,
 		OP_CONDJMP,
+		OP_TESTJMP, //Jumps if (src1 & src2) is zero (CONDITION_EQ) or not (CONDITION_NE)
+		OP_JMPTABLE,
 		OP_EXTERNJMP,     //Pass control to another function with same signature (void (*)(void*)) and same input parameter
 		OP_EXTERNJMP_DYN, //Same as above, but destination can be changed at run time, cannot be used in AOT mode
 		OP_GOTO,
+		OP_SWITCH,
 		OP_BREAK,
 
 		OP_LABEL,
@@ -196,6 +257,9 @@ namespace Jitter
 		CONDITION_GE,
 	};
 
+	typedef std::vector<uint32> JumpTable;
+	typedef std::shared_ptr<JumpTable> JumpTablePtr;
+
 	struct STATEMENT
 	{
 	public:
@@ -213,6 +277,46 @@ namespace Jitter
 		SymbolRefPtr dst;
 		uint32 jmpBlock;
 		CONDITION jmpCondition;
+		//Kept out of line and shared between copies, only OP_SWITCH and OP_JMPTABLE use it
+		JumpTablePtr jmpTable;
+
+		bool IsJump() const
+		{
+			return (op == OP_JMP) || (op == OP_CONDJMP) || (op == OP_TESTJMP) || (op == OP_JMPTABLE);
+		}
+
+		template <typename F>
+		void VisitJumpTargets(const F& visitor)
+		{
+			if(!IsJump()) return;
+			visitor(jmpBlock);
+			if(jmpTable)
+			{
+				//Only detach from other copies of this statement if the table is shared
+				if(jmpTable.use_count() != 1)
+				{
+					jmpTable = std::make_shared<JumpTable>(*jmpTable);
+				}
+				for(auto& target : *jmpTable)
+				{
+					visitor(target);
+				}
+			}
+		}
+
+		template <typename F>
+		void VisitJumpTargets(const F& visitor) const
+		{
+			if(!IsJump()) return;
+			visitor(jmpBlock);
+			if(jmpTable)
+			{
+				for(const auto& target : *jmpTable)
+				{
+					visitor(target);
+				}
+			}
+		}
 
 		template <typename F>
 		void VisitOperands(const F& visitor)
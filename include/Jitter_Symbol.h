@@ -26,6 +26,7 @@ namespace Jitter
 		SYM_RELATIVE64,
 		SYM_TEMPORARY64,
 		SYM_CONSTANT64,
+		SYM_REGISTER64,
 
 		SYM_RELATIVE128,
 		SYM_TEMPORARY128,
@@ -36,6 +37,10 @@ namespace Jitter
 		SYM_FP_RELATIVE32,
 		SYM_FP_TEMPORARY32,
 		SYM_FP_REGISTER32,
+
+		SYM_FP_RELATIVE64,
+		SYM_FP_TEMPORARY64,
+		SYM_FP_REGISTER64,
 	};
 
 	class CSymbol
@@ -85,6 +90,9 @@ namespace Jitter
 			case SYM_RELATIVE64:
 				return "REL64[" + std::to_string(m_valueLow) + "]";
 				break;
+			case SYM_REGISTER64:
+				return "REG64[" + std::to_string(m_valueLow) + "]";
+				break;
 			case SYM_REGISTER:
 				return "REG[" + std::to_string(m_valueLow) + "]";
 				break;
@@ -97,6 +105,15 @@ namespace Jitter
 			case SYM_FP_REGISTER32:
 				return "FPREG32[" + std::to_string(m_valueLow) + "]";
 				break;
+			case SYM_FP_RELATIVE64:
+				return "FPREL64[" + std::to_string(m_valueLow) + "]";
+				break;
+			case SYM_FP_TEMPORARY64:
+				return "FPTMP64[" + std::to_string(m_valueLow) + "]";
+				break;
+			case SYM_FP_REGISTER64:
+				return "FPREG64[" + std::to_string(m_valueLow) + "]";
+				break;
 			case SYM_RELATIVE128:
 				return "REL128[" + std::to_string(m_valueLow) + "]";
 				break;
@@ -128,6 +145,7 @@ namespace Jitter
 			case SYM_RELATIVE64:
 			case SYM_TEMPORARY64:
 			case SYM_CONSTANT64:
+			case SYM_REGISTER64:
 				return 8;
 				break;
 			case SYM_RELATIVE128:
@@ -141,6 +159,10 @@ namespace Jitter
 			case SYM_FP_TEMPORARY32:
 				return 4;
 				break;
+			case SYM_FP_RELATIVE64:
+			case SYM_FP_TEMPORARY64:
+				return 8;
+				break;
 			case SYM_REL_REFERENCE:
 			case SYM_TMP_REFERENCE:
 				return sizeof(void*);
@@ -156,7 +178,9 @@ namespace Jitter
 		{
 			return (m_type == SYM_REGISTER) ||
 			       (m_type == SYM_REG_REFERENCE) ||
+			       (m_type == SYM_REGISTER64) ||
 			       (m_type == SYM_FP_REGISTER32) ||
+			       (m_type == SYM_FP_REGISTER64) ||
 			       (m_type == SYM_REGISTER128);
 		}
 
@@ -166,7 +190,8 @@ namespace Jitter
 			       (m_type == SYM_RELATIVE64) ||
 			       (m_type == SYM_RELATIVE128) ||
 			       (m_type == SYM_REL_REFERENCE) ||
-			       (m_type == SYM_FP_RELATIVE32);
+			       (m_type == SYM_FP_RELATIVE32) ||
+			       (m_type == SYM_FP_RELATIVE64);
 		}
 
 		bool IsConstant() const
@@ -181,7 +206,8 @@ namespace Jitter
 			       (m_type == SYM_TEMPORARY128) ||
 			       (m_type == SYM_TEMPORARY256) ||
 			       (m_type == SYM_TMP_REFERENCE) ||
-			       (m_type == SYM_FP_TEMPORARY32);
+			       (m_type == SYM_FP_TEMPORARY32) ||
+			       (m_type == SYM_FP_TEMPORARY64);
 		}
 
 		bool Equals(CSymbol* symbol) const
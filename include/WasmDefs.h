@@ -105,6 +105,8 @@ namespace Wasm
 		INST_F64_GT = 0x64,
 		INST_F64_LE = 0x65,
 		INST_I32_CLZ = 0x67,
+		INST_I32_CTZ = 0x68,
+		INST_I32_POPCNT = 0x69,
 		INST_I32_ADD = 0x6A,
 		INST_I32_SUB = 0x6B,
 		INST_I32_DIV_S = 0x6D,
@@ -149,14 +151,21 @@ namespace Wasm
 		INST_F64_SUB = 0xA1,
 		INST_F64_MUL = 0xA2,
 		INST_F64_DIV = 0xA3,
+		INST_F64_MIN = 0xA4,
+		INST_F64_MAX = 0xA5,
 		INST_I32_WRAP_I64 = 0xA7,
 		INST_I32_TRUNC_F32_S = 0xA8,
 		INST_I64_EXTEND_I32_S = 0xAC,
 		INST_I64_EXTEND_I32_U = 0xAD,
 		INST_F32_CONVERT_I32_S = 0xB2,
 		INST_F32_DEMOTE_F64 = 0xB6,
+		INST_F64_CONVERT_I32_S = 0xB7,
 		INST_F64_CONVERT_I64_S = 0xB9,
 		INST_F64_PROMOTE_F32 = 0xBB,
+		INST_I32_REINTERPRET_F32 = 0xBC,
+		INST_I64_REINTERPRET_F64 = 0xBD,
+		INST_F32_REINTERPRET_I32 = 0xBE,
+		INST_F64_REINTERPRET_I64 = 0xBF,
 		INST_I32x4_TRUNC_SAT_F32x4_S = 0xF8,
 		INST_F32x4_CONVERT_I32x4_S = 0xFA
 	};
@@ -181,7 +190,9 @@ namespace Wasm
 		INST_I8x16_EXTRACT_LANE_U = 0x16,
 		INST_I8x16_REPLACE_LANE = 0x17,
 		INST_I32x4_EXTRACT_LANE = 0x1B,
+		INST_I32x4_REPLACE_LANE = 0x1C,
 		INST_F32x4_EXTRACT_LANE = 0x1F,
+		INST_F32x4_REPLACE_LANE = 0x20,
 		INST_I8x16_EQ = 0x23,
 		INST_I8x16_GT_S = 0x27,
 		INST_I16x8_EQ = 0x2D,
@@ -213,6 +224,7 @@ namespace Wasm
 		INST_I16x8_SUB = 0x91,
 		INST_I16x8_SUB_SAT_S = 0x92,
 		INST_I16x8_SUB_SAT_U = 0x93,
+		INST_I16x8_MUL = 0x95,
 		INST_I16x8_MIN_S = 0x96,
 		INST_I16x8_MAX_S = 0x98,
 		INST_I32x4_SHL = 0xAB,
@@ -220,9 +232,16 @@ namespace Wasm
 		INST_I32x4_SHR_U = 0xAD,
 		INST_I32x4_ADD = 0xAE,
 		INST_I32x4_SUB = 0xB1,
+		INST_I32x4_MUL = 0xB5,
 		INST_I32x4_MIN_S = 0xB6,
 		INST_I32x4_MIN_U = 0xB7,
 		INST_I32x4_MAX_S = 0xB8,
+		INST_I32x4_EXTMUL_LOW_I16x8_S = 0xBC,
+		INST_I32x4_EXTMUL_HIGH_I16x8_S = 0xBD,
+		INST_I32x4_EXTMUL_LOW_I16x8_U = 0xBE,
+		INST_I32x4_EXTMUL_HIGH_I16x8_U = 0xBF,
+		INST_I64x2_EXTMUL_LOW_I32x4_S = 0xDC,
+		INST_I64x2_EXTMUL_LOW_I32x4_U = 0xDE,
 		INST_F32x4_ABS = 0xE0,
 		INST_F32x4_NEG = 0xE1,
 		INST_F32x4_SQRT = 0xE3,
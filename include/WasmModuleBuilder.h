@@ -20,6 +20,7 @@ public:
 		uint32 localI32Count = 0;
 		uint32 localI64Count = 0;
 		uint32 localF32Count = 0;
+		uint32 localF64Count = 0;
 		uint32 localV128Count = 0;
 	};
 
@@ -62,6 +62,18 @@ public:
 		xMM15,
 	};
 
+	enum OPMASKREGISTER
+	{
+		kMASK0 = 0,
+		kMASK1,
+		kMASK2,
+		kMASK3,
+		kMASK4,
+		kMASK5,
+		kMASK6,
+		kMASK7,
+	};
+
 	typedef unsigned int LABEL;
 	typedef unsigned int LITERAL128ID;
 
@@ -135,9 +147,19 @@ public:
 	void MarkLabel(LABEL, int32 = 0);
 	uint32 GetLabelOffset(LABEL) const;
 
+	//Pads with NOPs before the label so that its start is aligned on the specified boundary (power of 2)
+	void AlignLabel(LABEL, uint32);
+
+	//Pads jumps to labels so that they don't cross or end on a 32-byte boundary (Intel JCC erratum)
+	void SetJccErratumPaddingEnabled(bool);
+
+	//Returns the same id for all uses of a literal within the function
 	LITERAL128ID CreateLiteral128(const LITERAL128&);
 	void ResolveLiteralReferences();
 
+	//Writes the distance between a label and the start of the current label (needs to be baseLabel)
+	void DdLabelOffset(LABEL, LABEL baseLabel);
+
 	void AdcEd(REGISTER, const CAddress&);
 	void AdcId(const CAddress&, uint32);
 	void AddEd(REGISTER, const CAddress&);
@@ -149,12 +171,22 @@ public:
 	void AndIb(const CAddress&, uint8);
 	void AndId(const CAddress&, uint32);
 	void AndIq(const CAddress&, uint64);
+	void BsfEd(REGISTER, const CAddress&);
 	void BsrEd(REGISTER, const CAddress&);
+	void BswapEd(REGISTER);
+	void BswapEq(REGISTER);
 	void CallEd(const CAddress&);
 	void CmoveEd(REGISTER, const CAddress&);
 	void CmovneEd(REGISTER, const CAddress&);
+	void CmovneEq(REGISTER, const CAddress&);
 	void CmovleEd(REGISTER, const CAddress&);
 	void CmovgEd(REGISTER, const CAddress&);
+	void CmovlEd(REGISTER, const CAddress&);
+	void CmovgeEd(REGISTER, const CAddress&);
+	void CmovbEd(REGISTER, const CAddress&);
+	void CmovbeEd(REGISTER, const CAddress&);
+	void CmovaEd(REGISTER, const CAddress&);
+	void CmovaeEd(REGISTER, const CAddress&);
 	void CmovsEd(REGISTER, const CAddress&);
 	void CmovnsEd(REGISTER, const CAddress&);
 	void CmpEd(REGISTER, const CAddress&);
@@ -163,10 +195,14 @@ public:
 	void CmpId(const CAddress&, uint32);
 	void CmpIq(const CAddress&, uint64);
 	void Cdq();
+	void Cqo();
 	void DivEd(const CAddress&);
+	void DivEq(const CAddress&);
 	void IdivEd(const CAddress&);
+	void IdivEq(const CAddress&);
 	void ImulEw(const CAddress&);
 	void ImulEd(const CAddress&);
+	void ImulEq(REGISTER, const CAddress&);
 	void Int3();
 	void JbJx(LABEL);
 	void JbeJx(LABEL);
@@ -183,7 +219,11 @@ public:
 	void JnoJx(LABEL);
 	void JnsJx(LABEL);
 	void LeaGd(REGISTER, const CAddress&);
+	//No rIP relative addressing in 32-bit mode, this is emitted as a call/pop/add sequence
+	void LeaGd(REGISTER, LABEL);
 	void LeaGq(REGISTER, const CAddress&);
+	void LeaGq(REGISTER, LABEL);
+	void LzcntEd(REGISTER, const CAddress&);
 	void MovEw(REGISTER, const CAddress&);
 	void MovEd(REGISTER, const CAddress&);
 	void MovEq(REGISTER, const CAddress&);
@@ -198,27 +238,46 @@ public:
 	void MovIw(const CAddress&, uint16);
 	void MovId(const CAddress&, uint32);
 	void MovIq(const CAddress&, uint32);
+	void MovbeEd(REGISTER, const CAddress&);
+	void MovbeEq(REGISTER, const CAddress&);
 	void MovsxEb(REGISTER, const CAddress&);
 	void MovsxEw(REGISTER, const CAddress&);
+	void MovsxdEq(REGISTER, const CAddress&);
 	void MovzxEb(REGISTER, const CAddress&);
 	void MovzxEw(REGISTER, const CAddress&);
 	void MulEd(const CAddress&);
 	void NegEd(const CAddress&);
 	void Nop();
 	void NotEd(const CAddress&);
+	void NotEq(const CAddress&);
 	void OrEd(REGISTER, const CAddress&);
+	void OrEq(REGISTER, const CAddress&);
 	void OrId(const CAddress&, uint32);
+	void OrIq(const CAddress&, uint64);
 	void Pop(REGISTER);
+	void PopcntEd(REGISTER, const CAddress&);
 	void Push(REGISTER);
 	void PushEd(const CAddress&);
 	void PushId(uint32);
 	void RclEd(const CAddress&, uint8);
 	void RepMovsb();
 	void Ret();
+	void RolEd(const CAddress&);
+	void RolEd(const CAddress&, uint8);
+	void RolEq(const CAddress&);
+	void RolEq(const CAddress&, uint8);
+	void RorEd(const CAddress&);
+	void RorEd(const CAddress&, uint8);
+	void RorEq(const CAddress&);
+	void RorEq(const CAddress&, uint8);
+	void RorxEd(REGISTER, const CAddress&, uint8);
+	void RorxEq(REGISTER, const CAddress&, uint8);
 	void SarEd(const CAddress&);
 	void SarEd(const CAddress&, uint8);
 	void SarEq(const CAddress&);
 	void SarEq(const CAddress&, uint8);
+	void SarxEd(REGISTER, const CAddress&, REGISTER);
+	void SarxEq(REGISTER, const CAddress&, REGISTER);
 	void SbbEd(REGISTER, const CAddress&);
 	void SbbId(const CAddress&, uint32);
 	void SetaEb(const CAddress&);
@@ -235,12 +294,16 @@ public:
 	void ShrEd(const CAddress&, uint8);
 	void ShrEq(const CAddress&);
 	void ShrEq(const CAddress&, uint8);
+	void ShrxEd(REGISTER, const CAddress&, REGISTER);
+	void ShrxEq(REGISTER, const CAddress&, REGISTER);
 	void ShrdEd(const CAddress&, REGISTER);
 	void ShrdEd(const CAddress&, REGISTER, uint8);
 	void ShlEd(const CAddress&);
 	void ShlEd(const CAddress&, uint8);
 	void ShlEq(const CAddress&);
 	void ShlEq(const CAddress&, uint8);
+	void ShlxEd(REGISTER, const CAddress&, REGISTER);
+	void ShlxEq(REGISTER, const CAddress&, REGISTER);
 	void ShldEd(const CAddress&, REGISTER);
 	void ShldEd(const CAddress&, REGISTER, uint8);
 	void SubEd(REGISTER, const CAddress&);
@@ -250,8 +313,12 @@ public:
 	void TestEb(BYTEREGISTER, const CAddress&);
 	void TestEd(REGISTER, const CAddress&);
 	void TestEq(REGISTER, const CAddress&);
+	void TestId(const CAddress&, uint32);
+	void TzcntEd(REGISTER, const CAddress&);
 	void XorEd(REGISTER, const CAddress&);
+	void XorEq(REGISTER, const CAddress&);
 	void XorId(const CAddress&, uint32);
+	void XorIq(const CAddress&, uint64);
 	void XorGd(const CAddress&, REGISTER);
 	void XorGq(const CAddress&, REGISTER);
 
@@ -261,6 +328,10 @@ public:
 	void FstpEd(const CAddress&);
 	void FistpEd(const CAddress&);
 	void FisttpEd(const CAddress&);
+	void FldEq(const CAddress&);
+	void FildEq(const CAddress&);
+	void FstpEq(const CAddress&);
+	void FisttpEq(const CAddress&);
 	void FaddpSt(uint8);
 	void FsubpSt(uint8);
 	void FmulpSt(uint8);
@@ -287,6 +358,7 @@ public:
 	void MovdVo(XMMREGISTER, const CAddress&);
 	void MovdVo(const CAddress&, XMMREGISTER);
 	void MovqVo(XMMREGISTER, const CAddress&);
+	void MovqVo(const CAddress&, XMMREGISTER);
 	void MovdqaVo(XMMREGISTER, const CAddress&);
 	void MovdqaVo(const CAddress&, XMMREGISTER);
 	void MovdquVo(XMMREGISTER, const CAddress&);
@@ -317,12 +389,20 @@ public:
 	void PcmpgtbVo(XMMREGISTER, const CAddress&);
 	void PcmpgtwVo(XMMREGISTER, const CAddress&);
 	void PcmpgtdVo(XMMREGISTER, const CAddress&);
+	void PextrdVo(const CAddress&, XMMREGISTER, uint8);
+	void PinsrdVo(XMMREGISTER, const CAddress&, uint8);
 	void PmaxswVo(XMMREGISTER, const CAddress&);
 	void PmaxsdVo(XMMREGISTER, const CAddress&);
 	void PminswVo(XMMREGISTER, const CAddress&);
 	void PminsdVo(XMMREGISTER, const CAddress&);
 	void PminudVo(XMMREGISTER, const CAddress&);
 	void PmovmskbVo(REGISTER, XMMREGISTER);
+	void PmuldqVo(XMMREGISTER, const CAddress&);
+	void PmulhwVo(XMMREGISTER, const CAddress&);
+	void PmulhuwVo(XMMREGISTER, const CAddress&);
+	void PmulldVo(XMMREGISTER, const CAddress&);
+	void PmullwVo(XMMREGISTER, const CAddress&);
+	void PmuludqVo(XMMREGISTER, const CAddress&);
 	void PorVo(XMMREGISTER, const CAddress&);
 	void PshufbVo(XMMREGISTER, const CAddress&);
 	void PshufdVo(XMMREGISTER, const CAddress&, uint8);
@@ -332,6 +412,10 @@ public:
 	void PsradVo(XMMREGISTER, uint8);
 	void PsrlwVo(XMMREGISTER, uint8);
 	void PsrldVo(XMMREGISTER, uint8);
+	void PsllqVo(XMMREGISTER, uint8);
+	void PsrlqVo(XMMREGISTER, uint8);
+	void PslldqVo(XMMREGISTER, uint8);
+	void PsrldqVo(XMMREGISTER, uint8);
 
 	void PsubbVo(XMMREGISTER, const CAddress&);
 	void PsubsbVo(XMMREGISTER, const CAddress&);
@@ -340,6 +424,7 @@ public:
 	void PsubswVo(XMMREGISTER, const CAddress&);
 	void PsubuswVo(XMMREGISTER, const CAddress&);
 	void PsubdVo(XMMREGISTER, const CAddress&);
+	void PsubqVo(XMMREGISTER, const CAddress&);
 
 	void PunpcklbwVo(XMMREGISTER, const CAddress&);
 	void PunpcklwdVo(XMMREGISTER, const CAddress&);
@@ -369,14 +454,36 @@ public:
 	void Cvtdq2psVo(XMMREGISTER, const CAddress&);
 	void Cvttps2dqVo(XMMREGISTER, const CAddress&);
 
+	void MovsdEd(const CAddress&, XMMREGISTER);
+	void MovsdEd(XMMREGISTER, const CAddress&);
+	void AddsdEd(XMMREGISTER, const CAddress&);
+	void SubsdEd(XMMREGISTER, const CAddress&);
+	void MaxsdEd(XMMREGISTER, const CAddress&);
+	void MinsdEd(XMMREGISTER, const CAddress&);
+	void MulsdEd(XMMREGISTER, const CAddress&);
+	void DivsdEd(XMMREGISTER, const CAddress&);
+	void SqrtsdEd(XMMREGISTER, const CAddress&);
+	void CmpsdEd(XMMREGISTER, const CAddress&, SSE_CMP_TYPE);
+	void Cvtss2sdEd(XMMREGISTER, const CAddress&);
+	void Cvtsd2ssEd(XMMREGISTER, const CAddress&);
+	void Cvtsi2sdEd(XMMREGISTER, const CAddress&);
+	void Cvtsi2sdEq(XMMREGISTER, const CAddress&);
+	void Cvttsd2siEd(REGISTER, const CAddress&);
+	void Cvttsd2siEq(REGISTER, const CAddress&);
+
 	void AddpsVo(XMMREGISTER, const CAddress&);
 	void BlendpsVo(XMMREGISTER, const CAddress&, uint8);
 	void DivpsVo(XMMREGISTER, const CAddress&);
+	void DppsVo(XMMREGISTER, const CAddress&, uint8);
+	void HaddpsVo(XMMREGISTER, const CAddress&);
+	void InsertpsVo(XMMREGISTER, const CAddress&, uint8);
 	void MaxpsVo(XMMREGISTER, const CAddress&);
 	void MinpsVo(XMMREGISTER, const CAddress&);
 	void MulpsVo(XMMREGISTER, const CAddress&);
 	void SubpsVo(XMMREGISTER, const CAddress&);
 	void ShufpsVo(XMMREGISTER, const CAddress&, uint8);
+	void SqrtpsVo(XMMREGISTER, const CAddress&);
+	void XorpsVo(XMMREGISTER, const CAddress&);
 
 	//AVX
 	void VmovdVo(XMMREGISTER, const CAddress&);
@@ -399,9 +506,30 @@ public:
 
 	void VsqrtssEd(XMMREGISTER, XMMREGISTER, const CAddress&);
 
+	void Vfmadd231ssEd(XMMREGISTER, XMMREGISTER, const CAddress&);
+
 	void Vcvtsi2ssEd(XMMREGISTER, const CAddress&);
 	void Vcvttss2siEd(REGISTER, const CAddress&);
 
+	void VmovsdEd(XMMREGISTER, const CAddress&);
+	void VmovsdEd(const CAddress&, XMMREGISTER);
+
+	void VaddsdEd(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void VsubsdEd(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void VmulsdEd(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void VdivsdEd(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void VmaxsdEd(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void VminsdEd(XMMREGISTER, XMMREGISTER, const CAddress&);
+
+	void VcmpsdEd(XMMREGISTER, XMMREGISTER, const CAddress&, SSE_CMP_TYPE);
+
+	void VsqrtsdEd(XMMREGISTER, XMMREGISTER, const CAddress&);
+
+	void Vcvtss2sdEd(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void Vcvtsd2ssEd(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void Vcvtsi2sdEd(XMMREGISTER, const CAddress&);
+	void Vcvttsd2siEd(REGISTER, const CAddress&);
+
 	void VmovdqaVo(XMMREGISTER, const CAddress&);
 	void VmovdqaVo(const CAddress&, XMMREGISTER);
 	void VmovdquVo(XMMREGISTER, const CAddress&);
@@ -438,6 +566,8 @@ public:
 
 	void VpslldVo(XMMREGISTER, XMMREGISTER, uint8);
 	void VpsrldVo(XMMREGISTER, XMMREGISTER, uint8);
+	void VpsllqVo(XMMREGISTER, XMMREGISTER, uint8);
+	void VpsrlqVo(XMMREGISTER, XMMREGISTER, uint8);
 	void VpsradVo(XMMREGISTER, XMMREGISTER, uint8);
 
 	void VpcmpeqbVo(XMMREGISTER, XMMREGISTER, const CAddress&);
@@ -456,6 +586,13 @@ public:
 
 	void VpminudVo(XMMREGISTER, XMMREGISTER, const CAddress&);
 
+	void VpmullwVo(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void VpmulhwVo(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void VpmulhuwVo(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void VpmulldVo(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void VpmuldqVo(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void VpmuludqVo(XMMREGISTER, XMMREGISTER, const CAddress&);
+
 	void VpackssdwVo(XMMREGISTER, XMMREGISTER, const CAddress&);
 	void VpackuswbVo(XMMREGISTER, XMMREGISTER, const CAddress&);
 
@@ -467,6 +604,10 @@ public:
 	void VpunpckhdqVo(XMMREGISTER, XMMREGISTER, const CAddress&);
 
 	void VpshufbVo(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void VpshufdVo(XMMREGISTER, const CAddress&, uint8);
+	void VpextrdVo(const CAddress&, XMMREGISTER, uint8);
+	void VpinsrdVo(XMMREGISTER, XMMREGISTER, const CAddress&, uint8);
+	void VinsertpsVo(XMMREGISTER, XMMREGISTER, const CAddress&, uint8);
 	void VpmovmskbVo(REGISTER, XMMREGISTER);
 	void VpbroadcastdVo(XMMREGISTER, const CAddress&);
 
@@ -475,6 +616,12 @@ public:
 	void VmulpsVo(XMMREGISTER, XMMREGISTER, const CAddress&);
 	void VdivpsVo(XMMREGISTER, XMMREGISTER, const CAddress&);
 
+	void Vfmadd231psVo(XMMREGISTER, XMMREGISTER, const CAddress&);
+
+	void VsqrtpsVo(XMMREGISTER, const CAddress&);
+	void VhaddpsVo(XMMREGISTER, XMMREGISTER, const CAddress&);
+	void VdppsVo(XMMREGISTER, XMMREGISTER, const CAddress&, uint8);
+
 	void VcmpltpsVo(XMMREGISTER, XMMREGISTER, const CAddress&);
 	void VcmpgtpsVo(XMMREGISTER, XMMREGISTER, const CAddress&);
 
@@ -483,12 +630,19 @@ public:
 
 	void Vcvtdq2psVo(XMMREGISTER, const CAddress&);
 	void Vcvttps2dqVo(XMMREGISTER, const CAddress&);
+	void Vcvtdq2pdVo(XMMREGISTER, const CAddress&);
+	void Vcvttpd2dqVo(XMMREGISTER, const CAddress&);
 
 	void VcmppsVo(XMMREGISTER, XMMREGISTER, const CAddress&, SSE_CMP_TYPE);
 
 	void VblendpsVo(XMMREGISTER, XMMREGISTER, const CAddress&, uint8);
 	void VshufpsVo(XMMREGISTER, XMMREGISTER, const CAddress&, uint8);
 
+	//AVX-512
+	void KmovwKd(OPMASKREGISTER, REGISTER);
+	void Vmovdqa32Vo(const CAddress&, XMMREGISTER, OPMASKREGISTER);
+	void VpternlogdVo(XMMREGISTER, XMMREGISTER, const CAddress&, uint8);
+
 private:
 	enum JMP_TYPE
 	{
@@ -523,11 +677,15 @@ private:
 	enum VEX_OPCODE_MAP : uint8
 	{
 		VEX_OPCODE_MAP_NONE = 0x01,
+		VEX_OPCODE_MAP_38 = 0x02,
 		VEX_OPCODE_MAP_66 = 0x11,
 		VEX_OPCODE_MAP_66_38 = 0x12,
 		VEX_OPCODE_MAP_66_3A = 0x13,
 		VEX_OPCODE_MAP_F3 = 0x21,
-		VEX_OPCODE_MAP_F2 = 0x31
+		VEX_OPCODE_MAP_F3_38 = 0x22,
+		VEX_OPCODE_MAP_F2 = 0x31,
+		VEX_OPCODE_MAP_F2_38 = 0x32,
+		VEX_OPCODE_MAP_F2_3A = 0x33
 	};
 
 	struct LABELREF
@@ -535,6 +693,9 @@ private:
 		LABELREF()
 		    : label(0)
 		    , offset(0)
+		    , fusedOffset(0)
+		    , projectedOffset(0)
+		    , padding(0)
 		    , type(JMP_ALWAYS)
 		    , length(JMP_NOTSET)
 		{
@@ -542,6 +703,10 @@ private:
 
 		LABEL label;
 		uint32 offset;
+		//Start of the compare macro-fused with this jump, same as offset if there is none
+		uint32 fusedOffset;
+		uint32 projectedOffset;
+		uint32 padding;
 		JMP_TYPE type;
 		JMP_LENGTH length;
 	};
@@ -551,9 +716,19 @@ private:
 	struct LITERAL128REF
 	{
 		uint32 offset = 0;
-		LITERAL128 value = LITERAL128(0, 0);
+		LITERAL128ID literalId = 0;
+	};
+	typedef std::vector<LITERAL128REF> Literal128RefArray;
+	typedef std::map<LITERAL128, LITERAL128ID> Literal128IdMap;
+	typedef std::map<LITERAL128ID, LITERAL128> Literal128Map;
+
+	struct LABELDISTANCEREF
+	{
+		LABEL label = 0;
+		uint32 offset = 0;
+		uint32 origin = 0;
 	};
-	typedef std::map<LITERAL128ID, LITERAL128REF> Literal128Refs;
+	typedef std::vector<LABELDISTANCEREF> LabelDistanceRefArray;
 
 	struct LABELINFO
 	{
@@ -561,14 +736,19 @@ private:
 		    : start(0)
 		    , size(0)
 		    , projectedStart(0)
+		    , alignment(0)
+		    , padding(0)
 		{
 		}
 
 		uint32 start;
 		uint32 size;
 		uint32 projectedStart;
+		uint32 alignment;
+		uint32 padding;
 		LabelRefArray labelRefs;
-		Literal128Refs literal128Refs;
+		Literal128RefArray literal128Refs;
+		LabelDistanceRefArray labelDistanceRefs;
 	};
 
 	typedef std::map<LABEL, LABELINFO> LabelMap;
@@ -595,20 +775,26 @@ private:
 	void WriteEdVdOp_66_0F_38(uint8, const CAddress&, XMMREGISTER);
 	void WriteEdVdOp_66_0F_3A(uint8, const CAddress&, XMMREGISTER);
 	void WriteEdVdOp_F3_0F(uint8, const CAddress&, XMMREGISTER);
+	void WriteEdVdOp_F2_0F(uint8, const CAddress&, XMMREGISTER, bool = false);
 	void WriteVrOp_66_0F(uint8, uint8, XMMREGISTER);
 	void WriteVexVoOp(VEX_OPCODE_MAP, uint8, XMMREGISTER, XMMREGISTER, const CAddress&);
 	void WriteVexShiftVoOp(uint8, uint8, XMMREGISTER, XMMREGISTER, uint8);
+	void WriteVexGvOp(VEX_OPCODE_MAP, uint8, bool, REGISTER, REGISTER, const CAddress&);
+	void WriteEvexVoOp(VEX_OPCODE_MAP, uint8, bool, XMMREGISTER, XMMREGISTER, const CAddress&, OPMASKREGISTER = kMASK0);
 	void WriteStOp(uint8, uint8, uint8);
 
 	void CreateLabelReference(LABEL, JMP_TYPE);
+	void MarkFusibleCompare(uint32);
 
-	void IncrementJumpOffsetsLocal(LABELINFO&, LabelRefArray::iterator, unsigned int);
-	void IncrementJumpOffsets(LabelArray::const_iterator, unsigned int);
+	void UpdateProjectedOffsets();
 
 	static unsigned int GetJumpSize(JMP_TYPE, JMP_LENGTH);
 	static void WriteJump(Framework::CStream*, JMP_TYPE, JMP_LENGTH, uint32);
+	static void WriteNops(Framework::CStream*, uint32);
 
 	void WriteLiteralPlaceholder(const CAddress&);
+	void WriteLabelDistancePlaceholder(LABEL, uint32);
+	void ResolveLabelDistanceReferences();
 
 	void WriteByte(uint8);
 	void WriteWord(uint16);
@@ -618,7 +804,12 @@ private:
 	LabelArray m_labelOrder;
 	LABEL m_nextLabelId = 1;
 	LITERAL128ID m_nextLiteral128Id = 1;
+	Literal128IdMap m_literal128Ids;
+	Literal128Map m_literal128s;
 	LABELINFO* m_currentLabel = nullptr;
+	bool m_jccErratumPaddingEnabled = false;
+	uint32 m_fusibleCompareStart = 0;
+	uint32 m_fusibleCompareEnd = 0;
 	Framework::CStream* m_outputStream = nullptr;
 	Framework::CMemStream m_tmpStream;
 	ByteArray m_copyBuffer;
@@ -7,6 +7,14 @@ public:
 	bool hasSse41 = false;
 	bool hasAvx = false;
 	bool hasAvx2 = false;
+	bool hasFma = false;
+	bool hasPopcnt = false;
+	bool hasMovbe = false;
+	bool hasBmi1 = false;
+	bool hasBmi2 = false;
+	bool hasLzcnt = false;
+	//AVX-512 F, VL, DQ and BW
+	bool hasAvx512 = false;
 
 	static CX86CpuFeatures AutoDetect();
 };
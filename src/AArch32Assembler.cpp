@@ -391,6 +391,13 @@ void CAArch32Assembler::Ldrd(REGISTER rt, REGISTER rn, const LdrAddress& address
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Mla(REGISTER rd, REGISTER rn, REGISTER rm, REGISTER ra)
+{
+	uint32 opcode = 0;
+	opcode = (CONDITION_AL << 28) | (0x01 << 21) | (rd << 16) | (ra << 12) | (rm << 8) | (0x9 << 4) | (rn << 0);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Mov(REGISTER rd, REGISTER rm)
 {
 	MovCc(CONDITION_AL, rd, rm);
@@ -461,6 +468,13 @@ void CAArch32Assembler::Movt(REGISTER rd, uint16 value)
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Mul(REGISTER rd, REGISTER rn, REGISTER rm)
+{
+	uint32 opcode = 0;
+	opcode = (CONDITION_AL << 28) | (rd << 16) | (rm << 8) | (0x9 << 4) | (rn << 0);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Mvn(REGISTER rd, REGISTER rm)
 {
 	InstructionAlu instruction;
@@ -503,6 +517,24 @@ void CAArch32Assembler::Or(CONDITION cc, REGISTER rd, REGISTER rn, const Immedia
 	GenericAlu(ALU_OPCODE_ORR, false, rd, rn, operand, cc);
 }
 
+void CAArch32Assembler::Rbit(REGISTER rd, REGISTER rm)
+{
+	uint32 opcode = 0x06FF0F30;
+	opcode |= CONDITION_AL << 28;
+	opcode |= rm;
+	opcode |= (rd << 12);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Rev(REGISTER rd, REGISTER rm)
+{
+	uint32 opcode = 0x06BF0F30;
+	opcode |= CONDITION_AL << 28;
+	opcode |= rm;
+	opcode |= (rd << 12);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Rsb(REGISTER rd, REGISTER rn, const ImmediateAluOperand& operand)
 {
 	GenericAlu(ALU_OPCODE_RSB, false, rd, rn, operand);
@@ -718,6 +750,19 @@ void CAArch32Assembler::Vldr(SINGLE_REGISTER sd, REGISTER rbase, const LdrAddres
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vldr(DOUBLE_REGISTER dd, REGISTER rbase, const LdrAddress& address)
+{
+	assert(address.isImmediate);
+	assert(!address.isNegative);
+	assert((address.immediate / 4) <= 0xFF);
+
+	uint32 opcode = 0x0D900B00;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= (static_cast<uint32>(rbase) << 16) | (static_cast<uint32>(address.immediate / 4));
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vld1_32x2(DOUBLE_REGISTER dd, REGISTER rn)
 {
 	//TODO: Make this aligned
@@ -758,6 +803,19 @@ void CAArch32Assembler::Vstr(SINGLE_REGISTER sd, REGISTER rbase, const LdrAddres
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vstr(DOUBLE_REGISTER dd, REGISTER rbase, const LdrAddress& address)
+{
+	assert(address.isImmediate);
+	assert(!address.isNegative);
+	assert((address.immediate / 4) <= 0xFF);
+
+	uint32 opcode = 0x0D800B00;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= (static_cast<uint32>(rbase) << 16) | (static_cast<uint32>(address.immediate / 4));
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vst1_32x4(QUAD_REGISTER qd, REGISTER rn)
 {
 	uint32 opcode = 0xF4000AAF;
@@ -786,6 +844,15 @@ void CAArch32Assembler::Vmov(REGISTER rt, DOUBLE_REGISTER dn, uint8 offset)
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::VmovCc_F64(CONDITION condition, DOUBLE_REGISTER dd, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0x0EB00B40;
+	opcode |= (condition << 28);
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vmovn_I16(DOUBLE_REGISTER dd, QUAD_REGISTER qm)
 {
 	uint32 opcode = 0xF3B20200;
@@ -802,6 +869,14 @@ void CAArch32Assembler::Vmovn_I32(DOUBLE_REGISTER dd, QUAD_REGISTER qm)
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vmovn_I64(DOUBLE_REGISTER dd, QUAD_REGISTER qm)
+{
+	uint32 opcode = 0xF3BA0200;
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeQm(qm);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vdup(QUAD_REGISTER qd, REGISTER rt)
 {
 	uint32 opcode = 0x0EA00B10;
@@ -845,6 +920,14 @@ void CAArch32Assembler::Vzip_I32(QUAD_REGISTER qd, QUAD_REGISTER qm)
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vuzp_I16(QUAD_REGISTER qd, QUAD_REGISTER qm)
+{
+	uint32 opcode = 0xF3B60140;
+	opcode |= FPSIMD_EncodeQd(qd);
+	opcode |= FPSIMD_EncodeQm(qm);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vtbl(DOUBLE_REGISTER dd, DOUBLE_REGISTER dn, DOUBLE_REGISTER dm)
 {
 	uint32 opcode = 0xF3B00B00;
@@ -873,6 +956,16 @@ void CAArch32Assembler::Vadd_F32(QUAD_REGISTER qd, QUAD_REGISTER qn, QUAD_REGIST
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vadd_F64(DOUBLE_REGISTER dd, DOUBLE_REGISTER dn, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0x0E300B00;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeDn(dn);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vadd_I8(QUAD_REGISTER qd, QUAD_REGISTER qn, QUAD_REGISTER qm)
 {
 	uint32 opcode = 0xF2000840;
@@ -900,6 +993,15 @@ void CAArch32Assembler::Vadd_I32(QUAD_REGISTER qd, QUAD_REGISTER qn, QUAD_REGIST
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vpadd_F32(DOUBLE_REGISTER dd, DOUBLE_REGISTER dn, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0xF3000D00;
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeDn(dn);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vpaddl_U8(QUAD_REGISTER qd, QUAD_REGISTER qm)
 {
 	uint32 opcode = 0xF3B002C0;
@@ -924,6 +1026,14 @@ void CAArch32Assembler::Vpaddl_U32(QUAD_REGISTER qd, QUAD_REGISTER qm)
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vcnt_I8(QUAD_REGISTER qd, QUAD_REGISTER qm)
+{
+	uint32 opcode = 0xF3B00540;
+	opcode |= FPSIMD_EncodeQd(qd);
+	opcode |= FPSIMD_EncodeQm(qm);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vqadd_U8(QUAD_REGISTER qd, QUAD_REGISTER qn, QUAD_REGISTER qm)
 {
 	uint32 opcode = 0xF3000050;
@@ -997,6 +1107,16 @@ void CAArch32Assembler::Vsub_F32(QUAD_REGISTER qd, QUAD_REGISTER qn, QUAD_REGIST
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vsub_F64(DOUBLE_REGISTER dd, DOUBLE_REGISTER dn, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0x0E300B40;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeDn(dn);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vsub_I8(QUAD_REGISTER qd, QUAD_REGISTER qn, QUAD_REGISTER qm)
 {
 	uint32 opcode = 0xF3000840;
@@ -1097,6 +1217,16 @@ void CAArch32Assembler::Vmul_F32(QUAD_REGISTER qd, QUAD_REGISTER qn, QUAD_REGIST
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vmul_F64(DOUBLE_REGISTER dd, DOUBLE_REGISTER dn, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0x0E200B00;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeDn(dn);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vdiv_F32(SINGLE_REGISTER sd, SINGLE_REGISTER sn, SINGLE_REGISTER sm)
 {
 	uint32 opcode = 0x0E800A00;
@@ -1107,6 +1237,16 @@ void CAArch32Assembler::Vdiv_F32(SINGLE_REGISTER sd, SINGLE_REGISTER sn, SINGLE_
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vdiv_F64(DOUBLE_REGISTER dd, DOUBLE_REGISTER dn, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0x0E800B00;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeDn(dn);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vand(QUAD_REGISTER qd, QUAD_REGISTER qn, QUAD_REGISTER qm)
 {
 	uint32 opcode = 0xF2000150;
@@ -1222,6 +1362,15 @@ void CAArch32Assembler::Vabs_F32(QUAD_REGISTER qd, QUAD_REGISTER qm)
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vabs_F64(DOUBLE_REGISTER dd, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0x0EB00BC0;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vneg_F32(SINGLE_REGISTER sd, SINGLE_REGISTER sm)
 {
 	uint32 opcode = 0x0EB10A40;
@@ -1239,6 +1388,15 @@ void CAArch32Assembler::Vneg_F32(QUAD_REGISTER qd, QUAD_REGISTER qm)
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vneg_F64(DOUBLE_REGISTER dd, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0x0EB10B40;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vsqrt_F32(SINGLE_REGISTER sd, SINGLE_REGISTER sm)
 {
 	uint32 opcode = 0x0EB10AC0;
@@ -1248,6 +1406,15 @@ void CAArch32Assembler::Vsqrt_F32(SINGLE_REGISTER sd, SINGLE_REGISTER sm)
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vsqrt_F64(DOUBLE_REGISTER dd, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0x0EB10BC0;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vceq_I8(QUAD_REGISTER qd, QUAD_REGISTER qn, QUAD_REGISTER qm)
 {
 	uint32 opcode = 0xF3000850;
@@ -1353,6 +1520,15 @@ void CAArch32Assembler::Vcmpz_F32(SINGLE_REGISTER sd)
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vcmp_F64(DOUBLE_REGISTER dd, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0x0EB40B40;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vcvt_F32_S32(SINGLE_REGISTER sd, SINGLE_REGISTER sm)
 {
 	uint32 opcode = 0x0EB80AC0;
@@ -1387,6 +1563,42 @@ void CAArch32Assembler::Vcvt_S32_F32(QUAD_REGISTER qd, QUAD_REGISTER qm)
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vcvt_F64_F32(DOUBLE_REGISTER dd, SINGLE_REGISTER sm)
+{
+	uint32 opcode = 0x0EB70AC0;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeSm(sm);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Vcvt_F32_F64(SINGLE_REGISTER sd, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0x0EB70BC0;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeSd(sd);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Vcvt_F64_S32(DOUBLE_REGISTER dd, SINGLE_REGISTER sm)
+{
+	uint32 opcode = 0x0EB80BC0;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeDd(dd);
+	opcode |= FPSIMD_EncodeSm(sm);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Vcvt_S32_F64(SINGLE_REGISTER sd, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0x0EBD0BC0;
+	opcode |= (CONDITION_AL << 28);
+	opcode |= FPSIMD_EncodeSd(sd);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::Vmrs(REGISTER rt)
 {
 	uint32 opcode = 0x0EF10A10;
@@ -1492,6 +1704,60 @@ void CAArch32Assembler::Vmax_I32(QUAD_REGISTER qd, QUAD_REGISTER qn, QUAD_REGIST
 	WriteWord(opcode);
 }
 
+void CAArch32Assembler::Vmul_I16(QUAD_REGISTER qd, QUAD_REGISTER qn, QUAD_REGISTER qm)
+{
+	uint32 opcode = 0xF2100950;
+	opcode |= FPSIMD_EncodeQd(qd);
+	opcode |= FPSIMD_EncodeQn(qn);
+	opcode |= FPSIMD_EncodeQm(qm);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Vmul_I32(QUAD_REGISTER qd, QUAD_REGISTER qn, QUAD_REGISTER qm)
+{
+	uint32 opcode = 0xF2200950;
+	opcode |= FPSIMD_EncodeQd(qd);
+	opcode |= FPSIMD_EncodeQn(qn);
+	opcode |= FPSIMD_EncodeQm(qm);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Vmull_S16(QUAD_REGISTER qd, DOUBLE_REGISTER dn, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0xF2900C00;
+	opcode |= FPSIMD_EncodeQd(qd);
+	opcode |= FPSIMD_EncodeDn(dn);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Vmull_U16(QUAD_REGISTER qd, DOUBLE_REGISTER dn, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0xF3900C00;
+	opcode |= FPSIMD_EncodeQd(qd);
+	opcode |= FPSIMD_EncodeDn(dn);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Vmull_S32(QUAD_REGISTER qd, DOUBLE_REGISTER dn, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0xF2A00C00;
+	opcode |= FPSIMD_EncodeQd(qd);
+	opcode |= FPSIMD_EncodeDn(dn);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
+void CAArch32Assembler::Vmull_U32(QUAD_REGISTER qd, DOUBLE_REGISTER dn, DOUBLE_REGISTER dm)
+{
+	uint32 opcode = 0xF3A00C00;
+	opcode |= FPSIMD_EncodeQd(qd);
+	opcode |= FPSIMD_EncodeDn(dn);
+	opcode |= FPSIMD_EncodeDm(dm);
+	WriteWord(opcode);
+}
+
 void CAArch32Assembler::WriteWord(uint32 value)
 {
 	m_stream->Write32(value);
@@ -51,6 +51,16 @@ void CAArch64Assembler::CreateCompareBranchLabelReference(LABEL label, CONDITION
 	m_labelReferences.insert(std::make_pair(label, reference));
 }
 
+void CAArch64Assembler::CreateAddressLabelReference(LABEL label, REGISTER64 rd)
+{
+	LABELREF reference;
+	reference.offset = static_cast<size_t>(m_stream->Tell());
+	reference.condition = CONDITION_AL;
+	reference.adr = true;
+	reference.cbRegister = static_cast<REGISTER32>(rd);
+	m_labelReferences.insert(std::make_pair(label, reference));
+}
+
 void CAArch64Assembler::ResolveLabelReferences()
 {
 	for(const auto& labelReferencePair : m_labelReferences)
@@ -65,7 +75,16 @@ void CAArch64Assembler::ResolveLabelReferences()
 		int offset = static_cast<int>(labelPos - labelReference.offset) / 4;
 
 		m_stream->Seek(labelReference.offset, Framework::STREAM_SEEK_SET);
-		if(labelReference.condition == CONDITION_AL)
+		if(labelReference.adr)
+		{
+			int byteOffset = static_cast<int>(labelPos - labelReference.offset);
+			uint32 opcode = 0x10000000;
+			opcode |= (byteOffset & 0x3) << 29;
+			opcode |= ((byteOffset >> 2) & 0x7FFFF) << 5;
+			opcode |= labelReference.cbRegister;
+			WriteWord(opcode);
+		}
+		else if(labelReference.condition == CONDITION_AL)
 		{
 			uint32 opcode = 0x14000000;
 			opcode |= (offset & 0x3FFFFFF);
@@ -184,6 +203,12 @@ void CAArch64Assembler::Add_16b(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Adr(REGISTER64 rd, LABEL label)
+{
+	CreateAddressLabelReference(label, rd);
+	WriteWord(0);
+}
+
 void CAArch64Assembler::And(REGISTER32 rd, REGISTER32 rn, REGISTER32 rm)
 {
 	uint32 opcode = 0x0A000000;
@@ -418,6 +443,14 @@ void CAArch64Assembler::Cmp(REGISTER64 rn, uint16 imm, ADDSUB_IMM_SHIFT_TYPE shi
 	WriteAddSubOpImm(0xF1000000, shift, imm, rn, wZR);
 }
 
+void CAArch64Assembler::Cnt_16b(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x4E205800;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Csel(REGISTER32 rd, REGISTER32 rn, REGISTER32 rm, CONDITION condition)
 {
 	uint32 opcode = 0x1A800000;
@@ -428,6 +461,16 @@ void CAArch64Assembler::Csel(REGISTER32 rd, REGISTER32 rn, REGISTER32 rm, CONDIT
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Csel(REGISTER64 rd, REGISTER64 rn, REGISTER64 rm, CONDITION condition)
+{
+	uint32 opcode = 0x9A800000;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	opcode |= (condition << 12);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Cset(REGISTER32 rd, CONDITION condition)
 {
 	uint32 opcode = 0x1A800400;
@@ -465,6 +508,15 @@ void CAArch64Assembler::Eor(REGISTER32 rd, REGISTER32 rn, REGISTER32 rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Eor(REGISTER64 rd, REGISTER64 rn, REGISTER64 rm)
+{
+	uint32 opcode = 0xCA000000;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Eor(REGISTER32 rd, REGISTER32 rn, uint8 n, uint8 immr, uint8 imms)
 {
 	WriteLogicalOpImm(0x52000000, n, immr, imms, rn, rd);
@@ -479,6 +531,14 @@ void CAArch64Assembler::Eor_16b(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Fabs_1d(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x1E60C000;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Fabs_1s(REGISTERMD rd, REGISTERMD rn)
 {
 	uint32 opcode = 0x1E20C000;
@@ -495,6 +555,15 @@ void CAArch64Assembler::Fabs_4s(REGISTERMD rd, REGISTERMD rn)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Fadd_1d(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x1E602800;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Fadd_1s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 {
 	uint32 opcode = 0x1E202800;
@@ -513,6 +582,15 @@ void CAArch64Assembler::Fadd_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Faddp_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x6E20D400;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Fcmeqz_4s(REGISTERMD rd, REGISTERMD rn)
 {
 	uint32 opcode = 0x4EA0D800;
@@ -547,6 +625,14 @@ void CAArch64Assembler::Fcmltz_4s(REGISTERMD rd, REGISTERMD rn)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Fcmp_1d(REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x1E602000;
+	opcode |= (rn << 5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Fcmp_1s(REGISTERMD rn, REGISTERMD rm)
 {
 	uint32 opcode = 0x1E202000;
@@ -555,6 +641,38 @@ void CAArch64Assembler::Fcmp_1s(REGISTERMD rn, REGISTERMD rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Fcvt_1d_1s(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x1E22C000;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Fcvt_1s_1d(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x1E624000;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Fcvtzs_1d(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x5EE1B800;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Fcvtzs_1d(REGISTER32 rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x1E780000;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Fcvtzs_1s(REGISTERMD rd, REGISTERMD rn)
 {
 	uint32 opcode = 0x5EA1B800;
@@ -571,6 +689,15 @@ void CAArch64Assembler::Fcvtzs_4s(REGISTERMD rd, REGISTERMD rn)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Fdiv_1d(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x1E601800;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Fdiv_1s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 {
 	uint32 opcode = 0x1E201800;
@@ -589,6 +716,33 @@ void CAArch64Assembler::Fdiv_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Fmadd_1s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm, REGISTERMD ra)
+{
+	uint32 opcode = 0x1F000000;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	opcode |= (ra << 10);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Fmla_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x4E20CC00;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Fmov_1d(REGISTERMD rd, REGISTER64 rn)
+{
+	uint32 opcode = 0x9E670000;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Fmov_1s(REGISTERMD rd, REGISTER32 rn)
 {
 	uint32 opcode = 0x1E270000;
@@ -618,6 +772,15 @@ void CAArch64Assembler::Fmov_4s(REGISTERMD rd, uint8 imm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Fmul_1d(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x1E600800;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Fmul_1s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 {
 	uint32 opcode = 0x1E200800;
@@ -636,6 +799,15 @@ void CAArch64Assembler::Fmul_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Fmax_1d(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x1E604800;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Fmax_1s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 {
 	uint32 opcode = 0x1E204800;
@@ -654,6 +826,14 @@ void CAArch64Assembler::Fmax_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Fneg_1d(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x1E614000;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Fneg_1s(REGISTERMD rd, REGISTERMD rn)
 {
 	uint32 opcode = 0x1E214000;
@@ -670,6 +850,15 @@ void CAArch64Assembler::Fneg_4s(REGISTERMD rd, REGISTERMD rn)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Fmin_1d(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x1E605800;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Fmin_1s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 {
 	uint32 opcode = 0x1E205800;
@@ -688,6 +877,14 @@ void CAArch64Assembler::Fmin_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Fsqrt_1d(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x1E61C000;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Fsqrt_1s(REGISTERMD rd, REGISTERMD rn)
 {
 	uint32 opcode = 0x1E21C000;
@@ -696,6 +893,23 @@ void CAArch64Assembler::Fsqrt_1s(REGISTERMD rd, REGISTERMD rn)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Fsqrt_4s(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x6EA1F800;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Fsub_1d(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x1E603800;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Fsub_1s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 {
 	uint32 opcode = 0x1E203800;
@@ -714,6 +928,18 @@ void CAArch64Assembler::Fsub_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Ins_1s(REGISTERMD rd, uint8 index, REGISTER32 rn)
+{
+	assert(index < 4);
+	index &= 0x3;
+	uint8 imm5 = (index << 3) | 0x4;
+	uint32 opcode = 0x4E001C00;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	opcode |= (imm5 << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Ins_1s(REGISTERMD rd, uint8 index1, REGISTERMD rn, uint8 index2)
 {
 	assert(index1 < 4);
@@ -867,6 +1093,14 @@ void CAArch64Assembler::Ldr_Pc(REGISTERMD rt, const LITERAL128& literal)
 	WriteWord(0);
 }
 
+void CAArch64Assembler::Ldr_1d(REGISTERMD rt, REGISTER64 rn, uint32 offset)
+{
+	assert((offset & 0x07) == 0);
+	uint32 scaledOffset = offset / 8;
+	assert(scaledOffset < 0x1000);
+	WriteLoadStoreOpImm(0xFD400000, scaledOffset, rn, rt);
+}
+
 void CAArch64Assembler::Ldr_1s(REGISTERMD rt, REGISTER64 rn, uint32 offset)
 {
 	assert((offset & 0x03) == 0);
@@ -1053,6 +1287,34 @@ void CAArch64Assembler::Msub(REGISTER32 rd, REGISTER32 rn, REGISTER32 rm, REGIST
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Mul(REGISTER64 rd, REGISTER64 rn, REGISTER64 rm)
+{
+	uint32 opcode = 0x9B000000;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	opcode |= (xZR << 10);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Mul_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x4EA09C00;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Mul_8h(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x4E609C00;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Mvn(REGISTER32 rd, REGISTER32 rm)
 {
 	uint32 opcode = 0x2A200000;
@@ -1062,6 +1324,15 @@ void CAArch64Assembler::Mvn(REGISTER32 rd, REGISTER32 rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Mvn(REGISTER64 rd, REGISTER64 rm)
+{
+	uint32 opcode = 0xAA200000;
+	opcode |= (rd << 0);
+	opcode |= (xZR << 5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Mvn_16b(REGISTERMD rd, REGISTERMD rn)
 {
 	uint32 opcode = 0x6E205800;
@@ -1116,6 +1387,15 @@ void CAArch64Assembler::Orr(REGISTER32 rd, REGISTER32 rn, REGISTER32 rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Orr(REGISTER64 rd, REGISTER64 rn, REGISTER64 rm)
+{
+	uint32 opcode = 0xAA000000;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Orr(REGISTER32 rd, REGISTER32 rn, uint8 n, uint8 immr, uint8 imms)
 {
 	WriteLogicalOpImm(0x32000000, n, immr, imms, rn, rd);
@@ -1130,6 +1410,14 @@ void CAArch64Assembler::Orr_16b(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Rbit(REGISTER32 rd, REGISTER32 rn)
+{
+	uint32 opcode = 0x5AC00000;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Ret(REGISTER64 rn)
 {
 	uint32 opcode = 0xD65F0000;
@@ -1137,6 +1425,70 @@ void CAArch64Assembler::Ret(REGISTER64 rn)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Rev(REGISTER32 rd, REGISTER32 rn)
+{
+	uint32 opcode = 0x5AC00800;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Rev(REGISTER64 rd, REGISTER64 rn)
+{
+	uint32 opcode = 0xDAC00C00;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Ror(REGISTER32 rd, REGISTER32 rs, uint8 sa)
+{
+	//EXTR rd, rs, rs, #sa
+	uint32 opcode = 0x13800000;
+	opcode |= (rd << 0);
+	opcode |= (rs << 5);
+	opcode |= ((sa & 0x1F) << 10);
+	opcode |= (rs << 16);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Ror(REGISTER64 rd, REGISTER64 rs, uint8 sa)
+{
+	//EXTR rd, rs, rs, #sa
+	uint32 opcode = 0x93C00000;
+	opcode |= (rd << 0);
+	opcode |= (rs << 5);
+	opcode |= ((sa & 0x3F) << 10);
+	opcode |= (rs << 16);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Rorv(REGISTER32 rd, REGISTER32 rn, REGISTER32 rm)
+{
+	WriteDataProcOpReg2(0x1AC02C00, rm, rn, rd);
+}
+
+void CAArch64Assembler::Rorv(REGISTER64 rd, REGISTER64 rn, REGISTER64 rm)
+{
+	WriteDataProcOpReg2(0x9AC02C00, rm, rn, rd);
+}
+
+void CAArch64Assembler::Scvtf_1d(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x5E61D800;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Scvtf_1d(REGISTERMD rd, REGISTER32 rn)
+{
+	uint32 opcode = 0x1E620000;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Scvtf_1s(REGISTERMD rd, REGISTERMD rn)
 {
 	uint32 opcode = 0x5E21D800;
@@ -1162,6 +1514,15 @@ void CAArch64Assembler::Sdiv(REGISTER32 rd, REGISTER32 rn, REGISTER32 rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Sdiv(REGISTER64 rd, REGISTER64 rn, REGISTER64 rm)
+{
+	uint32 opcode = 0x9AC00C00;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Shl_4s(REGISTERMD rd, REGISTERMD rn, uint8 sa)
 {
 	uint8 immhb = (sa & 0x1F) + 32;
@@ -1228,6 +1589,33 @@ void CAArch64Assembler::Smull(REGISTER64 rd, REGISTER32 rn, REGISTER32 rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Smull_2d(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x0EA0C000;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Smull_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x0E60C000;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Smull2_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x4E60C000;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Sshr_4s(REGISTERMD rd, REGISTERMD rn, uint8 sa)
 {
 	uint8 immhb = (32 * 2) - (sa & 0x1F);
@@ -1407,6 +1795,14 @@ void CAArch64Assembler::Strh(REGISTER32 rt, REGISTER64 rn, REGISTER64 rm, bool s
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Str_1d(REGISTERMD rt, REGISTER64 rn, uint32 offset)
+{
+	assert((offset & 0x07) == 0);
+	uint32 scaledOffset = offset / 8;
+	assert(scaledOffset < 0x1000);
+	WriteLoadStoreOpImm(0xFD000000, scaledOffset, rn, rt);
+}
+
 void CAArch64Assembler::Str_1s(REGISTERMD rt, REGISTER64 rn, uint32 offset)
 {
 	assert((offset & 0x03) == 0);
@@ -1540,6 +1936,15 @@ void CAArch64Assembler::Udiv(REGISTER32 rd, REGISTER32 rn, REGISTER32 rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Udiv(REGISTER64 rd, REGISTER64 rn, REGISTER64 rm)
+{
+	uint32 opcode = 0x9AC00800;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Umin_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 {
 	uint32 opcode = 0x6EA06C00;
@@ -1570,6 +1975,33 @@ void CAArch64Assembler::Umull(REGISTER64 rd, REGISTER32 rn, REGISTER32 rm)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Umull_2d(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x2EA0C000;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Umull_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x2E60C000;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
+void CAArch64Assembler::Umull2_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x6E60C000;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Uqadd_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 {
 	uint32 opcode = 0x6EA00C00;
@@ -1644,6 +2076,14 @@ void CAArch64Assembler::Ushr_8h(REGISTERMD rd, REGISTERMD rn, uint8 sa)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Xtn1_2s(REGISTERMD rd, REGISTERMD rn)
+{
+	uint32 opcode = 0x0EA12800;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Xtn1_4h(REGISTERMD rd, REGISTERMD rn)
 {
 	uint32 opcode = 0x0E612800;
@@ -1676,6 +2116,15 @@ void CAArch64Assembler::Xtn2_16b(REGISTERMD rd, REGISTERMD rn)
 	WriteWord(opcode);
 }
 
+void CAArch64Assembler::Uzp2_8h(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
+{
+	uint32 opcode = 0x4E405800;
+	opcode |= (rd << 0);
+	opcode |= (rn << 5);
+	opcode |= (rm << 16);
+	WriteWord(opcode);
+}
+
 void CAArch64Assembler::Zip1_4s(REGISTERMD rd, REGISTERMD rn, REGISTERMD rm)
 {
 	uint32 opcode = 0x4E803800;
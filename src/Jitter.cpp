@@ -1,4 +1,5 @@
 #include <assert.h>
+#include <cstring>
 #include "Jitter.h"
 #include "placeholder_def.h"
 
@@ -8,6 +9,9 @@ using namespace Jitter;
 CJitter::CJitter(CCodeGen* codeGen)
     : m_codeGen(codeGen)
     , m_codeGenSupportsCmpSelect(codeGen->SupportsCmpSelect())
+    , m_codeGenSupportsJumpTables(codeGen->SupportsJumpTables())
+    , m_codeGenSupportsTestJumps(codeGen->SupportsTestJumps())
+    , m_codeGenSupportsFma(codeGen->SupportsFma())
 {
 }
 
@@ -26,6 +30,11 @@ void CJitter::SetStream(Framework::CStream* stream)
 	m_codeGen->SetStream(stream);
 }
 
+void CJitter::SetFpContractionEnabled(bool enabled)
+{
+	m_fpContractionEnabled = enabled;
+}
+
 void CJitter::Begin()
 {
 	assert(m_blockStarted == false);
@@ -33,6 +42,7 @@ void CJitter::Begin()
 	m_nextTemporary = 1;
 	m_nextBlockId = 1;
 	m_basicBlocks.clear();
+	m_crossBlockTemporaries.clear();
 
 	StartBlock(m_nextBlockId++);
 }
@@ -80,6 +90,42 @@ void CJitter::Goto(LABEL label)
 	InsertStatement(statement);
 }
 
+void CJitter::Switch(const std::vector<LABEL>& labels, LABEL defaultLabel)
+{
+	if(!m_codeGenSupportsJumpTables)
+	{
+		//Dispatch with a sequence of compares instead
+		auto indexSym = m_shadow.Pull();
+		assert(m_shadow.GetCount() == 0);
+		if(indexSym->IsTemporary())
+		{
+			//Every compare is in its own block
+			m_crossBlockTemporaries.insert(indexSym->m_valueLow);
+		}
+		for(uint32 i = 0; i < labels.size(); i++)
+		{
+			m_shadow.Push(indexSym);
+			PushCst(i);
+			BeginIf(CONDITION_EQ);
+			{
+				Goto(labels[i]);
+			}
+			EndIf();
+		}
+		Goto(defaultLabel);
+		return;
+	}
+
+	STATEMENT statement;
+	statement.op = OP_SWITCH;
+	statement.src1 = MakeSymbolRef(m_shadow.Pull());
+	statement.jmpBlock = defaultLabel;
+	statement.jmpTable = std::make_shared<JumpTable>(labels);
+	InsertStatement(statement);
+
+	assert(m_shadow.GetCount() == 0);
+}
+
 void CJitter::BeginIf(CONDITION condition)
 {
 	uint32 jumpBlockId = m_nextBlockId++;
@@ -211,6 +257,16 @@ void CJitter::Break()
 	InsertStatement(statement);
 }
 
+void CJitter::Bswap()
+{
+	InsertUnaryStatement(OP_BSWAP);
+}
+
+void CJitter::Bswap16()
+{
+	InsertUnaryStatement(OP_BSWAP16);
+}
+
 void CJitter::Call(void* func, unsigned int paramCount, RETURN_VALUE_TYPE returnValue)
 {
 	for(unsigned int i = 0; i < paramCount; i++)
@@ -331,7 +387,16 @@ void CJitter::JumpToDynamic(void* func)
 
 void CJitter::Lookup(uint32* table)
 {
-	throw std::exception();
+	auto tempSym = MakeSymbol(SYM_TEMPORARY, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op = OP_LOOKUP;
+	statement.src1 = MakeSymbolRef(MakeConstantPtr(reinterpret_cast<uintptr_t>(table)));
+	statement.src2 = MakeSymbolRef(m_shadow.Pull());
+	statement.dst = MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
 }
 
 void CJitter::Lzc()
@@ -377,6 +442,31 @@ void CJitter::Or()
 	InsertBinaryStatement(OP_OR);
 }
 
+void CJitter::Popcnt()
+{
+	InsertUnaryStatement(OP_POPCNT);
+}
+
+void CJitter::Rotl()
+{
+	InsertBinaryStatement(OP_ROTL);
+}
+
+void CJitter::Rotl(uint8 amount)
+{
+	InsertShiftCstStatement(OP_ROTL, amount);
+}
+
+void CJitter::Rotr()
+{
+	InsertBinaryStatement(OP_ROTR);
+}
+
+void CJitter::Rotr(uint8 amount)
+{
+	InsertShiftCstStatement(OP_ROTR, amount);
+}
+
 void CJitter::Select()
 {
 	auto tempSym = MakeSymbol(SYM_TEMPORARY, m_nextTemporary++);
@@ -444,6 +534,11 @@ void CJitter::Sub()
 	InsertBinaryStatement(OP_SUB);
 }
 
+void CJitter::Tzc()
+{
+	InsertUnaryStatement(OP_TZC);
+}
+
 void CJitter::Xor()
 {
 	InsertBinaryStatement(OP_XOR);
@@ -714,6 +809,44 @@ void CJitter::And64()
 	InsertBinary64Statement(OP_AND64);
 }
 
+void CJitter::Or64()
+{
+	InsertBinary64Statement(OP_OR64);
+}
+
+void CJitter::Xor64()
+{
+	InsertBinary64Statement(OP_XOR64);
+}
+
+void CJitter::Not64()
+{
+	auto tempSym = MakeSymbol(SYM_TEMPORARY64, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op = OP_NOT64;
+	statement.src1 = MakeSymbolRef(m_shadow.Pull());
+	statement.dst = MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::Mult64()
+{
+	InsertBinary64Statement(OP_MUL64);
+}
+
+void CJitter::Div64()
+{
+	InsertBinary64Statement(OP_DIV64);
+}
+
+void CJitter::DivS64()
+{
+	InsertBinary64Statement(OP_DIVS64);
+}
+
 void CJitter::Cmp64(CONDITION condition)
 {
 	auto tempSym = MakeSymbol(SYM_TEMPORARY, m_nextTemporary++);
@@ -729,6 +862,23 @@ void CJitter::Cmp64(CONDITION condition)
 	m_shadow.Push(tempSym);
 }
 
+void CJitter::Select64()
+{
+	auto tempSym = MakeSymbol(SYM_TEMPORARY64, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op = OP_SELECT64;
+	statement.src3 = MakeSymbolRef(m_shadow.Pull());
+	statement.src2 = MakeSymbolRef(m_shadow.Pull());
+	statement.src1 = MakeSymbolRef(m_shadow.Pull());
+	statement.dst = MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	assert(GetSymbolSize(statement.src1) == 4);
+
+	m_shadow.Push(tempSym);
+}
+
 void CJitter::Sub64()
 {
 	InsertBinary64Statement(OP_SUB64);
@@ -818,6 +968,75 @@ void CJitter::Shl64(uint8 nAmount)
 	m_shadow.Push(tempSym);
 }
 
+void CJitter::Rotl64()
+{
+	SymbolPtr tempSym = MakeSymbol(SYM_TEMPORARY64, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op = OP_ROTL64;
+	statement.src2 = MakeSymbolRef(m_shadow.Pull());
+	statement.src1 = MakeSymbolRef(m_shadow.Pull());
+	statement.dst = MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::Rotl64(uint8 nAmount)
+{
+	SymbolPtr tempSym = MakeSymbol(SYM_TEMPORARY64, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op = OP_ROTL64;
+	statement.src2 = MakeSymbolRef(MakeSymbol(SYM_CONSTANT, nAmount));
+	statement.src1 = MakeSymbolRef(m_shadow.Pull());
+	statement.dst = MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::Rotr64()
+{
+	SymbolPtr tempSym = MakeSymbol(SYM_TEMPORARY64, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op = OP_ROTR64;
+	statement.src2 = MakeSymbolRef(m_shadow.Pull());
+	statement.src1 = MakeSymbolRef(m_shadow.Pull());
+	statement.dst = MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::Rotr64(uint8 nAmount)
+{
+	SymbolPtr tempSym = MakeSymbol(SYM_TEMPORARY64, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op = OP_ROTR64;
+	statement.src2 = MakeSymbolRef(MakeSymbol(SYM_CONSTANT, nAmount));
+	statement.src1 = MakeSymbolRef(m_shadow.Pull());
+	statement.dst = MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::Bswap64()
+{
+	auto tempSym = MakeSymbol(SYM_TEMPORARY64, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op = OP_BSWAP64;
+	statement.src1 = MakeSymbolRef(m_shadow.Pull());
+	statement.dst = MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
 //Floating-Point
 //------------------------------------------------
 void CJitter::FP_PushCst32(float constant)
@@ -869,6 +1088,30 @@ void CJitter::FP_DivS()
 	InsertBinaryFp32Statement(OP_FP_DIV_S);
 }
 
+void CJitter::FP_MulAddS()
+{
+	if(!m_codeGenSupportsFma)
+	{
+		auto addend = m_shadow.Pull();
+		FP_MulS();
+		m_shadow.Push(addend);
+		FP_AddS();
+		return;
+	}
+
+	auto tempSym = MakeSymbol(SYM_FP_TEMPORARY32, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op = OP_FP_FMA_S;
+	statement.src3 = MakeSymbolRef(m_shadow.Pull());
+	statement.src2 = MakeSymbolRef(m_shadow.Pull());
+	statement.src1 = MakeSymbolRef(m_shadow.Pull());
+	statement.dst = MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
 void CJitter::FP_CmpS(Jitter::CONDITION condition)
 {
 	auto tempSym = MakeSymbol(SYM_TEMPORARY, m_nextTemporary++);
@@ -958,6 +1201,128 @@ void CJitter::FP_SetRoundingMode(ROUNDINGMODE roundingMode)
 	InsertStatement(statement);
 }
 
+void CJitter::FP_PushCst64(double constant)
+{
+	auto tempSym = MakeSymbol(SYM_FP_TEMPORARY64, m_nextTemporary++);
+
+	uint64 constantBits = 0;
+	memcpy(&constantBits, &constant, sizeof(double));
+
+	STATEMENT statement;
+	statement.op = OP_FP_LDCST;
+	statement.src1 = MakeSymbolRef(MakeConstant64(constantBits));
+	statement.dst = MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::FP_PushRel64(size_t offset)
+{
+	m_shadow.Push(MakeSymbol(SYM_FP_RELATIVE64, static_cast<uint32>(offset)));
+}
+
+void CJitter::FP_PullRel64(size_t offset)
+{
+	STATEMENT statement;
+	statement.op = OP_MOV;
+	statement.src1 = MakeSymbolRef(m_shadow.Pull());
+	statement.dst = MakeSymbolRef(MakeSymbol(SYM_FP_RELATIVE64, static_cast<uint32>(offset)));
+	InsertStatement(statement);
+
+	assert(GetSymbolSize(statement.src1) == GetSymbolSize(statement.dst));
+}
+
+void CJitter::FP_AddD()
+{
+	InsertBinaryFp64Statement(OP_FP_ADD_D);
+}
+
+void CJitter::FP_SubD()
+{
+	InsertBinaryFp64Statement(OP_FP_SUB_D);
+}
+
+void CJitter::FP_MulD()
+{
+	InsertBinaryFp64Statement(OP_FP_MUL_D);
+}
+
+void CJitter::FP_DivD()
+{
+	InsertBinaryFp64Statement(OP_FP_DIV_D);
+}
+
+void CJitter::FP_CmpD(Jitter::CONDITION condition)
+{
+	auto tempSym = MakeSymbol(SYM_TEMPORARY, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op = OP_FP_CMP_D;
+	statement.src2 = MakeSymbolRef(m_shadow.Pull());
+	statement.src1 = MakeSymbolRef(m_shadow.Pull());
+	statement.dst = MakeSymbolRef(tempSym);
+	statement.jmpCondition = condition;
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::FP_SqrtD()
+{
+	InsertUnaryFp64Statement(OP_FP_SQRT_D);
+}
+
+void CJitter::FP_AbsD()
+{
+	InsertUnaryFp64Statement(OP_FP_ABS_D);
+}
+
+void CJitter::FP_NegD()
+{
+	InsertUnaryFp64Statement(OP_FP_NEG_D);
+}
+
+void CJitter::FP_MinD()
+{
+	InsertBinaryFp64Statement(OP_FP_MIN_D);
+}
+
+void CJitter::FP_MaxD()
+{
+	InsertBinaryFp64Statement(OP_FP_MAX_D);
+}
+
+void CJitter::FP_ToDoubleS()
+{
+	InsertFpConversionStatement(OP_FP_TODOUBLE_S, SYM_FP_TEMPORARY64);
+}
+
+void CJitter::FP_ToSingleD()
+{
+	InsertFpConversionStatement(OP_FP_TOSINGLE_D, SYM_FP_TEMPORARY32);
+}
+
+void CJitter::FP_ToInt32TruncateD()
+{
+	InsertFpConversionStatement(OP_FP_TOINT32_TRUNC_D, SYM_FP_TEMPORARY32);
+}
+
+void CJitter::FP_ToDoubleI32()
+{
+	InsertFpConversionStatement(OP_FP_TODOUBLE_I32, SYM_FP_TEMPORARY64);
+}
+
+void CJitter::FP_ToInt64TruncateD()
+{
+	InsertFpConversionStatement(OP_FP_TOINT64_TRUNC_D, SYM_FP_TEMPORARY64);
+}
+
+void CJitter::FP_ToDoubleI64()
+{
+	InsertFpConversionStatement(OP_FP_TODOUBLE_I64, SYM_FP_TEMPORARY64);
+}
+
 //SIMD
 //------------------------------------------------
 void CJitter::MD_PullRel(size_t offset)
@@ -1381,6 +1746,36 @@ void CJitter::MD_MaxW()
 	InsertBinaryMdStatement(OP_MD_MAX_W);
 }
 
+void CJitter::MD_MulH()
+{
+	InsertBinaryMdStatement(OP_MD_MUL_H);
+}
+
+void CJitter::MD_MulHiHS()
+{
+	InsertBinaryMdStatement(OP_MD_MULHS_H);
+}
+
+void CJitter::MD_MulHiHU()
+{
+	InsertBinaryMdStatement(OP_MD_MULHU_H);
+}
+
+void CJitter::MD_MulW()
+{
+	InsertBinaryMdStatement(OP_MD_MUL_W);
+}
+
+void CJitter::MD_MulWDS()
+{
+	InsertBinaryMdStatement(OP_MD_MULS_WD);
+}
+
+void CJitter::MD_MulWDU()
+{
+	InsertBinaryMdStatement(OP_MD_MULU_WD);
+}
+
 void CJitter::MD_ClampS()
 {
 	InsertUnaryMdStatement(OP_MD_CLAMP_S);
@@ -1481,16 +1876,156 @@ void CJitter::MD_MulS()
 	InsertBinaryMdStatement(OP_MD_MUL_S);
 }
 
+void CJitter::MD_MulAddS()
+{
+	if(!m_codeGenSupportsFma)
+	{
+		auto addend = m_shadow.Pull();
+		MD_MulS();
+		m_shadow.Push(addend);
+		MD_AddS();
+		return;
+	}
+
+	auto tempSym = MakeSymbol(SYM_TEMPORARY128, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op = OP_MD_FMA_S;
+	statement.src3 = MakeSymbolRef(m_shadow.Pull());
+	statement.src2 = MakeSymbolRef(m_shadow.Pull());
+	statement.src1 = MakeSymbolRef(m_shadow.Pull());
+	statement.dst = MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
 void CJitter::MD_DivS()
 {
 	InsertBinaryMdStatement(OP_MD_DIV_S);
 }
 
+void CJitter::MD_SqrtS()
+{
+	InsertUnaryMdStatement(OP_MD_SQRT_S);
+}
+
+void CJitter::MD_RsqrtS()
+{
+	InsertUnaryMdStatement(OP_MD_RSQRT_S);
+}
+
+void CJitter::MD_RcplS()
+{
+	InsertUnaryMdStatement(OP_MD_RCPL_S);
+}
+
+//Mask works like SSE4.1's DPPS: upper nibble selects the lanes taking part
+//in the sum, lower nibble selects the lanes receiving it (others are zeroed)
+void CJitter::MD_DotS(uint8 mask)
+{
+	auto tempSym = MakeSymbol(SYM_TEMPORARY128, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op = OP_MD_DOT_S;
+	statement.src2 = MakeSymbolRef(m_shadow.Pull());
+	statement.src1 = MakeSymbolRef(m_shadow.Pull());
+	statement.dst = MakeSymbolRef(tempSym);
+	statement.jmpCondition = static_cast<Jitter::CONDITION>(mask);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::MD_HaddS()
+{
+	InsertBinaryMdStatement(OP_MD_HADD_S);
+}
+
 void CJitter::MD_ExpandW()
 {
 	InsertUnaryMdStatement(OP_MD_EXPAND_W);
 }
 
+void CJitter::MD_ShuffleW(uint8 selector)
+{
+	auto tempSym = MakeSymbol(SYM_TEMPORARY128, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op = OP_MD_SHUFFLE_W;
+	statement.src2 = MakeSymbolRef(MakeSymbol(SYM_CONSTANT, selector));
+	statement.src1 = MakeSymbolRef(m_shadow.Pull());
+	statement.dst = MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::MD_ShuffleB(uint64 patternLow, uint64 patternHigh)
+{
+	//Each byte of the pattern selects a source byte, indices above 15 yield 0
+	auto tempSym = MakeSymbol(SYM_TEMPORARY128, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op = OP_MD_SHUFFLE_B;
+	statement.src3 = MakeSymbolRef(MakeConstant64(patternHigh));
+	statement.src2 = MakeSymbolRef(MakeConstant64(patternLow));
+	statement.src1 = MakeSymbolRef(m_shadow.Pull());
+	statement.dst = MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::MD_InsertW(uint8 lane)
+{
+	assert(lane < 4);
+
+	auto tempSym = MakeSymbol(SYM_TEMPORARY128, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op = OP_MD_INSERT_W;
+	statement.src3 = MakeSymbolRef(MakeSymbol(SYM_CONSTANT, lane));
+	statement.src2 = MakeSymbolRef(m_shadow.Pull());
+	statement.src1 = MakeSymbolRef(m_shadow.Pull());
+	statement.dst = MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::MD_ExtractW(uint8 lane)
+{
+	assert(lane < 4);
+
+	auto tempSym = MakeSymbol(SYM_TEMPORARY, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op = OP_MD_EXTRACT_W;
+	statement.src2 = MakeSymbolRef(MakeSymbol(SYM_CONSTANT, lane));
+	statement.src1 = MakeSymbolRef(m_shadow.Pull());
+	statement.dst = MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::MD_ExtractS(uint8 lane)
+{
+	assert(lane < 4);
+
+	auto tempSym = MakeSymbol(SYM_FP_TEMPORARY32, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op = OP_MD_EXTRACT_W;
+	statement.src2 = MakeSymbolRef(MakeSymbol(SYM_CONSTANT, lane));
+	statement.src1 = MakeSymbolRef(m_shadow.Pull());
+	statement.dst = MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
 void CJitter::MD_AbsS()
 {
 	InsertUnaryMdStatement(OP_MD_ABS_S);
@@ -1660,6 +2195,38 @@ void CJitter::InsertBinaryFp32Statement(Jitter::OPERATION operation)
 	m_shadow.Push(tempSym);
 }
 
+void CJitter::InsertUnaryFp64Statement(Jitter::OPERATION operation)
+{
+	InsertFpConversionStatement(operation, SYM_FP_TEMPORARY64);
+}
+
+void CJitter::InsertBinaryFp64Statement(Jitter::OPERATION operation)
+{
+	auto tempSym = MakeSymbol(SYM_FP_TEMPORARY64, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op = operation;
+	statement.src2 = MakeSymbolRef(m_shadow.Pull());
+	statement.src1 = MakeSymbolRef(m_shadow.Pull());
+	statement.dst = MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
+void CJitter::InsertFpConversionStatement(Jitter::OPERATION operation, SYM_TYPE dstType)
+{
+	auto tempSym = MakeSymbol(dstType, m_nextTemporary++);
+
+	STATEMENT statement;
+	statement.op = operation;
+	statement.src1 = MakeSymbolRef(m_shadow.Pull());
+	statement.dst = MakeSymbolRef(tempSym);
+	InsertStatement(statement);
+
+	m_shadow.Push(tempSym);
+}
+
 void CJitter::InsertUnaryMdStatement(Jitter::OPERATION operation)
 {
 	auto tempSym = MakeSymbol(SYM_TEMPORARY128, m_nextTemporary++);
@@ -57,6 +57,10 @@ bool CCodeGen::SymbolMatches(MATCHTYPE match, const SymbolRefPtr& symbolRef)
 		return (symbol->m_type == SYM_CONSTANT64);
 	case MATCH_MEMORY64:
 		return (symbol->m_type == SYM_RELATIVE64) || (symbol->m_type == SYM_TEMPORARY64);
+	case MATCH_REGISTER64:
+		return (symbol->m_type == SYM_REGISTER64);
+	case MATCH_VARIABLE64:
+		return (symbol->m_type == SYM_REGISTER64) || (symbol->m_type == SYM_RELATIVE64) || (symbol->m_type == SYM_TEMPORARY64);
 
 	case MATCH_FP_REGISTER32:
 		return (symbol->m_type == SYM_FP_REGISTER32);
@@ -69,6 +73,17 @@ bool CCodeGen::SymbolMatches(MATCHTYPE match, const SymbolRefPtr& symbolRef)
 	case MATCH_FP_VARIABLE32:
 		return (symbol->m_type == SYM_FP_REGISTER32) || (symbol->m_type == SYM_FP_RELATIVE32) || (symbol->m_type == SYM_FP_TEMPORARY32);
 
+	case MATCH_FP_REGISTER64:
+		return (symbol->m_type == SYM_FP_REGISTER64);
+	case MATCH_FP_RELATIVE64:
+		return (symbol->m_type == SYM_FP_RELATIVE64);
+	case MATCH_FP_TEMPORARY64:
+		return (symbol->m_type == SYM_FP_TEMPORARY64);
+	case MATCH_FP_MEMORY64:
+		return (symbol->m_type == SYM_FP_RELATIVE64) || (symbol->m_type == SYM_FP_TEMPORARY64);
+	case MATCH_FP_VARIABLE64:
+		return (symbol->m_type == SYM_FP_REGISTER64) || (symbol->m_type == SYM_FP_RELATIVE64) || (symbol->m_type == SYM_FP_TEMPORARY64);
+
 	case MATCH_REGISTER128:
 		return (symbol->m_type == SYM_REGISTER128);
 	case MATCH_RELATIVE128:
@@ -105,6 +120,51 @@ uint32 CCodeGen::GetRegisterUsage(const StatementList& statements)
 		{
 			registerUsage |= (1 << dst->m_valueLow);
 		}
+		else if(auto dst = dynamic_symbolref_cast(SYM_REGISTER64, statement.dst))
+		{
+			registerUsage |= (1 << dst->m_valueLow);
+		}
 	}
 	return registerUsage;
 }
+
+LITERAL128 CCodeGen::MakeMdLaneMaskLiteral(uint8 laneMask)
+{
+	//Builds a mask with all bits set in every 32-bit lane selected by laneMask
+	return LITERAL128(
+	    (laneMask & 0x01) ? 0xFFFFFFFF : 0,
+	    (laneMask & 0x02) ? 0xFFFFFFFF : 0,
+	    (laneMask & 0x04) ? 0xFFFFFFFF : 0,
+	    (laneMask & 0x08) ? 0xFFFFFFFF : 0);
+}
+
+LITERAL128 CCodeGen::MakeMdShuffleBLiteral(uint64 patternLow, uint64 patternHigh)
+{
+	//Out of range indices are turned into 0x80, which yields 0 with pshufb, tbl, vtbl and swizzle
+	uint64 pattern[2] = {patternLow, patternHigh};
+	for(auto& patternPart : pattern)
+	{
+		for(unsigned int i = 0; i < 8; i++)
+		{
+			uint64 index = (patternPart >> (i * 8)) & 0xFF;
+			if(index >= 0x10)
+			{
+				patternPart &= ~(0xFFULL << (i * 8));
+				patternPart |= (0x80ULL << (i * 8));
+			}
+		}
+	}
+	return LITERAL128(pattern[0], pattern[1]);
+}
+
+LITERAL128 CCodeGen::MakeMdShuffleWLiteral(uint8 selector)
+{
+	//Byte indices selecting the 32-bit lanes picked by a pshufd style selector
+	uint32 lanes[4];
+	for(unsigned int i = 0; i < 4; i++)
+	{
+		uint32 srcLane = (selector >> (i * 2)) & 0x03;
+		lanes[i] = 0x03020100 + (srcLane * 0x04040404);
+	}
+	return LITERAL128(lanes[0], lanes[1], lanes[2], lanes[3]);
+}
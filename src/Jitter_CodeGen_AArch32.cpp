@@ -172,6 +172,44 @@ void CCodeGen_AArch32::Emit_Shift_Generic(const STATEMENT& statement)
 	CommitSymbolRegister(dst, dstReg);
 }
 
+template <bool isLeft>
+void CCodeGen_AArch32::Emit_Rotate_Generic(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDef(dst, CAArch32Assembler::r0);
+	auto src1Reg = PrepareSymbolRegisterUse(src1, CAArch32Assembler::r1);
+	if(src2->IsConstant())
+	{
+		//ROR #0 encodes RRX, emit a plain move instead
+		uint8 amount = static_cast<uint8>((isLeft ? (32 - src2->m_valueLow) : src2->m_valueLow) & 0x1F);
+		if(amount == 0)
+		{
+			m_assembler.Mov(dstReg, src1Reg);
+		}
+		else
+		{
+			auto shift = CAArch32Assembler::MakeConstantShift(CAArch32Assembler::SHIFT_ROR, amount);
+			m_assembler.Mov(dstReg, CAArch32Assembler::MakeRegisterAluOperand(src1Reg, shift));
+		}
+	}
+	else
+	{
+		//Register rotates only use the lower bits of the amount, rotate left is a rotate right by the negated amount
+		auto amountReg = PrepareSymbolRegisterUse(src2, CAArch32Assembler::r2);
+		if(isLeft)
+		{
+			m_assembler.Rsb(CAArch32Assembler::r2, amountReg, CAArch32Assembler::MakeImmediateAluOperand(0, 0));
+			amountReg = CAArch32Assembler::r2;
+		}
+		auto shift = CAArch32Assembler::MakeVariableShift(CAArch32Assembler::SHIFT_ROR, amountReg);
+		m_assembler.Mov(dstReg, CAArch32Assembler::MakeRegisterAluOperand(src1Reg, shift));
+	}
+	CommitSymbolRegister(dst, dstReg);
+}
+
 // clang-format off
 CCodeGen_AArch32::CONSTMATCHER CCodeGen_AArch32::g_constMatchers[] = 
 { 
@@ -196,11 +234,20 @@ CCodeGen_AArch32::CONSTMATCHER CCodeGen_AArch32::g_constMatchers[] =
 	ALU_CONST_MATCHERS(OP_XOR, ALUOP_XOR)
 	
 	{ OP_LZC, MATCH_VARIABLE, MATCH_VARIABLE, MATCH_NIL, MATCH_NIL, &CCodeGen_AArch32::Emit_Lzc_VarVar },
+	{ OP_TZC, MATCH_VARIABLE, MATCH_VARIABLE, MATCH_NIL, MATCH_NIL, &CCodeGen_AArch32::Emit_Tzc_VarVar },
+
+	{ OP_POPCNT, MATCH_VARIABLE, MATCH_VARIABLE, MATCH_NIL, MATCH_NIL, &CCodeGen_AArch32::Emit_Popcnt_VarVar },
+
+	{ OP_BSWAP,   MATCH_VARIABLE, MATCH_VARIABLE, MATCH_NIL, MATCH_NIL, &CCodeGen_AArch32::Emit_Bswap_VarVar   },
+	{ OP_BSWAP16, MATCH_VARIABLE, MATCH_VARIABLE, MATCH_NIL, MATCH_NIL, &CCodeGen_AArch32::Emit_Bswap16_VarVar },
 
 	{ OP_SRL, MATCH_ANY, MATCH_ANY, MATCH_ANY, MATCH_NIL, &CCodeGen_AArch32::Emit_Shift_Generic<CAArch32Assembler::SHIFT_LSR> },
 	{ OP_SRA, MATCH_ANY, MATCH_ANY, MATCH_ANY, MATCH_NIL, &CCodeGen_AArch32::Emit_Shift_Generic<CAArch32Assembler::SHIFT_ASR> },
 	{ OP_SLL, MATCH_ANY, MATCH_ANY, MATCH_ANY, MATCH_NIL, &CCodeGen_AArch32::Emit_Shift_Generic<CAArch32Assembler::SHIFT_LSL> },
 
+	{ OP_ROTL, MATCH_VARIABLE, MATCH_ANY, MATCH_ANY, MATCH_NIL, &CCodeGen_AArch32::Emit_Rotate_Generic<true>  },
+	{ OP_ROTR, MATCH_VARIABLE, MATCH_ANY, MATCH_ANY, MATCH_NIL, &CCodeGen_AArch32::Emit_Rotate_Generic<false> },
+
 	{ OP_PARAM, MATCH_NIL, MATCH_CONTEXT,    MATCH_NIL, MATCH_NIL, &CCodeGen_AArch32::Emit_Param_Ctx    },
 	{ OP_PARAM, MATCH_NIL, MATCH_REGISTER,   MATCH_NIL, MATCH_NIL, &CCodeGen_AArch32::Emit_Param_Reg    },
 	{ OP_PARAM, MATCH_NIL, MATCH_MEMORY,     MATCH_NIL, MATCH_NIL, &CCodeGen_AArch32::Emit_Param_Mem    },
@@ -225,13 +272,17 @@ CCodeGen_AArch32::CONSTMATCHER CCodeGen_AArch32::g_constMatchers[] =
 	{ OP_CONDJMP, MATCH_NIL, MATCH_VARIABLE, MATCH_CONSTANT, MATCH_NIL, &CCodeGen_AArch32::Emit_CondJmp_VarCst     },
 	{ OP_CONDJMP, MATCH_NIL, MATCH_VARIABLE, MATCH_VARIABLE, MATCH_NIL, &CCodeGen_AArch32::Emit_CondJmp_VarVar     },
 	{ OP_CONDJMP, MATCH_NIL, MATCH_VAR_REF,  MATCH_CONSTANT, MATCH_NIL, &CCodeGen_AArch32::Emit_CondJmp_Ref_VarCst },
+
+	{ OP_TESTJMP, MATCH_NIL, MATCH_ANY,      MATCH_ANY,      MATCH_NIL, &CCodeGen_AArch32::Emit_TestJmp_AnyAny     },
+
+	{ OP_JMPTABLE, MATCH_NIL, MATCH_VARIABLE, MATCH_NIL, MATCH_NIL, &CCodeGen_AArch32::Emit_JmpTable_Var },
 	
 	{ OP_CMP, MATCH_ANY, MATCH_ANY, MATCH_CONSTANT, MATCH_NIL, &CCodeGen_AArch32::Emit_Cmp_AnyAnyCst },
 	{ OP_CMP, MATCH_ANY, MATCH_ANY, MATCH_ANY,      MATCH_NIL, &CCodeGen_AArch32::Emit_Cmp_AnyAnyAny },
 
 	{ OP_SELECT, MATCH_VARIABLE, MATCH_VARIABLE, MATCH_ANY, MATCH_ANY, &CCodeGen_AArch32::Emit_Select_VarVarAnyAny },
 	
-	{ OP_CMPSELECT_P1, MATCH_NIL,      MATCH_ANY, MATCH_VARIABLE, MATCH_NIL, &CCodeGen_AArch32::Emit_CmpSelectP1_AnyVar    },
+	{ OP_CMPSELECT_P1, MATCH_NIL,      MATCH_ANY, MATCH_ANY,      MATCH_NIL, &CCodeGen_AArch32::Emit_CmpSelectP1_AnyAny    },
 	{ OP_CMPSELECT_P2, MATCH_VARIABLE, MATCH_ANY, MATCH_ANY,      MATCH_NIL, &CCodeGen_AArch32::Emit_CmpSelectP2_VarAnyAny },
 
 	{ OP_NOT, MATCH_REGISTER, MATCH_REGISTER, MATCH_NIL, MATCH_NIL, &CCodeGen_AArch32::Emit_Not_RegReg },
@@ -240,6 +291,9 @@ CCodeGen_AArch32::CONSTMATCHER CCodeGen_AArch32::g_constMatchers[] =
 	
 	{ OP_DIV,  MATCH_TEMPORARY64, MATCH_ANY, MATCH_ANY, MATCH_NIL, &CCodeGen_AArch32::Emit_DivTmp64AnyAny<false> },
 	{ OP_DIVS, MATCH_TEMPORARY64, MATCH_ANY, MATCH_ANY, MATCH_NIL, &CCodeGen_AArch32::Emit_DivTmp64AnyAny<true>  },
+
+	{ OP_DIV64,  MATCH_MEMORY64, MATCH_ANY, MATCH_ANY, MATCH_NIL, &CCodeGen_AArch32::Emit_Div64_MemAnyAny<false> },
+	{ OP_DIVS64, MATCH_MEMORY64, MATCH_ANY, MATCH_ANY, MATCH_NIL, &CCodeGen_AArch32::Emit_Div64_MemAnyAny<true>  },
 	
 	{ OP_MUL,  MATCH_TEMPORARY64, MATCH_ANY, MATCH_ANY, MATCH_NIL, &CCodeGen_AArch32::Emit_MulTmp64AnyAny<false> },
 	{ OP_MULS, MATCH_TEMPORARY64, MATCH_ANY, MATCH_ANY, MATCH_NIL, &CCodeGen_AArch32::Emit_MulTmp64AnyAny<true>  },
@@ -253,6 +307,8 @@ CCodeGen_AArch32::CONSTMATCHER CCodeGen_AArch32::g_constMatchers[] =
 	{ OP_LOADFROMREF, MATCH_VARIABLE, MATCH_VAR_REF, MATCH_NIL,   MATCH_NIL, &CCodeGen_AArch32::Emit_LoadFromRef_VarVar    },
 	{ OP_LOADFROMREF, MATCH_VARIABLE, MATCH_VAR_REF, MATCH_ANY32, MATCH_NIL, &CCodeGen_AArch32::Emit_LoadFromRef_VarVarAny },
 
+	{ OP_LOOKUP, MATCH_VARIABLE, MATCH_CONSTANTPTR, MATCH_ANY32, MATCH_NIL, &CCodeGen_AArch32::Emit_Lookup_VarCstAny },
+
 	{ OP_LOADFROMREF, MATCH_VAR_REF, MATCH_VAR_REF, MATCH_NIL, MATCH_NIL, &CCodeGen_AArch32::Emit_LoadFromRef_Ref_VarVar },
 	{ OP_LOADFROMREF, MATCH_VAR_REF, MATCH_VAR_REF, MATCH_ANY32, MATCH_NIL, &CCodeGen_AArch32::Emit_LoadFromRef_Ref_VarVarAny },
 
@@ -301,11 +357,26 @@ unsigned int CCodeGen_AArch32::GetAvailableRegisterCount() const
 	return MAX_REGISTERS;
 }
 
+unsigned int CCodeGen_AArch32::GetAvailableCallerSavedRegisterCount() const
+{
+	return 0;
+}
+
 unsigned int CCodeGen_AArch32::GetAvailableMdRegisterCount() const
 {
 	return 0;
 }
 
+unsigned int CCodeGen_AArch32::GetMdTempRegisterCount(const STATEMENT&) const
+{
+	return 0;
+}
+
+bool CCodeGen_AArch32::IsHelperCall(const STATEMENT&) const
+{
+	return false;
+}
+
 bool CCodeGen_AArch32::Has128BitsCallOperands() const
 {
 	return true;
@@ -316,6 +387,11 @@ bool CCodeGen_AArch32::CanHold128BitsReturnValueInRegisters() const
 	return false;
 }
 
+bool CCodeGen_AArch32::Has64BitsRegisters() const
+{
+	return false;
+}
+
 bool CCodeGen_AArch32::SupportsExternalJumps() const
 {
 	return true;
@@ -326,6 +402,28 @@ bool CCodeGen_AArch32::SupportsCmpSelect() const
 	return true;
 }
 
+bool CCodeGen_AArch32::SupportsJumpTables() const
+{
+	return true;
+}
+
+bool CCodeGen_AArch32::SupportsTestJumps() const
+{
+	return true;
+}
+
+bool CCodeGen_AArch32::SupportsIndexScale(uint32 accessSize, uint32 scale) const
+{
+	if(scale == 1) return true;
+	//Only 32-bit accesses can use their natural size as scale
+	return (accessSize == 4) && (scale == 4);
+}
+
+bool CCodeGen_AArch32::SupportsFma() const
+{
+	return false;
+}
+
 uint32 CCodeGen_AArch32::GetPointerSize() const
 {
 	return 4;
@@ -759,6 +857,10 @@ CAArch32Assembler::REGISTER CCodeGen_AArch32::PrepareSymbolRegisterUseRef(CSymbo
 		LoadMemoryReferenceInRegister(preferedRegister, symbol);
 		return preferedRegister;
 		break;
+	case SYM_CONSTANTPTR:
+		LoadConstantPtrInRegister(preferedRegister, symbol->GetConstantPtr());
+		return preferedRegister;
+		break;
 	default:
 		throw std::runtime_error("Invalid symbol type.");
 		break;
@@ -1207,6 +1309,69 @@ void CCodeGen_AArch32::Emit_Lzc_VarVar(const STATEMENT& statement)
 	CommitSymbolRegister(dst, dstRegister);
 }
 
+void CCodeGen_AArch32::Emit_Tzc_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDef(dst, CAArch32Assembler::r0);
+	auto src1Register = PrepareSymbolRegisterUse(src1, CAArch32Assembler::r1);
+
+	m_assembler.Rbit(dstRegister, src1Register);
+	m_assembler.Clz(dstRegister, dstRegister);
+
+	CommitSymbolRegister(dst, dstRegister);
+}
+
+void CCodeGen_AArch32::Emit_Popcnt_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDef(dst, CAArch32Assembler::r0);
+	auto src1Register = PrepareSymbolRegisterUse(src1, CAArch32Assembler::r1);
+
+	//Only the first lane is relevant, other lanes hold garbage
+	auto tmpReg = CAArch32Assembler::q0;
+	auto tmpRegLo = CAArch32Assembler::d0;
+
+	m_assembler.Vmov(tmpRegLo, src1Register, 0);
+	m_assembler.Vcnt_I8(tmpReg, tmpReg);
+	m_assembler.Vpaddl_U8(tmpReg, tmpReg);
+	m_assembler.Vpaddl_U16(tmpReg, tmpReg);
+	m_assembler.Vmov(dstRegister, tmpRegLo, 0);
+
+	CommitSymbolRegister(dst, dstRegister);
+}
+
+void CCodeGen_AArch32::Emit_Bswap_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDef(dst, CAArch32Assembler::r0);
+	auto src1Register = PrepareSymbolRegisterUse(src1, CAArch32Assembler::r1);
+
+	m_assembler.Rev(dstRegister, src1Register);
+
+	CommitSymbolRegister(dst, dstRegister);
+}
+
+void CCodeGen_AArch32::Emit_Bswap16_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDef(dst, CAArch32Assembler::r0);
+	auto src1Register = PrepareSymbolRegisterUse(src1, CAArch32Assembler::r1);
+
+	auto shift = CAArch32Assembler::MakeConstantShift(CAArch32Assembler::SHIFT_LSR, 16);
+	m_assembler.Rev(dstRegister, src1Register);
+	m_assembler.Mov(dstRegister, CAArch32Assembler::MakeRegisterAluOperand(dstRegister, shift));
+
+	CommitSymbolRegister(dst, dstRegister);
+}
+
 void CCodeGen_AArch32::Emit_Jmp(const STATEMENT& statement)
 {
 	m_assembler.BCc(CAArch32Assembler::CONDITION_AL, GetLabel(statement.jmpBlock));
@@ -1272,6 +1437,38 @@ void CCodeGen_AArch32::Emit_CondJmp_Ref_VarCst(const STATEMENT& statement)
 	}
 }
 
+void CCodeGen_AArch32::Emit_TestJmp_AnyAny(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	assert((statement.jmpCondition == CONDITION_NE) || (statement.jmpCondition == CONDITION_EQ));
+
+	auto src1Reg = PrepareSymbolRegisterUse(src1, CAArch32Assembler::r1);
+	auto src2Reg = PrepareSymbolRegisterUse(src2, CAArch32Assembler::r2);
+	m_assembler.Tst(src1Reg, src2Reg);
+	Emit_CondJmp(statement);
+}
+
+void CCodeGen_AArch32::Emit_JmpTable_Var(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto indexReg = PrepareSymbolRegisterUse(src1, CAArch32Assembler::r1);
+	Cmp_GenericRegCst(indexReg, static_cast<uint32>(statement.jmpTable->size()), CAArch32Assembler::r2);
+	m_assembler.BCc(CAArch32Assembler::CONDITION_CS, GetLabel(statement.jmpBlock));
+
+	//PC reads 8 bytes ahead, table of branches starts right after the filler instruction
+	auto offsetShift = CAArch32Assembler::MakeConstantShift(CAArch32Assembler::SHIFT_LSL, 2);
+	m_assembler.Mov(CAArch32Assembler::r0, CAArch32Assembler::MakeRegisterAluOperand(indexReg, offsetShift));
+	m_assembler.Add(CAArch32Assembler::rPC, CAArch32Assembler::rPC, CAArch32Assembler::r0);
+	m_assembler.Mov(CAArch32Assembler::r0, CAArch32Assembler::r0);
+	for(const auto& target : *statement.jmpTable)
+	{
+		m_assembler.BCc(CAArch32Assembler::CONDITION_AL, GetLabel(target));
+	}
+}
+
 void CCodeGen_AArch32::Cmp_GetFlag(CAArch32Assembler::REGISTER registerId, Jitter::CONDITION condition)
 {
 	CAArch32Assembler::ImmediateAluOperand trueOperand(CAArch32Assembler::MakeImmediateAluOperand(1, 0));
@@ -1357,7 +1554,7 @@ void CCodeGen_AArch32::Emit_Select_VarVarAnyAny(const STATEMENT& statement)
 	CommitSymbolRegister(dst, dstReg);
 }
 
-void CCodeGen_AArch32::Emit_CmpSelectP1_AnyVar(const STATEMENT& statement)
+void CCodeGen_AArch32::Emit_CmpSelectP1_AnyAny(const STATEMENT& statement)
 {
 	auto src1 = statement.src1->GetSymbol().get();
 	auto src2 = statement.src2->GetSymbol().get();
@@ -1512,6 +1709,13 @@ void CCodeGen_AArch32::Emit_LoadFromRef_VarVarAny(const STATEMENT& statement)
 	CommitSymbolRegister(dst, dstReg);
 }
 
+void CCodeGen_AArch32::Emit_Lookup_VarCstAny(const STATEMENT& statement)
+{
+	auto loadStatement = statement;
+	loadStatement.jmpCondition = static_cast<CONDITION>(sizeof(uint32));
+	Emit_LoadFromRef_VarVarAny(loadStatement);
+}
+
 void CCodeGen_AArch32::Emit_LoadFromRef_Ref_VarVar(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -415,6 +415,105 @@ void CCodeGen_AArch32::Emit_And64_MemMemMem(const STATEMENT& statement)
 	StoreRegistersInMemory64(dst, regLo1, regHi1);
 }
 
+template <typename ALUOP>
+void CCodeGen_AArch32::Emit_Logic64_MemAnyAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto regLo1 = CAArch32Assembler::r0;
+	auto regHi1 = CAArch32Assembler::r1;
+	auto regLo2 = CAArch32Assembler::r2;
+	auto regHi2 = CAArch32Assembler::r3;
+
+	LoadSymbol64InRegisters(regLo1, regHi1, src1);
+	LoadSymbol64InRegisters(regLo2, regHi2, src2);
+
+	((m_assembler).*(ALUOP::OpReg()))(regLo1, regLo1, regLo2);
+	((m_assembler).*(ALUOP::OpReg()))(regHi1, regHi1, regHi2);
+
+	StoreRegistersInMemory64(dst, regLo1, regHi1);
+}
+
+void CCodeGen_AArch32::Emit_Not64_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto regLo = CAArch32Assembler::r0;
+	auto regHi = CAArch32Assembler::r1;
+
+	LoadMemory64InRegisters(regLo, regHi, src1);
+
+	m_assembler.Mvn(regLo, regLo);
+	m_assembler.Mvn(regHi, regHi);
+
+	StoreRegistersInMemory64(dst, regLo, regHi);
+}
+
+void CCodeGen_AArch32::Emit_Bswap64_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto regLo = CAArch32Assembler::r0;
+	auto regHi = CAArch32Assembler::r1;
+
+	LoadMemory64InRegisters(regLo, regHi, src1);
+
+	m_assembler.Rev(regLo, regLo);
+	m_assembler.Rev(regHi, regHi);
+
+	StoreRegistersInMemory64(dst, regHi, regLo);
+}
+
+void CCodeGen_AArch32::Emit_Mul64_MemAnyAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto regLo1 = CAArch32Assembler::r0;
+	auto regHi1 = CAArch32Assembler::r1;
+	auto regLo2 = CAArch32Assembler::r2;
+	auto regHi2 = CAArch32Assembler::r3;
+
+	LoadSymbol64InRegisters(regLo1, regHi1, src1);
+	LoadSymbol64InRegisters(regLo2, regHi2, src2);
+
+	//Cross products only contribute to the high word
+	m_assembler.Mul(regHi2, regLo1, regHi2);
+	m_assembler.Mla(regHi2, regHi1, regLo2, regHi2);
+	m_assembler.Umull(regLo1, regHi1, regLo1, regLo2);
+	m_assembler.Add(regHi1, regHi1, regHi2);
+
+	StoreRegistersInMemory64(dst, regLo1, regHi1);
+}
+
+void CCodeGen_AArch32::Emit_Select64_MemVarAnyAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	auto regLo = CAArch32Assembler::r0;
+	auto regHi = CAArch32Assembler::r1;
+	auto trueRegLo = CAArch32Assembler::r2;
+	auto trueRegHi = CAArch32Assembler::r3;
+
+	LoadSymbol64InRegisters(regLo, regHi, src3);
+	LoadSymbol64InRegisters(trueRegLo, trueRegHi, src2);
+
+	auto src1Reg = PrepareSymbolRegisterUse(src1, CAArch32Assembler::r12);
+	m_assembler.Tst(src1Reg, src1Reg);
+	m_assembler.MovCc(CAArch32Assembler::CONDITION_NE, regLo, trueRegLo);
+	m_assembler.MovCc(CAArch32Assembler::CONDITION_NE, regHi, trueRegHi);
+
+	StoreRegistersInMemory64(dst, regLo, regHi);
+}
+
 void CCodeGen_AArch32::Emit_Sl64Var_MemMem(CSymbol* dst, CSymbol* src, CAArch32Assembler::REGISTER saReg)
 {
 	//saReg will be modified by this function, do not use PrepareRegister
@@ -759,6 +858,75 @@ void CCodeGen_AArch32::Emit_Sra64_MemMemCst(const STATEMENT& statement)
 	Emit_Sr64Cst_MemMem(dst, src1, shiftAmount, CAArch32Assembler::SHIFT_ASR);
 }
 
+template <bool isLeft>
+void CCodeGen_AArch32::Emit_Rotate64_MemMemAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto saReg = CAArch32Assembler::r0;
+	auto loReg = CAArch32Assembler::r1;
+	auto hiReg = CAArch32Assembler::r2;
+	auto resLoReg = CAArch32Assembler::r3;
+	auto resHiReg = CAArch32Assembler::r12;
+
+	//Rotating by 32 or more swaps both halves, then:
+	//resLo = (lo << sa) | (hi >> (32 - sa)), resHi = (hi << sa) | (lo >> (32 - sa)) (shifts reversed for right rotates)
+	auto firstShiftType = isLeft ? CAArch32Assembler::SHIFT_LSL : CAArch32Assembler::SHIFT_LSR;
+	auto secondShiftType = isLeft ? CAArch32Assembler::SHIFT_LSR : CAArch32Assembler::SHIFT_LSL;
+
+	if(src2->IsConstant())
+	{
+		uint32 shiftAmount = src2->m_valueLow & 0x3F;
+		if(shiftAmount & 0x20)
+		{
+			LoadMemory64InRegisters(hiReg, loReg, src1);
+		}
+		else
+		{
+			LoadMemory64InRegisters(loReg, hiReg, src1);
+		}
+		shiftAmount &= 0x1F;
+		if(shiftAmount == 0)
+		{
+			StoreRegistersInMemory64(dst, loReg, hiReg);
+			return;
+		}
+		auto firstShift = CAArch32Assembler::MakeConstantShift(firstShiftType, shiftAmount);
+		auto secondShift = CAArch32Assembler::MakeConstantShift(secondShiftType, 32 - shiftAmount);
+		m_assembler.Mov(resLoReg, CAArch32Assembler::MakeRegisterAluOperand(loReg, firstShift));
+		m_assembler.Mov(resHiReg, CAArch32Assembler::MakeRegisterAluOperand(hiReg, firstShift));
+		m_assembler.Mov(loReg, CAArch32Assembler::MakeRegisterAluOperand(loReg, secondShift));
+		m_assembler.Mov(hiReg, CAArch32Assembler::MakeRegisterAluOperand(hiReg, secondShift));
+	}
+	else
+	{
+		auto amountReg = PrepareSymbolRegisterUse(src2, saReg);
+		m_assembler.And(saReg, amountReg, CAArch32Assembler::MakeImmediateAluOperand(0x3F, 0));
+		LoadMemory64InRegisters(loReg, hiReg, src1);
+
+		m_assembler.Cmp(saReg, CAArch32Assembler::MakeImmediateAluOperand(32, 0));
+		m_assembler.MovCc(CAArch32Assembler::CONDITION_GE, resLoReg, loReg);
+		m_assembler.MovCc(CAArch32Assembler::CONDITION_GE, loReg, hiReg);
+		m_assembler.MovCc(CAArch32Assembler::CONDITION_GE, hiReg, resLoReg);
+		m_assembler.And(saReg, saReg, CAArch32Assembler::MakeImmediateAluOperand(0x1F, 0));
+
+		//Register shifts by 32 yield 0, which handles the 0 amount case
+		auto firstShift = CAArch32Assembler::MakeVariableShift(firstShiftType, saReg);
+		auto secondShift = CAArch32Assembler::MakeVariableShift(secondShiftType, saReg);
+		m_assembler.Mov(resLoReg, CAArch32Assembler::MakeRegisterAluOperand(loReg, firstShift));
+		m_assembler.Mov(resHiReg, CAArch32Assembler::MakeRegisterAluOperand(hiReg, firstShift));
+		m_assembler.Rsb(saReg, saReg, CAArch32Assembler::MakeImmediateAluOperand(32, 0));
+		m_assembler.Mov(loReg, CAArch32Assembler::MakeRegisterAluOperand(loReg, secondShift));
+		m_assembler.Mov(hiReg, CAArch32Assembler::MakeRegisterAluOperand(hiReg, secondShift));
+	}
+
+	m_assembler.Or(resLoReg, resLoReg, hiReg);
+	m_assembler.Or(resHiReg, resHiReg, loReg);
+	StoreRegistersInMemory64(dst, resLoReg, resHiReg);
+}
+
 void CCodeGen_AArch32::Cmp64_RegSymLo(CAArch32Assembler::REGISTER src1Reg, CSymbol* src2, CAArch32Assembler::REGISTER src2Reg)
 {
 	switch(src2->m_type)
@@ -948,6 +1116,17 @@ CCodeGen_AArch32::CONSTMATCHER CCodeGen_AArch32::g_64ConstMatchers[] =
 
 	{ OP_AND64, MATCH_MEMORY64, MATCH_MEMORY64, MATCH_MEMORY64, MATCH_NIL, &CCodeGen_AArch32::Emit_And64_MemMemMem },
 
+	{ OP_OR64,  MATCH_MEMORY64, MATCH_ANY, MATCH_ANY, MATCH_NIL, &CCodeGen_AArch32::Emit_Logic64_MemAnyAny<ALUOP_OR>  },
+	{ OP_XOR64, MATCH_MEMORY64, MATCH_ANY, MATCH_ANY, MATCH_NIL, &CCodeGen_AArch32::Emit_Logic64_MemAnyAny<ALUOP_XOR> },
+
+	{ OP_NOT64, MATCH_MEMORY64, MATCH_MEMORY64, MATCH_NIL, MATCH_NIL, &CCodeGen_AArch32::Emit_Not64_MemMem },
+
+	{ OP_BSWAP64, MATCH_MEMORY64, MATCH_MEMORY64, MATCH_NIL, MATCH_NIL, &CCodeGen_AArch32::Emit_Bswap64_MemMem },
+
+	{ OP_MUL64, MATCH_MEMORY64, MATCH_ANY, MATCH_ANY, MATCH_NIL, &CCodeGen_AArch32::Emit_Mul64_MemAnyAny },
+
+	{ OP_SELECT64, MATCH_MEMORY64, MATCH_VARIABLE, MATCH_ANY, MATCH_ANY, &CCodeGen_AArch32::Emit_Select64_MemVarAnyAny },
+
 	{ OP_SLL64, MATCH_MEMORY64, MATCH_MEMORY64, MATCH_VARIABLE, MATCH_NIL, &CCodeGen_AArch32::Emit_Sll64_MemMemVar },
 	{ OP_SLL64, MATCH_MEMORY64, MATCH_MEMORY64, MATCH_CONSTANT, MATCH_NIL, &CCodeGen_AArch32::Emit_Sll64_MemMemCst },
 
@@ -957,6 +1136,9 @@ CCodeGen_AArch32::CONSTMATCHER CCodeGen_AArch32::g_64ConstMatchers[] =
 	{ OP_SRA64, MATCH_MEMORY64, MATCH_MEMORY64, MATCH_VARIABLE, MATCH_NIL, &CCodeGen_AArch32::Emit_Sra64_MemMemVar },
 	{ OP_SRA64, MATCH_MEMORY64, MATCH_MEMORY64, MATCH_CONSTANT, MATCH_NIL, &CCodeGen_AArch32::Emit_Sra64_MemMemCst },
 
+	{ OP_ROTL64, MATCH_MEMORY64, MATCH_MEMORY64, MATCH_ANY, MATCH_NIL, &CCodeGen_AArch32::Emit_Rotate64_MemMemAny<true>  },
+	{ OP_ROTR64, MATCH_MEMORY64, MATCH_MEMORY64, MATCH_ANY, MATCH_NIL, &CCodeGen_AArch32::Emit_Rotate64_MemMemAny<false> },
+
 	{ OP_CMP64, MATCH_VARIABLE, MATCH_MEMORY64, MATCH_MEMORY64,   MATCH_NIL, &CCodeGen_AArch32::Emit_Cmp64_VarMemAny },
 	{ OP_CMP64, MATCH_VARIABLE, MATCH_MEMORY64, MATCH_CONSTANT64, MATCH_NIL, &CCodeGen_AArch32::Emit_Cmp64_VarMemAny },
 
@@ -20,6 +20,16 @@ extern "C" int32 CodeGen_AArch32_mod_signed(int32 a, int32 b)
 	return a % b;
 }
 
+extern "C" uint64 CodeGen_AArch32_div64_unsigned(uint64 a, uint64 b)
+{
+	return a / b;
+}
+
+extern "C" int64 CodeGen_AArch32_div64_signed(int64 a, int64 b)
+{
+	return a / b;
+}
+
 template <bool isSigned>
 void CCodeGen_AArch32::Div_GenericTmp64AnyAnySoft(const STATEMENT& statement)
 {
@@ -119,3 +129,22 @@ void CCodeGen_AArch32::Emit_DivTmp64AnyAny(const STATEMENT& statement)
 		Div_GenericTmp64AnyAnySoft<isSigned>(statement);
 	}
 }
+
+template <bool isSigned>
+void CCodeGen_AArch32::Emit_Div64_MemAnyAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto divFct = isSigned ? reinterpret_cast<uintptr_t>(&CodeGen_AArch32_div64_signed) : reinterpret_cast<uintptr_t>(&CodeGen_AArch32_div64_unsigned);
+
+	//Operands are passed in r0:r1 and r2:r3, result comes back in r0:r1
+	LoadSymbol64InRegisters(CAArch32Assembler::r0, CAArch32Assembler::r1, src1);
+	LoadSymbol64InRegisters(CAArch32Assembler::r2, CAArch32Assembler::r3, src2);
+
+	LoadConstantPtrInRegister(CAArch32Assembler::r12, divFct);
+	m_assembler.Blx(CAArch32Assembler::r12);
+
+	StoreRegistersInMemory64(dst, CAArch32Assembler::r0, CAArch32Assembler::r1);
+}
@@ -1,7 +1,24 @@
+#include <cstring>
 #include "Jitter_CodeGen_AArch32.h"
 
 using namespace Jitter;
 
+//Values are passed as raw bits so that these don't depend on the float ABI in use
+extern "C" uint64 CodeGen_AArch32_fp64_toint64_trunc(uint64 value)
+{
+	double source = 0;
+	memcpy(&source, &value, sizeof(double));
+	return static_cast<uint64>(static_cast<int64>(source));
+}
+
+extern "C" uint64 CodeGen_AArch32_int64_tofp64(uint64 value)
+{
+	double result = static_cast<double>(static_cast<int64>(value));
+	uint64 resultBits = 0;
+	memcpy(&resultBits, &result, sizeof(double));
+	return resultBits;
+}
+
 void CCodeGen_AArch32::LoadMemoryFp32InRegister(CTempRegisterContext& tempRegContext, CAArch32Assembler::SINGLE_REGISTER reg, CSymbol* symbol)
 {
 	switch(symbol->m_type)
@@ -104,6 +121,70 @@ void CCodeGen_AArch32::StoreRegisterInTemporaryFp32(CTempRegisterContext& tempRe
 	}
 }
 
+void CCodeGen_AArch32::LoadMemoryFp64InRegister(CTempRegisterContext& tempRegContext, CAArch32Assembler::DOUBLE_REGISTER reg, CSymbol* symbol)
+{
+	auto baseRegister = CAArch32Assembler::rSP;
+	uint32 offset = 0;
+	switch(symbol->m_type)
+	{
+	case SYM_FP_RELATIVE64:
+		baseRegister = g_baseRegister;
+		offset = symbol->m_valueLow;
+		break;
+	case SYM_FP_TEMPORARY64:
+		baseRegister = CAArch32Assembler::rSP;
+		offset = symbol->m_stackLocation + m_stackLevel;
+		break;
+	default:
+		assert(false);
+		break;
+	}
+	if((offset / 4) < 0x100)
+	{
+		m_assembler.Vldr(reg, baseRegister, CAArch32Assembler::MakeImmediateLdrAddress(offset));
+	}
+	else
+	{
+		auto offsetRegister = tempRegContext.Allocate();
+		LoadConstantInRegister(offsetRegister, offset);
+		m_assembler.Add(offsetRegister, offsetRegister, baseRegister);
+		m_assembler.Vldr(reg, offsetRegister, CAArch32Assembler::MakeImmediateLdrAddress(0));
+		tempRegContext.Release(offsetRegister);
+	}
+}
+
+void CCodeGen_AArch32::StoreRegisterInMemoryFp64(CTempRegisterContext& tempRegContext, CSymbol* symbol, CAArch32Assembler::DOUBLE_REGISTER reg)
+{
+	auto baseRegister = CAArch32Assembler::rSP;
+	uint32 offset = 0;
+	switch(symbol->m_type)
+	{
+	case SYM_FP_RELATIVE64:
+		baseRegister = g_baseRegister;
+		offset = symbol->m_valueLow;
+		break;
+	case SYM_FP_TEMPORARY64:
+		baseRegister = CAArch32Assembler::rSP;
+		offset = symbol->m_stackLocation + m_stackLevel;
+		break;
+	default:
+		assert(false);
+		break;
+	}
+	if((offset / 4) < 0x100)
+	{
+		m_assembler.Vstr(reg, baseRegister, CAArch32Assembler::MakeImmediateLdrAddress(offset));
+	}
+	else
+	{
+		auto offsetRegister = tempRegContext.Allocate();
+		LoadConstantInRegister(offsetRegister, offset);
+		m_assembler.Add(offsetRegister, offsetRegister, baseRegister);
+		m_assembler.Vstr(reg, offsetRegister, CAArch32Assembler::MakeImmediateLdrAddress(0));
+		tempRegContext.Release(offsetRegister);
+	}
+}
+
 template <typename FPUOP>
 void CCodeGen_AArch32::Emit_Fpu_MemMem(const STATEMENT& statement)
 {
@@ -279,6 +360,192 @@ void CCodeGen_AArch32::Emit_Fp_LdCst_TmpCst(const STATEMENT& statement)
 	m_assembler.Str(CAArch32Assembler::r0, CAArch32Assembler::rSP, CAArch32Assembler::MakeImmediateLdrAddress(dst->m_stackLocation + m_stackLevel));
 }
 
+template <typename FPUOP>
+void CCodeGen_AArch32::Emit_Fpu64_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	CTempRegisterContext tempRegisterContext;
+
+	LoadMemoryFp64InRegister(tempRegisterContext, CAArch32Assembler::d0, src1);
+	((m_assembler).*(FPUOP::OpReg()))(CAArch32Assembler::d1, CAArch32Assembler::d0);
+	StoreRegisterInMemoryFp64(tempRegisterContext, dst, CAArch32Assembler::d1);
+}
+
+template <typename FPUOP>
+void CCodeGen_AArch32::Emit_Fpu64_MemMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	CTempRegisterContext tempRegisterContext;
+
+	LoadMemoryFp64InRegister(tempRegisterContext, CAArch32Assembler::d0, src1);
+	LoadMemoryFp64InRegister(tempRegisterContext, CAArch32Assembler::d1, src2);
+	((m_assembler).*(FPUOP::OpReg()))(CAArch32Assembler::d2, CAArch32Assembler::d0, CAArch32Assembler::d1);
+	StoreRegisterInMemoryFp64(tempRegisterContext, dst, CAArch32Assembler::d2);
+}
+
+template <bool isMax>
+void CCodeGen_AArch32::Emit_Fp_MinMaxD_MemMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	CTempRegisterContext tempRegisterContext;
+
+	//No scalar min/max for doubles in VFP, compare and select src2 if it wins
+	LoadMemoryFp64InRegister(tempRegisterContext, CAArch32Assembler::d0, src1);
+	LoadMemoryFp64InRegister(tempRegisterContext, CAArch32Assembler::d1, src2);
+	m_assembler.Vcmp_F64(CAArch32Assembler::d0, CAArch32Assembler::d1);
+	m_assembler.Vmrs(CAArch32Assembler::rPC); //Move to general purpose status register
+	m_assembler.VmovCc_F64(isMax ? CAArch32Assembler::CONDITION_MI : CAArch32Assembler::CONDITION_GT, CAArch32Assembler::d0, CAArch32Assembler::d1);
+	StoreRegisterInMemoryFp64(tempRegisterContext, dst, CAArch32Assembler::d0);
+}
+
+void CCodeGen_AArch32::Emit_Fp_CmpD_AnyMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	CTempRegisterContext tempRegisterContext;
+
+	auto tmpReg = tempRegisterContext.Allocate();
+	auto dstReg = PrepareSymbolRegisterDef(dst, tmpReg);
+
+	m_assembler.Mov(dstReg, CAArch32Assembler::MakeImmediateAluOperand(0, 0));
+	LoadMemoryFp64InRegister(tempRegisterContext, CAArch32Assembler::d0, src1);
+	LoadMemoryFp64InRegister(tempRegisterContext, CAArch32Assembler::d1, src2);
+	m_assembler.Vcmp_F64(CAArch32Assembler::d0, CAArch32Assembler::d1);
+	m_assembler.Vmrs(CAArch32Assembler::rPC); //Move to general purpose status register
+	switch(statement.jmpCondition)
+	{
+	case Jitter::CONDITION_AB:
+		m_assembler.MovCc(CAArch32Assembler::CONDITION_GT, dstReg, CAArch32Assembler::MakeImmediateAluOperand(1, 0));
+		break;
+	case Jitter::CONDITION_BE:
+		m_assembler.MovCc(CAArch32Assembler::CONDITION_LS, dstReg, CAArch32Assembler::MakeImmediateAluOperand(1, 0));
+		break;
+	case Jitter::CONDITION_BL:
+		m_assembler.MovCc(CAArch32Assembler::CONDITION_MI, dstReg, CAArch32Assembler::MakeImmediateAluOperand(1, 0));
+		break;
+	case Jitter::CONDITION_EQ:
+		m_assembler.MovCc(CAArch32Assembler::CONDITION_EQ, dstReg, CAArch32Assembler::MakeImmediateAluOperand(1, 0));
+		break;
+	default:
+		assert(0);
+		break;
+	}
+
+	CommitSymbolRegister(dst, dstReg);
+	tempRegisterContext.Release(tmpReg);
+}
+
+void CCodeGen_AArch32::Emit_Fp_ToDoubleS_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	CTempRegisterContext tempRegisterContext;
+
+	LoadMemoryFp32InRegister(tempRegisterContext, CAArch32Assembler::s0, src1);
+	m_assembler.Vcvt_F64_F32(CAArch32Assembler::d1, CAArch32Assembler::s0);
+	StoreRegisterInMemoryFp64(tempRegisterContext, dst, CAArch32Assembler::d1);
+}
+
+void CCodeGen_AArch32::Emit_Fp_ToSingleD_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	CTempRegisterContext tempRegisterContext;
+
+	LoadMemoryFp64InRegister(tempRegisterContext, CAArch32Assembler::d1, src1);
+	m_assembler.Vcvt_F32_F64(CAArch32Assembler::s0, CAArch32Assembler::d1);
+	StoreRegisterInMemoryFp32(tempRegisterContext, dst, CAArch32Assembler::s0);
+}
+
+void CCodeGen_AArch32::Emit_Fp_ToInt32TruncD_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	CTempRegisterContext tempRegisterContext;
+
+	LoadMemoryFp64InRegister(tempRegisterContext, CAArch32Assembler::d1, src1);
+	m_assembler.Vcvt_S32_F64(CAArch32Assembler::s0, CAArch32Assembler::d1);
+	StoreRegisterInMemoryFp32(tempRegisterContext, dst, CAArch32Assembler::s0);
+}
+
+void CCodeGen_AArch32::Emit_Fp_ToDoubleI32_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	CTempRegisterContext tempRegisterContext;
+
+	LoadMemoryFp32InRegister(tempRegisterContext, CAArch32Assembler::s0, src1);
+	m_assembler.Vcvt_F64_S32(CAArch32Assembler::d1, CAArch32Assembler::s0);
+	StoreRegisterInMemoryFp64(tempRegisterContext, dst, CAArch32Assembler::d1);
+}
+
+void CCodeGen_AArch32::Emit_Fp_ToInt64TruncD_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	CTempRegisterContext tempRegisterContext;
+
+	//VFP can't convert 64-bit integers, value is passed in r0:r1 and result comes back in r0:r1
+	LoadMemoryFp64InRegister(tempRegisterContext, CAArch32Assembler::d0, src1);
+	m_assembler.Vmov(CAArch32Assembler::r0, CAArch32Assembler::d0, 0);
+	m_assembler.Vmov(CAArch32Assembler::r1, CAArch32Assembler::d0, 1);
+
+	LoadConstantPtrInRegister(CAArch32Assembler::r12, reinterpret_cast<uintptr_t>(&CodeGen_AArch32_fp64_toint64_trunc));
+	m_assembler.Blx(CAArch32Assembler::r12);
+
+	m_assembler.Vmov(CAArch32Assembler::d0, CAArch32Assembler::r0, 0);
+	m_assembler.Vmov(CAArch32Assembler::d0, CAArch32Assembler::r1, 1);
+	StoreRegisterInMemoryFp64(tempRegisterContext, dst, CAArch32Assembler::d0);
+}
+
+void CCodeGen_AArch32::Emit_Fp_ToDoubleI64_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	CTempRegisterContext tempRegisterContext;
+
+	LoadMemoryFp64InRegister(tempRegisterContext, CAArch32Assembler::d0, src1);
+	m_assembler.Vmov(CAArch32Assembler::r0, CAArch32Assembler::d0, 0);
+	m_assembler.Vmov(CAArch32Assembler::r1, CAArch32Assembler::d0, 1);
+
+	LoadConstantPtrInRegister(CAArch32Assembler::r12, reinterpret_cast<uintptr_t>(&CodeGen_AArch32_int64_tofp64));
+	m_assembler.Blx(CAArch32Assembler::r12);
+
+	m_assembler.Vmov(CAArch32Assembler::d0, CAArch32Assembler::r0, 0);
+	m_assembler.Vmov(CAArch32Assembler::d0, CAArch32Assembler::r1, 1);
+	StoreRegisterInMemoryFp64(tempRegisterContext, dst, CAArch32Assembler::d0);
+}
+
+void CCodeGen_AArch32::Emit_Fp64_LdCst_TmpCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	assert(dst->m_type == SYM_FP_TEMPORARY64);
+	assert(src1->m_type == SYM_CONSTANT64);
+
+	LoadConstantInRegister(CAArch32Assembler::r0, src1->m_valueLow);
+	m_assembler.Str(CAArch32Assembler::r0, CAArch32Assembler::rSP, CAArch32Assembler::MakeImmediateLdrAddress(dst->m_stackLocation + m_stackLevel + 0));
+	LoadConstantInRegister(CAArch32Assembler::r0, src1->m_valueHigh);
+	m_assembler.Str(CAArch32Assembler::r0, CAArch32Assembler::rSP, CAArch32Assembler::MakeImmediateLdrAddress(dst->m_stackLocation + m_stackLevel + 4));
+}
+
 void CCodeGen_AArch32::Emit_Fp_SetRoundingMode_Cst(const STATEMENT& statement)
 {
 	//TODO: Implement
@@ -313,6 +580,29 @@ CCodeGen_AArch32::CONSTMATCHER CCodeGen_AArch32::g_fpuConstMatchers[] =
 
 	{ OP_FP_SETROUNDINGMODE, MATCH_NIL, MATCH_CONSTANT, MATCH_NIL, MATCH_NIL, &CCodeGen_AArch32::Emit_Fp_SetRoundingMode_Cst },
 
+	{ OP_FP_ADD_D, MATCH_FP_MEMORY64, MATCH_FP_MEMORY64, MATCH_FP_MEMORY64, MATCH_NIL, &CCodeGen_AArch32::Emit_Fpu64_MemMemMem<FPU64OP_ADD> },
+	{ OP_FP_SUB_D, MATCH_FP_MEMORY64, MATCH_FP_MEMORY64, MATCH_FP_MEMORY64, MATCH_NIL, &CCodeGen_AArch32::Emit_Fpu64_MemMemMem<FPU64OP_SUB> },
+	{ OP_FP_MUL_D, MATCH_FP_MEMORY64, MATCH_FP_MEMORY64, MATCH_FP_MEMORY64, MATCH_NIL, &CCodeGen_AArch32::Emit_Fpu64_MemMemMem<FPU64OP_MUL> },
+	{ OP_FP_DIV_D, MATCH_FP_MEMORY64, MATCH_FP_MEMORY64, MATCH_FP_MEMORY64, MATCH_NIL, &CCodeGen_AArch32::Emit_Fpu64_MemMemMem<FPU64OP_DIV> },
+
+	{ OP_FP_CMP_D, MATCH_ANY, MATCH_FP_MEMORY64, MATCH_FP_MEMORY64, MATCH_NIL, &CCodeGen_AArch32::Emit_Fp_CmpD_AnyMemMem },
+
+	{ OP_FP_MIN_D, MATCH_FP_MEMORY64, MATCH_FP_MEMORY64, MATCH_FP_MEMORY64, MATCH_NIL, &CCodeGen_AArch32::Emit_Fp_MinMaxD_MemMemMem<false> },
+	{ OP_FP_MAX_D, MATCH_FP_MEMORY64, MATCH_FP_MEMORY64, MATCH_FP_MEMORY64, MATCH_NIL, &CCodeGen_AArch32::Emit_Fp_MinMaxD_MemMemMem<true>  },
+
+	{ OP_FP_ABS_D,  MATCH_FP_MEMORY64, MATCH_FP_MEMORY64, MATCH_NIL, MATCH_NIL, &CCodeGen_AArch32::Emit_Fpu64_MemMem<FPU64OP_ABS>  },
+	{ OP_FP_NEG_D,  MATCH_FP_MEMORY64, MATCH_FP_MEMORY64, MATCH_NIL, MATCH_NIL, &CCodeGen_AArch32::Emit_Fpu64_MemMem<FPU64OP_NEG>  },
+	{ OP_FP_SQRT_D, MATCH_FP_MEMORY64, MATCH_FP_MEMORY64, MATCH_NIL, MATCH_NIL, &CCodeGen_AArch32::Emit_Fpu64_MemMem<FPU64OP_SQRT> },
+
+	{ OP_FP_TODOUBLE_S,      MATCH_FP_MEMORY64, MATCH_FP_MEMORY32, MATCH_NIL, MATCH_NIL, &CCodeGen_AArch32::Emit_Fp_ToDoubleS_MemMem      },
+	{ OP_FP_TOSINGLE_D,      MATCH_FP_MEMORY32, MATCH_FP_MEMORY64, MATCH_NIL, MATCH_NIL, &CCodeGen_AArch32::Emit_Fp_ToSingleD_MemMem      },
+	{ OP_FP_TOINT32_TRUNC_D, MATCH_FP_MEMORY32, MATCH_FP_MEMORY64, MATCH_NIL, MATCH_NIL, &CCodeGen_AArch32::Emit_Fp_ToInt32TruncD_MemMem  },
+	{ OP_FP_TODOUBLE_I32,    MATCH_FP_MEMORY64, MATCH_FP_MEMORY32, MATCH_NIL, MATCH_NIL, &CCodeGen_AArch32::Emit_Fp_ToDoubleI32_MemMem    },
+	{ OP_FP_TOINT64_TRUNC_D, MATCH_FP_MEMORY64, MATCH_FP_MEMORY64, MATCH_NIL, MATCH_NIL, &CCodeGen_AArch32::Emit_Fp_ToInt64TruncD_MemMem  },
+	{ OP_FP_TODOUBLE_I64,    MATCH_FP_MEMORY64, MATCH_FP_MEMORY64, MATCH_NIL, MATCH_NIL, &CCodeGen_AArch32::Emit_Fp_ToDoubleI64_MemMem    },
+
+	{ OP_FP_LDCST, MATCH_FP_TEMPORARY64, MATCH_CONSTANT64, MATCH_NIL, MATCH_NIL, &CCodeGen_AArch32::Emit_Fp64_LdCst_TmpCst },
+
 	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
 };
 // clang-format on
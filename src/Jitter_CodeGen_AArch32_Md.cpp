@@ -229,6 +229,146 @@ void CCodeGen_AArch32::Emit_Md_DivS_MemMemMem(const STATEMENT& statement)
 	m_assembler.Vst1_32x4(dstReg, dstAddrReg);
 }
 
+void CCodeGen_AArch32::Emit_Md_SqrtS_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstAddrReg = CAArch32Assembler::r0;
+	auto src1AddrReg = CAArch32Assembler::r1;
+	auto dstReg = CAArch32Assembler::q0;
+	auto src1Reg = CAArch32Assembler::q1;
+
+	LoadMemory128AddressInRegister(dstAddrReg, dst);
+	LoadMemory128AddressInRegister(src1AddrReg, src1);
+
+	m_assembler.Vld1_32x4(src1Reg, src1AddrReg);
+
+	//No vector square root on NEON, gotta do it 4x
+	for(unsigned int i = 0; i < 4; i++)
+	{
+		auto subDstReg = static_cast<CAArch32Assembler::SINGLE_REGISTER>(dstReg * 2 + i);
+		auto subSrc1Reg = static_cast<CAArch32Assembler::SINGLE_REGISTER>(src1Reg * 2 + i);
+		m_assembler.Vsqrt_F32(subDstReg, subSrc1Reg);
+	}
+
+	m_assembler.Vst1_32x4(dstReg, dstAddrReg);
+}
+
+void CCodeGen_AArch32::Emit_Md_RsqrtS_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstAddrReg = CAArch32Assembler::r0;
+	auto src1AddrReg = CAArch32Assembler::r1;
+	auto src1Reg = CAArch32Assembler::q0;
+	auto estReg = CAArch32Assembler::q1;
+	auto tmpReg = CAArch32Assembler::q2;
+	auto stepReg = CAArch32Assembler::q3;
+
+	LoadMemory128AddressInRegister(dstAddrReg, dst);
+	LoadMemory128AddressInRegister(src1AddrReg, src1);
+
+	//Same estimate and refinement step as the scalar version
+	m_assembler.Vld1_32x4(src1Reg, src1AddrReg);
+	m_assembler.Vrsqrte_F32(estReg, src1Reg);
+	m_assembler.Vmul_F32(tmpReg, src1Reg, estReg);
+	m_assembler.Vrsqrts_F32(stepReg, tmpReg, estReg);
+	m_assembler.Vmul_F32(estReg, estReg, stepReg);
+	m_assembler.Vst1_32x4(estReg, dstAddrReg);
+}
+
+void CCodeGen_AArch32::Emit_Md_RcplS_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstAddrReg = CAArch32Assembler::r0;
+	auto src1AddrReg = CAArch32Assembler::r1;
+	auto src1Reg = CAArch32Assembler::q0;
+	auto estReg = CAArch32Assembler::q1;
+	auto stepReg = CAArch32Assembler::q2;
+
+	LoadMemory128AddressInRegister(dstAddrReg, dst);
+	LoadMemory128AddressInRegister(src1AddrReg, src1);
+
+	//Same estimate and refinement step as the scalar version
+	m_assembler.Vld1_32x4(src1Reg, src1AddrReg);
+	m_assembler.Vrecpe_F32(estReg, src1Reg);
+	m_assembler.Vrecps_F32(stepReg, estReg, src1Reg);
+	m_assembler.Vmul_F32(estReg, estReg, stepReg);
+	m_assembler.Vst1_32x4(estReg, dstAddrReg);
+}
+
+void CCodeGen_AArch32::Emit_Md_DotS_MemMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	uint8 mask = static_cast<uint8>(statement.jmpCondition);
+
+	auto dstAddrReg = CAArch32Assembler::r0;
+	auto src1AddrReg = CAArch32Assembler::r1;
+	auto src2AddrReg = CAArch32Assembler::r2;
+	auto cstAddrReg = CAArch32Assembler::r3;
+	auto dstReg = CAArch32Assembler::q0;
+	auto src1Reg = CAArch32Assembler::q1;
+	auto src2Reg = CAArch32Assembler::q2;
+	auto maskReg = CAArch32Assembler::q3;
+	auto dstLoReg = static_cast<CAArch32Assembler::DOUBLE_REGISTER>(dstReg);
+	auto dstHiReg = static_cast<CAArch32Assembler::DOUBLE_REGISTER>(dstReg + 1);
+
+	LoadMemory128AddressInRegister(dstAddrReg, dst);
+	LoadMemory128AddressInRegister(src1AddrReg, src1);
+	LoadMemory128AddressInRegister(src2AddrReg, src2);
+
+	m_assembler.Vld1_32x4(src1Reg, src1AddrReg);
+	m_assembler.Vld1_32x4(src2Reg, src2AddrReg);
+	m_assembler.Vmul_F32(dstReg, src1Reg, src2Reg);
+	m_assembler.Adrl(cstAddrReg, MakeMdLaneMaskLiteral(mask >> 4));
+	m_assembler.Vld1_32x4(maskReg, cstAddrReg);
+	m_assembler.Vand(dstReg, dstReg, maskReg);
+
+	//Sum is done as (p0 + p1) + (p2 + p3)
+	m_assembler.Vpadd_F32(dstLoReg, dstLoReg, dstHiReg);
+	m_assembler.Vpadd_F32(dstLoReg, dstLoReg, dstLoReg);
+	m_assembler.Vdup_32(dstReg, dstLoReg, 0);
+
+	m_assembler.Adrl(cstAddrReg, MakeMdLaneMaskLiteral(mask & 0x0F));
+	m_assembler.Vld1_32x4(maskReg, cstAddrReg);
+	m_assembler.Vand(dstReg, dstReg, maskReg);
+	m_assembler.Vst1_32x4(dstReg, dstAddrReg);
+}
+
+void CCodeGen_AArch32::Emit_Md_HaddS_MemMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstAddrReg = CAArch32Assembler::r0;
+	auto src1AddrReg = CAArch32Assembler::r1;
+	auto src2AddrReg = CAArch32Assembler::r2;
+	auto dstReg = CAArch32Assembler::q0;
+	auto src1Reg = CAArch32Assembler::q1;
+	auto src2Reg = CAArch32Assembler::q2;
+
+	LoadMemory128AddressInRegister(dstAddrReg, dst);
+	LoadMemory128AddressInRegister(src1AddrReg, src1);
+	LoadMemory128AddressInRegister(src2AddrReg, src2);
+
+	m_assembler.Vld1_32x4(src1Reg, src1AddrReg);
+	m_assembler.Vld1_32x4(src2Reg, src2AddrReg);
+	m_assembler.Vpadd_F32(static_cast<CAArch32Assembler::DOUBLE_REGISTER>(dstReg),
+	                      static_cast<CAArch32Assembler::DOUBLE_REGISTER>(src1Reg),
+	                      static_cast<CAArch32Assembler::DOUBLE_REGISTER>(src1Reg + 1));
+	m_assembler.Vpadd_F32(static_cast<CAArch32Assembler::DOUBLE_REGISTER>(dstReg + 1),
+	                      static_cast<CAArch32Assembler::DOUBLE_REGISTER>(src2Reg),
+	                      static_cast<CAArch32Assembler::DOUBLE_REGISTER>(src2Reg + 1));
+	m_assembler.Vst1_32x4(dstReg, dstAddrReg);
+}
+
 void CCodeGen_AArch32::Emit_Md_Srl256_MemMemCst(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -500,6 +640,137 @@ void CCodeGen_AArch32::Emit_Md_ExpandW_VarVarCst(const STATEMENT& statement)
 	m_assembler.Vst1_32x4(dstReg, dstAddrReg);
 }
 
+void CCodeGen_AArch32::Emit_Md_Shuffle(CSymbol* dst, CSymbol* src1, const LITERAL128& pattern)
+{
+	auto dstAddrReg = CAArch32Assembler::r0;
+	auto src1AddrReg = CAArch32Assembler::r1;
+	auto cstAddrReg = CAArch32Assembler::r2;
+	auto dstReg = CAArch32Assembler::q0;
+	auto src1Reg = CAArch32Assembler::q1;
+	auto patternReg = CAArch32Assembler::q3;
+
+	LoadMemory128AddressInRegister(dstAddrReg, dst);
+	LoadMemory128AddressInRegister(src1AddrReg, src1);
+
+	m_assembler.Vld1_32x4(src1Reg, src1AddrReg);
+	m_assembler.Adrl(cstAddrReg, pattern);
+	m_assembler.Vld1_32x4(patternReg, cstAddrReg);
+
+	//VTBL produces 8 bytes at a time, out of range indices give 0
+	m_assembler.Vtbl(
+	    static_cast<CAArch32Assembler::DOUBLE_REGISTER>(dstReg),
+	    static_cast<CAArch32Assembler::DOUBLE_REGISTER>(src1Reg),
+	    static_cast<CAArch32Assembler::DOUBLE_REGISTER>(patternReg));
+	m_assembler.Vtbl(
+	    static_cast<CAArch32Assembler::DOUBLE_REGISTER>(dstReg + 1),
+	    static_cast<CAArch32Assembler::DOUBLE_REGISTER>(src1Reg),
+	    static_cast<CAArch32Assembler::DOUBLE_REGISTER>(patternReg + 1));
+	m_assembler.Vst1_32x4(dstReg, dstAddrReg);
+}
+
+void CCodeGen_AArch32::Emit_Md_ShuffleW_MemMemCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	Emit_Md_Shuffle(dst, src1, MakeMdShuffleWLiteral(static_cast<uint8>(src2->m_valueLow)));
+}
+
+void CCodeGen_AArch32::Emit_Md_ShuffleB_MemMemCstCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	Emit_Md_Shuffle(dst, src1, MakeMdShuffleBLiteral(src2->GetConstant64(), src3->GetConstant64()));
+}
+
+void CCodeGen_AArch32::Emit_Md_InsertW_MemMemAnyCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	assert(src3->m_valueLow < 4);
+
+	auto dstAddrReg = CAArch32Assembler::r0;
+	auto src1AddrReg = CAArch32Assembler::r1;
+	auto dstReg = CAArch32Assembler::q0;
+	auto laneReg = static_cast<CAArch32Assembler::DOUBLE_REGISTER>(dstReg + (src3->m_valueLow / 2));
+
+	LoadMemory128AddressInRegister(dstAddrReg, dst);
+	LoadMemory128AddressInRegister(src1AddrReg, src1);
+
+	auto src2Reg = PrepareSymbolRegisterUse(src2, CAArch32Assembler::r2);
+
+	m_assembler.Vld1_32x4(dstReg, src1AddrReg);
+	m_assembler.Vmov(laneReg, src2Reg, src3->m_valueLow & 1);
+	m_assembler.Vst1_32x4(dstReg, dstAddrReg);
+}
+
+void CCodeGen_AArch32::Emit_Md_InsertW_MemMemFpmemCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	assert(src3->m_valueLow < 4);
+
+	auto dstAddrReg = CAArch32Assembler::r0;
+	auto src1AddrReg = CAArch32Assembler::r1;
+	auto dstReg = CAArch32Assembler::q0;
+	auto laneReg = static_cast<CAArch32Assembler::SINGLE_REGISTER>((dstReg * 2) + src3->m_valueLow);
+
+	LoadMemory128AddressInRegister(src1AddrReg, src1);
+	m_assembler.Vld1_32x4(dstReg, src1AddrReg);
+
+	//Temporary registers used here start from r0, load the destination address afterwards
+	CTempRegisterContext tempRegisterContext;
+	LoadMemoryFp32InRegister(tempRegisterContext, laneReg, src2);
+
+	LoadMemory128AddressInRegister(dstAddrReg, dst);
+	m_assembler.Vst1_32x4(dstReg, dstAddrReg);
+}
+
+void CCodeGen_AArch32::Emit_Md_ExtractW_VarMemCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	assert(src2->m_valueLow < 4);
+
+	auto src1AddrReg = CAArch32Assembler::r1;
+	auto dstReg = PrepareSymbolRegisterDef(dst, CAArch32Assembler::r0);
+
+	LoadMemory128AddressInRegister(src1AddrReg, src1, src2->m_valueLow * 4);
+	m_assembler.Ldr(dstReg, src1AddrReg, CAArch32Assembler::MakeImmediateLdrAddress(0));
+
+	CommitSymbolRegister(dst, dstReg);
+}
+
+void CCodeGen_AArch32::Emit_Md_ExtractW_FpmemMemCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	assert(src2->m_valueLow < 4);
+
+	auto src1AddrReg = CAArch32Assembler::r1;
+	auto laneReg = CAArch32Assembler::s0;
+
+	LoadMemory128AddressInRegister(src1AddrReg, src1, src2->m_valueLow * 4);
+	m_assembler.Vldr(laneReg, src1AddrReg, CAArch32Assembler::MakeImmediateLdrAddress(0));
+
+	CTempRegisterContext tempRegisterContext;
+	StoreRegisterInMemoryFp32(tempRegisterContext, dst, laneReg);
+}
+
 void CCodeGen_AArch32::Emit_Md_ClampS_MemMem(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -667,6 +938,70 @@ void CCodeGen_AArch32::Emit_Md_PackWH_MemMemMem(const STATEMENT& statement)
 	m_assembler.Vst1_32x4(dstReg, dstAddrReg);
 }
 
+template <bool isSigned>
+void CCodeGen_AArch32::Emit_Md_MulHiH_MemMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstAddrReg = CAArch32Assembler::r0;
+	auto src1AddrReg = CAArch32Assembler::r1;
+	auto src2AddrReg = CAArch32Assembler::r2;
+	auto lowReg = CAArch32Assembler::q0;
+	auto src1Reg = CAArch32Assembler::q1;
+	auto src2Reg = CAArch32Assembler::q2;
+	auto highReg = CAArch32Assembler::q3;
+
+	LoadMemory128AddressInRegister(dstAddrReg, dst);
+	LoadMemory128AddressInRegister(src1AddrReg, src1);
+	LoadMemory128AddressInRegister(src2AddrReg, src2);
+
+	m_assembler.Vld1_32x4(src1Reg, src1AddrReg);
+	m_assembler.Vld1_32x4(src2Reg, src2AddrReg);
+	auto mullOp = isSigned ? &CAArch32Assembler::Vmull_S16 : &CAArch32Assembler::Vmull_U16;
+	((m_assembler).*(mullOp))(lowReg,
+	                          static_cast<CAArch32Assembler::DOUBLE_REGISTER>(src1Reg + 0),
+	                          static_cast<CAArch32Assembler::DOUBLE_REGISTER>(src2Reg + 0));
+	((m_assembler).*(mullOp))(highReg,
+	                          static_cast<CAArch32Assembler::DOUBLE_REGISTER>(src1Reg + 1),
+	                          static_cast<CAArch32Assembler::DOUBLE_REGISTER>(src2Reg + 1));
+	//Odd halfwords (upper halves of the products) end up in the second register
+	m_assembler.Vuzp_I16(lowReg, highReg);
+	m_assembler.Vst1_32x4(highReg, dstAddrReg);
+}
+
+template <bool isSigned>
+void CCodeGen_AArch32::Emit_Md_MulWD_MemMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstAddrReg = CAArch32Assembler::r0;
+	auto src1AddrReg = CAArch32Assembler::r1;
+	auto src2AddrReg = CAArch32Assembler::r2;
+	auto dstReg = CAArch32Assembler::q0;
+	auto src1Reg = CAArch32Assembler::q1;
+	auto src2Reg = CAArch32Assembler::q2;
+	auto evenReg = CAArch32Assembler::q3;
+
+	LoadMemory128AddressInRegister(dstAddrReg, dst);
+	LoadMemory128AddressInRegister(src1AddrReg, src1);
+	LoadMemory128AddressInRegister(src2AddrReg, src2);
+
+	m_assembler.Vld1_32x4(src1Reg, src1AddrReg);
+	m_assembler.Vld1_32x4(src2Reg, src2AddrReg);
+	//Narrowing each 64-bit lane gathers the even 32-bit lanes
+	m_assembler.Vmovn_I64(static_cast<CAArch32Assembler::DOUBLE_REGISTER>(evenReg + 0), src1Reg);
+	m_assembler.Vmovn_I64(static_cast<CAArch32Assembler::DOUBLE_REGISTER>(evenReg + 1), src2Reg);
+	auto mullOp = isSigned ? &CAArch32Assembler::Vmull_S32 : &CAArch32Assembler::Vmull_U32;
+	((m_assembler).*(mullOp))(dstReg,
+	                          static_cast<CAArch32Assembler::DOUBLE_REGISTER>(evenReg + 0),
+	                          static_cast<CAArch32Assembler::DOUBLE_REGISTER>(evenReg + 1));
+	m_assembler.Vst1_32x4(dstReg, dstAddrReg);
+}
+
 template <uint32 offset>
 void CCodeGen_AArch32::Emit_Md_UnpackBH_MemMemMem(const STATEMENT& statement)
 {
@@ -808,6 +1143,13 @@ CCodeGen_AArch32::CONSTMATCHER CCodeGen_AArch32::g_mdConstMatchers[] =
 	{ OP_MD_MAX_H, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_NIL, &CCodeGen_AArch32::Emit_Md_MemMemMem<MDOP_MAXH> },
 	{ OP_MD_MAX_W, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_NIL, &CCodeGen_AArch32::Emit_Md_MemMemMem<MDOP_MAXW> },
 
+	{ OP_MD_MUL_H, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_NIL, &CCodeGen_AArch32::Emit_Md_MemMemMem<MDOP_MULH> },
+	{ OP_MD_MULHS_H, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_NIL, &CCodeGen_AArch32::Emit_Md_MulHiH_MemMemMem<true> },
+	{ OP_MD_MULHU_H, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_NIL, &CCodeGen_AArch32::Emit_Md_MulHiH_MemMemMem<false> },
+	{ OP_MD_MUL_W, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_NIL, &CCodeGen_AArch32::Emit_Md_MemMemMem<MDOP_MULW> },
+	{ OP_MD_MULS_WD, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_NIL, &CCodeGen_AArch32::Emit_Md_MulWD_MemMemMem<true> },
+	{ OP_MD_MULU_WD, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_NIL, &CCodeGen_AArch32::Emit_Md_MulWD_MemMemMem<false> },
+
 	{ OP_MD_ADD_S, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_NIL, &CCodeGen_AArch32::Emit_Md_MemMemMem<MDOP_ADDS> },
 	{ OP_MD_SUB_S, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_NIL, &CCodeGen_AArch32::Emit_Md_MemMemMem<MDOP_SUBS> },
 	{ OP_MD_MUL_S, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_NIL, &CCodeGen_AArch32::Emit_Md_MemMemMem<MDOP_MULS> },
@@ -818,6 +1160,12 @@ CCodeGen_AArch32::CONSTMATCHER CCodeGen_AArch32::g_mdConstMatchers[] =
 	{ OP_MD_MIN_S, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_NIL, &CCodeGen_AArch32::Emit_Md_MemMemMem<FPUMDOP_MIN> },
 	{ OP_MD_MAX_S, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_NIL, &CCodeGen_AArch32::Emit_Md_MemMemMem<FPUMDOP_MAX> },
 
+	{ OP_MD_SQRT_S,  MATCH_MEMORY128, MATCH_MEMORY128, MATCH_NIL,       MATCH_NIL, &CCodeGen_AArch32::Emit_Md_SqrtS_MemMem     },
+	{ OP_MD_RSQRT_S, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_NIL,       MATCH_NIL, &CCodeGen_AArch32::Emit_Md_RsqrtS_MemMem    },
+	{ OP_MD_RCPL_S,  MATCH_MEMORY128, MATCH_MEMORY128, MATCH_NIL,       MATCH_NIL, &CCodeGen_AArch32::Emit_Md_RcplS_MemMem     },
+	{ OP_MD_DOT_S,   MATCH_MEMORY128, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_NIL, &CCodeGen_AArch32::Emit_Md_DotS_MemMemMem   },
+	{ OP_MD_HADD_S,  MATCH_MEMORY128, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_NIL, &CCodeGen_AArch32::Emit_Md_HaddS_MemMemMem  },
+
 	{ OP_MD_CMPLT_S, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_NIL, &CCodeGen_AArch32::Emit_Md_MemMemMemRev<FPUMDOP_CMPGT> },
 	{ OP_MD_CMPGT_S, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_NIL, &CCodeGen_AArch32::Emit_Md_MemMemMem<FPUMDOP_CMPGT>    },
 
@@ -861,6 +1209,13 @@ CCodeGen_AArch32::CONSTMATCHER CCodeGen_AArch32::g_mdConstMatchers[] =
 	{ OP_MD_EXPAND_W, MATCH_MEMORY128,   MATCH_CONSTANT,    MATCH_NIL,      MATCH_NIL, &CCodeGen_AArch32::Emit_Md_ExpandW_MemCst    },
 	{ OP_MD_EXPAND_W, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_CONSTANT, MATCH_NIL, &CCodeGen_AArch32::Emit_Md_ExpandW_VarVarCst },
 
+	{ OP_MD_SHUFFLE_W, MATCH_MEMORY128,   MATCH_MEMORY128, MATCH_CONSTANT,    MATCH_NIL,        &CCodeGen_AArch32::Emit_Md_ShuffleW_MemMemCst     },
+	{ OP_MD_SHUFFLE_B, MATCH_MEMORY128,   MATCH_MEMORY128, MATCH_CONSTANT64,  MATCH_CONSTANT64, &CCodeGen_AArch32::Emit_Md_ShuffleB_MemMemCstCst  },
+	{ OP_MD_INSERT_W,  MATCH_MEMORY128,   MATCH_MEMORY128, MATCH_ANY32,       MATCH_CONSTANT,   &CCodeGen_AArch32::Emit_Md_InsertW_MemMemAnyCst   },
+	{ OP_MD_INSERT_W,  MATCH_MEMORY128,   MATCH_MEMORY128, MATCH_FP_MEMORY32, MATCH_CONSTANT,   &CCodeGen_AArch32::Emit_Md_InsertW_MemMemFpmemCst },
+	{ OP_MD_EXTRACT_W, MATCH_VARIABLE,    MATCH_MEMORY128, MATCH_CONSTANT,    MATCH_NIL,        &CCodeGen_AArch32::Emit_Md_ExtractW_VarMemCst     },
+	{ OP_MD_EXTRACT_W, MATCH_FP_MEMORY32, MATCH_MEMORY128, MATCH_CONSTANT,    MATCH_NIL,        &CCodeGen_AArch32::Emit_Md_ExtractW_FpmemMemCst   },
+
 	{ OP_MD_PACK_HB, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_NIL, &CCodeGen_AArch32::Emit_Md_PackHB_MemMemMem },
 	{ OP_MD_PACK_WH, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_MEMORY128, MATCH_NIL, &CCodeGen_AArch32::Emit_Md_PackWH_MemMemMem },
 
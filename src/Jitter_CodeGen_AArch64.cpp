@@ -244,17 +244,15 @@ void CCodeGen_AArch64::Emit_Logic_VarVarCst(const STATEMENT& statement)
 }
 
 template <bool isSigned>
-void CCodeGen_AArch64::Emit_Mul_Tmp64AnyAny(const STATEMENT& statement)
+void CCodeGen_AArch64::Emit_Mul_Var64AnyAny(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
 	auto src1 = statement.src1->GetSymbol().get();
 	auto src2 = statement.src2->GetSymbol().get();
 
-	assert(dst->m_type == SYM_TEMPORARY64);
-
 	auto src1Reg = PrepareSymbolRegisterUse(src1, GetNextTempRegister());
 	auto src2Reg = PrepareSymbolRegisterUse(src2, GetNextTempRegister());
-	auto dstReg = GetNextTempRegister64();
+	auto dstReg = PrepareSymbolRegisterDef64(dst, GetNextTempRegister64());
 
 	if(isSigned)
 	{
@@ -265,18 +263,16 @@ void CCodeGen_AArch64::Emit_Mul_Tmp64AnyAny(const STATEMENT& statement)
 		m_assembler.Umull(dstReg, src1Reg, src2Reg);
 	}
 
-	m_assembler.Str(dstReg, CAArch64Assembler::xSP, dst->m_stackLocation);
+	CommitSymbolRegister64(dst, dstReg);
 }
 
 template <bool isSigned>
-void CCodeGen_AArch64::Emit_Div_Tmp64AnyAny(const STATEMENT& statement)
+void CCodeGen_AArch64::Emit_Div_Var64AnyAny(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
 	auto src1 = statement.src1->GetSymbol().get();
 	auto src2 = statement.src2->GetSymbol().get();
 
-	assert(dst->m_type == SYM_TEMPORARY64);
-
 	auto src1Reg = PrepareSymbolRegisterUse(src1, GetNextTempRegister());
 	auto src2Reg = PrepareSymbolRegisterUse(src2, GetNextTempRegister());
 	auto resReg = GetNextTempRegister();
@@ -293,8 +289,18 @@ void CCodeGen_AArch64::Emit_Div_Tmp64AnyAny(const STATEMENT& statement)
 
 	m_assembler.Msub(modReg, resReg, src2Reg, src1Reg);
 
-	m_assembler.Str(resReg, CAArch64Assembler::xSP, dst->m_stackLocation + 0);
-	m_assembler.Str(modReg, CAArch64Assembler::xSP, dst->m_stackLocation + 4);
+	if(dst->m_type == SYM_REGISTER64)
+	{
+		//Upper halves of resReg and modReg are cleared by the 32-bit operations above
+		auto dstReg = PrepareSymbolRegisterDef64(dst, GetNextTempRegister64());
+		m_assembler.Lsl(dstReg, static_cast<CAArch64Assembler::REGISTER64>(modReg), 32);
+		m_assembler.Orr(dstReg, dstReg, static_cast<CAArch64Assembler::REGISTER64>(resReg));
+		CommitSymbolRegister64(dst, dstReg);
+	}
+	else
+	{
+		StoreRegistersInMemory64(dst, resReg, modReg);
+	}
 }
 
 // clang-format off
@@ -318,6 +324,10 @@ CCodeGen_AArch64::CONSTMATCHER CCodeGen_AArch64::g_constMatchers[] =
 
 	{ OP_NOT,            MATCH_VARIABLE,       MATCH_VARIABLE,       MATCH_NIL,           MATCH_NIL,      &CCodeGen_AArch64::Emit_Not_VarVar                          },
 	{ OP_LZC,            MATCH_VARIABLE,       MATCH_VARIABLE,       MATCH_NIL,           MATCH_NIL,      &CCodeGen_AArch64::Emit_Lzc_VarVar                          },
+	{ OP_TZC,            MATCH_VARIABLE,       MATCH_VARIABLE,       MATCH_NIL,           MATCH_NIL,      &CCodeGen_AArch64::Emit_Tzc_VarVar                          },
+	{ OP_POPCNT,         MATCH_VARIABLE,       MATCH_VARIABLE,       MATCH_NIL,           MATCH_NIL,      &CCodeGen_AArch64::Emit_Popcnt_VarVar                       },
+	{ OP_BSWAP,          MATCH_VARIABLE,       MATCH_VARIABLE,       MATCH_NIL,           MATCH_NIL,      &CCodeGen_AArch64::Emit_Bswap_VarVar                        },
+	{ OP_BSWAP16,        MATCH_VARIABLE,       MATCH_VARIABLE,       MATCH_NIL,           MATCH_NIL,      &CCodeGen_AArch64::Emit_Bswap16_VarVar                      },
 	
 	{ OP_RELTOREF,       MATCH_VAR_REF,        MATCH_CONSTANT,       MATCH_ANY,           MATCH_NIL,      &CCodeGen_AArch64::Emit_RelToRef_VarCst                     },
 
@@ -327,6 +337,7 @@ CCodeGen_AArch64::CONSTMATCHER CCodeGen_AArch64::g_constMatchers[] =
 
 	{ OP_LOADFROMREF,    MATCH_VARIABLE,       MATCH_VAR_REF,        MATCH_NIL,           MATCH_NIL,      &CCodeGen_AArch64::Emit_LoadFromRef_VarVar                  },
 	{ OP_LOADFROMREF,    MATCH_VARIABLE,       MATCH_VAR_REF,        MATCH_ANY32,         MATCH_NIL,      &CCodeGen_AArch64::Emit_LoadFromRef_VarVarAny               },
+	{ OP_LOOKUP,         MATCH_VARIABLE,       MATCH_CONSTANTPTR,    MATCH_ANY32,         MATCH_NIL,      &CCodeGen_AArch64::Emit_Lookup_VarCstAny                    },
 
 	{ OP_LOADFROMREF,    MATCH_VAR_REF,        MATCH_VAR_REF,        MATCH_NIL,           MATCH_NIL,      &CCodeGen_AArch64::Emit_LoadFromRef_Ref_VarVar              },
 	{ OP_LOADFROMREF,    MATCH_VAR_REF,        MATCH_VAR_REF,        MATCH_ANY32,         MATCH_NIL,      &CCodeGen_AArch64::Emit_LoadFromRef_Ref_VarVarAny           },
@@ -350,6 +361,7 @@ CCodeGen_AArch64::CONSTMATCHER CCodeGen_AArch64::g_constMatchers[] =
 	{ OP_PARAM,          MATCH_NIL,            MATCH_REGISTER,       MATCH_NIL,           MATCH_NIL,      &CCodeGen_AArch64::Emit_Param_Reg                           },
 	{ OP_PARAM,          MATCH_NIL,            MATCH_MEMORY,         MATCH_NIL,           MATCH_NIL,      &CCodeGen_AArch64::Emit_Param_Mem                           },
 	{ OP_PARAM,          MATCH_NIL,            MATCH_CONSTANT,       MATCH_NIL,           MATCH_NIL,      &CCodeGen_AArch64::Emit_Param_Cst                           },
+	{ OP_PARAM,          MATCH_NIL,            MATCH_REGISTER64,     MATCH_NIL,           MATCH_NIL,      &CCodeGen_AArch64::Emit_Param_Reg64                         },
 	{ OP_PARAM,          MATCH_NIL,            MATCH_MEMORY64,       MATCH_NIL,           MATCH_NIL,      &CCodeGen_AArch64::Emit_Param_Mem64                         },
 	{ OP_PARAM,          MATCH_NIL,            MATCH_CONSTANT64,     MATCH_NIL,           MATCH_NIL,      &CCodeGen_AArch64::Emit_Param_Cst64                         },
 	{ OP_PARAM,          MATCH_NIL,            MATCH_REGISTER128,    MATCH_NIL,           MATCH_NIL,      &CCodeGen_AArch64::Emit_Param_Reg128                        },
@@ -359,6 +371,7 @@ CCodeGen_AArch64::CONSTMATCHER CCodeGen_AArch64::g_constMatchers[] =
 	
 	{ OP_RETVAL,         MATCH_REGISTER,       MATCH_NIL,            MATCH_NIL,           MATCH_NIL,      &CCodeGen_AArch64::Emit_RetVal_Reg                          },
 	{ OP_RETVAL,         MATCH_TEMPORARY,      MATCH_NIL,            MATCH_NIL,           MATCH_NIL,      &CCodeGen_AArch64::Emit_RetVal_Tmp                          },
+	{ OP_RETVAL,         MATCH_REGISTER64,     MATCH_NIL,            MATCH_NIL,           MATCH_NIL,      &CCodeGen_AArch64::Emit_RetVal_Reg64                        },
 	{ OP_RETVAL,         MATCH_MEMORY64,       MATCH_NIL,            MATCH_NIL,           MATCH_NIL,      &CCodeGen_AArch64::Emit_RetVal_Mem64                        },
 	{ OP_RETVAL,         MATCH_REGISTER128,    MATCH_NIL,            MATCH_NIL,           MATCH_NIL,      &CCodeGen_AArch64::Emit_RetVal_Reg128                       },
 	{ OP_RETVAL,         MATCH_MEMORY128,      MATCH_NIL,            MATCH_NIL,           MATCH_NIL,      &CCodeGen_AArch64::Emit_RetVal_Mem128                       },
@@ -372,22 +385,30 @@ CCodeGen_AArch64::CONSTMATCHER CCodeGen_AArch64::g_constMatchers[] =
 	{ OP_CONDJMP,        MATCH_NIL,            MATCH_VARIABLE,       MATCH_CONSTANT,      MATCH_NIL,      &CCodeGen_AArch64::Emit_CondJmp_VarCst                      },
 	
 	{ OP_CONDJMP,        MATCH_NIL,            MATCH_VAR_REF,        MATCH_CONSTANT,      MATCH_NIL,      &CCodeGen_AArch64::Emit_CondJmp_Ref_VarCst                  },
+
+	{ OP_TESTJMP,        MATCH_NIL,            MATCH_ANY,            MATCH_ANY,           MATCH_NIL,      &CCodeGen_AArch64::Emit_TestJmp_AnyAny                      },
+
+	{ OP_JMPTABLE,       MATCH_NIL,            MATCH_VARIABLE,       MATCH_NIL,           MATCH_NIL,      &CCodeGen_AArch64::Emit_JmpTable_Var                        },
 	
 	{ OP_CMP,            MATCH_VARIABLE,       MATCH_ANY,            MATCH_VARIABLE,      MATCH_NIL,      &CCodeGen_AArch64::Emit_Cmp_VarAnyVar                       },
 	{ OP_CMP,            MATCH_VARIABLE,       MATCH_VARIABLE,       MATCH_CONSTANT,      MATCH_NIL,      &CCodeGen_AArch64::Emit_Cmp_VarVarCst                       },
 	
 	{ OP_SELECT,         MATCH_VARIABLE,       MATCH_VARIABLE,       MATCH_ANY,           MATCH_ANY,      &CCodeGen_AArch64::Emit_Select_VarVarAnyAny                 },
 
-	{ OP_CMPSELECT_P1,   MATCH_NIL,            MATCH_ANY,            MATCH_VARIABLE,      MATCH_NIL,      &CCodeGen_AArch64::Emit_CmpSelectP1_AnyVar                  },
+	{ OP_CMPSELECT_P1,   MATCH_NIL,            MATCH_ANY,            MATCH_ANY,           MATCH_NIL,      &CCodeGen_AArch64::Emit_CmpSelectP1_AnyAny                  },
 	{ OP_CMPSELECT_P2,   MATCH_VARIABLE,       MATCH_ANY,            MATCH_ANY,           MATCH_NIL,      &CCodeGen_AArch64::Emit_CmpSelectP2_VarAnyAny               },
 	
 	{ OP_SLL,            MATCH_VARIABLE,       MATCH_ANY,            MATCH_VARIABLE,      MATCH_NIL,      &CCodeGen_AArch64::Emit_Shift_VarAnyVar<SHIFTOP_LSL>        },
 	{ OP_SRL,            MATCH_VARIABLE,       MATCH_ANY,            MATCH_VARIABLE,      MATCH_NIL,      &CCodeGen_AArch64::Emit_Shift_VarAnyVar<SHIFTOP_LSR>        },
 	{ OP_SRA,            MATCH_VARIABLE,       MATCH_ANY,            MATCH_VARIABLE,      MATCH_NIL,      &CCodeGen_AArch64::Emit_Shift_VarAnyVar<SHIFTOP_ASR>        },
+	{ OP_ROTR,           MATCH_VARIABLE,       MATCH_ANY,            MATCH_VARIABLE,      MATCH_NIL,      &CCodeGen_AArch64::Emit_Shift_VarAnyVar<SHIFTOP_ROR>        },
+	{ OP_ROTL,           MATCH_VARIABLE,       MATCH_ANY,            MATCH_VARIABLE,      MATCH_NIL,      &CCodeGen_AArch64::Emit_Rotl_VarAnyVar                      },
 
 	{ OP_SLL,            MATCH_VARIABLE,       MATCH_VARIABLE,       MATCH_CONSTANT,      MATCH_NIL,      &CCodeGen_AArch64::Emit_Shift_VarVarCst<SHIFTOP_LSL>        },
 	{ OP_SRL,            MATCH_VARIABLE,       MATCH_VARIABLE,       MATCH_CONSTANT,      MATCH_NIL,      &CCodeGen_AArch64::Emit_Shift_VarVarCst<SHIFTOP_LSR>        },
 	{ OP_SRA,            MATCH_VARIABLE,       MATCH_VARIABLE,       MATCH_CONSTANT,      MATCH_NIL,      &CCodeGen_AArch64::Emit_Shift_VarVarCst<SHIFTOP_ASR>        },
+	{ OP_ROTR,           MATCH_VARIABLE,       MATCH_VARIABLE,       MATCH_CONSTANT,      MATCH_NIL,      &CCodeGen_AArch64::Emit_Shift_VarVarCst<SHIFTOP_ROR>        },
+	{ OP_ROTL,           MATCH_VARIABLE,       MATCH_VARIABLE,       MATCH_CONSTANT,      MATCH_NIL,      &CCodeGen_AArch64::Emit_Rotl_VarVarCst                      },
 	
 	LOGIC_CONST_MATCHERS(OP_AND, LOGICOP_AND)
 	LOGIC_CONST_MATCHERS(OP_OR,  LOGICOP_OR )
@@ -398,11 +419,11 @@ CCodeGen_AArch64::CONSTMATCHER CCodeGen_AArch64::g_constMatchers[] =
 	{ OP_SUB,            MATCH_VARIABLE,       MATCH_ANY,            MATCH_VARIABLE,      MATCH_NIL,      &CCodeGen_AArch64::Emit_AddSub_VarAnyVar<ADDSUBOP_SUB>      },
 	{ OP_SUB,            MATCH_VARIABLE,       MATCH_VARIABLE,       MATCH_CONSTANT,      MATCH_NIL,      &CCodeGen_AArch64::Emit_AddSub_VarVarCst<ADDSUBOP_SUB>      },
 	
-	{ OP_MUL,            MATCH_TEMPORARY64,    MATCH_ANY,            MATCH_ANY,           MATCH_NIL,      &CCodeGen_AArch64::Emit_Mul_Tmp64AnyAny<false>              },
-	{ OP_MULS,           MATCH_TEMPORARY64,    MATCH_ANY,            MATCH_ANY,           MATCH_NIL,      &CCodeGen_AArch64::Emit_Mul_Tmp64AnyAny<true>               },
+	{ OP_MUL,            MATCH_VARIABLE64,     MATCH_ANY,            MATCH_ANY,           MATCH_NIL,      &CCodeGen_AArch64::Emit_Mul_Var64AnyAny<false>              },
+	{ OP_MULS,           MATCH_VARIABLE64,     MATCH_ANY,            MATCH_ANY,           MATCH_NIL,      &CCodeGen_AArch64::Emit_Mul_Var64AnyAny<true>               },
 
-	{ OP_DIV,            MATCH_TEMPORARY64,    MATCH_ANY,            MATCH_ANY,           MATCH_NIL,      &CCodeGen_AArch64::Emit_Div_Tmp64AnyAny<false>              },
-	{ OP_DIVS,           MATCH_TEMPORARY64,    MATCH_ANY,            MATCH_ANY,           MATCH_NIL,      &CCodeGen_AArch64::Emit_Div_Tmp64AnyAny<true>               },
+	{ OP_DIV,            MATCH_VARIABLE64,     MATCH_ANY,            MATCH_ANY,           MATCH_NIL,      &CCodeGen_AArch64::Emit_Div_Var64AnyAny<false>              },
+	{ OP_DIVS,           MATCH_VARIABLE64,     MATCH_ANY,            MATCH_ANY,           MATCH_NIL,      &CCodeGen_AArch64::Emit_Div_Var64AnyAny<true>               },
 	
 	{ OP_LABEL,          MATCH_NIL,            MATCH_NIL,            MATCH_NIL,           MATCH_NIL,      &CCodeGen_AArch64::MarkLabel                                },
 
@@ -443,11 +464,26 @@ unsigned int CCodeGen_AArch64::GetAvailableRegisterCount() const
 	return MAX_REGISTERS;
 }
 
+unsigned int CCodeGen_AArch64::GetAvailableCallerSavedRegisterCount() const
+{
+	return 0;
+}
+
 unsigned int CCodeGen_AArch64::GetAvailableMdRegisterCount() const
 {
 	return MAX_MDREGISTERS;
 }
 
+unsigned int CCodeGen_AArch64::GetMdTempRegisterCount(const STATEMENT&) const
+{
+	return 0;
+}
+
+bool CCodeGen_AArch64::IsHelperCall(const STATEMENT&) const
+{
+	return false;
+}
+
 bool CCodeGen_AArch64::Has128BitsCallOperands() const
 {
 	return true;
@@ -458,6 +494,11 @@ bool CCodeGen_AArch64::CanHold128BitsReturnValueInRegisters() const
 	return true;
 }
 
+bool CCodeGen_AArch64::Has64BitsRegisters() const
+{
+	return true;
+}
+
 bool CCodeGen_AArch64::SupportsExternalJumps() const
 {
 	return true;
@@ -468,6 +509,28 @@ bool CCodeGen_AArch64::SupportsCmpSelect() const
 	return true;
 }
 
+bool CCodeGen_AArch64::SupportsJumpTables() const
+{
+	return true;
+}
+
+bool CCodeGen_AArch64::SupportsTestJumps() const
+{
+	return true;
+}
+
+bool CCodeGen_AArch64::SupportsIndexScale(uint32 accessSize, uint32 scale) const
+{
+	if(scale == 1) return true;
+	//Only 32-bit accesses can use their natural size as scale
+	return (accessSize == 4) && (scale == 4);
+}
+
+bool CCodeGen_AArch64::SupportsFma() const
+{
+	return true;
+}
+
 uint32 CCodeGen_AArch64::GetPointerSize() const
 {
 	return 8;
@@ -757,6 +820,10 @@ CAArch64Assembler::REGISTER64 CCodeGen_AArch64::PrepareSymbolRegisterUseRef(CSym
 		LoadMemoryReferenceInRegister(preferedRegister, symbol);
 		return preferedRegister;
 		break;
+	case SYM_CONSTANTPTR:
+		LoadConstant64InRegister(preferedRegister, symbol->GetConstantPtr());
+		return preferedRegister;
+		break;
 	default:
 		throw std::runtime_error("Invalid symbol type.");
 		break;
@@ -779,6 +846,64 @@ void CCodeGen_AArch64::CommitSymbolRegisterRef(CSymbol* symbol, CAArch64Assemble
 	}
 }
 
+CAArch64Assembler::REGISTER64 CCodeGen_AArch64::PrepareSymbolRegisterDef64(CSymbol* symbol, CAArch64Assembler::REGISTER64 preferedRegister)
+{
+	switch(symbol->m_type)
+	{
+	case SYM_REGISTER64:
+		assert(symbol->m_valueLow < MAX_REGISTERS);
+		return static_cast<CAArch64Assembler::REGISTER64>(g_registers[symbol->m_valueLow]);
+		break;
+	case SYM_TEMPORARY64:
+	case SYM_RELATIVE64:
+		return preferedRegister;
+		break;
+	default:
+		throw std::runtime_error("Invalid symbol type.");
+		break;
+	}
+}
+
+CAArch64Assembler::REGISTER64 CCodeGen_AArch64::PrepareSymbolRegisterUse64(CSymbol* symbol, CAArch64Assembler::REGISTER64 preferedRegister)
+{
+	switch(symbol->m_type)
+	{
+	case SYM_REGISTER64:
+		assert(symbol->m_valueLow < MAX_REGISTERS);
+		return static_cast<CAArch64Assembler::REGISTER64>(g_registers[symbol->m_valueLow]);
+		break;
+	case SYM_TEMPORARY64:
+	case SYM_RELATIVE64:
+		LoadMemory64InRegister(preferedRegister, symbol);
+		return preferedRegister;
+		break;
+	case SYM_CONSTANT64:
+		LoadConstant64InRegister(preferedRegister, symbol->GetConstant64());
+		return preferedRegister;
+		break;
+	default:
+		throw std::runtime_error("Invalid symbol type.");
+		break;
+	}
+}
+
+void CCodeGen_AArch64::CommitSymbolRegister64(CSymbol* symbol, CAArch64Assembler::REGISTER64 usedRegister)
+{
+	switch(symbol->m_type)
+	{
+	case SYM_REGISTER64:
+		assert(usedRegister == static_cast<CAArch64Assembler::REGISTER64>(g_registers[symbol->m_valueLow]));
+		break;
+	case SYM_TEMPORARY64:
+	case SYM_RELATIVE64:
+		StoreRegisterInMemory64(symbol, usedRegister);
+		break;
+	default:
+		throw std::runtime_error("Invalid symbol type.");
+		break;
+	}
+}
+
 CAArch64Assembler::REGISTER32 CCodeGen_AArch64::PrepareParam(PARAM_STATE& paramState)
 {
 	assert(!paramState.prepared);
@@ -1144,6 +1269,95 @@ void CCodeGen_AArch64::Emit_Lzc_VarVar(const STATEMENT& statement)
 	CommitSymbolRegister(dst, dstRegister);
 }
 
+void CCodeGen_AArch64::Emit_Tzc_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDef(dst, GetNextTempRegister());
+	auto src1Register = PrepareSymbolRegisterUse(src1, GetNextTempRegister());
+
+	m_assembler.Rbit(dstRegister, src1Register);
+	m_assembler.Clz(dstRegister, dstRegister);
+
+	CommitSymbolRegister(dst, dstRegister);
+}
+
+void CCodeGen_AArch64::Emit_Popcnt_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDef(dst, GetNextTempRegister());
+	auto src1Register = PrepareSymbolRegisterUse(src1, GetNextTempRegister());
+	auto tmpRegister = GetNextTempRegisterMd();
+
+	m_assembler.Fmov_1s(tmpRegister, src1Register);
+	m_assembler.Cnt_16b(tmpRegister, tmpRegister);
+	m_assembler.Uaddlv_16b(tmpRegister, tmpRegister);
+	m_assembler.Umov_1s(dstRegister, tmpRegister, 0);
+
+	CommitSymbolRegister(dst, dstRegister);
+}
+
+void CCodeGen_AArch64::Emit_Bswap_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDef(dst, GetNextTempRegister());
+	auto src1Register = PrepareSymbolRegisterUse(src1, GetNextTempRegister());
+
+	m_assembler.Rev(dstRegister, src1Register);
+
+	CommitSymbolRegister(dst, dstRegister);
+}
+
+void CCodeGen_AArch64::Emit_Bswap16_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDef(dst, GetNextTempRegister());
+	auto src1Register = PrepareSymbolRegisterUse(src1, GetNextTempRegister());
+
+	m_assembler.Rev(dstRegister, src1Register);
+	m_assembler.Lsr(dstRegister, dstRegister, 16);
+
+	CommitSymbolRegister(dst, dstRegister);
+}
+
+void CCodeGen_AArch64::Emit_Rotl_VarAnyVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDef(dst, GetNextTempRegister());
+	auto src1Reg = PrepareSymbolRegisterUse(src1, GetNextTempRegister());
+	auto src2Reg = PrepareSymbolRegisterUse(src2, GetNextTempRegister());
+	auto amountReg = GetNextTempRegister();
+
+	//There is no rotate left, rotate right by the negated amount instead
+	m_assembler.Sub(amountReg, CAArch64Assembler::wZR, src2Reg);
+	m_assembler.Rorv(dstReg, src1Reg, amountReg);
+	CommitSymbolRegister(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Rotl_VarVarCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	assert(src2->m_type == SYM_CONSTANT);
+
+	auto dstReg = PrepareSymbolRegisterDef(dst, GetNextTempRegister());
+	auto src1Reg = PrepareSymbolRegisterUse(src1, GetNextTempRegister());
+	m_assembler.Ror(dstReg, src1Reg, (32 - src2->m_valueLow) & 0x1F);
+	CommitSymbolRegister(dst, dstReg);
+}
+
 void CCodeGen_AArch64::Emit_RelToRef_VarCst(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -1233,6 +1447,13 @@ void CCodeGen_AArch64::Emit_LoadFromRef_VarVarAny(const STATEMENT& statement)
 	CommitSymbolRegister(dst, valueReg);
 }
 
+void CCodeGen_AArch64::Emit_Lookup_VarCstAny(const STATEMENT& statement)
+{
+	auto loadStatement = statement;
+	loadStatement.jmpCondition = static_cast<CONDITION>(sizeof(uint32));
+	Emit_LoadFromRef_VarVarAny(loadStatement);
+}
+
 void CCodeGen_AArch64::Emit_LoadFromRef_Ref_VarVar(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -1501,6 +1722,18 @@ void CCodeGen_AArch64::Emit_Param_Cst(const STATEMENT& statement)
 	    });
 }
 
+void CCodeGen_AArch64::Emit_Param_Reg64(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+
+	m_params.push_back(
+	    [this, src1](PARAM_STATE& paramState) {
+		    auto paramReg = PrepareParam64(paramState);
+		    m_assembler.Mov(paramReg, static_cast<CAArch64Assembler::REGISTER64>(g_registers[src1->m_valueLow]));
+		    CommitParam64(paramState);
+	    });
+}
+
 void CCodeGen_AArch64::Emit_Param_Mem64(const STATEMENT& statement)
 {
 	auto src1 = statement.src1->GetSymbol().get();
@@ -1603,6 +1836,13 @@ void CCodeGen_AArch64::Emit_RetVal_Tmp(const STATEMENT& statement)
 	StoreRegisterInMemory(dst, CAArch64Assembler::w0);
 }
 
+void CCodeGen_AArch64::Emit_RetVal_Reg64(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	assert(dst->m_type == SYM_REGISTER64);
+	m_assembler.Mov(static_cast<CAArch64Assembler::REGISTER64>(g_registers[dst->m_valueLow]), CAArch64Assembler::x0);
+}
+
 void CCodeGen_AArch64::Emit_RetVal_Mem64(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -1777,6 +2017,57 @@ void CCodeGen_AArch64::Emit_CondJmp_Ref_VarCst(const STATEMENT& statement)
 	}
 }
 
+void CCodeGen_AArch64::Emit_TestJmp_AnyAny(const STATEMENT& statement)
+{
+	ResetTempRegisterMdState();
+
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	assert((statement.jmpCondition == CONDITION_NE) || (statement.jmpCondition == CONDITION_EQ));
+
+	auto src1Reg = PrepareSymbolRegisterUse(src1, GetNextTempRegister());
+	auto src2Reg = PrepareSymbolRegisterUse(src2, GetNextTempRegister());
+	m_assembler.Tst(src1Reg, src2Reg);
+	Emit_CondJmp(statement);
+}
+
+void CCodeGen_AArch64::Emit_JmpTable_Var(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto indexReg = PrepareSymbolRegisterUse(src1, GetNextTempRegister());
+	auto tableSize = static_cast<uint32>(statement.jmpTable->size());
+
+	ADDSUB_IMM_PARAMS addSubImmParams;
+	if(TryGetAddSubImmParams(tableSize, addSubImmParams))
+	{
+		m_assembler.Cmp(indexReg, addSubImmParams.imm, addSubImmParams.shiftType);
+	}
+	else
+	{
+		auto sizeReg = GetNextTempRegister();
+		LoadConstantInRegister(sizeReg, tableSize);
+		m_assembler.Cmp(indexReg, sizeReg);
+	}
+	m_assembler.BCc(CAArch64Assembler::CONDITION_CS, GetLabel(statement.jmpBlock));
+
+	//Table is made of branch instructions, 4 bytes each
+	auto tableLabel = m_assembler.CreateLabel();
+	auto tableReg = GetNextTempRegister64();
+	auto offsetReg = GetNextTempRegister();
+	m_assembler.Adr(tableReg, tableLabel);
+	m_assembler.Lsl(offsetReg, indexReg, 2);
+	m_assembler.Add(tableReg, tableReg, static_cast<CAArch64Assembler::REGISTER64>(offsetReg));
+	m_assembler.Br(tableReg);
+
+	m_assembler.MarkLabel(tableLabel);
+	for(const auto& target : *statement.jmpTable)
+	{
+		m_assembler.B(GetLabel(target));
+	}
+}
+
 void CCodeGen_AArch64::Cmp_GetFlag(CAArch64Assembler::REGISTER32 registerId, Jitter::CONDITION condition)
 {
 	auto conditionCode = GetConditionCode(condition);
@@ -1845,7 +2136,7 @@ void CCodeGen_AArch64::Emit_Select_VarVarAnyAny(const STATEMENT& statement)
 	CommitSymbolRegister(dst, dstReg);
 }
 
-void CCodeGen_AArch64::Emit_CmpSelectP1_AnyVar(const STATEMENT& statement)
+void CCodeGen_AArch64::Emit_CmpSelectP1_AnyAny(const STATEMENT& statement)
 {
 	auto src1 = statement.src1->GetSymbol().get();
 	auto src2 = statement.src2->GetSymbol().get();
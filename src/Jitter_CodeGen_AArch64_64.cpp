@@ -134,6 +134,9 @@ void CCodeGen_AArch64::LoadSymbol64InRegister(CAArch64Assembler::REGISTER64 regi
 	case SYM_CONSTANT64:
 		LoadConstant64InRegister(registerId, symbol->GetConstant64());
 		break;
+	case SYM_REGISTER64:
+		m_assembler.Mov(registerId, static_cast<CAArch64Assembler::REGISTER64>(g_registers[symbol->m_valueLow]));
+		break;
 	default:
 		assert(false);
 		break;
@@ -186,6 +189,17 @@ void CCodeGen_AArch64::Emit_ExtLow64VarMem64(const STATEMENT& statement)
 	CommitSymbolRegister(dst, dstReg);
 }
 
+void CCodeGen_AArch64::Emit_ExtLow64VarReg64(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDef(dst, GetNextTempRegister());
+	auto src1Reg = PrepareSymbolRegisterUse64(src1, GetNextTempRegister64());
+	m_assembler.Mov(dstReg, static_cast<CAArch64Assembler::REGISTER32>(src1Reg));
+	CommitSymbolRegister(dst, dstReg);
+}
+
 void CCodeGen_AArch64::Emit_ExtHigh64VarMem64(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -196,6 +210,17 @@ void CCodeGen_AArch64::Emit_ExtHigh64VarMem64(const STATEMENT& statement)
 	CommitSymbolRegister(dst, dstReg);
 }
 
+void CCodeGen_AArch64::Emit_ExtHigh64VarReg64(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDef(dst, GetNextTempRegister());
+	auto src1Reg = PrepareSymbolRegisterUse64(src1, GetNextTempRegister64());
+	m_assembler.Lsr(static_cast<CAArch64Assembler::REGISTER64>(dstReg), src1Reg, 32);
+	CommitSymbolRegister(dst, dstReg);
+}
+
 void CCodeGen_AArch64::Emit_MergeTo64_Mem64AnyAny(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -208,20 +233,38 @@ void CCodeGen_AArch64::Emit_MergeTo64_Mem64AnyAny(const STATEMENT& statement)
 	StoreRegistersInMemory64(dst, regLo, regHi);
 }
 
-void CCodeGen_AArch64::Emit_LoadFromRef_64_MemVar(const STATEMENT& statement)
+void CCodeGen_AArch64::Emit_MergeTo64_Reg64AnyAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDef64(dst, GetNextTempRegister64());
+	auto regLo = PrepareSymbolRegisterUse(src1, GetNextTempRegister());
+	auto regHi = PrepareSymbolRegisterUse(src2, GetNextTempRegister());
+	auto tmpReg = GetNextTempRegister64();
+
+	//Writing to the 32-bit view clears the upper half
+	m_assembler.Mov(static_cast<CAArch64Assembler::REGISTER32>(tmpReg), regLo);
+	m_assembler.Lsl(dstReg, static_cast<CAArch64Assembler::REGISTER64>(regHi), 32);
+	m_assembler.Orr(dstReg, dstReg, tmpReg);
+	CommitSymbolRegister64(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_LoadFromRef_64_VarVar(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
 	auto src1 = statement.src1->GetSymbol().get();
 
 	auto addressReg = PrepareSymbolRegisterUseRef(src1, GetNextTempRegister64());
-	auto dstReg = GetNextTempRegister64();
+	auto dstReg = PrepareSymbolRegisterDef64(dst, GetNextTempRegister64());
 
 	m_assembler.Ldr(dstReg, addressReg, 0);
 
-	StoreRegisterInMemory64(dst, dstReg);
+	CommitSymbolRegister64(dst, dstReg);
 }
 
-void CCodeGen_AArch64::Emit_LoadFromRef_64_MemVarAny(const STATEMENT& statement)
+void CCodeGen_AArch64::Emit_LoadFromRef_64_VarVarAny(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
 	auto src1 = statement.src1->GetSymbol().get();
@@ -231,7 +274,7 @@ void CCodeGen_AArch64::Emit_LoadFromRef_64_MemVarAny(const STATEMENT& statement)
 	assert(scale == 1);
 
 	auto addressReg = PrepareSymbolRegisterUseRef(src1, GetNextTempRegister64());
-	auto dstReg = GetNextTempRegister64();
+	auto dstReg = PrepareSymbolRegisterDef64(dst, GetNextTempRegister64());
 
 	if(uint32 scaledIndex = (src2->m_valueLow * scale); src2->IsConstant() && (scaledIndex < 0x8000))
 	{
@@ -243,7 +286,7 @@ void CCodeGen_AArch64::Emit_LoadFromRef_64_MemVarAny(const STATEMENT& statement)
 		m_assembler.Ldr(dstReg, addressReg, static_cast<CAArch64Assembler::REGISTER64>(indexReg), (scale == 8));
 	}
 
-	StoreRegisterInMemory64(dst, dstReg);
+	CommitSymbolRegister64(dst, dstReg);
 }
 
 void CCodeGen_AArch64::Emit_StoreAtRef_64_VarAny(const STATEMENT& statement)
@@ -252,9 +295,8 @@ void CCodeGen_AArch64::Emit_StoreAtRef_64_VarAny(const STATEMENT& statement)
 	auto src2 = statement.src2->GetSymbol().get();
 
 	auto addressReg = PrepareSymbolRegisterUseRef(src1, GetNextTempRegister64());
-	auto valueReg = GetNextTempRegister64();
+	auto valueReg = PrepareSymbolRegisterUse64(src2, GetNextTempRegister64());
 
-	LoadSymbol64InRegister(valueReg, src2);
 	m_assembler.Str(valueReg, addressReg, 0);
 }
 
@@ -268,9 +310,7 @@ void CCodeGen_AArch64::Emit_StoreAtRef_64_VarAnyAny(const STATEMENT& statement)
 	assert(scale == 1);
 
 	auto addressReg = PrepareSymbolRegisterUseRef(src1, GetNextTempRegister64());
-	auto valueReg = GetNextTempRegister64();
-
-	LoadSymbol64InRegister(valueReg, src3);
+	auto valueReg = PrepareSymbolRegisterUse64(src3, GetNextTempRegister64());
 
 	if(uint32 scaledIndex = (src2->m_valueLow * scale); src2->IsConstant() && (scaledIndex < 0x8000))
 	{
@@ -283,32 +323,28 @@ void CCodeGen_AArch64::Emit_StoreAtRef_64_VarAnyAny(const STATEMENT& statement)
 	}
 }
 
-void CCodeGen_AArch64::Emit_Add64_MemMemMem(const STATEMENT& statement)
+void CCodeGen_AArch64::Emit_Add64_VarVarVar(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
 	auto src1 = statement.src1->GetSymbol().get();
 	auto src2 = statement.src2->GetSymbol().get();
 
-	auto dstReg = GetNextTempRegister64();
-	auto src1Reg = GetNextTempRegister64();
-	auto src2Reg = GetNextTempRegister64();
+	auto dstReg = PrepareSymbolRegisterDef64(dst, GetNextTempRegister64());
+	auto src1Reg = PrepareSymbolRegisterUse64(src1, GetNextTempRegister64());
+	auto src2Reg = PrepareSymbolRegisterUse64(src2, GetNextTempRegister64());
 
-	LoadMemory64InRegister(src1Reg, src1);
-	LoadMemory64InRegister(src2Reg, src2);
 	m_assembler.Add(dstReg, src1Reg, src2Reg);
-	StoreRegisterInMemory64(dst, dstReg);
+	CommitSymbolRegister64(dst, dstReg);
 }
 
-void CCodeGen_AArch64::Emit_Add64_MemMemCst(const STATEMENT& statement)
+void CCodeGen_AArch64::Emit_Add64_VarVarCst(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
 	auto src1 = statement.src1->GetSymbol().get();
 	auto src2 = statement.src2->GetSymbol().get();
 
-	auto dstReg = GetNextTempRegister64();
-	auto src1Reg = GetNextTempRegister64();
-
-	LoadMemory64InRegister(src1Reg, src1);
+	auto dstReg = PrepareSymbolRegisterDef64(dst, GetNextTempRegister64());
+	auto src1Reg = PrepareSymbolRegisterUse64(src1, GetNextTempRegister64());
 	auto constant = src2->GetConstant64();
 
 	ADDSUB_IMM_PARAMS addSubImmParams;
@@ -327,35 +363,31 @@ void CCodeGen_AArch64::Emit_Add64_MemMemCst(const STATEMENT& statement)
 		m_assembler.Add(dstReg, src1Reg, src2Reg);
 	}
 
-	StoreRegisterInMemory64(dst, dstReg);
+	CommitSymbolRegister64(dst, dstReg);
 }
 
-void CCodeGen_AArch64::Emit_Sub64_MemAnyMem(const STATEMENT& statement)
+void CCodeGen_AArch64::Emit_Sub64_VarAnyVar(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
 	auto src1 = statement.src1->GetSymbol().get();
 	auto src2 = statement.src2->GetSymbol().get();
 
-	auto dstReg = GetNextTempRegister64();
-	auto src1Reg = GetNextTempRegister64();
-	auto src2Reg = GetNextTempRegister64();
+	auto dstReg = PrepareSymbolRegisterDef64(dst, GetNextTempRegister64());
+	auto src1Reg = PrepareSymbolRegisterUse64(src1, GetNextTempRegister64());
+	auto src2Reg = PrepareSymbolRegisterUse64(src2, GetNextTempRegister64());
 
-	LoadSymbol64InRegister(src1Reg, src1);
-	LoadMemory64InRegister(src2Reg, src2);
 	m_assembler.Sub(dstReg, src1Reg, src2Reg);
-	StoreRegisterInMemory64(dst, dstReg);
+	CommitSymbolRegister64(dst, dstReg);
 }
 
-void CCodeGen_AArch64::Emit_Sub64_MemMemCst(const STATEMENT& statement)
+void CCodeGen_AArch64::Emit_Sub64_VarVarCst(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
 	auto src1 = statement.src1->GetSymbol().get();
 	auto src2 = statement.src2->GetSymbol().get();
 
-	auto dstReg = GetNextTempRegister64();
-	auto src1Reg = GetNextTempRegister64();
-
-	LoadMemory64InRegister(src1Reg, src1);
+	auto dstReg = PrepareSymbolRegisterDef64(dst, GetNextTempRegister64());
+	auto src1Reg = PrepareSymbolRegisterUse64(src1, GetNextTempRegister64());
 	auto constant = src2->GetConstant64();
 
 	ADDSUB_IMM_PARAMS addSubImmParams;
@@ -374,27 +406,25 @@ void CCodeGen_AArch64::Emit_Sub64_MemMemCst(const STATEMENT& statement)
 		m_assembler.Sub(dstReg, src1Reg, src2Reg);
 	}
 
-	StoreRegisterInMemory64(dst, dstReg);
+	CommitSymbolRegister64(dst, dstReg);
 }
 
-void CCodeGen_AArch64::Emit_Cmp64_VarAnyMem(const STATEMENT& statement)
+void CCodeGen_AArch64::Emit_Cmp64_VarAnyVar(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
 	auto src1 = statement.src1->GetSymbol().get();
 	auto src2 = statement.src2->GetSymbol().get();
 
 	auto dstReg = PrepareSymbolRegisterDef(dst, GetNextTempRegister());
-	auto src1Reg = GetNextTempRegister64();
-	auto src2Reg = GetNextTempRegister64();
+	auto src1Reg = PrepareSymbolRegisterUse64(src1, GetNextTempRegister64());
+	auto src2Reg = PrepareSymbolRegisterUse64(src2, GetNextTempRegister64());
 
-	LoadMemory64InRegister(src1Reg, src1);
-	LoadMemory64InRegister(src2Reg, src2);
 	m_assembler.Cmp(src1Reg, src2Reg);
 	Cmp_GetFlag(dstReg, statement.jmpCondition);
 	CommitSymbolRegister(dst, dstReg);
 }
 
-void CCodeGen_AArch64::Emit_Cmp64_VarMemCst(const STATEMENT& statement)
+void CCodeGen_AArch64::Emit_Cmp64_VarVarCst(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
 	auto src1 = statement.src1->GetSymbol().get();
@@ -403,9 +433,7 @@ void CCodeGen_AArch64::Emit_Cmp64_VarMemCst(const STATEMENT& statement)
 	assert(src2->m_type == SYM_CONSTANT64);
 
 	auto dstReg = PrepareSymbolRegisterDef(dst, GetNextTempRegister());
-	auto src1Reg = GetNextTempRegister64();
-
-	LoadMemory64InRegister(src1Reg, src1);
+	auto src1Reg = PrepareSymbolRegisterUse64(src1, GetNextTempRegister64());
 	uint64 src2Cst = src2->GetConstant64();
 
 	ADDSUB_IMM_PARAMS addSubImmParams;
@@ -428,40 +456,93 @@ void CCodeGen_AArch64::Emit_Cmp64_VarMemCst(const STATEMENT& statement)
 	CommitSymbolRegister(dst, dstReg);
 }
 
-void CCodeGen_AArch64::Emit_And64_MemMemMem(const STATEMENT& statement)
+void CCodeGen_AArch64::Emit_And64_VarVarVar(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
 	auto src1 = statement.src1->GetSymbol().get();
 	auto src2 = statement.src2->GetSymbol().get();
 
-	auto dstReg = GetNextTempRegister64();
-	auto src1Reg = GetNextTempRegister64();
-	auto src2Reg = GetNextTempRegister64();
+	auto dstReg = PrepareSymbolRegisterDef64(dst, GetNextTempRegister64());
+	auto src1Reg = PrepareSymbolRegisterUse64(src1, GetNextTempRegister64());
+	auto src2Reg = PrepareSymbolRegisterUse64(src2, GetNextTempRegister64());
 
-	LoadMemory64InRegister(src1Reg, src1);
-	LoadMemory64InRegister(src2Reg, src2);
 	m_assembler.And(dstReg, src1Reg, src2Reg);
-	StoreRegisterInMemory64(dst, dstReg);
+	CommitSymbolRegister64(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Not64_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDef64(dst, GetNextTempRegister64());
+	auto src1Reg = PrepareSymbolRegisterUse64(src1, GetNextTempRegister64());
+
+	m_assembler.Mvn(dstReg, src1Reg);
+	CommitSymbolRegister64(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Bswap64_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDef64(dst, GetNextTempRegister64());
+	auto src1Reg = PrepareSymbolRegisterUse64(src1, GetNextTempRegister64());
+
+	m_assembler.Rev(dstReg, src1Reg);
+	CommitSymbolRegister64(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Select64_VarVarAnyAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDef64(dst, GetNextTempRegister64());
+	auto src1Reg = PrepareSymbolRegisterUse(src1, GetNextTempRegister());
+	auto src2Reg = PrepareSymbolRegisterUse64(src2, GetNextTempRegister64());
+	auto src3Reg = PrepareSymbolRegisterUse64(src3, GetNextTempRegister64());
+
+	m_assembler.Tst(src1Reg, src1Reg);
+	m_assembler.Csel(dstReg, src2Reg, src3Reg, CAArch64Assembler::CONDITION_NE);
+	CommitSymbolRegister64(dst, dstReg);
+}
+
+template <typename ALU64OP>
+void CCodeGen_AArch64::Emit_Alu64_VarAnyAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDef64(dst, GetNextTempRegister64());
+	auto src1Reg = PrepareSymbolRegisterUse64(src1, GetNextTempRegister64());
+	auto src2Reg = PrepareSymbolRegisterUse64(src2, GetNextTempRegister64());
+
+	((m_assembler).*(ALU64OP::OpReg()))(dstReg, src1Reg, src2Reg);
+	CommitSymbolRegister64(dst, dstReg);
 }
 
 template <typename Shift64Op>
-void CCodeGen_AArch64::Emit_Shift64_MemMemVar(const STATEMENT& statement)
+void CCodeGen_AArch64::Emit_Shift64_VarVarVar(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
 	auto src1 = statement.src1->GetSymbol().get();
 	auto src2 = statement.src2->GetSymbol().get();
 
-	auto dstReg = GetNextTempRegister64();
-	auto src1Reg = GetNextTempRegister64();
+	auto dstReg = PrepareSymbolRegisterDef64(dst, GetNextTempRegister64());
+	auto src1Reg = PrepareSymbolRegisterUse64(src1, GetNextTempRegister64());
 	auto src2Reg = PrepareSymbolRegisterUse(src2, GetNextTempRegister());
 
-	LoadMemory64InRegister(src1Reg, src1);
 	((m_assembler).*(Shift64Op::OpReg()))(dstReg, src1Reg, static_cast<CAArch64Assembler::REGISTER64>(src2Reg));
-	StoreRegisterInMemory64(dst, dstReg);
+	CommitSymbolRegister64(dst, dstReg);
 }
 
 template <typename Shift64Op>
-void CCodeGen_AArch64::Emit_Shift64_MemMemCst(const STATEMENT& statement)
+void CCodeGen_AArch64::Emit_Shift64_VarVarCst(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
 	auto src1 = statement.src1->GetSymbol().get();
@@ -469,72 +550,124 @@ void CCodeGen_AArch64::Emit_Shift64_MemMemCst(const STATEMENT& statement)
 
 	assert(src2->m_type == SYM_CONSTANT);
 
-	auto dstReg = GetNextTempRegister64();
-	auto src1Reg = GetNextTempRegister64();
+	auto dstReg = PrepareSymbolRegisterDef64(dst, GetNextTempRegister64());
+	auto src1Reg = PrepareSymbolRegisterUse64(src1, GetNextTempRegister64());
 
-	LoadMemory64InRegister(src1Reg, src1);
 	((m_assembler).*(Shift64Op::OpImm()))(dstReg, src1Reg, src2->m_valueLow);
-	StoreRegisterInMemory64(dst, dstReg);
+	CommitSymbolRegister64(dst, dstReg);
 }
 
-void CCodeGen_AArch64::Emit_Mov_Mem64Mem64(const STATEMENT& statement)
+void CCodeGen_AArch64::Emit_Rotl64_VarVarVar(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
 	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
 
-	auto tmpReg = GetNextTempRegister64();
-	LoadMemory64InRegister(tmpReg, src1);
-	StoreRegisterInMemory64(dst, tmpReg);
+	auto dstReg = PrepareSymbolRegisterDef64(dst, GetNextTempRegister64());
+	auto src1Reg = PrepareSymbolRegisterUse64(src1, GetNextTempRegister64());
+	auto src2Reg = PrepareSymbolRegisterUse(src2, GetNextTempRegister());
+	auto amountReg = GetNextTempRegister64();
+
+	m_assembler.Sub(amountReg, CAArch64Assembler::xZR, static_cast<CAArch64Assembler::REGISTER64>(src2Reg));
+	m_assembler.Rorv(dstReg, src1Reg, amountReg);
+	CommitSymbolRegister64(dst, dstReg);
 }
 
-void CCodeGen_AArch64::Emit_Mov_Mem64Cst64(const STATEMENT& statement)
+void CCodeGen_AArch64::Emit_Rotl64_VarVarCst(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
 	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
 
-	auto tmpReg = GetNextTempRegister64();
-	LoadConstant64InRegister(tmpReg, src1->GetConstant64());
-	StoreRegisterInMemory64(dst, tmpReg);
+	assert(src2->m_type == SYM_CONSTANT);
+
+	auto dstReg = PrepareSymbolRegisterDef64(dst, GetNextTempRegister64());
+	auto src1Reg = PrepareSymbolRegisterUse64(src1, GetNextTempRegister64());
+
+	m_assembler.Ror(dstReg, src1Reg, (64 - src2->m_valueLow) & 0x3F);
+	CommitSymbolRegister64(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Mov_Var64Var64(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDef64(dst, GetNextTempRegister64());
+	auto src1Reg = PrepareSymbolRegisterUse64(src1, dstReg);
+	if(src1Reg != dstReg)
+	{
+		m_assembler.Mov(dstReg, src1Reg);
+	}
+	CommitSymbolRegister64(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Mov_Var64Cst64(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDef64(dst, GetNextTempRegister64());
+	LoadConstant64InRegister(dstReg, src1->GetConstant64());
+	CommitSymbolRegister64(dst, dstReg);
 }
 
 // clang-format off
 CCodeGen_AArch64::CONSTMATCHER CCodeGen_AArch64::g_64ConstMatchers[] =
 {
 	{ OP_EXTLOW64,       MATCH_VARIABLE,       MATCH_MEMORY64,       MATCH_NIL,           MATCH_NIL, &CCodeGen_AArch64::Emit_ExtLow64VarMem64                    },
+	{ OP_EXTLOW64,       MATCH_VARIABLE,       MATCH_REGISTER64,     MATCH_NIL,           MATCH_NIL, &CCodeGen_AArch64::Emit_ExtLow64VarReg64                    },
 	{ OP_EXTHIGH64,      MATCH_VARIABLE,       MATCH_MEMORY64,       MATCH_NIL,           MATCH_NIL, &CCodeGen_AArch64::Emit_ExtHigh64VarMem64                   },
+	{ OP_EXTHIGH64,      MATCH_VARIABLE,       MATCH_REGISTER64,     MATCH_NIL,           MATCH_NIL, &CCodeGen_AArch64::Emit_ExtHigh64VarReg64                   },
 
 	{ OP_MERGETO64,      MATCH_MEMORY64,       MATCH_ANY,            MATCH_ANY,           MATCH_NIL, &CCodeGen_AArch64::Emit_MergeTo64_Mem64AnyAny               },
+	{ OP_MERGETO64,      MATCH_REGISTER64,     MATCH_ANY,            MATCH_ANY,           MATCH_NIL, &CCodeGen_AArch64::Emit_MergeTo64_Reg64AnyAny               },
 
-	{ OP_LOADFROMREF,    MATCH_MEMORY64,       MATCH_VAR_REF,        MATCH_NIL,           MATCH_NIL, &CCodeGen_AArch64::Emit_LoadFromRef_64_MemVar               },
-	{ OP_LOADFROMREF,    MATCH_MEMORY64,       MATCH_VAR_REF,        MATCH_ANY32,         MATCH_NIL, &CCodeGen_AArch64::Emit_LoadFromRef_64_MemVarAny            },
+	{ OP_LOADFROMREF,    MATCH_VARIABLE64,     MATCH_VAR_REF,        MATCH_NIL,           MATCH_NIL, &CCodeGen_AArch64::Emit_LoadFromRef_64_VarVar               },
+	{ OP_LOADFROMREF,    MATCH_VARIABLE64,     MATCH_VAR_REF,        MATCH_ANY32,         MATCH_NIL, &CCodeGen_AArch64::Emit_LoadFromRef_64_VarVarAny            },
 
-	{ OP_STOREATREF,     MATCH_NIL,            MATCH_VAR_REF,        MATCH_MEMORY64,      MATCH_NIL, &CCodeGen_AArch64::Emit_StoreAtRef_64_VarAny                },
+	{ OP_STOREATREF,     MATCH_NIL,            MATCH_VAR_REF,        MATCH_VARIABLE64,    MATCH_NIL, &CCodeGen_AArch64::Emit_StoreAtRef_64_VarAny                },
 	{ OP_STOREATREF,     MATCH_NIL,            MATCH_VAR_REF,        MATCH_CONSTANT64,    MATCH_NIL, &CCodeGen_AArch64::Emit_StoreAtRef_64_VarAny                },
 
-	{ OP_STOREATREF,     MATCH_NIL,            MATCH_VAR_REF,        MATCH_ANY32,         MATCH_MEMORY64,   &CCodeGen_AArch64::Emit_StoreAtRef_64_VarAnyAny      },
+	{ OP_STOREATREF,     MATCH_NIL,            MATCH_VAR_REF,        MATCH_ANY32,         MATCH_VARIABLE64, &CCodeGen_AArch64::Emit_StoreAtRef_64_VarAnyAny      },
 	{ OP_STOREATREF,     MATCH_NIL,            MATCH_VAR_REF,        MATCH_ANY32,         MATCH_CONSTANT64, &CCodeGen_AArch64::Emit_StoreAtRef_64_VarAnyAny      },
 
-	{ OP_ADD64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_MEMORY64,      MATCH_NIL, &CCodeGen_AArch64::Emit_Add64_MemMemMem                     },
-	{ OP_ADD64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_CONSTANT64,    MATCH_NIL, &CCodeGen_AArch64::Emit_Add64_MemMemCst                     },
+	{ OP_ADD64,          MATCH_VARIABLE64,     MATCH_VARIABLE64,     MATCH_VARIABLE64,    MATCH_NIL, &CCodeGen_AArch64::Emit_Add64_VarVarVar                     },
+	{ OP_ADD64,          MATCH_VARIABLE64,     MATCH_VARIABLE64,     MATCH_CONSTANT64,    MATCH_NIL, &CCodeGen_AArch64::Emit_Add64_VarVarCst                     },
 	
-	{ OP_SUB64,          MATCH_MEMORY64,       MATCH_ANY,            MATCH_MEMORY64,      MATCH_NIL, &CCodeGen_AArch64::Emit_Sub64_MemAnyMem                     },
-	{ OP_SUB64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_CONSTANT64,    MATCH_NIL, &CCodeGen_AArch64::Emit_Sub64_MemMemCst                     },
+	{ OP_SUB64,          MATCH_VARIABLE64,     MATCH_ANY,            MATCH_VARIABLE64,    MATCH_NIL, &CCodeGen_AArch64::Emit_Sub64_VarAnyVar                     },
+	{ OP_SUB64,          MATCH_VARIABLE64,     MATCH_VARIABLE64,     MATCH_CONSTANT64,    MATCH_NIL, &CCodeGen_AArch64::Emit_Sub64_VarVarCst                     },
 
-	{ OP_CMP64,          MATCH_VARIABLE,       MATCH_ANY,            MATCH_MEMORY64,      MATCH_NIL, &CCodeGen_AArch64::Emit_Cmp64_VarAnyMem                     },
-	{ OP_CMP64,          MATCH_VARIABLE,       MATCH_ANY,            MATCH_CONSTANT64,    MATCH_NIL, &CCodeGen_AArch64::Emit_Cmp64_VarMemCst                     },
-	
-	{ OP_AND64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_MEMORY64,      MATCH_NIL, &CCodeGen_AArch64::Emit_And64_MemMemMem                     },
+	{ OP_CMP64,          MATCH_VARIABLE,       MATCH_ANY,            MATCH_VARIABLE64,    MATCH_NIL, &CCodeGen_AArch64::Emit_Cmp64_VarAnyVar                     },
+	{ OP_CMP64,          MATCH_VARIABLE,       MATCH_VARIABLE64,     MATCH_CONSTANT64,    MATCH_NIL, &CCodeGen_AArch64::Emit_Cmp64_VarVarCst                     },
 	
-	{ OP_SLL64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_VARIABLE,      MATCH_NIL, &CCodeGen_AArch64::Emit_Shift64_MemMemVar<SHIFT64OP_LSL>    },
-	{ OP_SRL64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_VARIABLE,      MATCH_NIL, &CCodeGen_AArch64::Emit_Shift64_MemMemVar<SHIFT64OP_LSR>    },
-	{ OP_SRA64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_VARIABLE,      MATCH_NIL, &CCodeGen_AArch64::Emit_Shift64_MemMemVar<SHIFT64OP_ASR>    },
+	{ OP_AND64,          MATCH_VARIABLE64,     MATCH_VARIABLE64,     MATCH_VARIABLE64,    MATCH_NIL, &CCodeGen_AArch64::Emit_And64_VarVarVar                     },
+
+	{ OP_OR64,           MATCH_VARIABLE64,     MATCH_ANY,            MATCH_ANY,           MATCH_NIL, &CCodeGen_AArch64::Emit_Alu64_VarAnyAny<ALU64OP_OR>         },
+	{ OP_XOR64,          MATCH_VARIABLE64,     MATCH_ANY,            MATCH_ANY,           MATCH_NIL, &CCodeGen_AArch64::Emit_Alu64_VarAnyAny<ALU64OP_XOR>        },
+	{ OP_MUL64,          MATCH_VARIABLE64,     MATCH_ANY,            MATCH_ANY,           MATCH_NIL, &CCodeGen_AArch64::Emit_Alu64_VarAnyAny<ALU64OP_MUL>        },
+	{ OP_DIV64,          MATCH_VARIABLE64,     MATCH_ANY,            MATCH_ANY,           MATCH_NIL, &CCodeGen_AArch64::Emit_Alu64_VarAnyAny<ALU64OP_UDIV>       },
+	{ OP_DIVS64,         MATCH_VARIABLE64,     MATCH_ANY,            MATCH_ANY,           MATCH_NIL, &CCodeGen_AArch64::Emit_Alu64_VarAnyAny<ALU64OP_SDIV>       },
 
-	{ OP_SLL64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_CONSTANT,      MATCH_NIL, &CCodeGen_AArch64::Emit_Shift64_MemMemCst<SHIFT64OP_LSL>    },
-	{ OP_SRL64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_CONSTANT,      MATCH_NIL, &CCodeGen_AArch64::Emit_Shift64_MemMemCst<SHIFT64OP_LSR>    },
-	{ OP_SRA64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_CONSTANT,      MATCH_NIL, &CCodeGen_AArch64::Emit_Shift64_MemMemCst<SHIFT64OP_ASR>    },
+	{ OP_NOT64,          MATCH_VARIABLE64,     MATCH_VARIABLE64,     MATCH_NIL,           MATCH_NIL, &CCodeGen_AArch64::Emit_Not64_VarVar                        },
+	{ OP_BSWAP64,        MATCH_VARIABLE64,     MATCH_VARIABLE64,     MATCH_NIL,           MATCH_NIL, &CCodeGen_AArch64::Emit_Bswap64_VarVar                      },
+
+	{ OP_SELECT64,       MATCH_VARIABLE64,     MATCH_VARIABLE,       MATCH_ANY,           MATCH_ANY, &CCodeGen_AArch64::Emit_Select64_VarVarAnyAny               },
+	
+	{ OP_SLL64,          MATCH_VARIABLE64,     MATCH_VARIABLE64,     MATCH_VARIABLE,      MATCH_NIL, &CCodeGen_AArch64::Emit_Shift64_VarVarVar<SHIFT64OP_LSL>    },
+	{ OP_SRL64,          MATCH_VARIABLE64,     MATCH_VARIABLE64,     MATCH_VARIABLE,      MATCH_NIL, &CCodeGen_AArch64::Emit_Shift64_VarVarVar<SHIFT64OP_LSR>    },
+	{ OP_SRA64,          MATCH_VARIABLE64,     MATCH_VARIABLE64,     MATCH_VARIABLE,      MATCH_NIL, &CCodeGen_AArch64::Emit_Shift64_VarVarVar<SHIFT64OP_ASR>    },
+	{ OP_ROTR64,         MATCH_VARIABLE64,     MATCH_VARIABLE64,     MATCH_VARIABLE,      MATCH_NIL, &CCodeGen_AArch64::Emit_Shift64_VarVarVar<SHIFT64OP_ROR>    },
+	{ OP_ROTL64,         MATCH_VARIABLE64,     MATCH_VARIABLE64,     MATCH_VARIABLE,      MATCH_NIL, &CCodeGen_AArch64::Emit_Rotl64_VarVarVar                    },
+
+	{ OP_SLL64,          MATCH_VARIABLE64,     MATCH_VARIABLE64,     MATCH_CONSTANT,      MATCH_NIL, &CCodeGen_AArch64::Emit_Shift64_VarVarCst<SHIFT64OP_LSL>    },
+	{ OP_SRL64,          MATCH_VARIABLE64,     MATCH_VARIABLE64,     MATCH_CONSTANT,      MATCH_NIL, &CCodeGen_AArch64::Emit_Shift64_VarVarCst<SHIFT64OP_LSR>    },
+	{ OP_SRA64,          MATCH_VARIABLE64,     MATCH_VARIABLE64,     MATCH_CONSTANT,      MATCH_NIL, &CCodeGen_AArch64::Emit_Shift64_VarVarCst<SHIFT64OP_ASR>    },
+	{ OP_ROTR64,         MATCH_VARIABLE64,     MATCH_VARIABLE64,     MATCH_CONSTANT,      MATCH_NIL, &CCodeGen_AArch64::Emit_Shift64_VarVarCst<SHIFT64OP_ROR>    },
+	{ OP_ROTL64,         MATCH_VARIABLE64,     MATCH_VARIABLE64,     MATCH_CONSTANT,      MATCH_NIL, &CCodeGen_AArch64::Emit_Rotl64_VarVarCst                    },
 	
-	{ OP_MOV,            MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_NIL,           MATCH_NIL, &CCodeGen_AArch64::Emit_Mov_Mem64Mem64                      },
-	{ OP_MOV,            MATCH_MEMORY64,       MATCH_CONSTANT64,     MATCH_NIL,           MATCH_NIL, &CCodeGen_AArch64::Emit_Mov_Mem64Cst64                      },
+	{ OP_MOV,            MATCH_VARIABLE64,     MATCH_VARIABLE64,     MATCH_NIL,           MATCH_NIL, &CCodeGen_AArch64::Emit_Mov_Var64Var64                      },
+	{ OP_MOV,            MATCH_VARIABLE64,     MATCH_CONSTANT64,     MATCH_NIL,           MATCH_NIL, &CCodeGen_AArch64::Emit_Mov_Var64Cst64                      },
 
 	{ OP_MOV,            MATCH_NIL,            MATCH_NIL,            MATCH_NIL,           MATCH_NIL, nullptr                                                     },
 };
@@ -36,16 +36,51 @@ void CCodeGen_AArch64::StoreRegisterInMemoryFp32(CSymbol* symbol, CAArch64Assemb
 	}
 }
 
+void CCodeGen_AArch64::LoadMemoryFp64InRegister(CAArch64Assembler::REGISTERMD reg, CSymbol* symbol)
+{
+	switch(symbol->m_type)
+	{
+	case SYM_FP_RELATIVE64:
+		m_assembler.Ldr_1d(reg, g_baseRegister, symbol->m_valueLow);
+		break;
+	case SYM_FP_TEMPORARY64:
+		m_assembler.Ldr_1d(reg, CAArch64Assembler::xSP, symbol->m_stackLocation);
+		break;
+	default:
+		assert(false);
+		break;
+	}
+}
+
+void CCodeGen_AArch64::StoreRegisterInMemoryFp64(CSymbol* symbol, CAArch64Assembler::REGISTERMD reg)
+{
+	switch(symbol->m_type)
+	{
+	case SYM_FP_RELATIVE64:
+		m_assembler.Str_1d(reg, g_baseRegister, symbol->m_valueLow);
+		break;
+	case SYM_FP_TEMPORARY64:
+		m_assembler.Str_1d(reg, CAArch64Assembler::xSP, symbol->m_stackLocation);
+		break;
+	default:
+		assert(false);
+		break;
+	}
+}
+
 CAArch64Assembler::REGISTERMD CCodeGen_AArch64::PrepareSymbolRegisterDefFp(CSymbol* symbol)
 {
 	switch(symbol->m_type)
 	{
 	case SYM_FP_REGISTER32:
+	case SYM_FP_REGISTER64:
 		assert(symbol->m_valueLow < MAX_MDREGISTERS);
 		return g_registersMd[symbol->m_valueLow];
 		break;
 	case SYM_FP_TEMPORARY32:
 	case SYM_FP_RELATIVE32:
+	case SYM_FP_TEMPORARY64:
+	case SYM_FP_RELATIVE64:
 		return GetNextTempRegisterMd();
 		break;
 	default:
@@ -59,6 +94,7 @@ CAArch64Assembler::REGISTERMD CCodeGen_AArch64::PrepareSymbolRegisterUseFp(CSymb
 	switch(symbol->m_type)
 	{
 	case SYM_FP_REGISTER32:
+	case SYM_FP_REGISTER64:
 		assert(symbol->m_valueLow < MAX_MDREGISTERS);
 		return g_registersMd[symbol->m_valueLow];
 		break;
@@ -70,6 +106,14 @@ CAArch64Assembler::REGISTERMD CCodeGen_AArch64::PrepareSymbolRegisterUseFp(CSymb
 		return tempRegister;
 	}
 	break;
+	case SYM_FP_TEMPORARY64:
+	case SYM_FP_RELATIVE64:
+	{
+		auto tempRegister = GetNextTempRegisterMd();
+		LoadMemoryFp64InRegister(tempRegister, symbol);
+		return tempRegister;
+	}
+	break;
 	default:
 		throw std::exception();
 		break;
@@ -81,12 +125,17 @@ void CCodeGen_AArch64::CommitSymbolRegisterFp(CSymbol* symbol, CAArch64Assembler
 	switch(symbol->m_type)
 	{
 	case SYM_FP_REGISTER32:
+	case SYM_FP_REGISTER64:
 		assert(usedRegister == g_registersMd[symbol->m_valueLow]);
 		break;
 	case SYM_FP_TEMPORARY32:
 	case SYM_FP_RELATIVE32:
 		StoreRegisterInMemoryFp32(symbol, usedRegister);
 		break;
+	case SYM_FP_TEMPORARY64:
+	case SYM_FP_RELATIVE64:
+		StoreRegisterInMemoryFp64(symbol, usedRegister);
+		break;
 	default:
 		assert(false);
 		break;
@@ -264,6 +313,168 @@ void CCodeGen_AArch64::Emit_Fp_ToInt32TruncS_VarVar(const STATEMENT& statement)
 	CommitSymbolRegisterFp(dst, dstReg);
 }
 
+void CCodeGen_AArch64::Emit_Fp_FmaS_VarVarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDefFp(dst);
+	auto src1Reg = PrepareSymbolRegisterUseFp(src1);
+	auto src2Reg = PrepareSymbolRegisterUseFp(src2);
+	auto src3Reg = PrepareSymbolRegisterUseFp(src3);
+
+	m_assembler.Fmadd_1s(dstReg, src1Reg, src2Reg, src3Reg);
+
+	CommitSymbolRegisterFp(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Fp64_Mov_RegMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	assert(dst->m_type == SYM_FP_REGISTER64);
+
+	LoadMemoryFp64InRegister(g_registersMd[dst->m_valueLow], src1);
+}
+
+void CCodeGen_AArch64::Emit_Fp64_Mov_MemReg(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	assert(src1->m_type == SYM_FP_REGISTER64);
+
+	StoreRegisterInMemoryFp64(dst, g_registersMd[src1->m_valueLow]);
+}
+
+void CCodeGen_AArch64::Emit_Fp64_LdCst_RegCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	assert(dst->m_type == SYM_FP_REGISTER64);
+	assert(src1->m_type == SYM_CONSTANT64);
+
+	auto tmpReg = GetNextTempRegister64();
+	LoadConstant64InRegister(tmpReg, src1->GetConstant64());
+	m_assembler.Fmov_1d(g_registersMd[dst->m_valueLow], tmpReg);
+}
+
+void CCodeGen_AArch64::Emit_Fp64_LdCst_TmpCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	assert(dst->m_type == SYM_FP_TEMPORARY64);
+	assert(src1->m_type == SYM_CONSTANT64);
+
+	auto tmpReg = GetNextTempRegister64();
+
+	LoadConstant64InRegister(tmpReg, src1->GetConstant64());
+	m_assembler.Str(tmpReg, CAArch64Assembler::xSP, dst->m_stackLocation);
+}
+
+void CCodeGen_AArch64::Emit_Fp_CmpD_AnyVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDef(dst, GetNextTempRegister());
+	auto src1Reg = PrepareSymbolRegisterUseFp(src1);
+	auto src2Reg = PrepareSymbolRegisterUseFp(src2);
+
+	m_assembler.Fcmp_1d(src1Reg, src2Reg);
+	Cmp_GetFlag(dstReg, statement.jmpCondition);
+
+	CommitSymbolRegister(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Fp_ToDoubleS_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDefFp(dst);
+	auto src1Reg = PrepareSymbolRegisterUseFp(src1);
+
+	m_assembler.Fcvt_1d_1s(dstReg, src1Reg);
+
+	CommitSymbolRegisterFp(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Fp_ToSingleD_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDefFp(dst);
+	auto src1Reg = PrepareSymbolRegisterUseFp(src1);
+
+	m_assembler.Fcvt_1s_1d(dstReg, src1Reg);
+
+	CommitSymbolRegisterFp(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Fp_ToInt32TruncD_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDefFp(dst);
+	auto src1Reg = PrepareSymbolRegisterUseFp(src1);
+	auto tmpReg = GetNextTempRegister();
+
+	m_assembler.Fcvtzs_1d(tmpReg, src1Reg);
+	m_assembler.Fmov_1s(dstReg, tmpReg);
+
+	CommitSymbolRegisterFp(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Fp_ToDoubleI32_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDefFp(dst);
+	auto src1Reg = PrepareSymbolRegisterUseFp(src1);
+	auto tmpReg = GetNextTempRegister();
+
+	m_assembler.Umov_1s(tmpReg, src1Reg, 0);
+	m_assembler.Scvtf_1d(dstReg, tmpReg);
+
+	CommitSymbolRegisterFp(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Fp_ToInt64TruncD_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDefFp(dst);
+	auto src1Reg = PrepareSymbolRegisterUseFp(src1);
+
+	m_assembler.Fcvtzs_1d(dstReg, src1Reg);
+
+	CommitSymbolRegisterFp(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Fp_ToDoubleI64_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDefFp(dst);
+	auto src1Reg = PrepareSymbolRegisterUseFp(src1);
+
+	m_assembler.Scvtf_1d(dstReg, src1Reg);
+
+	CommitSymbolRegisterFp(dst, dstReg);
+}
+
 void CCodeGen_AArch64::Emit_Fp_SetRoundingMode_Cst(const STATEMENT& statement)
 {
 	auto src1 = statement.src1->GetSymbol().get();
@@ -319,6 +530,8 @@ CCodeGen_AArch64::CONSTMATCHER CCodeGen_AArch64::g_fpuConstMatchers[] =
 	{ OP_FP_MUL_S,           MATCH_FP_VARIABLE32,     MATCH_FP_VARIABLE32,   MATCH_FP_VARIABLE32,  MATCH_NIL, &CCodeGen_AArch64::Emit_Fpu_VarVarVar<FPUOP_MUL>    },
 	{ OP_FP_DIV_S,           MATCH_FP_VARIABLE32,     MATCH_FP_VARIABLE32,   MATCH_FP_VARIABLE32,  MATCH_NIL, &CCodeGen_AArch64::Emit_Fpu_VarVarVar<FPUOP_DIV>    },
 
+	{ OP_FP_FMA_S,           MATCH_FP_VARIABLE32,     MATCH_FP_VARIABLE32,   MATCH_FP_VARIABLE32,  MATCH_FP_VARIABLE32, &CCodeGen_AArch64::Emit_Fp_FmaS_VarVarVarVar },
+
 	{ OP_FP_CMP_S,           MATCH_ANY,               MATCH_FP_VARIABLE32,   MATCH_FP_VARIABLE32,  MATCH_NIL, &CCodeGen_AArch64::Emit_Fp_Cmp_AnyVarVar            },
 
 	{ OP_FP_MIN_S,           MATCH_FP_VARIABLE32,     MATCH_FP_VARIABLE32,   MATCH_FP_VARIABLE32,  MATCH_NIL, &CCodeGen_AArch64::Emit_Fpu_VarVarVar<FPUOP_MIN>    },
@@ -343,6 +556,29 @@ CCodeGen_AArch64::CONSTMATCHER CCodeGen_AArch64::g_fpuConstMatchers[] =
 
 	{ OP_FP_SETROUNDINGMODE, MATCH_NIL,               MATCH_CONSTANT,        MATCH_NIL,            MATCH_NIL, &CCodeGen_AArch64::Emit_Fp_SetRoundingMode_Cst      },
 
+	{ OP_FP_ADD_D,           MATCH_FP_VARIABLE64,     MATCH_FP_VARIABLE64,   MATCH_FP_VARIABLE64,  MATCH_NIL, &CCodeGen_AArch64::Emit_Fpu_VarVarVar<FPUOP_ADD_D>       },
+	{ OP_FP_SUB_D,           MATCH_FP_VARIABLE64,     MATCH_FP_VARIABLE64,   MATCH_FP_VARIABLE64,  MATCH_NIL, &CCodeGen_AArch64::Emit_Fpu_VarVarVar<FPUOP_SUB_D>       },
+	{ OP_FP_MUL_D,           MATCH_FP_VARIABLE64,     MATCH_FP_VARIABLE64,   MATCH_FP_VARIABLE64,  MATCH_NIL, &CCodeGen_AArch64::Emit_Fpu_VarVarVar<FPUOP_MUL_D>       },
+	{ OP_FP_DIV_D,           MATCH_FP_VARIABLE64,     MATCH_FP_VARIABLE64,   MATCH_FP_VARIABLE64,  MATCH_NIL, &CCodeGen_AArch64::Emit_Fpu_VarVarVar<FPUOP_DIV_D>       },
+	{ OP_FP_MIN_D,           MATCH_FP_VARIABLE64,     MATCH_FP_VARIABLE64,   MATCH_FP_VARIABLE64,  MATCH_NIL, &CCodeGen_AArch64::Emit_Fpu_VarVarVar<FPUOP_MIN_D>       },
+	{ OP_FP_MAX_D,           MATCH_FP_VARIABLE64,     MATCH_FP_VARIABLE64,   MATCH_FP_VARIABLE64,  MATCH_NIL, &CCodeGen_AArch64::Emit_Fpu_VarVarVar<FPUOP_MAX_D>       },
+	{ OP_FP_CMP_D,           MATCH_ANY,               MATCH_FP_VARIABLE64,   MATCH_FP_VARIABLE64,  MATCH_NIL, &CCodeGen_AArch64::Emit_Fp_CmpD_AnyVarVar                },
+	{ OP_FP_ABS_D,           MATCH_FP_VARIABLE64,     MATCH_FP_VARIABLE64,   MATCH_NIL,            MATCH_NIL, &CCodeGen_AArch64::Emit_Fpu_VarVar<FPUOP_ABS_D>          },
+	{ OP_FP_NEG_D,           MATCH_FP_VARIABLE64,     MATCH_FP_VARIABLE64,   MATCH_NIL,            MATCH_NIL, &CCodeGen_AArch64::Emit_Fpu_VarVar<FPUOP_NEG_D>          },
+	{ OP_FP_SQRT_D,          MATCH_FP_VARIABLE64,     MATCH_FP_VARIABLE64,   MATCH_NIL,            MATCH_NIL, &CCodeGen_AArch64::Emit_Fpu_VarVar<FPUOP_SQRT_D>         },
+
+	{ OP_FP_TODOUBLE_S,      MATCH_FP_VARIABLE64,     MATCH_FP_VARIABLE32,   MATCH_NIL,            MATCH_NIL, &CCodeGen_AArch64::Emit_Fp_ToDoubleS_VarVar              },
+	{ OP_FP_TOSINGLE_D,      MATCH_FP_VARIABLE32,     MATCH_FP_VARIABLE64,   MATCH_NIL,            MATCH_NIL, &CCodeGen_AArch64::Emit_Fp_ToSingleD_VarVar              },
+	{ OP_FP_TOINT32_TRUNC_D, MATCH_FP_VARIABLE32,     MATCH_FP_VARIABLE64,   MATCH_NIL,            MATCH_NIL, &CCodeGen_AArch64::Emit_Fp_ToInt32TruncD_VarVar          },
+	{ OP_FP_TODOUBLE_I32,    MATCH_FP_VARIABLE64,     MATCH_FP_VARIABLE32,   MATCH_NIL,            MATCH_NIL, &CCodeGen_AArch64::Emit_Fp_ToDoubleI32_VarVar            },
+	{ OP_FP_TOINT64_TRUNC_D, MATCH_FP_VARIABLE64,     MATCH_FP_VARIABLE64,   MATCH_NIL,            MATCH_NIL, &CCodeGen_AArch64::Emit_Fp_ToInt64TruncD_VarVar          },
+	{ OP_FP_TODOUBLE_I64,    MATCH_FP_VARIABLE64,     MATCH_FP_VARIABLE64,   MATCH_NIL,            MATCH_NIL, &CCodeGen_AArch64::Emit_Fp_ToDoubleI64_VarVar            },
+
+	{ OP_MOV,                MATCH_FP_REGISTER64,     MATCH_FP_MEMORY64,     MATCH_NIL,            MATCH_NIL, &CCodeGen_AArch64::Emit_Fp64_Mov_RegMem                  },
+	{ OP_MOV,                MATCH_FP_MEMORY64,       MATCH_FP_REGISTER64,   MATCH_NIL,            MATCH_NIL, &CCodeGen_AArch64::Emit_Fp64_Mov_MemReg                  },
+	{ OP_FP_LDCST,           MATCH_FP_REGISTER64,     MATCH_CONSTANT64,      MATCH_NIL,            MATCH_NIL, &CCodeGen_AArch64::Emit_Fp64_LdCst_RegCst                },
+	{ OP_FP_LDCST,           MATCH_FP_TEMPORARY64,    MATCH_CONSTANT64,      MATCH_NIL,            MATCH_NIL, &CCodeGen_AArch64::Emit_Fp64_LdCst_TmpCst                },
+
 	{ OP_MOV,                MATCH_NIL,               MATCH_NIL,             MATCH_NIL,            MATCH_NIL, nullptr                                             },
 };
 // clang-format on
@@ -544,6 +544,95 @@ void CCodeGen_AArch64::Emit_Md_MovMasked_VarVarVar(const STATEMENT& statement)
 	CommitSymbolRegisterMd(dst, src1Reg);
 }
 
+void CCodeGen_AArch64::Emit_Md_FmaS_VarVarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	auto src1Reg = PrepareSymbolRegisterUseMd(src1);
+	auto src2Reg = PrepareSymbolRegisterUseMd(src2);
+	auto src3Reg = PrepareSymbolRegisterUseMd(src3);
+	auto dstReg = PrepareSymbolRegisterDefMd(dst);
+
+	//FMLA accumulates in its destination, make sure we don't clobber a multiplicand
+	if((dstReg == src1Reg) || (dstReg == src2Reg))
+	{
+		auto resultReg = GetNextTempRegisterMd();
+		m_assembler.Mov(resultReg, src3Reg);
+		m_assembler.Fmla_4s(resultReg, src1Reg, src2Reg);
+		m_assembler.Mov(dstReg, resultReg);
+	}
+	else
+	{
+		if(dstReg != src3Reg)
+		{
+			m_assembler.Mov(dstReg, src3Reg);
+		}
+		m_assembler.Fmla_4s(dstReg, src1Reg, src2Reg);
+	}
+
+	CommitSymbolRegisterMd(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Md_RsqrtS_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto src1Reg = PrepareSymbolRegisterUseMd(src1);
+	auto sqrtReg = GetNextTempRegisterMd();
+	auto dstReg = PrepareSymbolRegisterDefMd(dst);
+
+	m_assembler.Fsqrt_4s(sqrtReg, src1Reg);
+	m_assembler.Fmov_4s(dstReg, 0x70); //1.0
+	m_assembler.Fdiv_4s(dstReg, dstReg, sqrtReg);
+
+	CommitSymbolRegisterMd(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Md_RcplS_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto src1Reg = PrepareSymbolRegisterUseMd(src1);
+	auto oneReg = GetNextTempRegisterMd();
+	auto dstReg = PrepareSymbolRegisterDefMd(dst);
+
+	m_assembler.Fmov_4s(oneReg, 0x70); //1.0
+	m_assembler.Fdiv_4s(dstReg, oneReg, src1Reg);
+
+	CommitSymbolRegisterMd(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Md_DotS_VarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	uint8 mask = static_cast<uint8>(statement.jmpCondition);
+
+	auto src1Reg = PrepareSymbolRegisterUseMd(src1);
+	auto src2Reg = PrepareSymbolRegisterUseMd(src2);
+	auto workReg = GetNextTempRegisterMd();
+	auto maskReg = GetNextTempRegisterMd();
+
+	//Two pairwise adds give (p0 + p1) + (p2 + p3) in every lane
+	m_assembler.Fmul_4s(workReg, src1Reg, src2Reg);
+	m_assembler.Ldr_Pc(maskReg, MakeMdLaneMaskLiteral(mask >> 4));
+	m_assembler.And_16b(workReg, workReg, maskReg);
+	m_assembler.Faddp_4s(workReg, workReg, workReg);
+	m_assembler.Faddp_4s(workReg, workReg, workReg);
+	m_assembler.Ldr_Pc(maskReg, MakeMdLaneMaskLiteral(mask & 0x0F));
+
+	auto dstReg = PrepareSymbolRegisterDefMd(dst);
+	m_assembler.And_16b(dstReg, workReg, maskReg);
+
+	CommitSymbolRegisterMd(dst, dstReg);
+}
+
 void CCodeGen_AArch64::Emit_Md_ExpandW_VarReg(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -635,6 +724,117 @@ void CCodeGen_AArch64::Emit_Md_ExpandW_VarVarCst(const STATEMENT& statement)
 	CommitSymbolRegisterMd(dst, dstReg);
 }
 
+void CCodeGen_AArch64::Emit_Md_ShuffleW_VarVarCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	assert(src2->m_type == SYM_CONSTANT);
+	uint8 selector = static_cast<uint8>(src2->m_valueLow);
+
+	auto dstReg = PrepareSymbolRegisterDefMd(dst);
+	auto src1Reg = PrepareSymbolRegisterUseMd(src1);
+
+	if((selector & 0x03) * 0x55 == selector)
+	{
+		m_assembler.Dup_4s(dstReg, src1Reg, selector & 0x03);
+	}
+	else
+	{
+		auto patternReg = GetNextTempRegisterMd();
+		m_assembler.Ldr_Pc(patternReg, MakeMdShuffleWLiteral(selector));
+		m_assembler.Tbl(dstReg, src1Reg, patternReg);
+	}
+
+	CommitSymbolRegisterMd(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Md_ShuffleB_VarVarCstCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDefMd(dst);
+	auto src1Reg = PrepareSymbolRegisterUseMd(src1);
+	auto patternReg = GetNextTempRegisterMd();
+
+	m_assembler.Ldr_Pc(patternReg, MakeMdShuffleBLiteral(src2->GetConstant64(), src3->GetConstant64()));
+	m_assembler.Tbl(dstReg, src1Reg, patternReg);
+
+	CommitSymbolRegisterMd(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Md_InsertW_VarVarAnyCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDefMd(dst);
+	auto src1Reg = PrepareSymbolRegisterUseMd(src1);
+	auto src2Reg = PrepareSymbolRegisterUse(src2, GetNextTempRegister());
+
+	if(dstReg != src1Reg)
+	{
+		m_assembler.Mov(dstReg, src1Reg);
+	}
+	m_assembler.Ins_1s(dstReg, static_cast<uint8>(src3->m_valueLow), src2Reg);
+
+	CommitSymbolRegisterMd(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Md_InsertW_VarVarFpvarCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDefMd(dst);
+	auto src1Reg = PrepareSymbolRegisterUseMd(src1);
+	auto src2Reg = PrepareSymbolRegisterUseFp(src2);
+
+	if(dstReg != src1Reg)
+	{
+		m_assembler.Mov(dstReg, src1Reg);
+	}
+	m_assembler.Ins_1s(dstReg, static_cast<uint8>(src3->m_valueLow), src2Reg, 0);
+
+	CommitSymbolRegisterMd(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Md_ExtractW_VarVarCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDef(dst, GetNextTempRegister());
+	auto src1Reg = PrepareSymbolRegisterUseMd(src1);
+
+	m_assembler.Umov_1s(dstReg, src1Reg, static_cast<uint8>(src2->m_valueLow));
+
+	CommitSymbolRegister(dst, dstReg);
+}
+
+void CCodeGen_AArch64::Emit_Md_ExtractW_FpvarVarCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDefFp(dst);
+	auto src1Reg = PrepareSymbolRegisterUseMd(src1);
+
+	m_assembler.Ins_1s(dstReg, 0, src1Reg, static_cast<uint8>(src2->m_valueLow));
+
+	CommitSymbolRegisterFp(dst, dstReg);
+}
+
 void CCodeGen_AArch64::Emit_Md_PackHB_VarVarVar(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -687,6 +887,64 @@ void CCodeGen_AArch64::Emit_Md_PackWH_VarVarVar(const STATEMENT& statement)
 	CommitSymbolRegisterMd(dst, dstReg);
 }
 
+template <bool isSigned>
+void CCodeGen_AArch64::Emit_Md_MulHiH_VarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDefMd(dst);
+	auto src1Reg = PrepareSymbolRegisterUseMd(src1);
+	auto src2Reg = PrepareSymbolRegisterUseMd(src2);
+
+	auto lowReg = GetNextTempRegisterMd();
+	auto highReg = GetNextTempRegisterMd();
+
+	if(isSigned)
+	{
+		m_assembler.Smull_4s(lowReg, src1Reg, src2Reg);
+		m_assembler.Smull2_4s(highReg, src1Reg, src2Reg);
+	}
+	else
+	{
+		m_assembler.Umull_4s(lowReg, src1Reg, src2Reg);
+		m_assembler.Umull2_4s(highReg, src1Reg, src2Reg);
+	}
+	m_assembler.Uzp2_8h(dstReg, lowReg, highReg);
+
+	CommitSymbolRegisterMd(dst, dstReg);
+}
+
+template <bool isSigned>
+void CCodeGen_AArch64::Emit_Md_MulWD_VarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDefMd(dst);
+	auto src1Reg = PrepareSymbolRegisterUseMd(src1);
+	auto src2Reg = PrepareSymbolRegisterUseMd(src2);
+
+	//Narrowing each 64-bit lane gathers the even 32-bit lanes
+	auto src1EvenReg = GetNextTempRegisterMd();
+	auto src2EvenReg = GetNextTempRegisterMd();
+
+	m_assembler.Xtn1_2s(src1EvenReg, src1Reg);
+	m_assembler.Xtn1_2s(src2EvenReg, src2Reg);
+	if(isSigned)
+	{
+		m_assembler.Smull_2d(dstReg, src1EvenReg, src2EvenReg);
+	}
+	else
+	{
+		m_assembler.Umull_2d(dstReg, src1EvenReg, src2EvenReg);
+	}
+
+	CommitSymbolRegisterMd(dst, dstReg);
+}
+
 void CCodeGen_AArch64::Emit_MergeTo256_MemVarVar(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -799,10 +1057,24 @@ CCodeGen_AArch64::CONSTMATCHER CCodeGen_AArch64::g_mdConstMatchers[] =
 	{ OP_MD_MAX_H,              MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      MATCH_NIL, &CCodeGen_AArch64::Emit_Md_VarVarVar<MDOP_MAXH>                  },
 	{ OP_MD_MAX_W,              MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      MATCH_NIL, &CCodeGen_AArch64::Emit_Md_VarVarVar<MDOP_MAXW>                  },
 
+	{ OP_MD_MUL_H,              MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      MATCH_NIL, &CCodeGen_AArch64::Emit_Md_VarVarVar<MDOP_MULH>                  },
+	{ OP_MD_MULHS_H,            MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      MATCH_NIL, &CCodeGen_AArch64::Emit_Md_MulHiH_VarVarVar<true>                },
+	{ OP_MD_MULHU_H,            MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      MATCH_NIL, &CCodeGen_AArch64::Emit_Md_MulHiH_VarVarVar<false>               },
+	{ OP_MD_MUL_W,              MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      MATCH_NIL, &CCodeGen_AArch64::Emit_Md_VarVarVar<MDOP_MULW>                  },
+	{ OP_MD_MULS_WD,            MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      MATCH_NIL, &CCodeGen_AArch64::Emit_Md_MulWD_VarVarVar<true>                 },
+	{ OP_MD_MULU_WD,            MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      MATCH_NIL, &CCodeGen_AArch64::Emit_Md_MulWD_VarVarVar<false>                },
+
 	{ OP_MD_ADD_S,              MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      MATCH_NIL, &CCodeGen_AArch64::Emit_Md_VarVarVar<MDOP_ADDS>                  },
 	{ OP_MD_SUB_S,              MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      MATCH_NIL, &CCodeGen_AArch64::Emit_Md_VarVarVar<MDOP_SUBS>                  },
 	{ OP_MD_MUL_S,              MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      MATCH_NIL, &CCodeGen_AArch64::Emit_Md_VarVarVar<MDOP_MULS>                  },
 	{ OP_MD_DIV_S,              MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      MATCH_NIL, &CCodeGen_AArch64::Emit_Md_VarVarVar<MDOP_DIVS>                  },
+	{ OP_MD_FMA_S,              MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      MATCH_VARIABLE128, &CCodeGen_AArch64::Emit_Md_FmaS_VarVarVarVar           },
+
+	{ OP_MD_SQRT_S,             MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_NIL,              MATCH_NIL, &CCodeGen_AArch64::Emit_Md_VarVar<MDOP_SQRTS>                    },
+	{ OP_MD_RSQRT_S,            MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_NIL,              MATCH_NIL, &CCodeGen_AArch64::Emit_Md_RsqrtS_VarVar                         },
+	{ OP_MD_RCPL_S,             MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_NIL,              MATCH_NIL, &CCodeGen_AArch64::Emit_Md_RcplS_VarVar                          },
+	{ OP_MD_DOT_S,              MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      MATCH_NIL, &CCodeGen_AArch64::Emit_Md_DotS_VarVarVar                        },
+	{ OP_MD_HADD_S,             MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      MATCH_NIL, &CCodeGen_AArch64::Emit_Md_VarVarVar<MDOP_HADDS>                 },
 
 	{ OP_MD_ABS_S,              MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_NIL,              MATCH_NIL, &CCodeGen_AArch64::Emit_Md_VarVar<MDOP_ABSS>                     },
 	{ OP_MD_NEG_S,              MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_NIL,              MATCH_NIL, &CCodeGen_AArch64::Emit_Md_VarVar<MDOP_NEGS>                     },
@@ -850,6 +1122,13 @@ CCodeGen_AArch64::CONSTMATCHER CCodeGen_AArch64::g_mdConstMatchers[] =
 	{ OP_MD_EXPAND_W,           MATCH_VARIABLE128,    MATCH_CONSTANT,       MATCH_NIL,              MATCH_NIL, &CCodeGen_AArch64::Emit_Md_ExpandW_VarCst                        },
 	{ OP_MD_EXPAND_W,           MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_CONSTANT,         MATCH_NIL, &CCodeGen_AArch64::Emit_Md_ExpandW_VarVarCst                     },
 
+	{ OP_MD_SHUFFLE_W,          MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_CONSTANT,         MATCH_NIL,         &CCodeGen_AArch64::Emit_Md_ShuffleW_VarVarCst            },
+	{ OP_MD_SHUFFLE_B,          MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_CONSTANT64,       MATCH_CONSTANT64,  &CCodeGen_AArch64::Emit_Md_ShuffleB_VarVarCstCst         },
+	{ OP_MD_INSERT_W,           MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_ANY32,            MATCH_CONSTANT,    &CCodeGen_AArch64::Emit_Md_InsertW_VarVarAnyCst          },
+	{ OP_MD_INSERT_W,           MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_FP_VARIABLE32,    MATCH_CONSTANT,    &CCodeGen_AArch64::Emit_Md_InsertW_VarVarFpvarCst        },
+	{ OP_MD_EXTRACT_W,          MATCH_VARIABLE,       MATCH_VARIABLE128,    MATCH_CONSTANT,         MATCH_NIL,         &CCodeGen_AArch64::Emit_Md_ExtractW_VarVarCst            },
+	{ OP_MD_EXTRACT_W,          MATCH_FP_VARIABLE32,  MATCH_VARIABLE128,    MATCH_CONSTANT,         MATCH_NIL,         &CCodeGen_AArch64::Emit_Md_ExtractW_FpvarVarCst          },
+
 	{ OP_MD_PACK_HB,            MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      MATCH_NIL, &CCodeGen_AArch64::Emit_Md_PackHB_VarVarVar                      },
 	{ OP_MD_PACK_WH,            MATCH_VARIABLE128,    MATCH_VARIABLE128,    MATCH_VARIABLE128,      MATCH_NIL, &CCodeGen_AArch64::Emit_Md_PackWH_VarVarVar                      },
 
@@ -10,6 +10,20 @@ using namespace Jitter;
 
 #include "Jitter_CodeGen_Wasm_LoadStore.h"
 
+template <uint32 op>
+void CCodeGen_Wasm::Emit_Generic_Unary_MemAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	PrepareSymbolDef(dst);
+	PrepareSymbolUse(src1);
+
+	m_functionStream.Write8(op);
+
+	CommitSymbol(dst);
+}
+
 template <uint32 op>
 void CCodeGen_Wasm::Emit_Generic_Binary_MemAnyAny(const STATEMENT& statement)
 {
@@ -102,6 +116,7 @@ CCodeGen_Wasm::CONSTMATCHER CCodeGen_Wasm::g_constMatchers[] =
 
 	{ OP_LOADFROMREF,    MATCH_VARIABLE,       MATCH_VAR_REF,        MATCH_NIL,           MATCH_NIL,      &CCodeGen_Wasm::Emit_LoadFromRef_VarVar                     },
 	{ OP_LOADFROMREF,    MATCH_VARIABLE,       MATCH_VAR_REF,        MATCH_ANY32,         MATCH_NIL,      &CCodeGen_Wasm::Emit_LoadFromRef_VarVarAny                  },
+	{ OP_LOOKUP,         MATCH_VARIABLE,       MATCH_CONSTANTPTR,    MATCH_ANY32,         MATCH_NIL,      &CCodeGen_Wasm::Emit_Lookup_VarCstAny                       },
 
 	// Reusing the same generators for refs since they're 32-bit values
 	{ OP_LOADFROMREF,    MATCH_VAR_REF,        MATCH_VAR_REF,        MATCH_NIL,           MATCH_NIL,      &CCodeGen_Wasm::Emit_LoadFromRef_VarVar                     },
@@ -139,9 +154,15 @@ CCodeGen_Wasm::CONSTMATCHER CCodeGen_Wasm::g_constMatchers[] =
 	{ OP_SLL,            MATCH_ANY,            MATCH_ANY,            MATCH_ANY,           MATCH_NIL,      &CCodeGen_Wasm::Emit_Generic_Binary_MemAnyAny<Wasm::INST_I32_SHL>   },
 	{ OP_SRL,            MATCH_ANY,            MATCH_ANY,            MATCH_ANY,           MATCH_NIL,      &CCodeGen_Wasm::Emit_Generic_Binary_MemAnyAny<Wasm::INST_I32_SHR_U> },
 	{ OP_SRA,            MATCH_ANY,            MATCH_ANY,            MATCH_ANY,           MATCH_NIL,      &CCodeGen_Wasm::Emit_Generic_Binary_MemAnyAny<Wasm::INST_I32_SHR_S> },
+	{ OP_ROTL,           MATCH_ANY,            MATCH_ANY,            MATCH_ANY,           MATCH_NIL,      &CCodeGen_Wasm::Emit_Generic_Binary_MemAnyAny<Wasm::INST_I32_ROTL>  },
+	{ OP_ROTR,           MATCH_ANY,            MATCH_ANY,            MATCH_ANY,           MATCH_NIL,      &CCodeGen_Wasm::Emit_Generic_Binary_MemAnyAny<Wasm::INST_I32_ROTR>  },
 
 	{ OP_NOT,            MATCH_ANY,            MATCH_ANY,            MATCH_NIL,           MATCH_NIL,      &CCodeGen_Wasm::Emit_Not_AnyAny                             },
 	{ OP_LZC,            MATCH_ANY,            MATCH_ANY,            MATCH_NIL,           MATCH_NIL,      &CCodeGen_Wasm::Emit_Lzc_AnyAny                             },
+	{ OP_TZC,            MATCH_ANY,            MATCH_ANY,            MATCH_NIL,           MATCH_NIL,      &CCodeGen_Wasm::Emit_Generic_Unary_MemAny<Wasm::INST_I32_CTZ>    },
+	{ OP_POPCNT,         MATCH_ANY,            MATCH_ANY,            MATCH_NIL,           MATCH_NIL,      &CCodeGen_Wasm::Emit_Generic_Unary_MemAny<Wasm::INST_I32_POPCNT> },
+	{ OP_BSWAP,          MATCH_ANY,            MATCH_ANY,            MATCH_NIL,           MATCH_NIL,      &CCodeGen_Wasm::Emit_Bswap_AnyAny                           },
+	{ OP_BSWAP16,        MATCH_ANY,            MATCH_ANY,            MATCH_NIL,           MATCH_NIL,      &CCodeGen_Wasm::Emit_Bswap16_AnyAny                         },
 
 	{ OP_AND,            MATCH_ANY,            MATCH_ANY,            MATCH_ANY,           MATCH_NIL,      &CCodeGen_Wasm::Emit_Generic_Binary_MemAnyAny<Wasm::INST_I32_AND> },
 	{ OP_OR,             MATCH_ANY,            MATCH_ANY,            MATCH_ANY,           MATCH_NIL,      &CCodeGen_Wasm::Emit_Generic_Binary_MemAnyAny<Wasm::INST_I32_OR>  },
@@ -267,6 +288,7 @@ void CCodeGen_Wasm::GenerateCode(const StatementList& statements, unsigned int s
 	m_localI32Count = 0;
 	m_localI64Count = 0;
 	m_localF32Count = 0;
+	m_localF64Count = 0;
 	m_localV128Count = 0;
 	m_isInsideBlock = false;
 	m_isInsideLoop = false;
@@ -318,6 +340,7 @@ void CCodeGen_Wasm::GenerateCode(const StatementList& statements, unsigned int s
 	function.localI32Count = m_localI32Count;
 	function.localI64Count = m_localI64Count;
 	function.localF32Count = m_localF32Count;
+	function.localF64Count = m_localF64Count;
 	function.localV128Count = m_localV128Count;
 
 	moduleBuilder.AddFunction(std::move(function));
@@ -340,11 +363,26 @@ unsigned int CCodeGen_Wasm::GetAvailableRegisterCount() const
 	return 0;
 }
 
+unsigned int CCodeGen_Wasm::GetAvailableCallerSavedRegisterCount() const
+{
+	return 0;
+}
+
 unsigned int CCodeGen_Wasm::GetAvailableMdRegisterCount() const
 {
 	return 0;
 }
 
+unsigned int CCodeGen_Wasm::GetMdTempRegisterCount(const STATEMENT&) const
+{
+	return 0;
+}
+
+bool CCodeGen_Wasm::IsHelperCall(const STATEMENT&) const
+{
+	return false;
+}
+
 bool CCodeGen_Wasm::Has128BitsCallOperands() const
 {
 	return false;
@@ -355,6 +393,11 @@ bool CCodeGen_Wasm::CanHold128BitsReturnValueInRegisters() const
 	return false;
 }
 
+bool CCodeGen_Wasm::Has64BitsRegisters() const
+{
+	return false;
+}
+
 bool CCodeGen_Wasm::SupportsExternalJumps() const
 {
 	return false;
@@ -365,6 +408,28 @@ bool CCodeGen_Wasm::SupportsCmpSelect() const
 	return false;
 }
 
+bool CCodeGen_Wasm::SupportsJumpTables() const
+{
+	return false;
+}
+
+bool CCodeGen_Wasm::SupportsTestJumps() const
+{
+	return false;
+}
+
+bool CCodeGen_Wasm::SupportsIndexScale(uint32 accessSize, uint32 scale) const
+{
+	if(scale == 1) return true;
+	//Only 32-bit accesses can use their natural size as scale
+	return (accessSize == 4) && (scale == 4);
+}
+
+bool CCodeGen_Wasm::SupportsFma() const
+{
+	return false;
+}
+
 uint32 CCodeGen_Wasm::GetPointerSize() const
 {
 	return 4;
@@ -612,6 +677,10 @@ void CCodeGen_Wasm::PrepareLocalVars(const StatementList& statements)
 				    m_temporaryLocations[temporaryInstance] = m_localF32Count;
 				    m_localF32Count++;
 				    break;
+			    case SYM_FP_TEMPORARY64:
+				    m_temporaryLocations[temporaryInstance] = m_localF64Count;
+				    m_localF64Count++;
+				    break;
 			    case SYM_TEMPORARY128:
 				    m_temporaryLocations[temporaryInstance] = m_localV128Count;
 				    m_localV128Count++;
@@ -651,9 +720,12 @@ uint32 CCodeGen_Wasm::GetTemporaryLocation(CSymbol* symbol) const
 	case SYM_FP_TEMPORARY32:
 		localIdx = temporaryLocation + m_localI32Count + m_localI64Count + 1;
 		break;
+	case SYM_FP_TEMPORARY64:
+		localIdx = temporaryLocation + m_localI32Count + m_localI64Count + m_localF32Count + 1;
+		break;
 	case SYM_TEMPORARY128:
 	case SYM_TEMPORARY256:
-		localIdx = temporaryLocation + m_localI32Count + m_localI64Count + m_localF32Count + 1;
+		localIdx = temporaryLocation + m_localI32Count + m_localI64Count + m_localF32Count + m_localF64Count + 1;
 		break;
 	default:
 		assert(false);
@@ -676,6 +748,7 @@ void CCodeGen_Wasm::PushRelativeAddress(CSymbol* symbol)
 	    (symbol->m_type == SYM_RELATIVE) ||
 	    (symbol->m_type == SYM_RELATIVE64) ||
 	    (symbol->m_type == SYM_FP_RELATIVE32) ||
+	    (symbol->m_type == SYM_FP_RELATIVE64) ||
 	    (symbol->m_type == SYM_RELATIVE128));
 
 	PushContext();
@@ -774,6 +847,10 @@ void CCodeGen_Wasm::PrepareSymbolUse(CSymbol* symbol)
 		m_functionStream.Write8(Wasm::INST_I32_CONST);
 		CWasmModuleBuilder::WriteSLeb128(m_functionStream, static_cast<int32>(symbol->m_valueLow));
 		break;
+	case SYM_CONSTANTPTR:
+		m_functionStream.Write8(Wasm::INST_I32_CONST);
+		CWasmModuleBuilder::WriteSLeb128(m_functionStream, static_cast<int32>(symbol->GetConstantPtr()));
+		break;
 	case SYM_RELATIVE64:
 		PushRelative64(symbol);
 		break;
@@ -790,6 +867,12 @@ void CCodeGen_Wasm::PrepareSymbolUse(CSymbol* symbol)
 	case SYM_FP_TEMPORARY32:
 		PushTemporaryFp32(symbol);
 		break;
+	case SYM_FP_RELATIVE64:
+		PushRelativeFp64(symbol);
+		break;
+	case SYM_FP_TEMPORARY64:
+		PushTemporaryFp64(symbol);
+		break;
 	case SYM_RELATIVE128:
 		PushRelative128(symbol);
 		break;
@@ -810,6 +893,7 @@ void CCodeGen_Wasm::PrepareSymbolDef(CSymbol* symbol)
 	case SYM_RELATIVE64:
 	case SYM_RELATIVE128:
 	case SYM_FP_RELATIVE32:
+	case SYM_FP_RELATIVE64:
 		PushRelativeAddress(symbol);
 		break;
 	case SYM_TEMPORARY:
@@ -817,6 +901,7 @@ void CCodeGen_Wasm::PrepareSymbolDef(CSymbol* symbol)
 	case SYM_TEMPORARY128:
 	case SYM_TMP_REFERENCE:
 	case SYM_FP_TEMPORARY32:
+	case SYM_FP_TEMPORARY64:
 		break;
 	default:
 		assert(false);
@@ -855,6 +940,14 @@ void CCodeGen_Wasm::CommitSymbol(CSymbol* symbol)
 	case SYM_FP_TEMPORARY32:
 		PullTemporaryFp32(symbol);
 		break;
+	case SYM_FP_RELATIVE64:
+		m_functionStream.Write8(Wasm::INST_F64_STORE);
+		m_functionStream.Write8(0x03);
+		m_functionStream.Write8(0x00);
+		break;
+	case SYM_FP_TEMPORARY64:
+		PullTemporaryFp64(symbol);
+		break;
 	case SYM_RELATIVE128:
 		m_functionStream.Write8(Wasm::INST_PREFIX_SIMD);
 		m_functionStream.Write8(Wasm::INST_V128_STORE);
@@ -1032,6 +1125,13 @@ void CCodeGen_Wasm::Emit_LoadFromRef_VarVarAny(const STATEMENT& statement)
 	CommitSymbol(dst);
 }
 
+void CCodeGen_Wasm::Emit_Lookup_VarCstAny(const STATEMENT& statement)
+{
+	auto loadStatement = statement;
+	loadStatement.jmpCondition = static_cast<CONDITION>(sizeof(uint32));
+	Emit_LoadFromRef_VarVarAny(loadStatement);
+}
+
 void CCodeGen_Wasm::Emit_StoreAtRef_VarAny(const STATEMENT& statement)
 {
 	auto src1 = statement.src1->GetSymbol().get();
@@ -1355,6 +1455,64 @@ void CCodeGen_Wasm::Emit_Lzc_AnyAny(const STATEMENT& statement)
 	CommitSymbol(dst);
 }
 
+void CCodeGen_Wasm::Emit_Bswap_AnyAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	PrepareSymbolDef(dst);
+
+	//(rotl(x, 8) & 0x00FF00FF) | (rotr(x, 8) & 0xFF00FF00)
+	PrepareSymbolUse(src1);
+	m_functionStream.Write8(Wasm::INST_I32_CONST);
+	CWasmModuleBuilder::WriteSLeb128(m_functionStream, 8);
+	m_functionStream.Write8(Wasm::INST_I32_ROTL);
+	m_functionStream.Write8(Wasm::INST_I32_CONST);
+	CWasmModuleBuilder::WriteSLeb128(m_functionStream, 0x00FF00FF);
+	m_functionStream.Write8(Wasm::INST_I32_AND);
+
+	PrepareSymbolUse(src1);
+	m_functionStream.Write8(Wasm::INST_I32_CONST);
+	CWasmModuleBuilder::WriteSLeb128(m_functionStream, 8);
+	m_functionStream.Write8(Wasm::INST_I32_ROTR);
+	m_functionStream.Write8(Wasm::INST_I32_CONST);
+	CWasmModuleBuilder::WriteSLeb128(m_functionStream, static_cast<int32>(0xFF00FF00));
+	m_functionStream.Write8(Wasm::INST_I32_AND);
+
+	m_functionStream.Write8(Wasm::INST_I32_OR);
+
+	CommitSymbol(dst);
+}
+
+void CCodeGen_Wasm::Emit_Bswap16_AnyAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	PrepareSymbolDef(dst);
+
+	//((x & 0xFF) << 8) | ((x >> 8) & 0xFF)
+	PrepareSymbolUse(src1);
+	m_functionStream.Write8(Wasm::INST_I32_CONST);
+	CWasmModuleBuilder::WriteSLeb128(m_functionStream, 0xFF);
+	m_functionStream.Write8(Wasm::INST_I32_AND);
+	m_functionStream.Write8(Wasm::INST_I32_CONST);
+	CWasmModuleBuilder::WriteSLeb128(m_functionStream, 8);
+	m_functionStream.Write8(Wasm::INST_I32_SHL);
+
+	PrepareSymbolUse(src1);
+	m_functionStream.Write8(Wasm::INST_I32_CONST);
+	CWasmModuleBuilder::WriteSLeb128(m_functionStream, 8);
+	m_functionStream.Write8(Wasm::INST_I32_SHR_U);
+	m_functionStream.Write8(Wasm::INST_I32_CONST);
+	CWasmModuleBuilder::WriteSLeb128(m_functionStream, 0xFF);
+	m_functionStream.Write8(Wasm::INST_I32_AND);
+
+	m_functionStream.Write8(Wasm::INST_I32_OR);
+
+	CommitSymbol(dst);
+}
+
 void CCodeGen_Wasm::Emit_ExtLow64VarMem64(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -79,6 +79,65 @@ void CCodeGen_Wasm::Emit_Mov64_MemAny(const STATEMENT& statement)
 	CommitSymbol(dst);
 }
 
+void CCodeGen_Wasm::Emit_Not64_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	PrepareSymbolDef(dst);
+	PrepareSymbolUse(src1);
+
+	m_functionStream.Write8(Wasm::INST_I64_CONST);
+	CWasmModuleBuilder::WriteSLeb128(m_functionStream, -1);
+
+	m_functionStream.Write8(Wasm::INST_I64_XOR);
+
+	CommitSymbol(dst);
+}
+
+void CCodeGen_Wasm::Emit_Bswap64_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	//Swap bytes, then 16-bit halves inside each word, then both words
+	//dst is used to hold intermediate results
+	auto emitSwapStep =
+	    [&](CSymbol* src, uint64 mask, int64 shiftAmount) {
+		    PrepareSymbolDef(dst);
+
+		    PrepareSymbolUse(src);
+		    m_functionStream.Write8(Wasm::INST_I64_CONST);
+		    CWasmModuleBuilder::WriteSLeb128(m_functionStream, mask);
+		    m_functionStream.Write8(Wasm::INST_I64_AND);
+		    m_functionStream.Write8(Wasm::INST_I64_CONST);
+		    CWasmModuleBuilder::WriteSLeb128(m_functionStream, shiftAmount);
+		    m_functionStream.Write8(Wasm::INST_I64_SHL);
+
+		    PrepareSymbolUse(src);
+		    m_functionStream.Write8(Wasm::INST_I64_CONST);
+		    CWasmModuleBuilder::WriteSLeb128(m_functionStream, shiftAmount);
+		    m_functionStream.Write8(Wasm::INST_I64_SHR_U);
+		    m_functionStream.Write8(Wasm::INST_I64_CONST);
+		    CWasmModuleBuilder::WriteSLeb128(m_functionStream, mask);
+		    m_functionStream.Write8(Wasm::INST_I64_AND);
+
+		    m_functionStream.Write8(Wasm::INST_I64_OR);
+
+		    CommitSymbol(dst);
+	    };
+
+	emitSwapStep(src1, 0x00FF00FF00FF00FFULL, 8);
+	emitSwapStep(dst, 0x0000FFFF0000FFFFULL, 16);
+
+	PrepareSymbolDef(dst);
+	PrepareSymbolUse(dst);
+	m_functionStream.Write8(Wasm::INST_I64_CONST);
+	CWasmModuleBuilder::WriteSLeb128(m_functionStream, 32);
+	m_functionStream.Write8(Wasm::INST_I64_ROTL);
+	CommitSymbol(dst);
+}
+
 void CCodeGen_Wasm::Emit_MergeTo64_Mem64AnyAny(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -172,12 +231,39 @@ CCodeGen_Wasm::CONSTMATCHER CCodeGen_Wasm::g_64ConstMatchers[] =
 
 	{ OP_AND64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_MEMORY64,      MATCH_NIL, &CCodeGen_Wasm::Emit_Alu64_MemAnyAny<Wasm::INST_I64_AND> },
 
+	{ OP_OR64,           MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_MEMORY64,      MATCH_NIL, &CCodeGen_Wasm::Emit_Alu64_MemAnyAny<Wasm::INST_I64_OR> },
+	{ OP_OR64,           MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_CONSTANT64,    MATCH_NIL, &CCodeGen_Wasm::Emit_Alu64_MemAnyAny<Wasm::INST_I64_OR> },
+
+	{ OP_XOR64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_MEMORY64,      MATCH_NIL, &CCodeGen_Wasm::Emit_Alu64_MemAnyAny<Wasm::INST_I64_XOR> },
+	{ OP_XOR64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_CONSTANT64,    MATCH_NIL, &CCodeGen_Wasm::Emit_Alu64_MemAnyAny<Wasm::INST_I64_XOR> },
+
+	{ OP_NOT64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_NIL,           MATCH_NIL, &CCodeGen_Wasm::Emit_Not64_MemMem                        },
+
+	{ OP_BSWAP64,        MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_NIL,           MATCH_NIL, &CCodeGen_Wasm::Emit_Bswap64_MemMem                      },
+
+	{ OP_MUL64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_MEMORY64,      MATCH_NIL, &CCodeGen_Wasm::Emit_Alu64_MemAnyAny<Wasm::INST_I64_MUL> },
+	{ OP_MUL64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_CONSTANT64,    MATCH_NIL, &CCodeGen_Wasm::Emit_Alu64_MemAnyAny<Wasm::INST_I64_MUL> },
+
+	{ OP_DIV64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_MEMORY64,      MATCH_NIL, &CCodeGen_Wasm::Emit_Alu64_MemAnyAny<Wasm::INST_I64_DIV_U> },
+	{ OP_DIV64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_CONSTANT64,    MATCH_NIL, &CCodeGen_Wasm::Emit_Alu64_MemAnyAny<Wasm::INST_I64_DIV_U> },
+	{ OP_DIV64,          MATCH_MEMORY64,       MATCH_CONSTANT64,     MATCH_MEMORY64,      MATCH_NIL, &CCodeGen_Wasm::Emit_Alu64_MemAnyAny<Wasm::INST_I64_DIV_U> },
+
+	{ OP_DIVS64,         MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_MEMORY64,      MATCH_NIL, &CCodeGen_Wasm::Emit_Alu64_MemAnyAny<Wasm::INST_I64_DIV_S> },
+	{ OP_DIVS64,         MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_CONSTANT64,    MATCH_NIL, &CCodeGen_Wasm::Emit_Alu64_MemAnyAny<Wasm::INST_I64_DIV_S> },
+	{ OP_DIVS64,         MATCH_MEMORY64,       MATCH_CONSTANT64,     MATCH_MEMORY64,      MATCH_NIL, &CCodeGen_Wasm::Emit_Alu64_MemAnyAny<Wasm::INST_I64_DIV_S> },
+
+	{ OP_SELECT64,       MATCH_MEMORY64,       MATCH_VARIABLE,       MATCH_ANY,           MATCH_ANY, &CCodeGen_Wasm::Emit_Select_VarVarAnyAny                 },
+
 	{ OP_SLL64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_ANY,           MATCH_NIL, &CCodeGen_Wasm::Emit_Shift64_MemAnyAny<Wasm::INST_I64_SHL>     },
 
 	{ OP_SRL64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_ANY,           MATCH_NIL, &CCodeGen_Wasm::Emit_Shift64_MemAnyAny<Wasm::INST_I64_SHR_U>   },
 
 	{ OP_SRA64,          MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_ANY,           MATCH_NIL, &CCodeGen_Wasm::Emit_Shift64_MemAnyAny<Wasm::INST_I64_SHR_S>   },
 
+	{ OP_ROTL64,         MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_ANY,           MATCH_NIL, &CCodeGen_Wasm::Emit_Shift64_MemAnyAny<Wasm::INST_I64_ROTL>    },
+
+	{ OP_ROTR64,         MATCH_MEMORY64,       MATCH_MEMORY64,       MATCH_ANY,           MATCH_NIL, &CCodeGen_Wasm::Emit_Shift64_MemAnyAny<Wasm::INST_I64_ROTR>    },
+
 	{ OP_CMP64,          MATCH_MEMORY,         MATCH_MEMORY64,       MATCH_MEMORY64,      MATCH_NIL, &CCodeGen_Wasm::Emit_Cmp64_MemAnyAny                     },
 	{ OP_CMP64,          MATCH_MEMORY,         MATCH_MEMORY64,       MATCH_CONSTANT64,    MATCH_NIL, &CCodeGen_Wasm::Emit_Cmp64_MemAnyAny                     },
 
@@ -63,6 +63,35 @@ void CCodeGen_Wasm::PullTemporaryFp32(CSymbol* symbol)
 	CWasmModuleBuilder::WriteULeb128(m_functionStream, localIdx);
 }
 
+void CCodeGen_Wasm::PushRelativeFp64(CSymbol* symbol)
+{
+	PushRelativeAddress(symbol);
+
+	m_functionStream.Write8(Wasm::INST_F64_LOAD);
+	m_functionStream.Write8(0x03);
+	m_functionStream.Write8(0x00);
+}
+
+void CCodeGen_Wasm::PushTemporaryFp64(CSymbol* symbol)
+{
+	assert(symbol->m_type == SYM_FP_TEMPORARY64);
+
+	uint32 localIdx = GetTemporaryLocation(symbol);
+
+	m_functionStream.Write8(Wasm::INST_LOCAL_GET);
+	CWasmModuleBuilder::WriteULeb128(m_functionStream, localIdx);
+}
+
+void CCodeGen_Wasm::PullTemporaryFp64(CSymbol* symbol)
+{
+	assert(symbol->m_type == SYM_FP_TEMPORARY64);
+
+	uint32 localIdx = GetTemporaryLocation(symbol);
+
+	m_functionStream.Write8(Wasm::INST_LOCAL_SET);
+	CWasmModuleBuilder::WriteULeb128(m_functionStream, localIdx);
+}
+
 void CCodeGen_Wasm::Emit_Fp_Cmp_AnyMemMem(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -236,6 +265,115 @@ void CCodeGen_Wasm::Emit_Fp_SetRoundingMode_Cst(const STATEMENT& statement)
 	//Not supported
 }
 
+void CCodeGen_Wasm::Emit_Fp_CmpD_AnyMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	PrepareSymbolDef(dst);
+	PrepareSymbolUse(src1);
+	PrepareSymbolUse(src2);
+
+	switch(statement.jmpCondition)
+	{
+	case CONDITION_EQ:
+		m_functionStream.Write8(Wasm::INST_F64_EQ);
+		break;
+	case CONDITION_BL:
+		m_functionStream.Write8(Wasm::INST_F64_LT);
+		break;
+	case CONDITION_BE:
+		m_functionStream.Write8(Wasm::INST_F64_LE);
+		break;
+	case CONDITION_AB:
+		m_functionStream.Write8(Wasm::INST_F64_GT);
+		break;
+	default:
+		assert(false);
+		break;
+	}
+
+	CommitSymbol(dst);
+}
+
+void CCodeGen_Wasm::Emit_Fp_ToInt32TruncD_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	PrepareSymbolDef(dst);
+	PrepareSymbolUse(src1);
+
+	m_functionStream.Write8(Wasm::INST_PREFIX_FC);
+	m_functionStream.Write8(Wasm::INST_I32_TRUNC_SAT_F64_S);
+
+	//Result is an i32 but our dst symbol is a f32, keep the bits as is
+	m_functionStream.Write8(Wasm::INST_F32_REINTERPRET_I32);
+
+	CommitSymbol(dst);
+}
+
+void CCodeGen_Wasm::Emit_Fp_ToDoubleI32_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	PrepareSymbolDef(dst);
+	PrepareSymbolUse(src1);
+
+	m_functionStream.Write8(Wasm::INST_I32_REINTERPRET_F32);
+	m_functionStream.Write8(Wasm::INST_F64_CONVERT_I32_S);
+
+	CommitSymbol(dst);
+}
+
+void CCodeGen_Wasm::Emit_Fp_ToInt64TruncD_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	PrepareSymbolDef(dst);
+	PrepareSymbolUse(src1);
+
+	m_functionStream.Write8(Wasm::INST_PREFIX_FC);
+	m_functionStream.Write8(Wasm::INST_I64_TRUNC_SAT_F64_S);
+
+	m_functionStream.Write8(Wasm::INST_F64_REINTERPRET_I64);
+
+	CommitSymbol(dst);
+}
+
+void CCodeGen_Wasm::Emit_Fp_ToDoubleI64_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	PrepareSymbolDef(dst);
+	PrepareSymbolUse(src1);
+
+	m_functionStream.Write8(Wasm::INST_I64_REINTERPRET_F64);
+	m_functionStream.Write8(Wasm::INST_F64_CONVERT_I64_S);
+
+	CommitSymbol(dst);
+}
+
+void CCodeGen_Wasm::Emit_Fp64_LdCst_TmpCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	assert(dst->m_type == SYM_FP_TEMPORARY64);
+	assert(src1->m_type == SYM_CONSTANT64);
+
+	PrepareSymbolDef(dst);
+
+	m_functionStream.Write8(Wasm::INST_F64_CONST);
+	m_functionStream.Write64(src1->GetConstant64());
+
+	CommitSymbol(dst);
+}
+
 // clang-format off
 CCodeGen_Wasm::CONSTMATCHER CCodeGen_Wasm::g_fpuConstMatchers[] =
 {
@@ -265,6 +403,29 @@ CCodeGen_Wasm::CONSTMATCHER CCodeGen_Wasm::g_fpuConstMatchers[] =
 
 	{ OP_FP_SETROUNDINGMODE, MATCH_NIL,              MATCH_CONSTANT,      MATCH_NIL,          MATCH_NIL,      &CCodeGen_Wasm::Emit_Fp_SetRoundingMode_Cst                  },
 
+	{ OP_FP_ADD_D,           MATCH_FP_MEMORY64,      MATCH_FP_MEMORY64,   MATCH_FP_MEMORY64,  MATCH_NIL,      &CCodeGen_Wasm::Emit_Fpu_MemMemMem<Wasm::INST_F64_ADD>       },
+	{ OP_FP_SUB_D,           MATCH_FP_MEMORY64,      MATCH_FP_MEMORY64,   MATCH_FP_MEMORY64,  MATCH_NIL,      &CCodeGen_Wasm::Emit_Fpu_MemMemMem<Wasm::INST_F64_SUB>       },
+	{ OP_FP_MUL_D,           MATCH_FP_MEMORY64,      MATCH_FP_MEMORY64,   MATCH_FP_MEMORY64,  MATCH_NIL,      &CCodeGen_Wasm::Emit_Fpu_MemMemMem<Wasm::INST_F64_MUL>       },
+	{ OP_FP_DIV_D,           MATCH_FP_MEMORY64,      MATCH_FP_MEMORY64,   MATCH_FP_MEMORY64,  MATCH_NIL,      &CCodeGen_Wasm::Emit_Fpu_MemMemMem<Wasm::INST_F64_DIV>       },
+
+	{ OP_FP_CMP_D,           MATCH_ANY,              MATCH_FP_MEMORY64,   MATCH_FP_MEMORY64,  MATCH_NIL,      &CCodeGen_Wasm::Emit_Fp_CmpD_AnyMemMem                       },
+
+	{ OP_FP_MIN_D,           MATCH_FP_MEMORY64,      MATCH_FP_MEMORY64,   MATCH_FP_MEMORY64,  MATCH_NIL,      &CCodeGen_Wasm::Emit_Fpu_MemMemMem<Wasm::INST_F64_MIN>       },
+	{ OP_FP_MAX_D,           MATCH_FP_MEMORY64,      MATCH_FP_MEMORY64,   MATCH_FP_MEMORY64,  MATCH_NIL,      &CCodeGen_Wasm::Emit_Fpu_MemMemMem<Wasm::INST_F64_MAX>       },
+
+	{ OP_FP_SQRT_D,          MATCH_FP_MEMORY64,      MATCH_FP_MEMORY64,   MATCH_NIL,          MATCH_NIL,      &CCodeGen_Wasm::Emit_Fpu_MemMem<Wasm::INST_F64_SQRT>         },
+	{ OP_FP_ABS_D,           MATCH_FP_MEMORY64,      MATCH_FP_MEMORY64,   MATCH_NIL,          MATCH_NIL,      &CCodeGen_Wasm::Emit_Fpu_MemMem<Wasm::INST_F64_ABS>          },
+	{ OP_FP_NEG_D,           MATCH_FP_MEMORY64,      MATCH_FP_MEMORY64,   MATCH_NIL,          MATCH_NIL,      &CCodeGen_Wasm::Emit_Fpu_MemMem<Wasm::INST_F64_NEG>          },
+
+	{ OP_FP_TODOUBLE_S,      MATCH_FP_MEMORY64,      MATCH_FP_MEMORY32,   MATCH_NIL,          MATCH_NIL,      &CCodeGen_Wasm::Emit_Fpu_MemMem<Wasm::INST_F64_PROMOTE_F32>  },
+	{ OP_FP_TOSINGLE_D,      MATCH_FP_MEMORY32,      MATCH_FP_MEMORY64,   MATCH_NIL,          MATCH_NIL,      &CCodeGen_Wasm::Emit_Fpu_MemMem<Wasm::INST_F32_DEMOTE_F64>   },
+	{ OP_FP_TOINT32_TRUNC_D, MATCH_FP_MEMORY32,      MATCH_FP_MEMORY64,   MATCH_NIL,          MATCH_NIL,      &CCodeGen_Wasm::Emit_Fp_ToInt32TruncD_MemMem                 },
+	{ OP_FP_TODOUBLE_I32,    MATCH_FP_MEMORY64,      MATCH_FP_MEMORY32,   MATCH_NIL,          MATCH_NIL,      &CCodeGen_Wasm::Emit_Fp_ToDoubleI32_MemMem                   },
+	{ OP_FP_TOINT64_TRUNC_D, MATCH_FP_MEMORY64,      MATCH_FP_MEMORY64,   MATCH_NIL,          MATCH_NIL,      &CCodeGen_Wasm::Emit_Fp_ToInt64TruncD_MemMem                 },
+	{ OP_FP_TODOUBLE_I64,    MATCH_FP_MEMORY64,      MATCH_FP_MEMORY64,   MATCH_NIL,          MATCH_NIL,      &CCodeGen_Wasm::Emit_Fp_ToDoubleI64_MemMem                   },
+
+	{ OP_FP_LDCST,           MATCH_FP_TEMPORARY64,   MATCH_CONSTANT64,    MATCH_NIL,          MATCH_NIL,      &CCodeGen_Wasm::Emit_Fp64_LdCst_TmpCst                       },
+
 	{ OP_MOV,                MATCH_NIL,              MATCH_NIL,           MATCH_NIL,          MATCH_NIL,      nullptr                                                      },
 };
 // clang-format on
@@ -15,6 +15,11 @@ static const uint8 g_unpackUpperBHShuffle[0x10] = {8, 24, 9, 25, 10, 26, 11, 27,
 static const uint8 g_unpackUpperHWShuffle[0x10] = {8, 9, 24, 25, 10, 11, 26, 27, 12, 13, 28, 29, 14, 15, 30, 31};
 static const uint8 g_unpackUpperWDShuffle[0x10] = {8, 9, 10, 11, 24, 25, 26, 27, 12, 13, 14, 15, 28, 29, 30, 31};
 
+static const uint8 g_haddEvenShuffle[0x10] = {0, 1, 2, 3, 8, 9, 10, 11, 16, 17, 18, 19, 24, 25, 26, 27};
+static const uint8 g_haddOddShuffle[0x10] = {4, 5, 6, 7, 12, 13, 14, 15, 20, 21, 22, 23, 28, 29, 30, 31};
+
+static const uint8 g_mulHiHShuffle[0x10] = {2, 3, 6, 7, 10, 11, 14, 15, 18, 19, 22, 23, 26, 27, 30, 31};
+
 void CCodeGen_Wasm::MdBlendValues(uint8 mask)
 {
 	m_functionStream.Write8(Wasm::INST_PREFIX_SIMD);
@@ -97,6 +102,60 @@ void CCodeGen_Wasm::Emit_Md_Unpack_MemMemMemRev(const STATEMENT& statement)
 	CommitSymbol(dst);
 }
 
+template <uint32 LOWOP, uint32 HIGHOP>
+void CCodeGen_Wasm::Emit_Md_MulHiH_MemMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	PrepareSymbolDef(dst);
+
+	PrepareSymbolUse(src1);
+	PrepareSymbolUse(src2);
+	m_functionStream.Write8(Wasm::INST_PREFIX_SIMD);
+	CWasmModuleBuilder::WriteULeb128(m_functionStream, LOWOP);
+
+	PrepareSymbolUse(src1);
+	PrepareSymbolUse(src2);
+	m_functionStream.Write8(Wasm::INST_PREFIX_SIMD);
+	CWasmModuleBuilder::WriteULeb128(m_functionStream, HIGHOP);
+
+	m_functionStream.Write8(Wasm::INST_PREFIX_SIMD);
+	CWasmModuleBuilder::WriteULeb128(m_functionStream, Wasm::INST_I8x16_SHUFFLE);
+	m_functionStream.Write(g_mulHiHShuffle, 0x10);
+
+	CommitSymbol(dst);
+}
+
+template <uint32 OP>
+void CCodeGen_Wasm::Emit_Md_MulWD_MemMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	PrepareSymbolDef(dst);
+
+	//Gather even words in the lower half before doing the widening multiply
+	PrepareSymbolUse(src1);
+	PrepareSymbolUse(src1);
+	m_functionStream.Write8(Wasm::INST_PREFIX_SIMD);
+	CWasmModuleBuilder::WriteULeb128(m_functionStream, Wasm::INST_I8x16_SHUFFLE);
+	m_functionStream.Write(g_haddEvenShuffle, 0x10);
+
+	PrepareSymbolUse(src2);
+	PrepareSymbolUse(src2);
+	m_functionStream.Write8(Wasm::INST_PREFIX_SIMD);
+	CWasmModuleBuilder::WriteULeb128(m_functionStream, Wasm::INST_I8x16_SHUFFLE);
+	m_functionStream.Write(g_haddEvenShuffle, 0x10);
+
+	m_functionStream.Write8(Wasm::INST_PREFIX_SIMD);
+	CWasmModuleBuilder::WriteULeb128(m_functionStream, OP);
+
+	CommitSymbol(dst);
+}
+
 void CCodeGen_Wasm::PushRelative128(CSymbol* symbol)
 {
 	PushRelativeAddress(symbol);
@@ -493,6 +552,139 @@ void CCodeGen_Wasm::Emit_Md_ClampS_MemMem(const STATEMENT& statement)
 	CommitSymbol(dst);
 }
 
+void CCodeGen_Wasm::Emit_Md_RsqrtS_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	PrepareSymbolDef(dst);
+
+	m_functionStream.Write8(Wasm::INST_F32_CONST);
+	m_functionStream.Write32(0x3F800000);
+
+	m_functionStream.Write8(Wasm::INST_PREFIX_SIMD);
+	CWasmModuleBuilder::WriteULeb128(m_functionStream, Wasm::INST_F32x4_SPLAT);
+
+	PrepareSymbolUse(src1);
+
+	m_functionStream.Write8(Wasm::INST_PREFIX_SIMD);
+	CWasmModuleBuilder::WriteULeb128(m_functionStream, Wasm::INST_F32x4_SQRT);
+
+	m_functionStream.Write8(Wasm::INST_PREFIX_SIMD);
+	CWasmModuleBuilder::WriteULeb128(m_functionStream, Wasm::INST_F32x4_DIV);
+
+	CommitSymbol(dst);
+}
+
+void CCodeGen_Wasm::Emit_Md_RcplS_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	PrepareSymbolDef(dst);
+
+	m_functionStream.Write8(Wasm::INST_F32_CONST);
+	m_functionStream.Write32(0x3F800000);
+
+	m_functionStream.Write8(Wasm::INST_PREFIX_SIMD);
+	CWasmModuleBuilder::WriteULeb128(m_functionStream, Wasm::INST_F32x4_SPLAT);
+
+	PrepareSymbolUse(src1);
+
+	m_functionStream.Write8(Wasm::INST_PREFIX_SIMD);
+	CWasmModuleBuilder::WriteULeb128(m_functionStream, Wasm::INST_F32x4_DIV);
+
+	CommitSymbol(dst);
+}
+
+void CCodeGen_Wasm::Emit_Md_DotS_MemMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	uint8 mask = static_cast<uint8>(statement.jmpCondition);
+
+	PrepareSymbolDef(dst);
+
+	//Sum lane products as (p0 + p1) + (p2 + p3), lanes left out of the sum count as 0
+	for(uint32 i = 0; i < 4; i++)
+	{
+		if(mask & (0x10 << i))
+		{
+			PrepareSymbolUse(src1);
+
+			m_functionStream.Write8(Wasm::INST_PREFIX_SIMD);
+			CWasmModuleBuilder::WriteULeb128(m_functionStream, Wasm::INST_F32x4_EXTRACT_LANE);
+			m_functionStream.Write8(i);
+
+			PrepareSymbolUse(src2);
+
+			m_functionStream.Write8(Wasm::INST_PREFIX_SIMD);
+			CWasmModuleBuilder::WriteULeb128(m_functionStream, Wasm::INST_F32x4_EXTRACT_LANE);
+			m_functionStream.Write8(i);
+
+			m_functionStream.Write8(Wasm::INST_F32_MUL);
+		}
+		else
+		{
+			m_functionStream.Write8(Wasm::INST_F32_CONST);
+			m_functionStream.Write32(0);
+		}
+
+		if(i & 1)
+		{
+			m_functionStream.Write8(Wasm::INST_F32_ADD);
+		}
+	}
+
+	m_functionStream.Write8(Wasm::INST_F32_ADD);
+
+	m_functionStream.Write8(Wasm::INST_PREFIX_SIMD);
+	CWasmModuleBuilder::WriteULeb128(m_functionStream, Wasm::INST_F32x4_SPLAT);
+
+	//Clear lanes that don't receive the result
+	{
+		auto dstMask = MakeMdLaneMaskLiteral(mask & 0x0F);
+
+		m_functionStream.Write8(Wasm::INST_PREFIX_SIMD);
+		m_functionStream.Write8(Wasm::INST_V128_CONST);
+		m_functionStream.Write(&dstMask, sizeof(LITERAL128));
+
+		m_functionStream.Write8(Wasm::INST_PREFIX_SIMD);
+		CWasmModuleBuilder::WriteULeb128(m_functionStream, Wasm::INST_V128_AND);
+	}
+
+	CommitSymbol(dst);
+}
+
+void CCodeGen_Wasm::Emit_Md_HaddS_MemMemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	PrepareSymbolDef(dst);
+
+	PrepareSymbolUse(src1);
+	PrepareSymbolUse(src2);
+
+	m_functionStream.Write8(Wasm::INST_PREFIX_SIMD);
+	CWasmModuleBuilder::WriteULeb128(m_functionStream, Wasm::INST_I8x16_SHUFFLE);
+	m_functionStream.Write(g_haddEvenShuffle, 0x10);
+
+	PrepareSymbolUse(src1);
+	PrepareSymbolUse(src2);
+
+	m_functionStream.Write8(Wasm::INST_PREFIX_SIMD);
+	CWasmModuleBuilder::WriteULeb128(m_functionStream, Wasm::INST_I8x16_SHUFFLE);
+	m_functionStream.Write(g_haddOddShuffle, 0x10);
+
+	m_functionStream.Write8(Wasm::INST_PREFIX_SIMD);
+	CWasmModuleBuilder::WriteULeb128(m_functionStream, Wasm::INST_F32x4_ADD);
+
+	CommitSymbol(dst);
+}
+
 void CCodeGen_Wasm::Emit_Md_MakeClip_MemMemMemMem(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -792,6 +984,89 @@ void CCodeGen_Wasm::Emit_Md_ExpandW_MemMemCst(const STATEMENT& statement)
 	CommitSymbol(dst);
 }
 
+void CCodeGen_Wasm::Emit_Md_ShuffleW_MemMemCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto shufflePattern = MakeMdShuffleWLiteral(static_cast<uint8>(src2->m_valueLow));
+
+	PrepareSymbolDef(dst);
+	PrepareSymbolUse(src1);
+	PrepareSymbolUse(src1);
+
+	m_functionStream.Write8(Wasm::INST_PREFIX_SIMD);
+	CWasmModuleBuilder::WriteULeb128(m_functionStream, Wasm::INST_I8x16_SHUFFLE);
+	m_functionStream.Write(&shufflePattern, sizeof(LITERAL128));
+
+	CommitSymbol(dst);
+}
+
+void CCodeGen_Wasm::Emit_Md_ShuffleB_MemMemCstCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	auto shufflePattern = MakeMdShuffleBLiteral(src2->GetConstant64(), src3->GetConstant64());
+
+	PrepareSymbolDef(dst);
+	PrepareSymbolUse(src1);
+
+	m_functionStream.Write8(Wasm::INST_PREFIX_SIMD);
+	m_functionStream.Write8(Wasm::INST_V128_CONST);
+	m_functionStream.Write(&shufflePattern, sizeof(LITERAL128));
+
+	m_functionStream.Write8(Wasm::INST_PREFIX_SIMD);
+	CWasmModuleBuilder::WriteULeb128(m_functionStream, Wasm::INST_I8x16_SWIZZLE);
+
+	CommitSymbol(dst);
+}
+
+template <uint32 OP>
+void CCodeGen_Wasm::Emit_Md_InsertW_MemMemAnyCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	assert(src3->m_type == SYM_CONSTANT);
+	assert(src3->m_valueLow < 4);
+
+	PrepareSymbolDef(dst);
+	PrepareSymbolUse(src1);
+	PrepareSymbolUse(src2);
+
+	m_functionStream.Write8(Wasm::INST_PREFIX_SIMD);
+	CWasmModuleBuilder::WriteULeb128(m_functionStream, OP);
+	m_functionStream.Write8(src3->m_valueLow);
+
+	CommitSymbol(dst);
+}
+
+template <uint32 OP>
+void CCodeGen_Wasm::Emit_Md_ExtractW_MemMemCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	assert(src2->m_type == SYM_CONSTANT);
+	assert(src2->m_valueLow < 4);
+
+	PrepareSymbolDef(dst);
+	PrepareSymbolUse(src1);
+
+	m_functionStream.Write8(Wasm::INST_PREFIX_SIMD);
+	CWasmModuleBuilder::WriteULeb128(m_functionStream, OP);
+	m_functionStream.Write8(src2->m_valueLow);
+
+	CommitSymbol(dst);
+}
+
 void CCodeGen_Wasm::Emit_Md_Srl256_MemMemVar(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -951,6 +1226,13 @@ CCodeGen_Wasm::CONSTMATCHER CCodeGen_Wasm::g_mdConstMatchers[] =
 	{ OP_MD_MAX_H,       MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_MEMORY128,     MATCH_NIL,      &CCodeGen_Wasm::Emit_Md_MemMemMem<Wasm::INST_I16x8_MAX_S>     },
 	{ OP_MD_MAX_W,       MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_MEMORY128,     MATCH_NIL,      &CCodeGen_Wasm::Emit_Md_MemMemMem<Wasm::INST_I32x4_MAX_S>     },
 
+	{ OP_MD_MUL_H,       MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_MEMORY128,     MATCH_NIL,      &CCodeGen_Wasm::Emit_Md_MemMemMem<Wasm::INST_I16x8_MUL>       },
+	{ OP_MD_MULHS_H,     MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_MEMORY128,     MATCH_NIL,      &CCodeGen_Wasm::Emit_Md_MulHiH_MemMemMem<Wasm::INST_I32x4_EXTMUL_LOW_I16x8_S, Wasm::INST_I32x4_EXTMUL_HIGH_I16x8_S> },
+	{ OP_MD_MULHU_H,     MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_MEMORY128,     MATCH_NIL,      &CCodeGen_Wasm::Emit_Md_MulHiH_MemMemMem<Wasm::INST_I32x4_EXTMUL_LOW_I16x8_U, Wasm::INST_I32x4_EXTMUL_HIGH_I16x8_U> },
+	{ OP_MD_MUL_W,       MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_MEMORY128,     MATCH_NIL,      &CCodeGen_Wasm::Emit_Md_MemMemMem<Wasm::INST_I32x4_MUL>       },
+	{ OP_MD_MULS_WD,     MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_MEMORY128,     MATCH_NIL,      &CCodeGen_Wasm::Emit_Md_MulWD_MemMemMem<Wasm::INST_I64x2_EXTMUL_LOW_I32x4_S> },
+	{ OP_MD_MULU_WD,     MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_MEMORY128,     MATCH_NIL,      &CCodeGen_Wasm::Emit_Md_MulWD_MemMemMem<Wasm::INST_I64x2_EXTMUL_LOW_I32x4_U> },
+
 	{ OP_MD_ADD_S,       MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_MEMORY128,     MATCH_NIL,      &CCodeGen_Wasm::Emit_Md_MemMemMem<Wasm::INST_F32x4_ADD>       },
 	{ OP_MD_SUB_S,       MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_MEMORY128,     MATCH_NIL,      &CCodeGen_Wasm::Emit_Md_MemMemMem<Wasm::INST_F32x4_SUB>       },
 	{ OP_MD_MUL_S,       MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_MEMORY128,     MATCH_NIL,      &CCodeGen_Wasm::Emit_Md_MemMemMem<Wasm::INST_F32x4_MUL>       },
@@ -961,6 +1243,12 @@ CCodeGen_Wasm::CONSTMATCHER CCodeGen_Wasm::g_mdConstMatchers[] =
 	{ OP_MD_MIN_S,       MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_MEMORY128,     MATCH_NIL,      &CCodeGen_Wasm::Emit_Md_MemMemMem<Wasm::INST_F32x4_MIN>       },
 	{ OP_MD_MAX_S,       MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_MEMORY128,     MATCH_NIL,      &CCodeGen_Wasm::Emit_Md_MemMemMem<Wasm::INST_F32x4_MAX>       },
 
+	{ OP_MD_SQRT_S,      MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_NIL,           MATCH_NIL,      &CCodeGen_Wasm::Emit_Md_MemMem<Wasm::INST_F32x4_SQRT>         },
+	{ OP_MD_RSQRT_S,     MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_NIL,           MATCH_NIL,      &CCodeGen_Wasm::Emit_Md_RsqrtS_MemMem                         },
+	{ OP_MD_RCPL_S,      MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_NIL,           MATCH_NIL,      &CCodeGen_Wasm::Emit_Md_RcplS_MemMem                          },
+	{ OP_MD_DOT_S,       MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_MEMORY128,     MATCH_NIL,      &CCodeGen_Wasm::Emit_Md_DotS_MemMemMem                        },
+	{ OP_MD_HADD_S,      MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_MEMORY128,     MATCH_NIL,      &CCodeGen_Wasm::Emit_Md_HaddS_MemMemMem                       },
+
 	{ OP_MD_CMPLT_S,     MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_MEMORY128,     MATCH_NIL,      &CCodeGen_Wasm::Emit_Md_MemMemMem<Wasm::INST_F32x4_LT>        },
 	{ OP_MD_CMPGT_S,     MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_MEMORY128,     MATCH_NIL,      &CCodeGen_Wasm::Emit_Md_MemMemMem<Wasm::INST_F32x4_GT>        },
 
@@ -999,6 +1287,13 @@ CCodeGen_Wasm::CONSTMATCHER CCodeGen_Wasm::g_mdConstMatchers[] =
 	{ OP_MD_EXPAND_W,    MATCH_MEMORY128,      MATCH_CONSTANT,       MATCH_NIL,           MATCH_NIL,      &CCodeGen_Wasm::Emit_Md_ExpandW_MemAny                        },
 	{ OP_MD_EXPAND_W,    MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_CONSTANT,      MATCH_NIL,      &CCodeGen_Wasm::Emit_Md_ExpandW_MemMemCst                     },
 
+	{ OP_MD_SHUFFLE_W,   MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_CONSTANT,      MATCH_NIL,        &CCodeGen_Wasm::Emit_Md_ShuffleW_MemMemCst                                      },
+	{ OP_MD_SHUFFLE_B,   MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_CONSTANT64,    MATCH_CONSTANT64, &CCodeGen_Wasm::Emit_Md_ShuffleB_MemMemCstCst                                   },
+	{ OP_MD_INSERT_W,    MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_ANY32,         MATCH_CONSTANT,   &CCodeGen_Wasm::Emit_Md_InsertW_MemMemAnyCst<Wasm::INST_I32x4_REPLACE_LANE>     },
+	{ OP_MD_INSERT_W,    MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_FP_MEMORY32,   MATCH_CONSTANT,   &CCodeGen_Wasm::Emit_Md_InsertW_MemMemAnyCst<Wasm::INST_F32x4_REPLACE_LANE>     },
+	{ OP_MD_EXTRACT_W,   MATCH_MEMORY,         MATCH_MEMORY128,      MATCH_CONSTANT,      MATCH_NIL,        &CCodeGen_Wasm::Emit_Md_ExtractW_MemMemCst<Wasm::INST_I32x4_EXTRACT_LANE>       },
+	{ OP_MD_EXTRACT_W,   MATCH_FP_MEMORY32,    MATCH_MEMORY128,      MATCH_CONSTANT,      MATCH_NIL,        &CCodeGen_Wasm::Emit_Md_ExtractW_MemMemCst<Wasm::INST_F32x4_EXTRACT_LANE>       },
+
 	{ OP_MD_PACK_HB,     MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_MEMORY128,     MATCH_NIL,      &CCodeGen_Wasm::Emit_Md_Unpack_MemMemMemRev<g_packHBShuffle>  },
 	{ OP_MD_PACK_WH,     MATCH_MEMORY128,      MATCH_MEMORY128,      MATCH_MEMORY128,     MATCH_NIL,      &CCodeGen_Wasm::Emit_Md_Unpack_MemMemMemRev<g_packWHShuffle>  },
 
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <functional>
 #include <assert.h>
 #include <stdexcept>
@@ -40,9 +41,16 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_constMatchers[] =
 	{ OP_LZC, MATCH_REGISTER, MATCH_VARIABLE, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Lzc_RegVar },
 	{ OP_LZC, MATCH_MEMORY,   MATCH_VARIABLE, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Lzc_MemVar },
 
+	{ OP_TZC,     MATCH_VARIABLE, MATCH_VARIABLE, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Tzc_VarVar     },
+	{ OP_POPCNT,  MATCH_VARIABLE, MATCH_VARIABLE, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Popcnt_VarVar  },
+	{ OP_BSWAP,   MATCH_VARIABLE, MATCH_VARIABLE, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Bswap_VarVar   },
+	{ OP_BSWAP16, MATCH_VARIABLE, MATCH_VARIABLE, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Bswap16_VarVar },
+
 	SHIFT_CONST_MATCHERS(OP_SRL, SHIFTOP_SRL)
 	SHIFT_CONST_MATCHERS(OP_SRA, SHIFTOP_SRA)
 	SHIFT_CONST_MATCHERS(OP_SLL, SHIFTOP_SLL)
+	SHIFT_CONST_MATCHERS(OP_ROTL, SHIFTOP_ROL)
+	SHIFT_CONST_MATCHERS(OP_ROTR, SHIFTOP_ROR)
 
 	{ OP_MOV, MATCH_REGISTER, MATCH_REGISTER, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Mov_RegReg },
 	{ OP_MOV, MATCH_REGISTER, MATCH_MEMORY,   MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Mov_RegMem },
@@ -56,10 +64,19 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_constMatchers[] =
 	{ OP_CONDJMP, MATCH_NIL, MATCH_REGISTER, MATCH_REGISTER, MATCH_NIL, &CCodeGen_x86::Emit_CondJmp_RegReg },
 	{ OP_CONDJMP, MATCH_NIL, MATCH_REGISTER, MATCH_MEMORY,   MATCH_NIL, &CCodeGen_x86::Emit_CondJmp_RegMem },
 	{ OP_CONDJMP, MATCH_NIL, MATCH_REGISTER, MATCH_CONSTANT, MATCH_NIL, &CCodeGen_x86::Emit_CondJmp_RegCst },
+	{ OP_CONDJMP, MATCH_NIL, MATCH_MEMORY,   MATCH_REGISTER, MATCH_NIL, &CCodeGen_x86::Emit_CondJmp_MemReg },
 	{ OP_CONDJMP, MATCH_NIL, MATCH_MEMORY,   MATCH_MEMORY,   MATCH_NIL, &CCodeGen_x86::Emit_CondJmp_MemMem },
 	{ OP_CONDJMP, MATCH_NIL, MATCH_MEMORY,   MATCH_CONSTANT, MATCH_NIL, &CCodeGen_x86::Emit_CondJmp_MemCst },
 
+	{ OP_TESTJMP, MATCH_NIL, MATCH_REGISTER, MATCH_REGISTER, MATCH_NIL, &CCodeGen_x86::Emit_TestJmp_RegReg },
+	{ OP_TESTJMP, MATCH_NIL, MATCH_REGISTER, MATCH_MEMORY,   MATCH_NIL, &CCodeGen_x86::Emit_TestJmp_RegMem },
+	{ OP_TESTJMP, MATCH_NIL, MATCH_REGISTER, MATCH_CONSTANT, MATCH_NIL, &CCodeGen_x86::Emit_TestJmp_RegCst },
+	{ OP_TESTJMP, MATCH_NIL, MATCH_MEMORY,   MATCH_REGISTER, MATCH_NIL, &CCodeGen_x86::Emit_TestJmp_MemReg },
+	{ OP_TESTJMP, MATCH_NIL, MATCH_MEMORY,   MATCH_MEMORY,   MATCH_NIL, &CCodeGen_x86::Emit_TestJmp_MemMem },
+	{ OP_TESTJMP, MATCH_NIL, MATCH_MEMORY,   MATCH_CONSTANT, MATCH_NIL, &CCodeGen_x86::Emit_TestJmp_MemCst },
+
 	{ OP_CMPSELECT_P1, MATCH_NIL,      MATCH_ANY, MATCH_VARIABLE, MATCH_NIL, &CCodeGen_x86::Emit_CmpSelectP1_AnyVar    },
+	{ OP_CMPSELECT_P1, MATCH_NIL,      MATCH_ANY, MATCH_CONSTANT, MATCH_NIL, &CCodeGen_x86::Emit_CmpSelectP1_AnyCst    },
 	{ OP_CMPSELECT_P2, MATCH_VARIABLE, MATCH_ANY, MATCH_ANY,      MATCH_NIL, &CCodeGen_x86::Emit_CmpSelectP2_VarAnyAny },
 
 	{ OP_SELECT, MATCH_VARIABLE, MATCH_VARIABLE, MATCH_ANY, MATCH_ANY, &CCodeGen_x86::Emit_Select_VarVarAnyAny },
@@ -83,6 +100,7 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_constMatchers[] =
 	{ OP_MERGETO64, MATCH_MEMORY64, MATCH_REGISTER, MATCH_CONSTANT, MATCH_NIL, &CCodeGen_x86::Emit_MergeTo64_Mem64RegCst },
 	{ OP_MERGETO64, MATCH_MEMORY64, MATCH_MEMORY,   MATCH_REGISTER, MATCH_NIL, &CCodeGen_x86::Emit_MergeTo64_Mem64MemReg },
 	{ OP_MERGETO64, MATCH_MEMORY64, MATCH_MEMORY,   MATCH_MEMORY,   MATCH_NIL, &CCodeGen_x86::Emit_MergeTo64_Mem64MemMem },
+	{ OP_MERGETO64, MATCH_MEMORY64, MATCH_MEMORY,   MATCH_CONSTANT, MATCH_NIL, &CCodeGen_x86::Emit_MergeTo64_Mem64MemCst },
 	{ OP_MERGETO64, MATCH_MEMORY64, MATCH_CONSTANT, MATCH_REGISTER, MATCH_NIL, &CCodeGen_x86::Emit_MergeTo64_Mem64CstReg },
 	{ OP_MERGETO64, MATCH_MEMORY64, MATCH_CONSTANT, MATCH_MEMORY,   MATCH_NIL, &CCodeGen_x86::Emit_MergeTo64_Mem64CstMem },
 
@@ -92,6 +110,8 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_constMatchers[] =
 	{ OP_LOADFROMREF, MATCH_VARIABLE,    MATCH_VAR_REF, MATCH_NIL,   MATCH_NIL, &CCodeGen_x86::Emit_LoadFromRef_VarVar    },
 	{ OP_LOADFROMREF, MATCH_VARIABLE,    MATCH_VAR_REF, MATCH_ANY32, MATCH_NIL, &CCodeGen_x86::Emit_LoadFromRef_VarVarAny },
 
+	{ OP_LOOKUP, MATCH_VARIABLE, MATCH_CONSTANTPTR, MATCH_ANY32, MATCH_NIL, &CCodeGen_x86::Emit_Lookup_VarCstAny },
+
 	{ OP_LOAD8FROMREF, MATCH_VARIABLE, MATCH_VAR_REF, MATCH_NIL,   MATCH_NIL, &CCodeGen_x86::Emit_Load8FromRef_VarVar },
 	{ OP_LOAD8FROMREF, MATCH_VARIABLE, MATCH_VAR_REF, MATCH_ANY32, MATCH_NIL, &CCodeGen_x86::Emit_Load8FromRef_VarVarAny },
 
@@ -113,16 +133,40 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_constMatchers[] =
 
 	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
 };
+
+CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_bmi2ConstMatchers[] =
+{
+	{ OP_SRL, MATCH_VARIABLE, MATCH_ANY32, MATCH_VARIABLE, MATCH_NIL, &CCodeGen_x86::Emit_Shift_Bmi2_VarAnyVar<SHIFTOP_SRL> },
+	{ OP_SRA, MATCH_VARIABLE, MATCH_ANY32, MATCH_VARIABLE, MATCH_NIL, &CCodeGen_x86::Emit_Shift_Bmi2_VarAnyVar<SHIFTOP_SRA> },
+	{ OP_SLL, MATCH_VARIABLE, MATCH_ANY32, MATCH_VARIABLE, MATCH_NIL, &CCodeGen_x86::Emit_Shift_Bmi2_VarAnyVar<SHIFTOP_SLL> },
+
+	{ OP_ROTL, MATCH_VARIABLE, MATCH_VARIABLE, MATCH_CONSTANT, MATCH_NIL, &CCodeGen_x86::Emit_Rotate_Bmi2_VarVarCst<SHIFTOP_ROL> },
+	{ OP_ROTR, MATCH_VARIABLE, MATCH_VARIABLE, MATCH_CONSTANT, MATCH_NIL, &CCodeGen_x86::Emit_Rotate_Bmi2_VarVarCst<SHIFTOP_ROR> },
+
+	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
+};
 // clang-format on
 
 CCodeGen_x86::CCodeGen_x86(CX86CpuFeatures cpuFeatures)
     : m_cpuFeatures(cpuFeatures)
 {
+	if(cpuFeatures.hasBmi2)
+	{
+		//Needs to be inserted first to take precedence over generic shift matchers
+		InsertMatchers(g_bmi2ConstMatchers);
+	}
+
 	InsertMatchers(g_constMatchers);
 	InsertMatchers(g_fpuConstMatchers);
 
 	if(cpuFeatures.hasAvx)
 	{
+		if(cpuFeatures.hasAvx512)
+		{
+			//Needs to be inserted first to take precedence over AVX matchers
+			InsertMatchers(g_mdAvx512ConstMatchers);
+		}
+
 		InsertMatchers(g_fpuAvxConstMatchers);
 		InsertMatchers(g_mdAvxConstMatchers);
 
@@ -134,6 +178,12 @@ CCodeGen_x86::CCodeGen_x86(CX86CpuFeatures cpuFeatures)
 		{
 			InsertMatchers(g_mdNoAvx2ConstMatchers);
 		}
+
+		if(cpuFeatures.hasFma)
+		{
+			InsertMatchers(g_fpuFmaConstMatchers);
+			InsertMatchers(g_mdFmaConstMatchers);
+		}
 	}
 	else
 	{
@@ -167,6 +217,14 @@ void CCodeGen_x86::GenerateCode(const StatementList& statements, unsigned int st
 	assert(m_labels.empty());
 
 	m_registerUsage = GetRegisterUsage(statements);
+	if(m_loopAlignment != 0)
+	{
+		m_loopHeads = GetLoopHeads(statements);
+	}
+	if(m_constantCacheEnabled)
+	{
+		m_constantCache = GetConstantCache(statements);
+	}
 
 	//Align stacksize
 	stackSize = (stackSize + 0xF) & ~0xF;
@@ -201,6 +259,11 @@ void CCodeGen_x86::GenerateCode(const StatementList& statements, unsigned int st
 			{
 				throw std::exception();
 			}
+			//Calls (including helper calls) don't preserve MD registers and labels can be reached from elsewhere
+			if((statement.op == OP_LABEL) || (statement.op == OP_CALL) || IsHelperCall(statement))
+			{
+				InvalidateConstantCache();
+			}
 		}
 
 		Emit_Epilog();
@@ -218,6 +281,9 @@ void CCodeGen_x86::GenerateCode(const StatementList& statements, unsigned int st
 	}
 
 	m_labels.clear();
+	m_loopHeads.clear();
+	m_constantCache.clear();
+	m_constantUseCounts.clear();
 	m_symbolReferenceLabels.clear();
 }
 
@@ -236,6 +302,21 @@ void CCodeGen_x86::InsertMatchers(const CONSTMATCHER* constMatchers)
 	}
 }
 
+void CCodeGen_x86::SetLoopAlignment(uint32 loopAlignment)
+{
+	m_loopAlignment = loopAlignment;
+}
+
+void CCodeGen_x86::SetJccErratumPaddingEnabled(bool enabled)
+{
+	m_assembler.SetJccErratumPaddingEnabled(enabled);
+}
+
+void CCodeGen_x86::SetConstantCacheEnabled(bool enabled)
+{
+	m_constantCacheEnabled = enabled;
+}
+
 void CCodeGen_x86::SetStream(Framework::CStream* stream)
 {
 	m_assembler.SetStream(stream);
@@ -261,6 +342,55 @@ bool CCodeGen_x86::SupportsCmpSelect() const
 	return true;
 }
 
+bool CCodeGen_x86::SupportsJumpTables() const
+{
+	return true;
+}
+
+bool CCodeGen_x86::SupportsTestJumps() const
+{
+	return true;
+}
+
+bool CCodeGen_x86::SupportsIndexScale(uint32, uint32 scale) const
+{
+	//Encoded directly in the SIB byte
+	return (scale == 1) || (scale == 2) || (scale == 4) || (scale == 8);
+}
+
+bool CCodeGen_x86::SupportsFma() const
+{
+	return m_cpuFeatures.hasAvx && m_cpuFeatures.hasFma;
+}
+
+unsigned int CCodeGen_x86::GetMdTempRegisterCount(const STATEMENT& statement) const
+{
+	if(m_mdTempRegisters)
+	{
+		//Has dedicated temporary registers
+		return 0;
+	}
+	switch(statement.op)
+	{
+	case OP_MD_MUL_W:
+	case OP_MD_PACK_WH:
+	case OP_MD_MAKESZ:
+		return 1;
+	case OP_MD_ADDSS_W:
+	case OP_MD_ADDUS_W:
+	case OP_MD_SUBSS_W:
+	case OP_MD_SUBUS_W:
+	case OP_MD_MIN_W:
+	case OP_MD_MAX_W:
+	case OP_MD_MULS_WD:
+	case OP_MD_PACK_HB:
+	case OP_MD_MAKECLIP:
+		return 2;
+	default:
+		return 0;
+	}
+}
+
 CX86Assembler::LABEL CCodeGen_x86::GetLabel(uint32 blockId)
 {
 	CX86Assembler::LABEL result;
@@ -277,6 +407,114 @@ CX86Assembler::LABEL CCodeGen_x86::GetLabel(uint32 blockId)
 	return result;
 }
 
+CCodeGen_x86::LoopHeadSet CCodeGen_x86::GetLoopHeads(const StatementList& statements)
+{
+	//A label is a loop head if it's the target of a jump that comes after it
+	std::set<uint32> markedLabels;
+	LoopHeadSet loopHeads;
+	for(const auto& statement : statements)
+	{
+		if(statement.op == OP_LABEL)
+		{
+			markedLabels.insert(statement.jmpBlock);
+			continue;
+		}
+		statement.VisitJumpTargets(
+		    [&](uint32 target) {
+			    if(markedLabels.find(target) != markedLabels.end())
+			    {
+				    loopHeads.insert(target);
+			    }
+		    });
+	}
+	return loopHeads;
+}
+
+CX86Assembler::XMMREGISTER CCodeGen_x86::GetMdTempRegister(unsigned int index)
+{
+	assert(index < MAX_MDTEMPREGISTERS);
+	if(m_mdTempRegisters)
+	{
+		return m_mdTempRegisters[index];
+	}
+	//Borrow the last allocatable registers, they're left free by the register allocator in
+	//ranges containing operations that need them (see GetMdTempRegisterCount)
+	return m_mdRegisters[GetAvailableMdRegisterCount() - 1 - index];
+}
+
+CX86Assembler::CAddress CCodeGen_x86::MakeConstant128Address(const LITERAL128& constant)
+{
+	auto entryIterator = std::find_if(std::begin(m_constantCache), std::end(m_constantCache),
+	                                  [&constant](const CONSTANTCACHEENTRY& entry) { return entry.valid && (entry.value == constant); });
+	if(entryIterator != std::end(m_constantCache))
+	{
+		return CX86Assembler::MakeXmmRegisterAddress(entryIterator->registerId);
+	}
+	//Loading a constant that is only used once in a register doesn't buy us anything.
+	//Entries are never evicted, constants used alternately would keep replacing each other otherwise.
+	auto& useCount = m_constantUseCounts[constant];
+	useCount++;
+	auto freeEntryIterator = std::find_if(std::begin(m_constantCache), std::end(m_constantCache),
+	                                      [](const CONSTANTCACHEENTRY& entry) { return !entry.valid; });
+	if((useCount < 2) || (freeEntryIterator == std::end(m_constantCache)))
+	{
+		return MakeConstant128MemoryAddress(constant);
+	}
+	auto& entry = *freeEntryIterator;
+	entry.value = constant;
+	entry.valid = true;
+	if(m_cpuFeatures.hasAvx)
+	{
+		m_assembler.VmovapsVo(entry.registerId, MakeConstant128MemoryAddress(constant));
+	}
+	else
+	{
+		m_assembler.MovapsVo(entry.registerId, MakeConstant128MemoryAddress(constant));
+	}
+	return CX86Assembler::MakeXmmRegisterAddress(entry.registerId);
+}
+
+CCodeGen_x86::ConstantCache CCodeGen_x86::GetConstantCache(const StatementList& statements) const
+{
+	//Use MD registers that aren't referenced anywhere in the function
+	uint32 mdRegisterUsage = 0;
+	for(const auto& statement : statements)
+	{
+		statement.VisitOperands(
+		    [&mdRegisterUsage](const SymbolRefPtr& symbolRef, bool) {
+			    auto symbol = symbolRef->GetSymbol();
+			    if((symbol->m_type == SYM_REGISTER128) || (symbol->m_type == SYM_FP_REGISTER32) || (symbol->m_type == SYM_FP_REGISTER64))
+			    {
+				    mdRegisterUsage |= (1 << symbol->m_valueLow);
+			    }
+		    });
+	}
+	unsigned int regCount = GetAvailableMdRegisterCount();
+	if(!m_mdTempRegisters)
+	{
+		//Last registers can be borrowed for temporaries (see GetMdTempRegister)
+		regCount -= MAX_MDTEMPREGISTERS;
+	}
+	ConstantCache constantCache;
+	for(unsigned int i = 0; (i < regCount) && (constantCache.size() < MAX_CONSTANTCACHEREGISTERS); i++)
+	{
+		if(mdRegisterUsage & (1 << i)) continue;
+		CONSTANTCACHEENTRY entry;
+		entry.registerId = m_mdRegisters[i];
+		constantCache.push_back(entry);
+	}
+	return constantCache;
+}
+
+void CCodeGen_x86::InvalidateConstantCache()
+{
+	for(auto& entry : m_constantCache)
+	{
+		entry.valid = false;
+	}
+	m_constantUseCounts.clear();
+}
+
 CX86Assembler::CAddress CCodeGen_x86::MakeTemporarySymbolAddress(CSymbol* symbol)
 {
 	assert(symbol->m_type == SYM_TEMPORARY);
@@ -487,6 +725,10 @@ void CCodeGen_x86::MarkLabel(const STATEMENT& statement)
 {
 	CX86Assembler::LABEL label = GetLabel(statement.jmpBlock);
 	m_assembler.MarkLabel(label);
+	if(m_loopHeads.find(statement.jmpBlock) != m_loopHeads.end())
+	{
+		m_assembler.AlignLabel(label, m_loopAlignment);
+	}
 }
 
 void CCodeGen_x86::Emit_Nop(const STATEMENT& statement)
@@ -552,6 +794,19 @@ void CCodeGen_x86::Emit_Lzc(CX86Assembler::REGISTER dstRegister, const CX86Assem
 
 	auto tmpRegister = CX86Assembler::rAX;
 
+	if(m_cpuFeatures.hasLzcnt)
+	{
+		//Flip negative values so that LZCNT counts leading sign bits (0 and -1 give 31)
+		auto signRegister = CX86Assembler::rCX;
+		m_assembler.MovEd(tmpRegister, srcAddress);
+		m_assembler.MovEd(signRegister, CX86Assembler::MakeRegisterAddress(tmpRegister));
+		m_assembler.SarEd(CX86Assembler::MakeRegisterAddress(signRegister), 31);
+		m_assembler.XorEd(tmpRegister, CX86Assembler::MakeRegisterAddress(signRegister));
+		m_assembler.LzcntEd(dstRegister, CX86Assembler::MakeRegisterAddress(tmpRegister));
+		m_assembler.SubId(CX86Assembler::MakeRegisterAddress(dstRegister), 1);
+		return;
+	}
+
 	m_assembler.MovEd(tmpRegister, srcAddress);
 	m_assembler.TestEd(tmpRegister, CX86Assembler::MakeRegisterAddress(tmpRegister));
 	m_assembler.JzJx(set32Label);
@@ -596,6 +851,117 @@ void CCodeGen_x86::Emit_Lzc_MemVar(const STATEMENT& statement)
 	m_assembler.MovGd(MakeMemorySymbolAddress(dst), dstRegister);
 }
 
+void CCodeGen_x86::Emit_Tzc_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDef(dst, CX86Assembler::rAX);
+	if(m_cpuFeatures.hasBmi1)
+	{
+		m_assembler.TzcntEd(dstRegister, MakeVariableSymbolAddress(src1));
+	}
+	else
+	{
+		//BSF leaves its destination undefined when source is 0
+		m_assembler.MovId(CX86Assembler::rCX, 32);
+		m_assembler.BsfEd(dstRegister, MakeVariableSymbolAddress(src1));
+		m_assembler.CmoveEd(dstRegister, CX86Assembler::MakeRegisterAddress(CX86Assembler::rCX));
+	}
+	CommitSymbolRegister(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Popcnt_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDef(dst, CX86Assembler::rAX);
+	if(m_cpuFeatures.hasPopcnt)
+	{
+		m_assembler.PopcntEd(dstRegister, MakeVariableSymbolAddress(src1));
+	}
+	else
+	{
+		auto valueRegister = CX86Assembler::rAX;
+		auto tmpRegister = CX86Assembler::rCX;
+		auto valueAddress = CX86Assembler::MakeRegisterAddress(valueRegister);
+		auto tmpAddress = CX86Assembler::MakeRegisterAddress(tmpRegister);
+
+		m_assembler.MovEd(valueRegister, MakeVariableSymbolAddress(src1));
+
+		m_assembler.MovEd(tmpRegister, valueAddress);
+		m_assembler.ShrEd(tmpAddress, 1);
+		m_assembler.AndId(tmpAddress, 0x55555555);
+		m_assembler.SubEd(valueRegister, tmpAddress);
+
+		m_assembler.MovEd(tmpRegister, valueAddress);
+		m_assembler.ShrEd(tmpAddress, 2);
+		m_assembler.AndId(valueAddress, 0x33333333);
+		m_assembler.AndId(tmpAddress, 0x33333333);
+		m_assembler.AddEd(valueRegister, tmpAddress);
+
+		m_assembler.MovEd(tmpRegister, valueAddress);
+		m_assembler.ShrEd(tmpAddress, 4);
+		m_assembler.AddEd(valueRegister, tmpAddress);
+		m_assembler.AndId(valueAddress, 0x0F0F0F0F);
+
+		m_assembler.MovEd(tmpRegister, valueAddress);
+		m_assembler.ShrEd(tmpAddress, 8);
+		m_assembler.AddEd(valueRegister, tmpAddress);
+
+		m_assembler.MovEd(tmpRegister, valueAddress);
+		m_assembler.ShrEd(tmpAddress, 16);
+		m_assembler.AddEd(valueRegister, tmpAddress);
+
+		m_assembler.AndId(valueAddress, 0x3F);
+
+		if(dstRegister != valueRegister)
+		{
+			m_assembler.MovEd(dstRegister, valueAddress);
+		}
+	}
+	CommitSymbolRegister(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Bswap_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDef(dst, CX86Assembler::rAX);
+	if(m_cpuFeatures.hasMovbe && !src1->IsRegister())
+	{
+		m_assembler.MovbeEd(dstRegister, MakeMemorySymbolAddress(src1));
+	}
+	else
+	{
+		auto src1Register = PrepareSymbolRegisterUse(src1, dstRegister);
+		if(src1Register != dstRegister)
+		{
+			m_assembler.MovEd(dstRegister, CX86Assembler::MakeRegisterAddress(src1Register));
+		}
+		m_assembler.BswapEd(dstRegister);
+	}
+	CommitSymbolRegister(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Bswap16_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDef(dst, CX86Assembler::rAX);
+	auto src1Register = PrepareSymbolRegisterUse(src1, dstRegister);
+	if(src1Register != dstRegister)
+	{
+		m_assembler.MovEd(dstRegister, CX86Assembler::MakeRegisterAddress(src1Register));
+	}
+	m_assembler.BswapEd(dstRegister);
+	m_assembler.ShrEd(CX86Assembler::MakeRegisterAddress(dstRegister), 16);
+	CommitSymbolRegister(dst, dstRegister);
+}
+
 void CCodeGen_x86::Emit_Mov_RegReg(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -731,6 +1097,21 @@ void CCodeGen_x86::Emit_MergeTo64_Mem64MemMem(const STATEMENT& statement)
 	m_assembler.MovGd(MakeMemory64SymbolHiAddress(dst), CX86Assembler::rDX);
 }
 
+void CCodeGen_x86::Emit_MergeTo64_Mem64MemCst(const STATEMENT& statement)
+{
+	CSymbol* dst = statement.dst->GetSymbol().get();
+	CSymbol* src1 = statement.src1->GetSymbol().get();
+	CSymbol* src2 = statement.src2->GetSymbol().get();
+
+	assert(src2->m_type == SYM_CONSTANT);
+
+	m_assembler.MovEd(CX86Assembler::rAX, MakeMemorySymbolAddress(src1));
+	m_assembler.MovId(CX86Assembler::rDX, src2->m_valueLow);
+
+	m_assembler.MovGd(MakeMemory64SymbolLoAddress(dst), CX86Assembler::rAX);
+	m_assembler.MovGd(MakeMemory64SymbolHiAddress(dst), CX86Assembler::rDX);
+}
+
 void CCodeGen_x86::Emit_MergeTo64_Mem64CstReg(const STATEMENT& statement)
 {
 	CSymbol* dst = statement.dst->GetSymbol().get();
@@ -806,6 +1187,13 @@ void CCodeGen_x86::Emit_LoadFromRef_VarVarAny(const STATEMENT& statement)
 	CommitSymbolRegister(dst, dstReg);
 }
 
+void CCodeGen_x86::Emit_Lookup_VarCstAny(const STATEMENT& statement)
+{
+	auto loadStatement = statement;
+	loadStatement.jmpCondition = static_cast<CONDITION>(sizeof(uint32));
+	Emit_LoadFromRef_VarVarAny(loadStatement);
+}
+
 void CCodeGen_x86::Emit_Load8FromRef_VarVar(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -826,8 +1214,6 @@ void CCodeGen_x86::Emit_Load8FromRef_VarVarAny(const STATEMENT& statement)
 	auto src2 = statement.src2->GetSymbol().get();
 	uint8 scale = static_cast<uint8>(statement.jmpCondition);
 
-	assert(scale == 1);
-
 	auto dstReg = PrepareSymbolRegisterDef(dst, CX86Assembler::rDX);
 	m_assembler.MovzxEb(dstReg, MakeRefBaseScaleSymbolAddress(src1, CX86Assembler::rAX, src2, CX86Assembler::rCX, scale));
 	CommitSymbolRegister(dst, dstReg);
@@ -853,8 +1239,6 @@ void CCodeGen_x86::Emit_Load16FromRef_VarVarAny(const STATEMENT& statement)
 	auto src2 = statement.src2->GetSymbol().get();
 	uint8 scale = static_cast<uint8>(statement.jmpCondition);
 
-	assert(scale == 1);
-
 	auto dstReg = PrepareSymbolRegisterDef(dst, CX86Assembler::rDX);
 	m_assembler.MovzxEw(dstReg, MakeRefBaseScaleSymbolAddress(src1, CX86Assembler::rAX, src2, CX86Assembler::rCX, scale));
 	CommitSymbolRegister(dst, dstReg);
@@ -920,10 +1304,9 @@ void CCodeGen_x86::Emit_Store8AtRef_VarAnyCst(const STATEMENT& statement)
 	auto src1 = statement.src1->GetSymbol().get();
 	auto src2 = statement.src2->GetSymbol().get();
 	auto src3 = statement.src3->GetSymbol().get();
-	FRAMEWORK_MAYBE_UNUSED uint8 scale = static_cast<uint8>(statement.jmpCondition);
+	uint8 scale = static_cast<uint8>(statement.jmpCondition);
 
 	assert(src3->m_type == SYM_CONSTANT);
-	assert(scale == 1);
 
 	m_assembler.MovIb(MakeRefBaseScaleSymbolAddress(src1, CX86Assembler::rAX, src2, CX86Assembler::rCX, scale), static_cast<uint8>(src3->m_valueLow));
 }
@@ -954,9 +1337,7 @@ void CCodeGen_x86::Emit_Store16AtRef_VarAnyVar(const STATEMENT& statement)
 	auto src1 = statement.src1->GetSymbol().get();
 	auto src2 = statement.src2->GetSymbol().get();
 	auto src3 = statement.src3->GetSymbol().get();
-	FRAMEWORK_MAYBE_UNUSED uint8 scale = static_cast<uint8>(statement.jmpCondition);
-
-	assert(scale == 1);
+	uint8 scale = static_cast<uint8>(statement.jmpCondition);
 
 	auto valueReg = PrepareSymbolRegisterUse(src3, CX86Assembler::rDX);
 	m_assembler.MovGw(MakeRefBaseScaleSymbolAddress(src1, CX86Assembler::rAX, src2, CX86Assembler::rCX, scale), valueReg);
@@ -967,10 +1348,9 @@ void CCodeGen_x86::Emit_Store16AtRef_VarAnyCst(const STATEMENT& statement)
 	auto src1 = statement.src1->GetSymbol().get();
 	auto src2 = statement.src2->GetSymbol().get();
 	auto src3 = statement.src3->GetSymbol().get();
-	FRAMEWORK_MAYBE_UNUSED uint8 scale = static_cast<uint8>(statement.jmpCondition);
+	uint8 scale = static_cast<uint8>(statement.jmpCondition);
 
 	assert(src3->m_type == SYM_CONSTANT);
-	assert(scale == 1);
 
 	m_assembler.MovIw(MakeRefBaseScaleSymbolAddress(src1, CX86Assembler::rAX, src2, CX86Assembler::rCX, scale), src3->m_valueLow);
 }
@@ -1100,6 +1480,19 @@ void CCodeGen_x86::Emit_CondJmp_RegCst(const STATEMENT& statement)
 	CondJmp_JumpTo(GetLabel(statement.jmpBlock), statement.jmpCondition);
 }
 
+void CCodeGen_x86::Emit_CondJmp_MemReg(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	assert(src2->m_type == SYM_REGISTER);
+
+	m_assembler.MovEd(CX86Assembler::rAX, MakeMemorySymbolAddress(src1));
+	m_assembler.CmpEd(CX86Assembler::rAX, CX86Assembler::MakeRegisterAddress(m_registers[src2->m_valueLow]));
+
+	CondJmp_JumpTo(GetLabel(statement.jmpBlock), statement.jmpCondition);
+}
+
 void CCodeGen_x86::Emit_CondJmp_MemMem(const STATEMENT& statement)
 {
 	auto src1 = statement.src1->GetSymbol().get();
@@ -1132,6 +1525,79 @@ void CCodeGen_x86::Emit_CondJmp_MemCst(const STATEMENT& statement)
 	CondJmp_JumpTo(GetLabel(statement.jmpBlock), statement.jmpCondition);
 }
 
+void CCodeGen_x86::Emit_TestJmp_RegReg(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	assert(src1->m_type == SYM_REGISTER);
+	assert(src2->m_type == SYM_REGISTER);
+
+	m_assembler.TestEd(m_registers[src1->m_valueLow], CX86Assembler::MakeRegisterAddress(m_registers[src2->m_valueLow]));
+
+	CondJmp_JumpTo(GetLabel(statement.jmpBlock), statement.jmpCondition);
+}
+
+void CCodeGen_x86::Emit_TestJmp_RegMem(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	assert(src1->m_type == SYM_REGISTER);
+
+	m_assembler.TestEd(m_registers[src1->m_valueLow], MakeMemorySymbolAddress(src2));
+
+	CondJmp_JumpTo(GetLabel(statement.jmpBlock), statement.jmpCondition);
+}
+
+void CCodeGen_x86::Emit_TestJmp_RegCst(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	assert(src1->m_type == SYM_REGISTER);
+	assert(src2->m_type == SYM_CONSTANT);
+
+	m_assembler.TestId(CX86Assembler::MakeRegisterAddress(m_registers[src1->m_valueLow]), src2->m_valueLow);
+
+	CondJmp_JumpTo(GetLabel(statement.jmpBlock), statement.jmpCondition);
+}
+
+void CCodeGen_x86::Emit_TestJmp_MemReg(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	assert(src2->m_type == SYM_REGISTER);
+
+	m_assembler.TestEd(m_registers[src2->m_valueLow], MakeMemorySymbolAddress(src1));
+
+	CondJmp_JumpTo(GetLabel(statement.jmpBlock), statement.jmpCondition);
+}
+
+void CCodeGen_x86::Emit_TestJmp_MemMem(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	m_assembler.MovEd(CX86Assembler::rAX, MakeMemorySymbolAddress(src1));
+	m_assembler.TestEd(CX86Assembler::rAX, MakeMemorySymbolAddress(src2));
+
+	CondJmp_JumpTo(GetLabel(statement.jmpBlock), statement.jmpCondition);
+}
+
+void CCodeGen_x86::Emit_TestJmp_MemCst(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	assert(src2->m_type == SYM_CONSTANT);
+
+	m_assembler.TestId(MakeMemorySymbolAddress(src1), src2->m_valueLow);
+
+	CondJmp_JumpTo(GetLabel(statement.jmpBlock), statement.jmpCondition);
+}
+
 void CCodeGen_x86::Select_Generic(Jitter::CONDITION cond, CSymbol* dstSymbol, CSymbol* trueSymbol, CSymbol* falseSymbol)
 {
 	auto dstReg = PrepareSymbolRegisterDef(dstSymbol, CX86Assembler::rAX);
@@ -1151,6 +1617,24 @@ void CCodeGen_x86::Select_Generic(Jitter::CONDITION cond, CSymbol* dstSymbol, CS
 		case CONDITION_GT:
 			m_assembler.CmovgEd(dstReg, srcAddress);
 			break;
+		case CONDITION_LT:
+			m_assembler.CmovlEd(dstReg, srcAddress);
+			break;
+		case CONDITION_GE:
+			m_assembler.CmovgeEd(dstReg, srcAddress);
+			break;
+		case CONDITION_BL:
+			m_assembler.CmovbEd(dstReg, srcAddress);
+			break;
+		case CONDITION_BE:
+			m_assembler.CmovbeEd(dstReg, srcAddress);
+			break;
+		case CONDITION_AB:
+			m_assembler.CmovaEd(dstReg, srcAddress);
+			break;
+		case CONDITION_AE:
+			m_assembler.CmovaeEd(dstReg, srcAddress);
+			break;
 		default:
 			assert(false);
 			break;
@@ -1230,6 +1714,18 @@ void CCodeGen_x86::Emit_CmpSelectP1_AnyVar(const STATEMENT& statement)
 	m_assembler.CmpEd(src1Reg, MakeVariableSymbolAddress(src2));
 }
 
+void CCodeGen_x86::Emit_CmpSelectP1_AnyCst(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	assert(src2->m_type == SYM_CONSTANT);
+
+	auto src1Reg = PrepareSymbolRegisterUse(src1, CX86Assembler::rDX);
+
+	m_assembler.CmpId(CX86Assembler::MakeRegisterAddress(src1Reg), src2->m_valueLow);
+}
+
 void CCodeGen_x86::Emit_CmpSelectP2_VarAnyAny(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -1347,6 +1843,23 @@ CX86Assembler::XMMREGISTER CCodeGen_x86::PrepareSymbolRegisterDefFp32(CSymbol* s
 	}
 }
 
+CX86Assembler::XMMREGISTER CCodeGen_x86::PrepareSymbolRegisterDefFp64(CSymbol* symbol, CX86Assembler::XMMREGISTER preferedRegister)
+{
+	switch(symbol->m_type)
+	{
+	case SYM_FP_REGISTER64:
+		return m_mdRegisters[symbol->m_valueLow];
+		break;
+	case SYM_FP_TEMPORARY64:
+	case SYM_FP_RELATIVE64:
+		return preferedRegister;
+		break;
+	default:
+		throw std::runtime_error("Invalid symbol type.");
+		break;
+	}
+}
+
 CX86Assembler::XMMREGISTER CCodeGen_x86::PrepareSymbolRegisterDefMd(CSymbol* symbol, CX86Assembler::XMMREGISTER preferedRegister)
 {
 	switch(symbol->m_type)
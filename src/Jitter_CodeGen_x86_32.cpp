@@ -12,8 +12,11 @@ CX86Assembler::REGISTER CCodeGen_x86_32::g_registers[MAX_REGISTERS] =
 	CX86Assembler::rDI,
 };
 
+//xMM0 and xMM1 are used internally for temporary uses, others are borrowed from the allocatable registers when needed
 CX86Assembler::XMMREGISTER CCodeGen_x86_32::g_mdRegisters[MAX_MDREGISTERS] =
 {
+	CX86Assembler::xMM2,
+	CX86Assembler::xMM3,
 	CX86Assembler::xMM4,
 	CX86Assembler::xMM5,
 	CX86Assembler::xMM6,
@@ -57,6 +60,25 @@ CCodeGen_x86_32::CONSTMATCHER CCodeGen_x86_32::g_constMatchers[] =
 
 	{ OP_AND64,         MATCH_MEMORY64,     MATCH_MEMORY64,    MATCH_MEMORY64,   MATCH_NIL, &CCodeGen_x86_32::Emit_And64_MemMemMem },
 
+	{ OP_OR64,          MATCH_MEMORY64,     MATCH_MEMORY64,    MATCH_MEMORY64,   MATCH_NIL, &CCodeGen_x86_32::Emit_Logic64_MemMemAny<ALUOP_OR>  },
+	{ OP_OR64,          MATCH_MEMORY64,     MATCH_MEMORY64,    MATCH_CONSTANT64, MATCH_NIL, &CCodeGen_x86_32::Emit_Logic64_MemMemAny<ALUOP_OR>  },
+
+	{ OP_XOR64,         MATCH_MEMORY64,     MATCH_MEMORY64,    MATCH_MEMORY64,   MATCH_NIL, &CCodeGen_x86_32::Emit_Logic64_MemMemAny<ALUOP_XOR> },
+	{ OP_XOR64,         MATCH_MEMORY64,     MATCH_MEMORY64,    MATCH_CONSTANT64, MATCH_NIL, &CCodeGen_x86_32::Emit_Logic64_MemMemAny<ALUOP_XOR> },
+
+	{ OP_NOT64,         MATCH_MEMORY64,     MATCH_MEMORY64,    MATCH_NIL,        MATCH_NIL, &CCodeGen_x86_32::Emit_Not64_MemMem },
+
+	{ OP_MUL64,         MATCH_MEMORY64,     MATCH_MEMORY64,    MATCH_MEMORY64,   MATCH_NIL, &CCodeGen_x86_32::Emit_Mul64_MemMemAny },
+	{ OP_MUL64,         MATCH_MEMORY64,     MATCH_MEMORY64,    MATCH_CONSTANT64, MATCH_NIL, &CCodeGen_x86_32::Emit_Mul64_MemMemAny },
+
+	{ OP_DIV64,         MATCH_MEMORY64,     MATCH_ANY,         MATCH_ANY,        MATCH_NIL, &CCodeGen_x86_32::Emit_Div64_MemAnyAny<false> },
+	{ OP_DIVS64,        MATCH_MEMORY64,     MATCH_ANY,         MATCH_ANY,        MATCH_NIL, &CCodeGen_x86_32::Emit_Div64_MemAnyAny<true>  },
+
+	{ OP_SELECT64,      MATCH_MEMORY64,     MATCH_VARIABLE,    MATCH_ANY,        MATCH_ANY, &CCodeGen_x86_32::Emit_Select64_MemVarAnyAny },
+
+	{ OP_FP_TOINT64_TRUNC_D, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_NIL, MATCH_NIL, &CCodeGen_x86_32::Emit_Fp_ToInt64TruncD_VarVar },
+	{ OP_FP_TODOUBLE_I64,    MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_NIL, MATCH_NIL, &CCodeGen_x86_32::Emit_Fp_ToDoubleI64_VarVar   },
+
 	{ OP_SRL64,         MATCH_MEMORY64,     MATCH_MEMORY64,    MATCH_REGISTER,   MATCH_NIL, &CCodeGen_x86_32::Emit_Srl64_MemMemReg },
 	{ OP_SRL64,         MATCH_MEMORY64,     MATCH_MEMORY64,    MATCH_MEMORY,     MATCH_NIL, &CCodeGen_x86_32::Emit_Srl64_MemMemMem },
 	{ OP_SRL64,         MATCH_MEMORY64,     MATCH_MEMORY64,    MATCH_CONSTANT,   MATCH_NIL, &CCodeGen_x86_32::Emit_Srl64_MemMemCst },
@@ -69,6 +91,11 @@ CCodeGen_x86_32::CONSTMATCHER CCodeGen_x86_32::g_constMatchers[] =
 	{ OP_SLL64,         MATCH_MEMORY64,     MATCH_MEMORY64,    MATCH_MEMORY,     MATCH_NIL, &CCodeGen_x86_32::Emit_Sll64_MemMemMem },
 	{ OP_SLL64,         MATCH_MEMORY64,     MATCH_MEMORY64,    MATCH_CONSTANT,   MATCH_NIL, &CCodeGen_x86_32::Emit_Sll64_MemMemCst },
 
+	{ OP_ROTL64,        MATCH_MEMORY64,     MATCH_MEMORY64,    MATCH_ANY,        MATCH_NIL, &CCodeGen_x86_32::Emit_Rot64_MemMemAny<false> },
+	{ OP_ROTR64,        MATCH_MEMORY64,     MATCH_MEMORY64,    MATCH_ANY,        MATCH_NIL, &CCodeGen_x86_32::Emit_Rot64_MemMemAny<true>  },
+
+	{ OP_BSWAP64,       MATCH_MEMORY64,     MATCH_MEMORY64,    MATCH_NIL,        MATCH_NIL, &CCodeGen_x86_32::Emit_Bswap64_MemMem },
+
 	{ OP_CMP,           MATCH_VARIABLE,     MATCH_VARIABLE,    MATCH_VARIABLE,   MATCH_NIL, &CCodeGen_x86_32::Emit_Cmp_VarVarVar },
 	{ OP_CMP,           MATCH_VARIABLE,     MATCH_VARIABLE,    MATCH_CONSTANT,   MATCH_NIL, &CCodeGen_x86_32::Emit_Cmp_VarVarCst },
 
@@ -103,6 +130,8 @@ CCodeGen_x86_32::CONSTMATCHER CCodeGen_x86_32::g_constMatchers[] =
 
 	{ OP_CONDJMP,       MATCH_NIL,          MATCH_VAR_REF,     MATCH_CONSTANT,   MATCH_NIL, &CCodeGen_x86_32::Emit_CondJmp_Ref_VarCst   },
 
+	{ OP_JMPTABLE,      MATCH_NIL,          MATCH_VARIABLE,    MATCH_NIL,        MATCH_NIL, &CCodeGen_x86_32::Emit_JmpTable_Var         },
+
 	{ OP_MOV,           MATCH_NIL,          MATCH_NIL,         MATCH_NIL,        MATCH_NIL, nullptr },
 };
 // clang-format on
@@ -138,6 +167,7 @@ void CCodeGen_x86_32::Emit_Prolog(const StatementList& statements, unsigned int
 	m_literalOffsets.clear();
 	uint32 maxParamSize = 0;
 	uint32 maxParamSpillSize = 0;
+	bool hasCalls = false;
 	{
 		uint32 currParamSize = 0;
 		uint32 currParamSpillSize = 0;
@@ -180,6 +210,13 @@ void CCodeGen_x86_32::Emit_Prolog(const StatementList& statements, unsigned int
 				maxParamSpillSize = std::max<uint32>(currParamSpillSize, maxParamSpillSize);
 				currParamSize = 0;
 				currParamSpillSize = 0;
+				hasCalls = true;
+				break;
+			case OP_DIV64:
+			case OP_DIVS64:
+				//Done through a helper function taking two 64-bit parameters
+				maxParamSize = std::max<uint32>(16, maxParamSize);
+				hasCalls = true;
 				break;
 
 			//Literal Gathering
@@ -200,6 +237,35 @@ void CCodeGen_x86_32::Emit_Prolog(const StatementList& statements, unsigned int
 				m_literalOffsets.insert(std::make_pair(g_fpClampMask1, -1));
 				m_literalOffsets.insert(std::make_pair(g_fpClampMask2, -1));
 				break;
+			case OP_MD_RSQRT_S:
+			case OP_MD_RCPL_S:
+				m_literalOffsets.insert(std::make_pair(g_fpCstOne, -1));
+				break;
+			case OP_MD_DOT_S:
+				if(!m_cpuFeatures.hasSse41 && !m_cpuFeatures.hasAvx)
+				{
+					uint8 mask = static_cast<uint8>(statement.jmpCondition);
+					m_literalOffsets.insert(std::make_pair(MakeMdLaneMaskLiteral(mask >> 4), -1));
+					m_literalOffsets.insert(std::make_pair(MakeMdLaneMaskLiteral(mask & 0x0F), -1));
+				}
+				break;
+			case OP_MD_SHUFFLE_B:
+			{
+				auto patternLow = statement.src2->GetSymbol()->GetConstant64();
+				auto patternHigh = statement.src3->GetSymbol()->GetConstant64();
+				if(m_cpuFeatures.hasSsse3 || m_cpuFeatures.hasAvx)
+				{
+					m_literalOffsets.insert(std::make_pair(MakeMdShuffleBLiteral(patternLow, patternHigh), -1));
+				}
+				else
+				{
+					for(const auto& shiftMask : GetMdShuffleBShiftMasks(patternLow, patternHigh))
+					{
+						m_literalOffsets.insert(std::make_pair(shiftMask.second, -1));
+					}
+				}
+			}
+			break;
 			case OP_MD_EXPAND_W:
 			{
 				auto src1 = statement.src1->GetSymbol().get();
@@ -233,11 +299,15 @@ void CCodeGen_x86_32::Emit_Prolog(const StatementList& statements, unsigned int
 		}
 	}
 
-	//Align stack
-	m_assembler.MovEd(CX86Assembler::rAX, CX86Assembler::MakeRegisterAddress(CX86Assembler::rSP));
-	m_assembler.AndId(CX86Assembler::MakeRegisterAddress(CX86Assembler::rSP), ~0x0F);
-	m_assembler.SubId(CX86Assembler::MakeRegisterAddress(CX86Assembler::rSP), 0x0C);
-	m_assembler.Push(CX86Assembler::rAX);
+	//Align stack (not needed by leaf functions that don't use the stack)
+	m_stackAligned = hasCalls || (stackSize != 0) || !m_literalOffsets.empty();
+	if(m_stackAligned)
+	{
+		m_assembler.MovEd(CX86Assembler::rAX, CX86Assembler::MakeRegisterAddress(CX86Assembler::rSP));
+		m_assembler.AndId(CX86Assembler::MakeRegisterAddress(CX86Assembler::rSP), ~0x0F);
+		m_assembler.SubId(CX86Assembler::MakeRegisterAddress(CX86Assembler::rSP), 0x0C);
+		m_assembler.Push(CX86Assembler::rAX);
+	}
 
 	{
 		m_literalStackAlloc = m_literalOffsets.size() * 0x10;
@@ -294,7 +364,10 @@ void CCodeGen_x86_32::Emit_Epilog()
 		m_assembler.AddId(CX86Assembler::MakeRegisterAddress(CX86Assembler::rSP), m_totalStackAlloc + m_literalStackAlloc);
 	}
 
-	m_assembler.Pop(CX86Assembler::rSP);
+	if(m_stackAligned)
+	{
+		m_assembler.Pop(CX86Assembler::rSP);
+	}
 
 	for(int i = MAX_REGISTERS - 1; i >= 0; i--)
 	{
@@ -307,7 +380,7 @@ void CCodeGen_x86_32::Emit_Epilog()
 	m_assembler.Pop(CX86Assembler::rBP);
 }
 
-CX86Assembler::CAddress CCodeGen_x86_32::MakeConstant128Address(const LITERAL128& constant)
+CX86Assembler::CAddress CCodeGen_x86_32::MakeConstant128MemoryAddress(const LITERAL128& constant)
 {
 	auto literalOffsetIterator = m_literalOffsets.find(constant);
 	assert(literalOffsetIterator != std::end(m_literalOffsets));
@@ -320,16 +393,32 @@ unsigned int CCodeGen_x86_32::GetAvailableRegisterCount() const
 	return MAX_REGISTERS;
 }
 
+unsigned int CCodeGen_x86_32::GetAvailableCallerSavedRegisterCount() const
+{
+	return 0;
+}
+
 unsigned int CCodeGen_x86_32::GetAvailableMdRegisterCount() const
 {
 	return MAX_MDREGISTERS;
 }
 
+bool CCodeGen_x86_32::IsHelperCall(const STATEMENT& statement) const
+{
+	//XMM registers are not preserved across calls
+	return (statement.op == OP_DIV64) || (statement.op == OP_DIVS64);
+}
+
 bool CCodeGen_x86_32::CanHold128BitsReturnValueInRegisters() const
 {
 	return false;
 }
 
+bool CCodeGen_x86_32::Has64BitsRegisters() const
+{
+	return false;
+}
+
 uint32 CCodeGen_x86_32::GetPointerSize() const
 {
 	return 4;
@@ -647,6 +736,236 @@ void CCodeGen_x86_32::Emit_And64_MemMemMem(const STATEMENT& statement)
 	m_assembler.MovGd(MakeMemory64SymbolHiAddress(dst), CX86Assembler::rDX);
 }
 
+template <typename ALUOP>
+void CCodeGen_x86_32::Emit_Logic64_MemMemAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	m_assembler.MovEd(CX86Assembler::rAX, MakeMemory64SymbolLoAddress(src1));
+	m_assembler.MovEd(CX86Assembler::rDX, MakeMemory64SymbolHiAddress(src1));
+
+	if(src2->m_type == SYM_CONSTANT64)
+	{
+		((m_assembler).*(ALUOP::OpId()))(CX86Assembler::MakeRegisterAddress(CX86Assembler::rAX), src2->m_valueLow);
+		((m_assembler).*(ALUOP::OpId()))(CX86Assembler::MakeRegisterAddress(CX86Assembler::rDX), src2->m_valueHigh);
+	}
+	else
+	{
+		((m_assembler).*(ALUOP::OpEd()))(CX86Assembler::rAX, MakeMemory64SymbolLoAddress(src2));
+		((m_assembler).*(ALUOP::OpEd()))(CX86Assembler::rDX, MakeMemory64SymbolHiAddress(src2));
+	}
+
+	m_assembler.MovGd(MakeMemory64SymbolLoAddress(dst), CX86Assembler::rAX);
+	m_assembler.MovGd(MakeMemory64SymbolHiAddress(dst), CX86Assembler::rDX);
+}
+
+void CCodeGen_x86_32::Emit_Not64_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	m_assembler.MovEd(CX86Assembler::rAX, MakeMemory64SymbolLoAddress(src1));
+	m_assembler.MovEd(CX86Assembler::rDX, MakeMemory64SymbolHiAddress(src1));
+
+	m_assembler.NotEd(CX86Assembler::MakeRegisterAddress(CX86Assembler::rAX));
+	m_assembler.NotEd(CX86Assembler::MakeRegisterAddress(CX86Assembler::rDX));
+
+	m_assembler.MovGd(MakeMemory64SymbolLoAddress(dst), CX86Assembler::rAX);
+	m_assembler.MovGd(MakeMemory64SymbolHiAddress(dst), CX86Assembler::rDX);
+}
+
+void CCodeGen_x86_32::Emit_Mul64_MemMemAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto loadSrc2Part =
+	    [&](bool high) {
+		    if(src2->m_type == SYM_CONSTANT64)
+		    {
+			    m_assembler.MovId(CX86Assembler::rAX, high ? src2->m_valueHigh : src2->m_valueLow);
+		    }
+		    else
+		    {
+			    m_assembler.MovEd(CX86Assembler::rAX, high ? MakeMemory64SymbolHiAddress(src2) : MakeMemory64SymbolLoAddress(src2));
+		    }
+	    };
+
+	//Cross products only contribute to the high part of the result
+	loadSrc2Part(false);
+	m_assembler.MulEd(MakeMemory64SymbolHiAddress(src1));
+	m_assembler.MovEd(CX86Assembler::rCX, CX86Assembler::MakeRegisterAddress(CX86Assembler::rAX));
+
+	loadSrc2Part(true);
+	m_assembler.MulEd(MakeMemory64SymbolLoAddress(src1));
+	m_assembler.AddEd(CX86Assembler::rCX, CX86Assembler::MakeRegisterAddress(CX86Assembler::rAX));
+
+	loadSrc2Part(false);
+	m_assembler.MulEd(MakeMemory64SymbolLoAddress(src1));
+	m_assembler.AddEd(CX86Assembler::rDX, CX86Assembler::MakeRegisterAddress(CX86Assembler::rCX));
+
+	m_assembler.MovGd(MakeMemory64SymbolLoAddress(dst), CX86Assembler::rAX);
+	m_assembler.MovGd(MakeMemory64SymbolHiAddress(dst), CX86Assembler::rDX);
+}
+
+extern "C" uint64 CodeGen_x86_32_div64_unsigned(uint64 a, uint64 b)
+{
+	return a / b;
+}
+
+extern "C" int64 CodeGen_x86_32_div64_signed(int64 a, int64 b)
+{
+	return a / b;
+}
+
+template <bool isSigned>
+void CCodeGen_x86_32::Emit_Div64_MemAnyAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto divFct = isSigned ? reinterpret_cast<uintptr_t>(&CodeGen_x86_32_div64_signed) : reinterpret_cast<uintptr_t>(&CodeGen_x86_32_div64_unsigned);
+
+	//Parameter space has been reserved by the prolog
+	auto storeParam =
+	    [&](CSymbol* symbol, uint32 paramOffset) {
+		    auto paramLoAddress = CX86Assembler::MakeIndRegOffAddress(CX86Assembler::rSP, paramOffset + 0);
+		    auto paramHiAddress = CX86Assembler::MakeIndRegOffAddress(CX86Assembler::rSP, paramOffset + 4);
+		    if(symbol->m_type == SYM_CONSTANT64)
+		    {
+			    m_assembler.MovId(paramLoAddress, symbol->m_valueLow);
+			    m_assembler.MovId(paramHiAddress, symbol->m_valueHigh);
+		    }
+		    else
+		    {
+			    m_assembler.MovEd(CX86Assembler::rAX, MakeMemory64SymbolLoAddress(symbol));
+			    m_assembler.MovEd(CX86Assembler::rDX, MakeMemory64SymbolHiAddress(symbol));
+			    m_assembler.MovGd(paramLoAddress, CX86Assembler::rAX);
+			    m_assembler.MovGd(paramHiAddress, CX86Assembler::rDX);
+		    }
+	    };
+
+	storeParam(src1, 0);
+	storeParam(src2, 8);
+
+	m_assembler.MovId(CX86Assembler::rAX, static_cast<uint32>(divFct));
+	auto symbolRefLabel = m_assembler.CreateLabel();
+	m_assembler.MarkLabel(symbolRefLabel, -4);
+	m_symbolReferenceLabels.push_back(std::make_pair(divFct, symbolRefLabel));
+	m_assembler.CallEd(CX86Assembler::MakeRegisterAddress(CX86Assembler::rAX));
+
+	m_assembler.MovGd(MakeMemory64SymbolLoAddress(dst), CX86Assembler::rAX);
+	m_assembler.MovGd(MakeMemory64SymbolHiAddress(dst), CX86Assembler::rDX);
+}
+
+void CCodeGen_x86_32::Emit_Select64_MemVarAnyAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	if(src3->m_type == SYM_CONSTANT64)
+	{
+		m_assembler.MovId(CX86Assembler::rAX, src3->m_valueLow);
+		m_assembler.MovId(CX86Assembler::rDX, src3->m_valueHigh);
+	}
+	else
+	{
+		m_assembler.MovEd(CX86Assembler::rAX, MakeMemory64SymbolLoAddress(src3));
+		m_assembler.MovEd(CX86Assembler::rDX, MakeMemory64SymbolHiAddress(src3));
+	}
+
+	m_assembler.CmpId(MakeVariableSymbolAddress(src1), 0);
+
+	//MOVs don't modify flags, it's safe to load constants after the comparison
+	if(src2->m_type == SYM_CONSTANT64)
+	{
+		m_assembler.MovId(CX86Assembler::rCX, src2->m_valueLow);
+		m_assembler.CmovneEd(CX86Assembler::rAX, CX86Assembler::MakeRegisterAddress(CX86Assembler::rCX));
+		m_assembler.MovId(CX86Assembler::rCX, src2->m_valueHigh);
+		m_assembler.CmovneEd(CX86Assembler::rDX, CX86Assembler::MakeRegisterAddress(CX86Assembler::rCX));
+	}
+	else
+	{
+		m_assembler.CmovneEd(CX86Assembler::rAX, MakeMemory64SymbolLoAddress(src2));
+		m_assembler.CmovneEd(CX86Assembler::rDX, MakeMemory64SymbolHiAddress(src2));
+	}
+
+	m_assembler.MovGd(MakeMemory64SymbolLoAddress(dst), CX86Assembler::rAX);
+	m_assembler.MovGd(MakeMemory64SymbolHiAddress(dst), CX86Assembler::rDX);
+}
+
+//---------------------------------------------------------------------------------
+//FP64 <-> INT64
+//---------------------------------------------------------------------------------
+
+//SSE2 can't convert 64-bit integers in 32-bit mode, go through the x87 unit instead
+
+void CCodeGen_x86_32::Emit_Fp_ToInt64TruncD_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto stackAddress = CX86Assembler::MakeIndRegAddress(CX86Assembler::rSP);
+
+	m_assembler.SubId(CX86Assembler::MakeRegisterAddress(CX86Assembler::rSP), 8);
+	m_stackLevel += 8;
+
+	if(src1->m_type == SYM_FP_REGISTER64)
+	{
+		m_assembler.MovsdEd(stackAddress, m_mdRegisters[src1->m_valueLow]);
+		m_assembler.FldEq(stackAddress);
+	}
+	else
+	{
+		m_assembler.FldEq(MakeMemoryFp64SymbolAddress(src1));
+	}
+	m_assembler.FisttpEq(stackAddress);
+
+	auto dstRegister = PrepareSymbolRegisterDefFp64(dst, CX86Assembler::xMM0);
+	m_assembler.MovsdEd(dstRegister, stackAddress);
+
+	m_assembler.AddId(CX86Assembler::MakeRegisterAddress(CX86Assembler::rSP), 8);
+	m_stackLevel -= 8;
+
+	CommitSymbolRegisterFp64Sse(dst, dstRegister);
+}
+
+void CCodeGen_x86_32::Emit_Fp_ToDoubleI64_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto stackAddress = CX86Assembler::MakeIndRegAddress(CX86Assembler::rSP);
+
+	m_assembler.SubId(CX86Assembler::MakeRegisterAddress(CX86Assembler::rSP), 8);
+	m_stackLevel += 8;
+
+	if(src1->m_type == SYM_FP_REGISTER64)
+	{
+		m_assembler.MovsdEd(stackAddress, m_mdRegisters[src1->m_valueLow]);
+		m_assembler.FildEq(stackAddress);
+	}
+	else
+	{
+		m_assembler.FildEq(MakeMemoryFp64SymbolAddress(src1));
+	}
+	m_assembler.FstpEq(stackAddress);
+
+	auto dstRegister = PrepareSymbolRegisterDefFp64(dst, CX86Assembler::xMM0);
+	m_assembler.MovsdEd(dstRegister, stackAddress);
+
+	m_assembler.AddId(CX86Assembler::MakeRegisterAddress(CX86Assembler::rSP), 8);
+	m_stackLevel -= 8;
+
+	CommitSymbolRegisterFp64Sse(dst, dstRegister);
+}
+
 //---------------------------------------------------------------------------------
 //SR64
 //---------------------------------------------------------------------------------
@@ -976,6 +1295,107 @@ void CCodeGen_x86_32::Emit_Sll64_MemMemCst(const STATEMENT& statement)
 	m_assembler.MovGd(MakeMemory64SymbolHiAddress(dst), regHi);
 }
 
+template <bool isRight>
+void CCodeGen_x86_32::Emit_Rot64_MemMemAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto resultLow = CX86Assembler::rAX;
+	auto resultHigh = CX86Assembler::rDX;
+	auto amountReg = CX86Assembler::rCX;
+
+	//Rotating by 32 or more swaps both halves, the remaining amount is handled by SHLD/SHRD
+	auto loadSource =
+	    [&](bool swapHalves) {
+		    m_assembler.MovEd(resultLow, swapHalves ? MakeMemory64SymbolHiAddress(src1) : MakeMemory64SymbolLoAddress(src1));
+		    m_assembler.MovEd(resultHigh, swapHalves ? MakeMemory64SymbolLoAddress(src1) : MakeMemory64SymbolHiAddress(src1));
+	    };
+
+	if(src2->IsConstant())
+	{
+		uint8 amount = static_cast<uint8>(src2->m_valueLow & 0x3F);
+		loadSource((amount & 0x20) != 0);
+		amount &= 0x1F;
+		m_assembler.MovGd(MakeMemory64SymbolLoAddress(dst), resultLow);
+		if(isRight)
+		{
+			m_assembler.ShrdEd(MakeMemory64SymbolLoAddress(dst), resultHigh, amount);
+			m_assembler.ShrdEd(CX86Assembler::MakeRegisterAddress(resultHigh), resultLow, amount);
+		}
+		else
+		{
+			m_assembler.ShldEd(MakeMemory64SymbolLoAddress(dst), resultHigh, amount);
+			m_assembler.ShldEd(CX86Assembler::MakeRegisterAddress(resultHigh), resultLow, amount);
+		}
+		m_assembler.MovGd(MakeMemory64SymbolHiAddress(dst), resultHigh);
+	}
+	else
+	{
+		auto swapLabel = m_assembler.CreateLabel();
+		auto loadedLabel = m_assembler.CreateLabel();
+
+		auto amountRegister = PrepareSymbolRegisterUse(src2, amountReg);
+		if(amountRegister != amountReg)
+		{
+			m_assembler.MovEd(amountReg, CX86Assembler::MakeRegisterAddress(amountRegister));
+		}
+
+		m_assembler.MovEd(resultLow, CX86Assembler::MakeRegisterAddress(amountReg));
+		m_assembler.AndId(CX86Assembler::MakeRegisterAddress(resultLow), 0x20);
+		m_assembler.JnzJx(swapLabel);
+
+		loadSource(false);
+		m_assembler.JmpJx(loadedLabel);
+
+		//$swap
+		m_assembler.MarkLabel(swapLabel);
+		loadSource(true);
+
+		//$loaded
+		m_assembler.MarkLabel(loadedLabel);
+
+		m_assembler.MovGd(MakeMemory64SymbolLoAddress(dst), resultLow);
+		if(isRight)
+		{
+			m_assembler.ShrdEd(MakeMemory64SymbolLoAddress(dst), resultHigh);
+			m_assembler.ShrdEd(CX86Assembler::MakeRegisterAddress(resultHigh), resultLow);
+		}
+		else
+		{
+			m_assembler.ShldEd(MakeMemory64SymbolLoAddress(dst), resultHigh);
+			m_assembler.ShldEd(CX86Assembler::MakeRegisterAddress(resultHigh), resultLow);
+		}
+		m_assembler.MovGd(MakeMemory64SymbolHiAddress(dst), resultHigh);
+	}
+}
+
+void CCodeGen_x86_32::Emit_Bswap64_MemMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto resultLow = CX86Assembler::rAX;
+	auto resultHigh = CX86Assembler::rDX;
+
+	if(m_cpuFeatures.hasMovbe)
+	{
+		m_assembler.MovbeEd(resultLow, MakeMemory64SymbolHiAddress(src1));
+		m_assembler.MovbeEd(resultHigh, MakeMemory64SymbolLoAddress(src1));
+	}
+	else
+	{
+		m_assembler.MovEd(resultLow, MakeMemory64SymbolHiAddress(src1));
+		m_assembler.MovEd(resultHigh, MakeMemory64SymbolLoAddress(src1));
+		m_assembler.BswapEd(resultLow);
+		m_assembler.BswapEd(resultHigh);
+	}
+
+	m_assembler.MovGd(MakeMemory64SymbolLoAddress(dst), resultLow);
+	m_assembler.MovGd(MakeMemory64SymbolHiAddress(dst), resultHigh);
+}
+
 void CCodeGen_x86_32::Emit_Cmp_VarVarVar(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -1436,8 +1856,6 @@ void CCodeGen_x86_32::Emit_LoadFromRef_64_MemVarAny(const STATEMENT& statement)
 	auto src2 = statement.src2->GetSymbol().get();
 	uint8 scale = static_cast<uint8>(statement.jmpCondition);
 
-	assert(scale == 1);
-
 	auto [loAddr, hiAddr] = MakeRefBaseScaleSymbolAddress64(src1, CX86Assembler::rDX, src2, CX86Assembler::rCX, scale);
 	auto valueReg = CX86Assembler::rAX;
 
@@ -1511,8 +1929,6 @@ void CCodeGen_x86_32::Emit_StoreAtRef_64_VarAnyMem(const STATEMENT& statement)
 	auto src3 = statement.src3->GetSymbol().get();
 	uint8 scale = static_cast<uint8>(statement.jmpCondition);
 
-	assert(scale == 1);
-
 	auto [loAddr, hiAddr] = MakeRefBaseScaleSymbolAddress64(src1, CX86Assembler::rDX, src2, CX86Assembler::rCX, scale);
 	auto valueReg = CX86Assembler::rAX;
 
@@ -1530,7 +1946,6 @@ void CCodeGen_x86_32::Emit_StoreAtRef_64_VarAnyCst(const STATEMENT& statement)
 	uint8 scale = static_cast<uint8>(statement.jmpCondition);
 
 	assert(src3->m_type == SYM_CONSTANT64);
-	assert(scale == 1);
 
 	auto [loAddr, hiAddr] = MakeRefBaseScaleSymbolAddress64(src1, CX86Assembler::rDX, src2, CX86Assembler::rCX, scale);
 
@@ -1555,8 +1970,6 @@ void CCodeGen_x86_32::Emit_Store8AtRef_VarAnyVar(const STATEMENT& statement)
 	auto src3 = statement.src3->GetSymbol().get();
 	uint8 scale = static_cast<uint8>(statement.jmpCondition);
 
-	assert(scale == 1);
-
 	auto valueReg = PrepareSymbolByteRegisterUse(src3, CX86Assembler::rDX);
 	m_assembler.MovGb(MakeRefBaseScaleSymbolAddress(src1, CX86Assembler::rAX, src2, CX86Assembler::rCX, scale), valueReg);
 }
@@ -1577,6 +1990,29 @@ void CCodeGen_x86_32::Emit_CondJmp_Ref_VarCst(const STATEMENT& statement)
 	CondJmp_JumpTo(GetLabel(statement.jmpBlock), statement.jmpCondition);
 }
 
+void CCodeGen_x86_32::Emit_JmpTable_Var(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto tableLabel = m_assembler.CreateLabel();
+
+	//Table entries are offsets relative to the start of the table. Its address is taken
+	//first since the assembler needs label distance references to come before jumps
+	m_assembler.LeaGd(CX86Assembler::rCX, tableLabel);
+	m_assembler.MovEd(CX86Assembler::rAX, MakeVariableSymbolAddress(src1));
+	m_assembler.CmpId(CX86Assembler::MakeRegisterAddress(CX86Assembler::rAX), static_cast<uint32>(statement.jmpTable->size()));
+	m_assembler.JnbJx(GetLabel(statement.jmpBlock));
+
+	m_assembler.AddEd(CX86Assembler::rCX, CX86Assembler::MakeBaseOffIndexScaleAddress(CX86Assembler::rCX, 0, CX86Assembler::rAX, 4));
+	m_assembler.JmpEd(CX86Assembler::MakeRegisterAddress(CX86Assembler::rCX));
+
+	m_assembler.MarkLabel(tableLabel);
+	for(const auto& target : *statement.jmpTable)
+	{
+		m_assembler.DdLabelOffset(GetLabel(target), tableLabel);
+	}
+}
+
 CX86Assembler::REGISTER CCodeGen_x86_32::PrepareRefSymbolRegisterDef(CSymbol* symbol, CX86Assembler::REGISTER preferedRegister)
 {
 	switch(symbol->m_type)
@@ -1606,6 +2042,10 @@ CX86Assembler::REGISTER CCodeGen_x86_32::PrepareRefSymbolRegisterUse(CSymbol* sy
 		m_assembler.MovEd(preferedRegister, MakeMemoryReferenceSymbolAddress(symbol));
 		return preferedRegister;
 		break;
+	case SYM_CONSTANTPTR:
+		m_assembler.MovId(preferedRegister, static_cast<uint32>(symbol->GetConstantPtr()));
+		return preferedRegister;
+		break;
 	default:
 		throw std::runtime_error("Invalid symbol type.");
 		break;
@@ -5,13 +5,21 @@
 using namespace Jitter;
 
 // clang-format off
-CX86Assembler::REGISTER CCodeGen_x86_64::g_systemVRegisters[SYSTEMV_MAX_REGISTERS] =
+//Caller-saved registers come after callee-saved ones
+CX86Assembler::REGISTER CCodeGen_x86_64::g_systemVRegisters[SYSTEMV_MAX_REGISTERS + SYSTEMV_MAX_CALLER_SAVED_REGISTERS] =
 {
 	CX86Assembler::rBX,
 	CX86Assembler::r12,
 	CX86Assembler::r13,
 	CX86Assembler::r14,
 	CX86Assembler::r15,
+
+	CX86Assembler::rSI,
+	CX86Assembler::rDI,
+	CX86Assembler::r8,
+	CX86Assembler::r9,
+	CX86Assembler::r10,
+	CX86Assembler::r11,
 };
 
 CX86Assembler::REGISTER CCodeGen_x86_64::g_systemVParamRegs[SYSTEMV_MAX_PARAMS] =
@@ -24,7 +32,7 @@ CX86Assembler::REGISTER CCodeGen_x86_64::g_systemVParamRegs[SYSTEMV_MAX_PARAMS]
 	CX86Assembler::r9,
 };
 
-CX86Assembler::REGISTER CCodeGen_x86_64::g_win32Registers[WIN32_MAX_REGISTERS] =
+CX86Assembler::REGISTER CCodeGen_x86_64::g_win32Registers[WIN32_MAX_REGISTERS + WIN32_MAX_CALLER_SAVED_REGISTERS] =
 {
 	CX86Assembler::rBX,
 	CX86Assembler::rSI,
@@ -33,6 +41,11 @@ CX86Assembler::REGISTER CCodeGen_x86_64::g_win32Registers[WIN32_MAX_REGISTERS] =
 	CX86Assembler::r13,
 	CX86Assembler::r14,
 	CX86Assembler::r15,
+
+	CX86Assembler::r8,
+	CX86Assembler::r9,
+	CX86Assembler::r10,
+	CX86Assembler::r11,
 };
 
 CX86Assembler::REGISTER CCodeGen_x86_64::g_win32ParamRegs[WIN32_MAX_PARAMS] =
@@ -44,6 +57,12 @@ CX86Assembler::REGISTER CCodeGen_x86_64::g_win32ParamRegs[WIN32_MAX_PARAMS] =
 };
 
 //xMM0->xMM3 are used internally for temporary uses
+CX86Assembler::XMMREGISTER CCodeGen_x86_64::g_mdTempRegisters[MAX_MDTEMPREGISTERS] =
+{
+	CX86Assembler::xMM2,
+	CX86Assembler::xMM3,
+};
+
 CX86Assembler::XMMREGISTER CCodeGen_x86_64::g_mdRegisters[MAX_MDREGISTERS] =
 {
 	CX86Assembler::xMM4,
@@ -65,21 +84,39 @@ CX86Assembler::XMMREGISTER CCodeGen_x86_64::g_mdRegisters[MAX_MDREGISTERS] =
 //-------------------------------------------------------------------
 
 template <typename ALUOP>
-void CCodeGen_x86_64::Emit_Alu64_MemMemMem(const STATEMENT& statement)
+void CCodeGen_x86_64::Emit_Alu64_VarVarVar(const STATEMENT& statement)
 {
 	CSymbol* dst = statement.dst->GetSymbol().get();
 	CSymbol* src1 = statement.src1->GetSymbol().get();
 	CSymbol* src2 = statement.src2->GetSymbol().get();
 
-	CX86Assembler::REGISTER tmpReg = CX86Assembler::rAX;
+	if((statement.op == OP_ADD64) && dst->IsRegister() && src1->IsRegister() && src2->IsRegister() && !dst->Equals(src1))
+	{
+		//Non-destructive add, avoids copying src1 in dst first
+		auto address = CX86Assembler::MakeBaseOffIndexScaleAddress(m_registers[src1->m_valueLow], 0, m_registers[src2->m_valueLow], 1);
+		m_assembler.LeaGq(m_registers[dst->m_valueLow], address);
+		return;
+	}
+
+	auto src2Address = MakeVariable64SymbolAddress(src2);
+	if(dst->IsRegister() && dst->Equals(src2) && !dst->Equals(src1))
+	{
+		//src2 would be overwritten by src1's value
+		m_assembler.MovEq(CX86Assembler::rCX, src2Address);
+		src2Address = CX86Assembler::MakeRegisterAddress(CX86Assembler::rCX);
+	}
 
-	m_assembler.MovEq(tmpReg, MakeMemory64SymbolAddress(src1));
-	((m_assembler).*(ALUOP::OpEq()))(tmpReg, MakeMemory64SymbolAddress(src2));
-	m_assembler.MovGq(MakeMemory64SymbolAddress(dst), tmpReg);
+	auto dstReg = PrepareSymbol64RegisterDef(dst, CX86Assembler::rAX);
+	if(!(dst->IsRegister() && dst->Equals(src1)))
+	{
+		m_assembler.MovEq(dstReg, MakeVariable64SymbolAddress(src1));
+	}
+	((m_assembler).*(ALUOP::OpEq()))(dstReg, src2Address);
+	CommitSymbol64Register(dst, dstReg);
 }
 
 template <typename ALUOP>
-void CCodeGen_x86_64::Emit_Alu64_MemMemCst(const STATEMENT& statement)
+void CCodeGen_x86_64::Emit_Alu64_VarVarCst(const STATEMENT& statement)
 {
 	CSymbol* dst = statement.dst->GetSymbol().get();
 	CSymbol* src1 = statement.src1->GetSymbol().get();
@@ -87,25 +124,38 @@ void CCodeGen_x86_64::Emit_Alu64_MemMemCst(const STATEMENT& statement)
 
 	assert(src2->m_type == SYM_CONSTANT64);
 
-	CX86Assembler::REGISTER tmpReg = CX86Assembler::rAX;
 	uint64 constant = src2->GetConstant64();
 
-	m_assembler.MovEq(tmpReg, MakeMemory64SymbolAddress(src1));
+	//Non-destructive add or subtract, as long as the constant fits in a displacement
+	uint64 displacement = (statement.op == OP_SUB64) ? (0 - constant) : constant;
+	if(((statement.op == OP_ADD64) || (statement.op == OP_SUB64)) && dst->IsRegister() && src1->IsRegister() && !dst->Equals(src1) &&
+	   (CX86Assembler::GetMinimumConstantSize64(displacement) <= 4))
+	{
+		auto address = CX86Assembler::MakeIndRegOffAddress(m_registers[src1->m_valueLow], static_cast<uint32>(displacement));
+		m_assembler.LeaGq(m_registers[dst->m_valueLow], address);
+		return;
+	}
+
+	auto dstReg = PrepareSymbol64RegisterDef(dst, CX86Assembler::rAX);
+	if(!(dst->IsRegister() && dst->Equals(src1)))
+	{
+		m_assembler.MovEq(dstReg, MakeVariable64SymbolAddress(src1));
+	}
 	if(CX86Assembler::GetMinimumConstantSize64(constant) >= 4)
 	{
 		auto cstReg = CX86Assembler::rCX;
 		m_assembler.MovIq(cstReg, constant);
-		((m_assembler).*(ALUOP::OpEq()))(tmpReg, CX86Assembler::MakeRegisterAddress(cstReg));
+		((m_assembler).*(ALUOP::OpEq()))(dstReg, CX86Assembler::MakeRegisterAddress(cstReg));
 	}
 	else
 	{
-		((m_assembler).*(ALUOP::OpIq()))(CX86Assembler::MakeRegisterAddress(tmpReg), constant);
+		((m_assembler).*(ALUOP::OpIq()))(CX86Assembler::MakeRegisterAddress(dstReg), constant);
 	}
-	m_assembler.MovGq(MakeMemory64SymbolAddress(dst), tmpReg);
+	CommitSymbol64Register(dst, dstReg);
 }
 
 template <typename ALUOP>
-void CCodeGen_x86_64::Emit_Alu64_MemCstMem(const STATEMENT& statement)
+void CCodeGen_x86_64::Emit_Alu64_VarCstVar(const STATEMENT& statement)
 {
 	CSymbol* dst = statement.dst->GetSymbol().get();
 	CSymbol* src1 = statement.src1->GetSymbol().get();
@@ -117,82 +167,329 @@ void CCodeGen_x86_64::Emit_Alu64_MemCstMem(const STATEMENT& statement)
 	uint64 constant = src1->GetConstant64();
 
 	m_assembler.MovIq(tmpReg, constant);
-	((m_assembler).*(ALUOP::OpEq()))(tmpReg, MakeMemory64SymbolAddress(src2));
-	m_assembler.MovGq(MakeMemory64SymbolAddress(dst), tmpReg);
+	((m_assembler).*(ALUOP::OpEq()))(tmpReg, MakeVariable64SymbolAddress(src2));
+	m_assembler.MovGq(MakeVariable64SymbolAddress(dst), tmpReg);
+}
+
+void CCodeGen_x86_64::Emit_Not64_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = PrepareSymbol64RegisterDef(dst, CX86Assembler::rAX);
+
+	if(!(dst->IsRegister() && dst->Equals(src1)))
+	{
+		m_assembler.MovEq(dstReg, MakeVariable64SymbolAddress(src1));
+	}
+	m_assembler.NotEq(CX86Assembler::MakeRegisterAddress(dstReg));
+	CommitSymbol64Register(dst, dstReg);
+}
+
+void CCodeGen_x86_64::Emit_Bswap64_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = PrepareSymbol64RegisterDef(dst, CX86Assembler::rAX);
+
+	if(m_cpuFeatures.hasMovbe && !src1->IsRegister())
+	{
+		m_assembler.MovbeEq(dstReg, MakeVariable64SymbolAddress(src1));
+	}
+	else
+	{
+		if(!(dst->IsRegister() && dst->Equals(src1)))
+		{
+			m_assembler.MovEq(dstReg, MakeVariable64SymbolAddress(src1));
+		}
+		m_assembler.BswapEq(dstReg);
+	}
+	CommitSymbol64Register(dst, dstReg);
+}
+
+void CCodeGen_x86_64::Emit_Mul64_VarVarAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto tmpReg = CX86Assembler::rAX;
+
+	m_assembler.MovEq(tmpReg, MakeVariable64SymbolAddress(src1));
+	m_assembler.ImulEq(tmpReg, MakeSymbol64Address(src2, CX86Assembler::rCX));
+	m_assembler.MovGq(MakeVariable64SymbolAddress(dst), tmpReg);
+}
+
+template <bool isSigned>
+void CCodeGen_x86_64::Emit_Div64_VarAnyAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto divisorAddress = MakeSymbol64Address(src2, CX86Assembler::rCX);
+	LoadSymbol64InRegister(CX86Assembler::rAX, src1);
+	if(isSigned)
+	{
+		m_assembler.Cqo();
+		m_assembler.IdivEq(divisorAddress);
+	}
+	else
+	{
+		m_assembler.XorEd(CX86Assembler::rDX, CX86Assembler::MakeRegisterAddress(CX86Assembler::rDX));
+		m_assembler.DivEq(divisorAddress);
+	}
+	m_assembler.MovGq(MakeVariable64SymbolAddress(dst), CX86Assembler::rAX);
+}
+
+void CCodeGen_x86_64::Emit_Select64_VarVarAnyAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	auto resultReg = CX86Assembler::rAX;
+
+	LoadSymbol64InRegister(resultReg, src3);
+	auto trueAddress = MakeSymbol64Address(src2, CX86Assembler::rCX);
+	m_assembler.CmpId(MakeVariableSymbolAddress(src1), 0);
+	m_assembler.CmovneEq(resultReg, trueAddress);
+	m_assembler.MovGq(MakeVariable64SymbolAddress(dst), resultReg);
+}
+
+void CCodeGen_x86_64::Emit_Fp_ToInt64TruncD_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto tmpIntRegister = CX86Assembler::rAX;
+
+	m_assembler.Cvttsd2siEq(tmpIntRegister, MakeVariableFp64SymbolAddress(src1));
+	if(dst->m_type == SYM_FP_REGISTER64)
+	{
+		m_assembler.MovqVo(m_mdRegisters[dst->m_valueLow], CX86Assembler::MakeRegisterAddress(tmpIntRegister));
+	}
+	else
+	{
+		m_assembler.MovGq(MakeMemoryFp64SymbolAddress(dst), tmpIntRegister);
+	}
+}
+
+void CCodeGen_x86_64::Emit_Fp_ToDoubleI64_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDefFp64(dst, CX86Assembler::xMM0);
+	auto src1Address = MakeVariableFp64SymbolAddress(src1);
+
+	if(src1->m_type == SYM_FP_REGISTER64)
+	{
+		auto tmpIntRegister = CX86Assembler::rAX;
+		m_assembler.MovqVo(CX86Assembler::MakeRegisterAddress(tmpIntRegister), m_mdRegisters[src1->m_valueLow]);
+		src1Address = CX86Assembler::MakeRegisterAddress(tmpIntRegister);
+	}
+
+	BreakFpDependencySse(dstRegister);
+	m_assembler.Cvtsi2sdEq(dstRegister, src1Address);
+
+	CommitSymbolRegisterFp64Sse(dst, dstRegister);
+}
+
+template <bool isSigned>
+void CCodeGen_x86_64::Emit_Mul_Reg64AnyAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	//Extend both operands to 64 bits, the lower 64 bits of the product are then exact
+	auto loadOperand =
+	    [this](CX86Assembler::REGISTER registerId, CSymbol* symbol) {
+		    if(symbol->m_type == SYM_CONSTANT)
+		    {
+			    uint64 constant = isSigned ? static_cast<int64>(static_cast<int32>(symbol->m_valueLow)) : symbol->m_valueLow;
+			    m_assembler.MovIq(registerId, constant);
+		    }
+		    else if(isSigned)
+		    {
+			    m_assembler.MovsxdEq(registerId, MakeVariableSymbolAddress(symbol));
+		    }
+		    else
+		    {
+			    m_assembler.MovEd(registerId, MakeVariableSymbolAddress(symbol));
+		    }
+	    };
+
+	auto dstReg = PrepareSymbol64RegisterDef(dst, CX86Assembler::rAX);
+	loadOperand(CX86Assembler::rAX, src1);
+	loadOperand(CX86Assembler::rCX, src2);
+	m_assembler.ImulEq(CX86Assembler::rAX, CX86Assembler::MakeRegisterAddress(CX86Assembler::rCX));
+	m_assembler.MovEq(dstReg, CX86Assembler::MakeRegisterAddress(CX86Assembler::rAX));
+	CommitSymbol64Register(dst, dstReg);
+}
+
+template <bool isSigned>
+void CCodeGen_x86_64::Emit_Div_Reg64AnyAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstReg = PrepareSymbol64RegisterDef(dst, CX86Assembler::rAX);
+	auto divisorReg = PrepareSymbolRegisterUse(src2, CX86Assembler::rCX);
+	if(src1->m_type == SYM_CONSTANT)
+	{
+		m_assembler.MovId(CX86Assembler::rAX, src1->m_valueLow);
+	}
+	else
+	{
+		m_assembler.MovEd(CX86Assembler::rAX, MakeVariableSymbolAddress(src1));
+	}
+	if(isSigned)
+	{
+		m_assembler.Cdq();
+		m_assembler.IdivEd(CX86Assembler::MakeRegisterAddress(divisorReg));
+	}
+	else
+	{
+		m_assembler.XorEd(CX86Assembler::rDX, CX86Assembler::MakeRegisterAddress(CX86Assembler::rDX));
+		m_assembler.DivEd(CX86Assembler::MakeRegisterAddress(divisorReg));
+	}
+	//Quotient goes in the low part, remainder in the high part. 32-bit results have their upper halves cleared.
+	m_assembler.ShlEq(CX86Assembler::MakeRegisterAddress(CX86Assembler::rDX), 32);
+	m_assembler.OrEq(CX86Assembler::rDX, CX86Assembler::MakeRegisterAddress(CX86Assembler::rAX));
+	m_assembler.MovEq(dstReg, CX86Assembler::MakeRegisterAddress(CX86Assembler::rDX));
+	CommitSymbol64Register(dst, dstReg);
+}
+
+void CCodeGen_x86_64::Emit_ExtLow64VarReg64(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDef(dst, CX86Assembler::rAX);
+	m_assembler.MovEd(dstReg, MakeVariable64SymbolAddress(src1));
+	CommitSymbolRegister(dst, dstReg);
+}
+
+void CCodeGen_x86_64::Emit_ExtHigh64VarReg64(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDef(dst, CX86Assembler::rAX);
+	m_assembler.MovEq(dstReg, MakeVariable64SymbolAddress(src1));
+	m_assembler.ShrEq(CX86Assembler::MakeRegisterAddress(dstReg), 32);
+	CommitSymbolRegister(dst, dstReg);
+}
+
+void CCodeGen_x86_64::Emit_MergeTo64_Reg64AnyAny(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstReg = PrepareSymbol64RegisterDef(dst, CX86Assembler::rAX);
+	auto loReg = PrepareSymbolRegisterUse(src1, CX86Assembler::rCX);
+	auto hiReg = PrepareSymbolRegisterUse(src2, CX86Assembler::rDX);
+
+	//32-bit moves clear the upper half of the destination
+	m_assembler.MovEd(dstReg, CX86Assembler::MakeRegisterAddress(hiReg));
+	m_assembler.ShlEq(CX86Assembler::MakeRegisterAddress(dstReg), 32);
+	m_assembler.MovEd(CX86Assembler::rCX, CX86Assembler::MakeRegisterAddress(loReg));
+	m_assembler.OrEq(dstReg, CX86Assembler::MakeRegisterAddress(CX86Assembler::rCX));
+	CommitSymbol64Register(dst, dstReg);
 }
 
 // clang-format off
 #define ALU64_CONST_MATCHERS(ALUOP_CST, ALUOP) \
-	{ ALUOP_CST, MATCH_MEMORY64, MATCH_MEMORY64,   MATCH_MEMORY64,   MATCH_NIL, &CCodeGen_x86_64::Emit_Alu64_MemMemMem<ALUOP> }, \
-	{ ALUOP_CST, MATCH_MEMORY64, MATCH_MEMORY64,   MATCH_CONSTANT64, MATCH_NIL, &CCodeGen_x86_64::Emit_Alu64_MemMemCst<ALUOP> }, \
-	{ ALUOP_CST, MATCH_MEMORY64, MATCH_CONSTANT64, MATCH_MEMORY64,   MATCH_NIL, &CCodeGen_x86_64::Emit_Alu64_MemCstMem<ALUOP> },
+	{ ALUOP_CST, MATCH_VARIABLE64, MATCH_VARIABLE64, MATCH_VARIABLE64, MATCH_NIL, &CCodeGen_x86_64::Emit_Alu64_VarVarVar<ALUOP> }, \
+	{ ALUOP_CST, MATCH_VARIABLE64, MATCH_VARIABLE64, MATCH_CONSTANT64, MATCH_NIL, &CCodeGen_x86_64::Emit_Alu64_VarVarCst<ALUOP> }, \
+	{ ALUOP_CST, MATCH_VARIABLE64, MATCH_CONSTANT64, MATCH_VARIABLE64, MATCH_NIL, &CCodeGen_x86_64::Emit_Alu64_VarCstVar<ALUOP> },
 // clang-format on
 
 //SHIFTOP
 //-------------------------------------------------------------------
 
 template <typename SHIFTOP>
-void CCodeGen_x86_64::Emit_Shift64_RelRelReg(const STATEMENT& statement)
+void CCodeGen_x86_64::Emit_Shift64_VarVarVar(const STATEMENT& statement)
 {
 	CSymbol* dst = statement.dst->GetSymbol().get();
 	CSymbol* src1 = statement.src1->GetSymbol().get();
 	CSymbol* src2 = statement.src2->GetSymbol().get();
 
-	assert(dst->m_type == SYM_RELATIVE64);
-	assert(src1->m_type == SYM_RELATIVE64);
-	assert(src2->m_type == SYM_REGISTER);
-
-	CX86Assembler::REGISTER tmpReg = CX86Assembler::rAX;
 	CX86Assembler::REGISTER shiftReg = CX86Assembler::rCX;
 
-	m_assembler.MovEq(tmpReg, MakeRelative64SymbolAddress(src1));
-	m_assembler.MovEd(shiftReg, CX86Assembler::MakeRegisterAddress(m_registers[src2->m_valueLow]));
-	((m_assembler).*(SHIFTOP::OpVar()))(CX86Assembler::MakeRegisterAddress(tmpReg));
-	m_assembler.MovGq(MakeRelative64SymbolAddress(dst), tmpReg);
+	m_assembler.MovEd(shiftReg, MakeVariableSymbolAddress(src2));
+	auto dstReg = PrepareSymbol64RegisterDef(dst, CX86Assembler::rAX);
+	if(!(dst->IsRegister() && dst->Equals(src1)))
+	{
+		m_assembler.MovEq(dstReg, MakeVariable64SymbolAddress(src1));
+	}
+	((m_assembler).*(SHIFTOP::OpVar()))(CX86Assembler::MakeRegisterAddress(dstReg));
+	CommitSymbol64Register(dst, dstReg);
 }
 
 template <typename SHIFTOP>
-void CCodeGen_x86_64::Emit_Shift64_RelRelMem(const STATEMENT& statement)
+void CCodeGen_x86_64::Emit_Shift64_VarVarCst(const STATEMENT& statement)
 {
 	CSymbol* dst = statement.dst->GetSymbol().get();
 	CSymbol* src1 = statement.src1->GetSymbol().get();
 	CSymbol* src2 = statement.src2->GetSymbol().get();
 
-	assert(dst->m_type == SYM_RELATIVE64);
-	assert(src1->m_type == SYM_RELATIVE64);
+	assert(src2->m_type == SYM_CONSTANT);
 
-	CX86Assembler::REGISTER tmpReg = CX86Assembler::rAX;
-	CX86Assembler::REGISTER shiftReg = CX86Assembler::rCX;
+	if((statement.op == OP_SLL64) && (src2->m_valueLow == 1) && dst->IsRegister() && src1->IsRegister() && !dst->Equals(src1))
+	{
+		//x << 1 = x + x, doesn't need src1 to be copied in dst first
+		auto src1Register = m_registers[src1->m_valueLow];
+		m_assembler.LeaGq(m_registers[dst->m_valueLow], CX86Assembler::MakeBaseOffIndexScaleAddress(src1Register, 0, src1Register, 1));
+		return;
+	}
 
-	m_assembler.MovEq(tmpReg, MakeRelative64SymbolAddress(src1));
-	m_assembler.MovEd(shiftReg, MakeMemorySymbolAddress(src2));
-	((m_assembler).*(SHIFTOP::OpVar()))(CX86Assembler::MakeRegisterAddress(tmpReg));
-	m_assembler.MovGq(MakeRelative64SymbolAddress(dst), tmpReg);
+	auto dstReg = PrepareSymbol64RegisterDef(dst, CX86Assembler::rAX);
+	if(!(dst->IsRegister() && dst->Equals(src1)))
+	{
+		m_assembler.MovEq(dstReg, MakeVariable64SymbolAddress(src1));
+	}
+	((m_assembler).*(SHIFTOP::OpCst()))(CX86Assembler::MakeRegisterAddress(dstReg), static_cast<uint8>(src2->m_valueLow));
+	CommitSymbol64Register(dst, dstReg);
 }
 
 template <typename SHIFTOP>
-void CCodeGen_x86_64::Emit_Shift64_RelRelCst(const STATEMENT& statement)
+void CCodeGen_x86_64::Emit_Shift64_Bmi2_VarVarVar(const STATEMENT& statement)
 {
 	CSymbol* dst = statement.dst->GetSymbol().get();
 	CSymbol* src1 = statement.src1->GetSymbol().get();
 	CSymbol* src2 = statement.src2->GetSymbol().get();
 
-	assert(dst->m_type == SYM_RELATIVE64);
-	assert(src1->m_type == SYM_RELATIVE64);
-	assert(src2->m_type == SYM_CONSTANT);
+	auto amountReg = PrepareSymbolRegisterUse(src2, CX86Assembler::rCX);
+	auto dstReg = PrepareSymbol64RegisterDef(dst, CX86Assembler::rAX);
+	((m_assembler).*(SHIFTOP::OpVarBmi2()))(dstReg, MakeVariable64SymbolAddress(src1), amountReg);
+	CommitSymbol64Register(dst, dstReg);
+}
 
-	CX86Assembler::REGISTER tmpReg = CX86Assembler::rAX;
+template <typename SHIFTOP>
+void CCodeGen_x86_64::Emit_Rotate64_Bmi2_VarVarCst(const STATEMENT& statement)
+{
+	CSymbol* dst = statement.dst->GetSymbol().get();
+	CSymbol* src1 = statement.src1->GetSymbol().get();
+	CSymbol* src2 = statement.src2->GetSymbol().get();
+
+	assert(src2->m_type == SYM_CONSTANT);
 
-	m_assembler.MovEq(tmpReg, MakeRelative64SymbolAddress(src1));
-	((m_assembler).*(SHIFTOP::OpCst()))(CX86Assembler::MakeRegisterAddress(tmpReg), static_cast<uint8>(src2->m_valueLow));
-	m_assembler.MovGq(MakeRelative64SymbolAddress(dst), tmpReg);
+	auto dstReg = PrepareSymbol64RegisterDef(dst, CX86Assembler::rAX);
+	m_assembler.RorxEq(dstReg, MakeVariable64SymbolAddress(src1), SHIFTOP::RorxAmount(static_cast<uint8>(src2->m_valueLow)));
+	CommitSymbol64Register(dst, dstReg);
 }
 
 // clang-format off
 #define SHIFT64_CONST_MATCHERS(SHIFTOP_CST, SHIFTOP) \
-	{ SHIFTOP_CST, MATCH_RELATIVE64, MATCH_RELATIVE64, MATCH_REGISTER, MATCH_NIL, &CCodeGen_x86_64::Emit_Shift64_RelRelReg<SHIFTOP> }, \
-	{ SHIFTOP_CST, MATCH_RELATIVE64, MATCH_RELATIVE64, MATCH_MEMORY,   MATCH_NIL, &CCodeGen_x86_64::Emit_Shift64_RelRelMem<SHIFTOP> }, \
-	{ SHIFTOP_CST, MATCH_RELATIVE64, MATCH_RELATIVE64, MATCH_CONSTANT, MATCH_NIL, &CCodeGen_x86_64::Emit_Shift64_RelRelCst<SHIFTOP> },
+	{ SHIFTOP_CST, MATCH_VARIABLE64, MATCH_VARIABLE64, MATCH_VARIABLE, MATCH_NIL, &CCodeGen_x86_64::Emit_Shift64_VarVarVar<SHIFTOP> }, \
+	{ SHIFTOP_CST, MATCH_VARIABLE64, MATCH_VARIABLE64, MATCH_CONSTANT, MATCH_NIL, &CCodeGen_x86_64::Emit_Shift64_VarVarCst<SHIFTOP> },
 
 CCodeGen_x86_64::CONSTMATCHER CCodeGen_x86_64::g_constMatchers[] = 
 {
@@ -200,6 +497,7 @@ CCodeGen_x86_64::CONSTMATCHER CCodeGen_x86_64::g_constMatchers[] =
 	{ OP_PARAM, MATCH_NIL, MATCH_REGISTER,    MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_Param_Reg    },
 	{ OP_PARAM, MATCH_NIL, MATCH_MEMORY,      MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_Param_Mem    },
 	{ OP_PARAM, MATCH_NIL, MATCH_CONSTANT,    MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_Param_Cst    },
+	{ OP_PARAM, MATCH_NIL, MATCH_REGISTER64,  MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_Param_Reg64  },
 	{ OP_PARAM, MATCH_NIL, MATCH_MEMORY64,    MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_Param_Mem64  },
 	{ OP_PARAM, MATCH_NIL, MATCH_CONSTANT64,  MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_Param_Cst64  },
 	{ OP_PARAM, MATCH_NIL, MATCH_REGISTER128, MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_Param_Reg128 },
@@ -211,6 +509,7 @@ CCodeGen_x86_64::CONSTMATCHER CCodeGen_x86_64::g_constMatchers[] =
 
 	{ OP_RETVAL, MATCH_REGISTER,    MATCH_NIL, MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_RetVal_Reg    },
 	{ OP_RETVAL, MATCH_MEMORY,      MATCH_NIL, MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_RetVal_Mem    },
+	{ OP_RETVAL, MATCH_REGISTER64,  MATCH_NIL, MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_RetVal_Reg64  },
 	{ OP_RETVAL, MATCH_MEMORY64,    MATCH_NIL, MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_RetVal_Mem64  },
 	{ OP_RETVAL, MATCH_REGISTER128, MATCH_NIL, MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_RetVal_Reg128 },
 	{ OP_RETVAL, MATCH_MEMORY128,   MATCH_NIL, MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_RetVal_Mem128 },
@@ -218,8 +517,8 @@ CCodeGen_x86_64::CONSTMATCHER CCodeGen_x86_64::g_constMatchers[] =
 	{ OP_EXTERNJMP,     MATCH_NIL, MATCH_CONSTANTPTR, MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_ExternJmp },
 	{ OP_EXTERNJMP_DYN, MATCH_NIL, MATCH_CONSTANTPTR, MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_ExternJmp },
 
-	{ OP_MOV, MATCH_MEMORY64,   MATCH_MEMORY64,   MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_Mov_Mem64Mem64 },
-	{ OP_MOV, MATCH_RELATIVE64, MATCH_CONSTANT64, MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_Mov_Rel64Cst64 },
+	{ OP_MOV, MATCH_VARIABLE64, MATCH_VARIABLE64, MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_Mov_Var64Var64 },
+	{ OP_MOV, MATCH_VARIABLE64, MATCH_CONSTANT64, MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_Mov_Var64Cst64 },
 
 	{ OP_MOV, MATCH_REG_REF, MATCH_MEM_REF, MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_Mov_RegRefMemRef },
 	{ OP_MOV, MATCH_MEM_REF, MATCH_REG_REF, MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_Mov_MemRefRegRef },
@@ -227,16 +526,44 @@ CCodeGen_x86_64::CONSTMATCHER CCodeGen_x86_64::g_constMatchers[] =
 	ALU64_CONST_MATCHERS(OP_ADD64, ALUOP64_ADD)
 	ALU64_CONST_MATCHERS(OP_SUB64, ALUOP64_SUB)
 	ALU64_CONST_MATCHERS(OP_AND64, ALUOP64_AND)
+	ALU64_CONST_MATCHERS(OP_OR64,  ALUOP64_OR)
+	ALU64_CONST_MATCHERS(OP_XOR64, ALUOP64_XOR)
+
+	{ OP_NOT64, MATCH_VARIABLE64, MATCH_VARIABLE64, MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_Not64_VarVar },
+
+	{ OP_BSWAP64, MATCH_VARIABLE64, MATCH_VARIABLE64, MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_Bswap64_VarVar },
+
+	{ OP_MUL64, MATCH_VARIABLE64, MATCH_VARIABLE64, MATCH_VARIABLE64, MATCH_NIL, &CCodeGen_x86_64::Emit_Mul64_VarVarAny },
+	{ OP_MUL64, MATCH_VARIABLE64, MATCH_VARIABLE64, MATCH_CONSTANT64, MATCH_NIL, &CCodeGen_x86_64::Emit_Mul64_VarVarAny },
+
+	{ OP_DIV64,  MATCH_VARIABLE64, MATCH_ANY, MATCH_ANY, MATCH_NIL, &CCodeGen_x86_64::Emit_Div64_VarAnyAny<false> },
+	{ OP_DIVS64, MATCH_VARIABLE64, MATCH_ANY, MATCH_ANY, MATCH_NIL, &CCodeGen_x86_64::Emit_Div64_VarAnyAny<true>  },
+
+	{ OP_SELECT64, MATCH_VARIABLE64, MATCH_VARIABLE, MATCH_ANY, MATCH_ANY, &CCodeGen_x86_64::Emit_Select64_VarVarAnyAny },
+
+	{ OP_FP_TOINT64_TRUNC_D, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_Fp_ToInt64TruncD_VarVar },
+	{ OP_FP_TODOUBLE_I64,    MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_Fp_ToDoubleI64_VarVar   },
+
+	{ OP_MUL,  MATCH_REGISTER64, MATCH_ANY32, MATCH_ANY32, MATCH_NIL, &CCodeGen_x86_64::Emit_Mul_Reg64AnyAny<false> },
+	{ OP_MULS, MATCH_REGISTER64, MATCH_ANY32, MATCH_ANY32, MATCH_NIL, &CCodeGen_x86_64::Emit_Mul_Reg64AnyAny<true>  },
+	{ OP_DIV,  MATCH_REGISTER64, MATCH_ANY32, MATCH_ANY32, MATCH_NIL, &CCodeGen_x86_64::Emit_Div_Reg64AnyAny<false> },
+	{ OP_DIVS, MATCH_REGISTER64, MATCH_ANY32, MATCH_ANY32, MATCH_NIL, &CCodeGen_x86_64::Emit_Div_Reg64AnyAny<true>  },
+
+	{ OP_EXTLOW64,  MATCH_VARIABLE,   MATCH_REGISTER64, MATCH_NIL,   MATCH_NIL, &CCodeGen_x86_64::Emit_ExtLow64VarReg64       },
+	{ OP_EXTHIGH64, MATCH_VARIABLE,   MATCH_REGISTER64, MATCH_NIL,   MATCH_NIL, &CCodeGen_x86_64::Emit_ExtHigh64VarReg64      },
+	{ OP_MERGETO64, MATCH_REGISTER64, MATCH_ANY32,      MATCH_ANY32, MATCH_NIL, &CCodeGen_x86_64::Emit_MergeTo64_Reg64AnyAny },
 
 	SHIFT64_CONST_MATCHERS(OP_SLL64, SHIFTOP64_SLL)
 	SHIFT64_CONST_MATCHERS(OP_SRL64, SHIFTOP64_SRL)
 	SHIFT64_CONST_MATCHERS(OP_SRA64, SHIFTOP64_SRA)
+	SHIFT64_CONST_MATCHERS(OP_ROTL64, SHIFTOP64_ROL)
+	SHIFT64_CONST_MATCHERS(OP_ROTR64, SHIFTOP64_ROR)
 
 	{ OP_CMP, MATCH_VARIABLE, MATCH_VARIABLE, MATCH_VARIABLE, MATCH_NIL, &CCodeGen_x86_64::Emit_Cmp_VarVarVar },
 	{ OP_CMP, MATCH_VARIABLE, MATCH_VARIABLE, MATCH_CONSTANT, MATCH_NIL, &CCodeGen_x86_64::Emit_Cmp_VarVarCst },
 
-	{ OP_CMP64, MATCH_VARIABLE, MATCH_MEMORY64, MATCH_MEMORY64,   MATCH_NIL, &CCodeGen_x86_64::Emit_Cmp64_VarMemMem },
-	{ OP_CMP64, MATCH_VARIABLE, MATCH_MEMORY64, MATCH_CONSTANT64, MATCH_NIL, &CCodeGen_x86_64::Emit_Cmp64_VarMemCst },
+	{ OP_CMP64, MATCH_VARIABLE, MATCH_VARIABLE64, MATCH_VARIABLE64, MATCH_NIL, &CCodeGen_x86_64::Emit_Cmp64_VarVarVar },
+	{ OP_CMP64, MATCH_VARIABLE, MATCH_VARIABLE64, MATCH_CONSTANT64, MATCH_NIL, &CCodeGen_x86_64::Emit_Cmp64_VarVarCst },
 
 	{ OP_RELTOREF, MATCH_VAR_REF, MATCH_CONSTANT, MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_RelToRef_VarCst },
 
@@ -245,16 +572,16 @@ CCodeGen_x86_64::CONSTMATCHER CCodeGen_x86_64::g_constMatchers[] =
 
 	{ OP_ISREFNULL, MATCH_VARIABLE, MATCH_VAR_REF, MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_IsRefNull_VarVar },
 
-	{ OP_LOADFROMREF, MATCH_MEMORY64, MATCH_VAR_REF, MATCH_NIL,   MATCH_NIL, &CCodeGen_x86_64::Emit_LoadFromRef_64_MemVar },
-	{ OP_LOADFROMREF, MATCH_MEMORY64, MATCH_VAR_REF, MATCH_ANY32, MATCH_NIL, &CCodeGen_x86_64::Emit_LoadFromRef_64_MemVarAny },
+	{ OP_LOADFROMREF, MATCH_VARIABLE64, MATCH_VAR_REF, MATCH_NIL,   MATCH_NIL, &CCodeGen_x86_64::Emit_LoadFromRef_64_VarVar },
+	{ OP_LOADFROMREF, MATCH_VARIABLE64, MATCH_VAR_REF, MATCH_ANY32, MATCH_NIL, &CCodeGen_x86_64::Emit_LoadFromRef_64_VarVarAny },
 
 	{ OP_LOADFROMREF, MATCH_VAR_REF, MATCH_VAR_REF, MATCH_NIL,   MATCH_NIL, &CCodeGen_x86_64::Emit_LoadFromRef_Ref_VarVar },
 	{ OP_LOADFROMREF, MATCH_VAR_REF, MATCH_VAR_REF, MATCH_ANY32, MATCH_NIL, &CCodeGen_x86_64::Emit_LoadFromRef_Ref_VarVarAny },
 
-	{ OP_STOREATREF, MATCH_NIL, MATCH_VAR_REF, MATCH_MEMORY64, MATCH_NIL, &CCodeGen_x86_64::Emit_StoreAtRef_64_VarMem },
+	{ OP_STOREATREF, MATCH_NIL, MATCH_VAR_REF, MATCH_VARIABLE64, MATCH_NIL, &CCodeGen_x86_64::Emit_StoreAtRef_64_VarVar },
 	{ OP_STOREATREF, MATCH_NIL, MATCH_VAR_REF, MATCH_CONSTANT64, MATCH_NIL, &CCodeGen_x86_64::Emit_StoreAtRef_64_VarCst },
 
-	{ OP_STOREATREF, MATCH_NIL, MATCH_VAR_REF, MATCH_ANY32, MATCH_MEMORY64, &CCodeGen_x86_64::Emit_StoreAtRef_64_VarAnyMem },
+	{ OP_STOREATREF, MATCH_NIL, MATCH_VAR_REF, MATCH_ANY32, MATCH_VARIABLE64, &CCodeGen_x86_64::Emit_StoreAtRef_64_VarAnyVar },
 	{ OP_STOREATREF, MATCH_NIL, MATCH_VAR_REF, MATCH_ANY32, MATCH_CONSTANT64, &CCodeGen_x86_64::Emit_StoreAtRef_64_VarAnyCst },
 
 	{ OP_STORE8ATREF, MATCH_NIL, MATCH_VAR_REF, MATCH_VARIABLE, MATCH_NIL,      &CCodeGen_x86_64::Emit_Store8AtRef_VarVar },
@@ -262,6 +589,20 @@ CCodeGen_x86_64::CONSTMATCHER CCodeGen_x86_64::g_constMatchers[] =
 
 	{ OP_CONDJMP, MATCH_NIL, MATCH_VAR_REF, MATCH_CONSTANT, MATCH_NIL, &CCodeGen_x86_64::Emit_CondJmp_Ref_VarCst },
 
+	{ OP_JMPTABLE, MATCH_NIL, MATCH_VARIABLE, MATCH_NIL, MATCH_NIL, &CCodeGen_x86_64::Emit_JmpTable_Var },
+
+	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
+};
+
+CCodeGen_x86_64::CONSTMATCHER CCodeGen_x86_64::g_bmi2ConstMatchers[] =
+{
+	{ OP_SLL64, MATCH_VARIABLE64, MATCH_VARIABLE64, MATCH_VARIABLE, MATCH_NIL, &CCodeGen_x86_64::Emit_Shift64_Bmi2_VarVarVar<SHIFTOP64_SLL> },
+	{ OP_SRL64, MATCH_VARIABLE64, MATCH_VARIABLE64, MATCH_VARIABLE, MATCH_NIL, &CCodeGen_x86_64::Emit_Shift64_Bmi2_VarVarVar<SHIFTOP64_SRL> },
+	{ OP_SRA64, MATCH_VARIABLE64, MATCH_VARIABLE64, MATCH_VARIABLE, MATCH_NIL, &CCodeGen_x86_64::Emit_Shift64_Bmi2_VarVarVar<SHIFTOP64_SRA> },
+
+	{ OP_ROTL64, MATCH_VARIABLE64, MATCH_VARIABLE64, MATCH_CONSTANT, MATCH_NIL, &CCodeGen_x86_64::Emit_Rotate64_Bmi2_VarVarCst<SHIFTOP64_ROL> },
+	{ OP_ROTR64, MATCH_VARIABLE64, MATCH_VARIABLE64, MATCH_CONSTANT, MATCH_NIL, &CCodeGen_x86_64::Emit_Rotate64_Bmi2_VarVarCst<SHIFTOP64_ROR> },
+
 	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
 };
 // clang-format on
@@ -271,8 +612,19 @@ CCodeGen_x86_64::CCodeGen_x86_64(CX86CpuFeatures features)
 {
 	SetPlatformAbi(PLATFORM_ABI_SYSTEMV);
 	CCodeGen_x86::m_mdRegisters = g_mdRegisters;
+	CCodeGen_x86::m_mdTempRegisters = g_mdTempRegisters;
+
+	if(features.hasBmi2)
+	{
+		InsertMatchers(g_bmi2ConstMatchers);
+	}
+
+	InsertMatchers(g_constMatchers);
+}
 
-	for(CONSTMATCHER* constMatcher = g_constMatchers; constMatcher->emitter != NULL; constMatcher++)
+void CCodeGen_x86_64::InsertMatchers(const CONSTMATCHER* constMatchers)
+{
+	for(auto* constMatcher = constMatchers; constMatcher->emitter != nullptr; constMatcher++)
 	{
 		MATCHER matcher;
 		matcher.op = constMatcher->op;
@@ -294,6 +646,7 @@ void CCodeGen_x86_64::SetPlatformAbi(PLATFORM_ABI platformAbi)
 		CCodeGen_x86::m_registers = g_systemVRegisters;
 		m_paramRegs = g_systemVParamRegs;
 		m_maxRegisters = SYSTEMV_MAX_REGISTERS;
+		m_maxCallerSavedRegisters = SYSTEMV_MAX_CALLER_SAVED_REGISTERS;
 		m_maxParams = SYSTEMV_MAX_PARAMS;
 		m_hasMdRegRetValues = true;
 		break;
@@ -301,6 +654,7 @@ void CCodeGen_x86_64::SetPlatformAbi(PLATFORM_ABI platformAbi)
 		CCodeGen_x86::m_registers = g_win32Registers;
 		m_paramRegs = g_win32ParamRegs;
 		m_maxRegisters = WIN32_MAX_REGISTERS;
+		m_maxCallerSavedRegisters = WIN32_MAX_CALLER_SAVED_REGISTERS;
 		m_maxParams = WIN32_MAX_PARAMS;
 		m_hasMdRegRetValues = false;
 		break;
@@ -315,16 +669,31 @@ unsigned int CCodeGen_x86_64::GetAvailableRegisterCount() const
 	return m_maxRegisters;
 }
 
+unsigned int CCodeGen_x86_64::GetAvailableCallerSavedRegisterCount() const
+{
+	return m_maxCallerSavedRegisters;
+}
+
 unsigned int CCodeGen_x86_64::GetAvailableMdRegisterCount() const
 {
 	return MAX_MDREGISTERS;
 }
 
+bool CCodeGen_x86_64::IsHelperCall(const STATEMENT&) const
+{
+	return false;
+}
+
 bool CCodeGen_x86_64::CanHold128BitsReturnValueInRegisters() const
 {
 	return m_hasMdRegRetValues;
 }
 
+bool CCodeGen_x86_64::Has64BitsRegisters() const
+{
+	return true;
+}
+
 uint32 CCodeGen_x86_64::GetPointerSize() const
 {
 	return 8;
@@ -336,6 +705,7 @@ void CCodeGen_x86_64::Emit_Prolog(const StatementList& statements, unsigned int
 
 	//Compute the size needed to store all function call parameters
 	uint32 maxParamSpillSize = 0;
+	bool hasCalls = false;
 	{
 		uint32 currParamSpillSize = 0;
 		for(const auto& statement : statements)
@@ -359,6 +729,7 @@ void CCodeGen_x86_64::Emit_Prolog(const StatementList& statements, unsigned int
 			case OP_CALL:
 				maxParamSpillSize = std::max<uint32>(currParamSpillSize, maxParamSpillSize);
 				currParamSpillSize = 0;
+				hasCalls = true;
 				break;
 			default:
 				break;
@@ -382,15 +753,25 @@ void CCodeGen_x86_64::Emit_Prolog(const StatementList& statements, unsigned int
 		}
 	}
 
+	//Leaf functions don't need the callee's param spill area and, if they
+	//don't have any temporaries either, don't need a stack frame at all
+	uint32 calleeSpillSize = hasCalls ? 0x20 : 0;
 	uint32 savedRegAlignAdjust = (savedSize != 0) ? (0x10 - (savedSize & 0xF)) : 0;
 
 	m_totalStackAlloc = savedRegAlignAdjust + maxParamSpillSize + stackSize;
-	m_totalStackAlloc += 0x20;
+	m_totalStackAlloc += calleeSpillSize;
+	if(!hasCalls && (stackSize == 0))
+	{
+		m_totalStackAlloc = 0;
+	}
 
-	m_stackLevel = 0x20;
-	m_paramSpillBase = 0x20 + stackSize;
+	m_stackLevel = calleeSpillSize;
+	m_paramSpillBase = calleeSpillSize + stackSize;
 
-	m_assembler.SubIq(CX86Assembler::MakeRegisterAddress(CX86Assembler::rSP), m_totalStackAlloc);
+	if(m_totalStackAlloc != 0)
+	{
+		m_assembler.SubIq(CX86Assembler::MakeRegisterAddress(CX86Assembler::rSP), m_totalStackAlloc);
+	}
 
 	//-------------------------------
 	//Stack Frame
@@ -403,14 +784,17 @@ void CCodeGen_x86_64::Emit_Prolog(const StatementList& statements, unsigned int
 	//------------------			<----- rSP + m_paramSpillBase
 	//Temporary symbols (stackSize) + align adjustment
 	//------------------			<----- rSP + m_stackLevel
-	//Param spill area for callee (0x20 bytes)
+	//Param spill area for callee (0x20 bytes, none in leaf functions)
 	//------------------			<----- rSP
 	//(Low address)
 }
 
 void CCodeGen_x86_64::Emit_Epilog()
 {
-	m_assembler.AddIq(CX86Assembler::MakeRegisterAddress(CX86Assembler::rSP), m_totalStackAlloc);
+	if(m_totalStackAlloc != 0)
+	{
+		m_assembler.AddIq(CX86Assembler::MakeRegisterAddress(CX86Assembler::rSP), m_totalStackAlloc);
+	}
 
 	for(int i = m_maxRegisters - 1; i >= 0; i--)
 	{
@@ -423,7 +807,44 @@ void CCodeGen_x86_64::Emit_Epilog()
 	m_assembler.Pop(CX86Assembler::rBP);
 }
 
-CX86Assembler::CAddress CCodeGen_x86_64::MakeConstant128Address(const LITERAL128& constant)
+void CCodeGen_x86_64::LoadSymbol64InRegister(CX86Assembler::REGISTER registerId, CSymbol* symbol)
+{
+	if(symbol->m_type == SYM_CONSTANT64)
+	{
+		m_assembler.MovIq(registerId, symbol->GetConstant64());
+	}
+	else
+	{
+		m_assembler.MovEq(registerId, MakeVariable64SymbolAddress(symbol));
+	}
+}
+
+CX86Assembler::CAddress CCodeGen_x86_64::MakeSymbol64Address(CSymbol* symbol, CX86Assembler::REGISTER cstRegister)
+{
+	if(symbol->m_type == SYM_CONSTANT64)
+	{
+		m_assembler.MovIq(cstRegister, symbol->GetConstant64());
+		return CX86Assembler::MakeRegisterAddress(cstRegister);
+	}
+	else
+	{
+		return MakeVariable64SymbolAddress(symbol);
+	}
+}
+
+CX86Assembler::CAddress CCodeGen_x86_64::MakeVariable64SymbolAddress(CSymbol* symbol)
+{
+	if(symbol->m_type == SYM_REGISTER64)
+	{
+		return CX86Assembler::MakeRegisterAddress(m_registers[symbol->m_valueLow]);
+	}
+	else
+	{
+		return MakeMemory64SymbolAddress(symbol);
+	}
+}
+
+CX86Assembler::CAddress CCodeGen_x86_64::MakeConstant128MemoryAddress(const LITERAL128& constant)
 {
 	auto literalId = m_assembler.CreateLiteral128(constant);
 	return CX86Assembler::MakeLiteral128Address(literalId);
@@ -479,6 +900,19 @@ void CCodeGen_x86_64::Emit_Param_Cst(const STATEMENT& statement)
 	    });
 }
 
+void CCodeGen_x86_64::Emit_Param_Reg64(const STATEMENT& statement)
+{
+	assert(m_params.size() < m_maxParams);
+
+	auto src1 = statement.src1->GetSymbol().get();
+
+	m_params.push_back(
+	    [this, src1](CX86Assembler::REGISTER paramReg, uint32) {
+		    m_assembler.MovEq(paramReg, CX86Assembler::MakeRegisterAddress(m_registers[src1->m_valueLow]));
+		    return 0;
+	    });
+}
+
 void CCodeGen_x86_64::Emit_Param_Mem64(const STATEMENT& statement)
 {
 	assert(m_params.size() < m_maxParams);
@@ -570,6 +1004,15 @@ void CCodeGen_x86_64::Emit_RetVal_Mem(const STATEMENT& statement)
 	m_assembler.MovGd(MakeMemorySymbolAddress(dst), CX86Assembler::rAX);
 }
 
+void CCodeGen_x86_64::Emit_RetVal_Reg64(const STATEMENT& statement)
+{
+	CSymbol* dst = statement.dst->GetSymbol().get();
+
+	assert(dst->m_type == SYM_REGISTER64);
+
+	m_assembler.MovEq(m_registers[dst->m_valueLow], CX86Assembler::MakeRegisterAddress(CX86Assembler::rAX));
+}
+
 void CCodeGen_x86_64::Emit_RetVal_Mem64(const STATEMENT& statement)
 {
 	CSymbol* dst = statement.dst->GetSymbol().get();
@@ -606,21 +1049,35 @@ void CCodeGen_x86_64::Emit_ExternJmp(const STATEMENT& statement)
 	m_assembler.JmpEd(CX86Assembler::MakeRegisterAddress(CX86Assembler::rAX));
 }
 
-void CCodeGen_x86_64::Emit_Mov_Mem64Mem64(const STATEMENT& statement)
+void CCodeGen_x86_64::Emit_Mov_Var64Var64(const STATEMENT& statement)
 {
 	CSymbol* dst = statement.dst->GetSymbol().get();
 	CSymbol* src1 = statement.src1->GetSymbol().get();
 
-	m_assembler.MovEq(CX86Assembler::rAX, MakeMemory64SymbolAddress(src1));
-	m_assembler.MovGq(MakeMemory64SymbolAddress(dst), CX86Assembler::rAX);
+	if(dst->IsRegister())
+	{
+		m_assembler.MovEq(m_registers[dst->m_valueLow], MakeVariable64SymbolAddress(src1));
+	}
+	else
+	{
+		auto src1Reg = PrepareSymbol64RegisterUse(src1, CX86Assembler::rAX);
+		m_assembler.MovGq(MakeMemory64SymbolAddress(dst), src1Reg);
+	}
 }
 
-void CCodeGen_x86_64::Emit_Mov_Rel64Cst64(const STATEMENT& statement)
+void CCodeGen_x86_64::Emit_Mov_Var64Cst64(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
 	auto src1 = statement.src1->GetSymbol().get();
 
-	WriteConstant64ToAddress(MakeRelative64SymbolAddress(dst), CX86Assembler::rAX, src1->GetConstant64());
+	if(dst->IsRegister())
+	{
+		m_assembler.MovIq(m_registers[dst->m_valueLow], src1->GetConstant64());
+	}
+	else
+	{
+		WriteConstant64ToAddress(MakeMemory64SymbolAddress(dst), CX86Assembler::rAX, src1->GetConstant64());
+	}
 }
 
 void CCodeGen_x86_64::Emit_Mov_RegRefMemRef(const STATEMENT& statement)
@@ -674,7 +1131,7 @@ void CCodeGen_x86_64::Emit_Cmp_VarVarCst(const STATEMENT& statement)
 	CommitSymbolRegister(dst, dstReg);
 }
 
-void CCodeGen_x86_64::Emit_Cmp64_VarMemMem(const STATEMENT& statement)
+void CCodeGen_x86_64::Emit_Cmp64_VarVarVar(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
 	auto src1 = statement.src1->GetSymbol().get();
@@ -683,16 +1140,15 @@ void CCodeGen_x86_64::Emit_Cmp64_VarMemMem(const STATEMENT& statement)
 	auto dstReg = PrepareSymbolRegisterDef(dst, CX86Assembler::rAX);
 	m_assembler.XorEd(dstReg, CX86Assembler::MakeRegisterAddress(dstReg));
 
-	auto tmpReg = CX86Assembler::rCX;
-	m_assembler.MovEq(tmpReg, MakeMemory64SymbolAddress(src1));
-	m_assembler.CmpEq(tmpReg, MakeMemory64SymbolAddress(src2));
+	auto src1Reg = PrepareSymbol64RegisterUse(src1, CX86Assembler::rCX);
+	m_assembler.CmpEq(src1Reg, MakeVariable64SymbolAddress(src2));
 
 	Cmp_GetFlag(CX86Assembler::MakeRegisterAddress(dstReg), statement.jmpCondition);
 
 	CommitSymbolRegister(dst, dstReg);
 }
 
-void CCodeGen_x86_64::Emit_Cmp64_VarMemCst(const STATEMENT& statement)
+void CCodeGen_x86_64::Emit_Cmp64_VarVarCst(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
 	auto src1 = statement.src1->GetSymbol().get();
@@ -705,21 +1161,20 @@ void CCodeGen_x86_64::Emit_Cmp64_VarMemCst(const STATEMENT& statement)
 
 	m_assembler.XorEd(dstReg, CX86Assembler::MakeRegisterAddress(dstReg));
 
-	auto tmpReg = CX86Assembler::rCX;
-	m_assembler.MovEq(tmpReg, MakeMemory64SymbolAddress(src1));
+	auto src1Reg = PrepareSymbol64RegisterUse(src1, CX86Assembler::rCX);
 	if(constant == 0)
 	{
-		m_assembler.TestEq(tmpReg, CX86Assembler::MakeRegisterAddress(tmpReg));
+		m_assembler.TestEq(src1Reg, CX86Assembler::MakeRegisterAddress(src1Reg));
 	}
 	else if(CX86Assembler::GetMinimumConstantSize64(constant) == 8)
 	{
 		auto cstReg = CX86Assembler::rDX;
 		m_assembler.MovIq(cstReg, constant);
-		m_assembler.CmpEq(tmpReg, CX86Assembler::MakeRegisterAddress(cstReg));
+		m_assembler.CmpEq(src1Reg, CX86Assembler::MakeRegisterAddress(cstReg));
 	}
 	else
 	{
-		m_assembler.CmpIq(CX86Assembler::MakeRegisterAddress(tmpReg), constant);
+		m_assembler.CmpIq(CX86Assembler::MakeRegisterAddress(src1Reg), constant);
 	}
 
 	Cmp_GetFlag(CX86Assembler::MakeRegisterAddress(dstReg), statement.jmpCondition);
@@ -792,28 +1247,28 @@ void CCodeGen_x86_64::Emit_IsRefNull_VarVar(const STATEMENT& statement)
 	CommitSymbolRegister(dst, dstReg);
 }
 
-void CCodeGen_x86_64::Emit_LoadFromRef_64_MemVar(const STATEMENT& statement)
+void CCodeGen_x86_64::Emit_LoadFromRef_64_VarVar(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
 	auto src1 = statement.src1->GetSymbol().get();
 
 	auto addressReg = PrepareRefSymbolRegisterUse(src1, CX86Assembler::rAX);
-	auto dstReg = CX86Assembler::rCX;
+	auto dstReg = PrepareSymbol64RegisterDef(dst, CX86Assembler::rCX);
 
 	m_assembler.MovEq(dstReg, CX86Assembler::MakeIndRegAddress(addressReg));
-	m_assembler.MovGq(MakeMemory64SymbolAddress(dst), dstReg);
+	CommitSymbol64Register(dst, dstReg);
 }
 
-void CCodeGen_x86_64::Emit_LoadFromRef_64_MemVarAny(const STATEMENT& statement)
+void CCodeGen_x86_64::Emit_LoadFromRef_64_VarVarAny(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
 	auto src1 = statement.src1->GetSymbol().get();
 	auto src2 = statement.src2->GetSymbol().get();
 	uint8 scale = static_cast<uint8>(statement.jmpCondition);
 
-	auto dstReg = CX86Assembler::rDX;
+	auto dstReg = PrepareSymbol64RegisterDef(dst, CX86Assembler::rDX);
 	m_assembler.MovEq(dstReg, MakeRefBaseScaleSymbolAddress(src1, CX86Assembler::rAX, src2, CX86Assembler::rCX, scale));
-	m_assembler.MovGq(MakeMemory64SymbolAddress(dst), dstReg);
+	CommitSymbol64Register(dst, dstReg);
 }
 
 void CCodeGen_x86_64::Emit_LoadFromRef_Ref_VarVar(const STATEMENT& statement)
@@ -843,15 +1298,14 @@ void CCodeGen_x86_64::Emit_LoadFromRef_Ref_VarVarAny(const STATEMENT& statement)
 	CommitRefSymbolRegister(dst, dstReg);
 }
 
-void CCodeGen_x86_64::Emit_StoreAtRef_64_VarMem(const STATEMENT& statement)
+void CCodeGen_x86_64::Emit_StoreAtRef_64_VarVar(const STATEMENT& statement)
 {
 	auto src1 = statement.src1->GetSymbol().get();
 	auto src2 = statement.src2->GetSymbol().get();
 
 	auto addressReg = PrepareRefSymbolRegisterUse(src1, CX86Assembler::rAX);
-	auto valueReg = CX86Assembler::rDX;
+	auto valueReg = PrepareSymbol64RegisterUse(src2, CX86Assembler::rDX);
 
-	m_assembler.MovEq(valueReg, MakeMemory64SymbolAddress(src2));
 	m_assembler.MovGq(CX86Assembler::MakeIndRegAddress(addressReg), valueReg);
 }
 
@@ -864,18 +1318,15 @@ void CCodeGen_x86_64::Emit_StoreAtRef_64_VarCst(const STATEMENT& statement)
 	WriteConstant64ToAddress(CX86Assembler::MakeIndRegAddress(addressReg), CX86Assembler::rDX, src2->GetConstant64());
 }
 
-void CCodeGen_x86_64::Emit_StoreAtRef_64_VarAnyMem(const STATEMENT& statement)
+void CCodeGen_x86_64::Emit_StoreAtRef_64_VarAnyVar(const STATEMENT& statement)
 {
 	auto src1 = statement.src1->GetSymbol().get();
 	auto src2 = statement.src2->GetSymbol().get();
 	auto src3 = statement.src3->GetSymbol().get();
 	uint8 scale = static_cast<uint8>(statement.jmpCondition);
 
-	assert((scale == 1) || (scale == 8));
+	auto valueReg = PrepareSymbol64RegisterUse(src3, CX86Assembler::rDX);
 
-	auto valueReg = CX86Assembler::rDX;
-
-	m_assembler.MovEq(valueReg, MakeMemory64SymbolAddress(src3));
 	m_assembler.MovGq(MakeRefBaseScaleSymbolAddress(src1, CX86Assembler::rAX, src2, CX86Assembler::rCX, scale), valueReg);
 }
 
@@ -886,8 +1337,6 @@ void CCodeGen_x86_64::Emit_StoreAtRef_64_VarAnyCst(const STATEMENT& statement)
 	auto src3 = statement.src3->GetSymbol().get();
 	uint8 scale = static_cast<uint8>(statement.jmpCondition);
 
-	assert((scale == 1) || (scale == 8));
-
 	WriteConstant64ToAddress(MakeRefBaseScaleSymbolAddress(src1, CX86Assembler::rAX, src2, CX86Assembler::rCX, scale),
 	                         CX86Assembler::rDX, src3->GetConstant64());
 }
@@ -929,6 +1378,30 @@ void CCodeGen_x86_64::Emit_CondJmp_Ref_VarCst(const STATEMENT& statement)
 	CondJmp_JumpTo(GetLabel(statement.jmpBlock), statement.jmpCondition);
 }
 
+void CCodeGen_x86_64::Emit_JmpTable_Var(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto tableLabel = m_assembler.CreateLabel();
+
+	//Table entries are offsets relative to the start of the table. Its address is taken
+	//first since the assembler needs label distance references to come before jumps
+	m_assembler.LeaGq(CX86Assembler::rCX, tableLabel);
+	m_assembler.MovEd(CX86Assembler::rAX, MakeVariableSymbolAddress(src1));
+	m_assembler.CmpId(CX86Assembler::MakeRegisterAddress(CX86Assembler::rAX), static_cast<uint32>(statement.jmpTable->size()));
+	m_assembler.JnbJx(GetLabel(statement.jmpBlock));
+
+	m_assembler.MovsxdEq(CX86Assembler::rDX, CX86Assembler::MakeBaseOffIndexScaleAddress(CX86Assembler::rCX, 0, CX86Assembler::rAX, 4));
+	m_assembler.AddEq(CX86Assembler::rCX, CX86Assembler::MakeRegisterAddress(CX86Assembler::rDX));
+	m_assembler.JmpEd(CX86Assembler::MakeRegisterAddress(CX86Assembler::rCX));
+
+	m_assembler.MarkLabel(tableLabel);
+	for(const auto& target : *statement.jmpTable)
+	{
+		m_assembler.DdLabelOffset(GetLabel(target), tableLabel);
+	}
+}
+
 CX86Assembler::REGISTER CCodeGen_x86_64::PrepareRefSymbolRegisterDef(CSymbol* symbol, CX86Assembler::REGISTER preferedRegister)
 {
 	switch(symbol->m_type)
@@ -958,6 +1431,10 @@ CX86Assembler::REGISTER CCodeGen_x86_64::PrepareRefSymbolRegisterUse(CSymbol* sy
 		m_assembler.MovEq(preferedRegister, MakeMemoryReferenceSymbolAddress(symbol));
 		return preferedRegister;
 		break;
+	case SYM_CONSTANTPTR:
+		m_assembler.MovIq(preferedRegister, symbol->GetConstantPtr());
+		return preferedRegister;
+		break;
 	default:
 		throw std::runtime_error("Invalid symbol type.");
 		break;
@@ -981,6 +1458,62 @@ void CCodeGen_x86_64::CommitRefSymbolRegister(CSymbol* symbol, CX86Assembler::RE
 	}
 }
 
+CX86Assembler::REGISTER CCodeGen_x86_64::PrepareSymbol64RegisterDef(CSymbol* symbol, CX86Assembler::REGISTER preferedRegister)
+{
+	switch(symbol->m_type)
+	{
+	case SYM_REGISTER64:
+		return m_registers[symbol->m_valueLow];
+		break;
+	case SYM_TEMPORARY64:
+	case SYM_RELATIVE64:
+		return preferedRegister;
+		break;
+	default:
+		throw std::runtime_error("Invalid symbol type.");
+		break;
+	}
+}
+
+CX86Assembler::REGISTER CCodeGen_x86_64::PrepareSymbol64RegisterUse(CSymbol* symbol, CX86Assembler::REGISTER preferedRegister)
+{
+	switch(symbol->m_type)
+	{
+	case SYM_REGISTER64:
+		return m_registers[symbol->m_valueLow];
+		break;
+	case SYM_TEMPORARY64:
+	case SYM_RELATIVE64:
+		m_assembler.MovEq(preferedRegister, MakeMemory64SymbolAddress(symbol));
+		return preferedRegister;
+		break;
+	case SYM_CONSTANT64:
+		m_assembler.MovIq(preferedRegister, symbol->GetConstant64());
+		return preferedRegister;
+		break;
+	default:
+		throw std::runtime_error("Invalid symbol type.");
+		break;
+	}
+}
+
+void CCodeGen_x86_64::CommitSymbol64Register(CSymbol* symbol, CX86Assembler::REGISTER usedRegister)
+{
+	switch(symbol->m_type)
+	{
+	case SYM_REGISTER64:
+		assert(usedRegister == m_registers[symbol->m_valueLow]);
+		break;
+	case SYM_TEMPORARY64:
+	case SYM_RELATIVE64:
+		m_assembler.MovGq(MakeMemory64SymbolAddress(symbol), usedRegister);
+		break;
+	default:
+		throw std::runtime_error("Invalid symbol type.");
+		break;
+	}
+}
+
 void CCodeGen_x86_64::WriteConstant64ToAddress(const CX86Assembler::CAddress& dstAddress, CX86Assembler::REGISTER tempRegister, uint64 constant)
 {
 	if(static_cast<int32>(constant) == constant)
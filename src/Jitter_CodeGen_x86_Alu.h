@@ -67,6 +67,10 @@ void CCodeGen_x86::Emit_Alu_RegRegCst(const STATEMENT& statement)
 	{
 		m_assembler.LeaGd(m_registers[dst->m_valueLow], CX86Assembler::MakeIndRegOffAddress(m_registers[src1->m_valueLow], src2->m_valueLow));
 	}
+	else if((statement.op == OP_SUB) && !dst->Equals(src1))
+	{
+		m_assembler.LeaGd(m_registers[dst->m_valueLow], CX86Assembler::MakeIndRegOffAddress(m_registers[src1->m_valueLow], 0 - src2->m_valueLow));
+	}
 	else
 	{
 		if(!dst->Equals(src1))
@@ -39,6 +39,53 @@ void CCodeGen_x86::CommitSymbolRegisterFp32Avx(CSymbol* symbol, CX86Assembler::X
 	}
 }
 
+CX86Assembler::XMMREGISTER CCodeGen_x86::PrepareSymbolRegisterUseFp64Avx(CSymbol* symbol, CX86Assembler::XMMREGISTER preferedRegister)
+{
+	switch(symbol->m_type)
+	{
+	case SYM_FP_REGISTER64:
+		return m_mdRegisters[symbol->m_valueLow];
+		break;
+	case SYM_FP_TEMPORARY64:
+	case SYM_FP_RELATIVE64:
+		m_assembler.VmovsdEd(preferedRegister, MakeMemoryFp64SymbolAddress(symbol));
+		return preferedRegister;
+		break;
+	default:
+		throw std::runtime_error("Invalid symbol type.");
+		break;
+	}
+}
+
+void CCodeGen_x86::CommitSymbolRegisterFp64Avx(CSymbol* symbol, CX86Assembler::XMMREGISTER usedRegister)
+{
+	switch(symbol->m_type)
+	{
+	case SYM_FP_REGISTER64:
+		assert(usedRegister == m_mdRegisters[symbol->m_valueLow]);
+		break;
+	case SYM_FP_TEMPORARY64:
+	case SYM_FP_RELATIVE64:
+		m_assembler.VmovsdEd(MakeMemoryFp64SymbolAddress(symbol), usedRegister);
+		break;
+	default:
+		throw std::runtime_error("Invalid symbol type.");
+		break;
+	}
+}
+
+CX86Assembler::XMMREGISTER CCodeGen_x86::PrepareFpMergeRegisterAvx(CSymbol* src)
+{
+	//Scalar ops copy upper lanes from their first source. Use the actual source if it's
+	//in a register, otherwise a cleared scratch to avoid depending on an unrelated value.
+	if(src && ((src->m_type == SYM_FP_REGISTER32) || (src->m_type == SYM_FP_REGISTER64)))
+	{
+		return m_mdRegisters[src->m_valueLow];
+	}
+	m_assembler.VpxorVo(CX86Assembler::xMM0, CX86Assembler::xMM0, CX86Assembler::MakeXmmRegisterAddress(CX86Assembler::xMM0));
+	return CX86Assembler::xMM0;
+}
+
 template <typename FPUOP>
 void CCodeGen_x86::Emit_Fp32_Avx_VarVar(const STATEMENT& statement)
 {
@@ -46,8 +93,9 @@ void CCodeGen_x86::Emit_Fp32_Avx_VarVar(const STATEMENT& statement)
 	auto src1 = statement.src1->GetSymbol().get();
 
 	auto dstRegister = PrepareSymbolRegisterDefFp32(dst, CX86Assembler::xMM0);
+	auto mergeRegister = PrepareFpMergeRegisterAvx(src1);
 
-	((m_assembler).*(FPUOP::OpEdAvx()))(dstRegister, CX86Assembler::xMM0, MakeVariableFp32SymbolAddress(src1));
+	((m_assembler).*(FPUOP::OpEdAvx()))(dstRegister, mergeRegister, MakeVariableFp32SymbolAddress(src1));
 
 	CommitSymbolRegisterFp32Avx(dst, dstRegister);
 }
@@ -127,7 +175,7 @@ void CCodeGen_x86::Emit_Fp_Avx_RsqrtS_VarVar(const STATEMENT& statement)
 	auto dstRegister = PrepareSymbolRegisterDefFp32(dst, CX86Assembler::xMM0);
 	auto sqrtRegister = CX86Assembler::xMM1;
 
-	m_assembler.VsqrtssEd(sqrtRegister, CX86Assembler::xMM0, MakeVariableFp32SymbolAddress(src1));
+	m_assembler.VsqrtssEd(sqrtRegister, PrepareFpMergeRegisterAvx(src1), MakeVariableFp32SymbolAddress(src1));
 	m_assembler.MovId(tmpIntRegister, 0x3F800000);
 	m_assembler.VmovdVo(dstRegister, CX86Assembler::MakeRegisterAddress(tmpIntRegister));
 	m_assembler.VdivssEd(dstRegister, dstRegister, CX86Assembler::MakeXmmRegisterAddress(sqrtRegister));
@@ -235,10 +283,9 @@ void CCodeGen_x86::Emit_Fp_Avx_ToSingleI32_VarReg(const STATEMENT& statement)
 	assert(src1->m_type == SYM_FP_REGISTER32);
 
 	auto dstRegister = PrepareSymbolRegisterDefFp32(dst, CX86Assembler::xMM0);
-	auto tmpIntRegister = CX86Assembler::rAX;
 
-	m_assembler.VmovdVo(CX86Assembler::MakeRegisterAddress(tmpIntRegister), m_mdRegisters[src1->m_valueLow]);
-	m_assembler.Vcvtsi2ssEd(dstRegister, CX86Assembler::MakeRegisterAddress(tmpIntRegister));
+	//Convert in place, upper lanes are don't care for scalar values
+	m_assembler.Vcvtdq2psVo(dstRegister, CX86Assembler::MakeXmmRegisterAddress(m_mdRegisters[src1->m_valueLow]));
 
 	CommitSymbolRegisterFp32Avx(dst, dstRegister);
 }
@@ -250,12 +297,25 @@ void CCodeGen_x86::Emit_Fp_Avx_ToSingleI32_VarMem(const STATEMENT& statement)
 
 	auto dstRegister = PrepareSymbolRegisterDefFp32(dst, CX86Assembler::xMM0);
 
+	//Merges into xMM0
+	PrepareFpMergeRegisterAvx();
 	m_assembler.Vcvtsi2ssEd(dstRegister, MakeVariableFp32SymbolAddress(src1));
 
 	CommitSymbolRegisterFp32Avx(dst, dstRegister);
 }
 
-void CCodeGen_x86::Emit_Fp_Avx_ToInt32TruncS_RegVar(const STATEMENT& statement)
+void CCodeGen_x86::Emit_Fp_Avx_ToInt32TruncS_RegReg(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	assert(dst->m_type == SYM_FP_REGISTER32);
+	assert(src1->m_type == SYM_FP_REGISTER32);
+
+	m_assembler.Vcvttps2dqVo(m_mdRegisters[dst->m_valueLow], CX86Assembler::MakeXmmRegisterAddress(m_mdRegisters[src1->m_valueLow]));
+}
+
+void CCodeGen_x86::Emit_Fp_Avx_ToInt32TruncS_RegMem(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
 	auto src1 = statement.src1->GetSymbol().get();
@@ -279,6 +339,32 @@ void CCodeGen_x86::Emit_Fp_Avx_ToInt32TruncS_MemVar(const STATEMENT& statement)
 	m_assembler.MovGd(MakeMemoryFp32SymbolAddress(dst), tmpIntRegister);
 }
 
+void CCodeGen_x86::Emit_Fp_Fma_FmaS_VarVarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	auto resultRegister = CX86Assembler::xMM0;
+
+	auto src3Register = PrepareSymbolRegisterUseFp32Avx(src3, resultRegister);
+	if(src3Register != resultRegister)
+	{
+		m_assembler.VmovapsVo(resultRegister, CX86Assembler::MakeXmmRegisterAddress(src3Register));
+	}
+
+	auto src1Register = PrepareSymbolRegisterUseFp32Avx(src1, CX86Assembler::xMM1);
+	m_assembler.Vfmadd231ssEd(resultRegister, src1Register, MakeVariableFp32SymbolAddress(src2));
+
+	auto dstRegister = PrepareSymbolRegisterDefFp32(dst, resultRegister);
+	if(dstRegister != resultRegister)
+	{
+		m_assembler.VmovapsVo(dstRegister, CX86Assembler::MakeXmmRegisterAddress(resultRegister));
+	}
+	CommitSymbolRegisterFp32Avx(dst, dstRegister);
+}
+
 void CCodeGen_x86::Emit_Fp_Avx_SetRoundingMode_Cst(const STATEMENT& statement)
 {
 	auto src1 = statement.src1->GetSymbol().get();
@@ -301,6 +387,192 @@ void CCodeGen_x86::Emit_Fp_Avx_SetRoundingMode_Cst(const STATEMENT& statement)
 	m_assembler.Pop(CX86Assembler::rAX);
 }
 
+template <typename FPUOP>
+void CCodeGen_x86::Emit_Fp64_Avx_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDefFp64(dst, CX86Assembler::xMM0);
+	auto mergeRegister = PrepareFpMergeRegisterAvx(src1);
+
+	((m_assembler).*(FPUOP::OpEdAvx()))(dstRegister, mergeRegister, MakeVariableFp64SymbolAddress(src1));
+
+	CommitSymbolRegisterFp64Avx(dst, dstRegister);
+}
+
+template <typename FPUOP>
+void CCodeGen_x86::Emit_Fp64_Avx_VarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDefFp64(dst, CX86Assembler::xMM0);
+	auto src1Register = PrepareSymbolRegisterUseFp64Avx(src1, CX86Assembler::xMM1);
+
+	((m_assembler).*(FPUOP::OpEdAvx()))(dstRegister, src1Register, MakeVariableFp64SymbolAddress(src2));
+
+	CommitSymbolRegisterFp64Avx(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Fp64_Avx_Mov_RegMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	assert(dst->m_type == SYM_FP_REGISTER64);
+
+	m_assembler.VmovsdEd(m_mdRegisters[dst->m_valueLow], MakeMemoryFp64SymbolAddress(src1));
+}
+
+void CCodeGen_x86::Emit_Fp64_Avx_Mov_MemReg(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	assert(src1->m_type == SYM_FP_REGISTER64);
+
+	m_assembler.VmovsdEd(MakeMemoryFp64SymbolAddress(dst), m_mdRegisters[src1->m_valueLow]);
+}
+
+void CCodeGen_x86::Emit_Fp64_Avx_LdCst_VarCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	assert(src1->m_type == SYM_CONSTANT64);
+
+	auto dstRegister = PrepareSymbolRegisterDefFp64(dst, CX86Assembler::xMM0);
+	auto hiRegister = CX86Assembler::xMM1;
+	auto tmpIntRegister = CX86Assembler::rAX;
+
+	m_assembler.MovId(tmpIntRegister, src1->m_valueLow);
+	m_assembler.VmovdVo(dstRegister, CX86Assembler::MakeRegisterAddress(tmpIntRegister));
+	m_assembler.MovId(tmpIntRegister, src1->m_valueHigh);
+	m_assembler.VmovdVo(hiRegister, CX86Assembler::MakeRegisterAddress(tmpIntRegister));
+	m_assembler.VpunpckldqVo(dstRegister, dstRegister, CX86Assembler::MakeXmmRegisterAddress(hiRegister));
+
+	CommitSymbolRegisterFp64Avx(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Fp_Avx_CmpD_VarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDef(dst, CX86Assembler::rAX);
+	auto cmpReg = PrepareSymbolRegisterUseFp64Avx(src1, CX86Assembler::xMM0);
+	auto resReg = CX86Assembler::xMM1;
+
+	auto conditionCode = GetSseConditionCode(statement.jmpCondition);
+	m_assembler.VcmpsdEd(resReg, cmpReg, MakeVariableFp64SymbolAddress(src2), conditionCode);
+	m_assembler.VmovdVo(CX86Assembler::MakeRegisterAddress(dstReg), resReg);
+
+	CommitSymbolRegister(dst, dstReg);
+}
+
+void CCodeGen_x86::Emit_Fp_Avx_AbsD_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDefFp64(dst, CX86Assembler::xMM0);
+	auto src1Register = PrepareSymbolRegisterUseFp64Avx(src1, CX86Assembler::xMM0);
+	auto maskRegister = CX86Assembler::xMM1;
+
+	m_assembler.VpcmpeqdVo(maskRegister, maskRegister, CX86Assembler::MakeXmmRegisterAddress(maskRegister));
+	m_assembler.VpsrlqVo(maskRegister, maskRegister, 1);
+	m_assembler.VpandVo(dstRegister, maskRegister, CX86Assembler::MakeXmmRegisterAddress(src1Register));
+
+	CommitSymbolRegisterFp64Avx(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Fp_Avx_NegD_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDefFp64(dst, CX86Assembler::xMM0);
+	auto src1Register = PrepareSymbolRegisterUseFp64Avx(src1, CX86Assembler::xMM0);
+	auto signRegister = CX86Assembler::xMM1;
+
+	m_assembler.VpcmpeqdVo(signRegister, signRegister, CX86Assembler::MakeXmmRegisterAddress(signRegister));
+	m_assembler.VpsllqVo(signRegister, signRegister, 63);
+	m_assembler.VpxorVo(dstRegister, signRegister, CX86Assembler::MakeXmmRegisterAddress(src1Register));
+
+	CommitSymbolRegisterFp64Avx(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Fp_Avx_ToDoubleS_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDefFp64(dst, CX86Assembler::xMM0);
+
+	m_assembler.Vcvtss2sdEd(dstRegister, PrepareFpMergeRegisterAvx(src1), MakeVariableFp32SymbolAddress(src1));
+
+	CommitSymbolRegisterFp64Avx(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Fp_Avx_ToSingleD_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDefFp32(dst, CX86Assembler::xMM0);
+
+	m_assembler.Vcvtsd2ssEd(dstRegister, PrepareFpMergeRegisterAvx(src1), MakeVariableFp64SymbolAddress(src1));
+
+	CommitSymbolRegisterFp32Avx(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Fp_Avx_ToInt32TruncD_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto tmpIntRegister = CX86Assembler::rAX;
+
+	if((dst->m_type == SYM_FP_REGISTER32) && (src1->m_type == SYM_FP_REGISTER64))
+	{
+		m_assembler.Vcvttpd2dqVo(m_mdRegisters[dst->m_valueLow], CX86Assembler::MakeXmmRegisterAddress(m_mdRegisters[src1->m_valueLow]));
+		return;
+	}
+
+	m_assembler.Vcvttsd2siEd(tmpIntRegister, MakeVariableFp64SymbolAddress(src1));
+	if(dst->m_type == SYM_FP_REGISTER32)
+	{
+		m_assembler.VmovdVo(m_mdRegisters[dst->m_valueLow], CX86Assembler::MakeRegisterAddress(tmpIntRegister));
+	}
+	else
+	{
+		m_assembler.MovGd(MakeMemoryFp32SymbolAddress(dst), tmpIntRegister);
+	}
+}
+
+void CCodeGen_x86::Emit_Fp_Avx_ToDoubleI32_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDefFp64(dst, CX86Assembler::xMM0);
+
+	if(src1->m_type == SYM_FP_REGISTER32)
+	{
+		m_assembler.Vcvtdq2pdVo(dstRegister, CX86Assembler::MakeXmmRegisterAddress(m_mdRegisters[src1->m_valueLow]));
+	}
+	else
+	{
+		PrepareFpMergeRegisterAvx();
+		m_assembler.Vcvtsi2sdEd(dstRegister, MakeVariableFp32SymbolAddress(src1));
+	}
+
+	CommitSymbolRegisterFp64Avx(dst, dstRegister);
+}
+
 // clang-format off
 CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_fpuAvxConstMatchers[] = 
 {
@@ -325,7 +597,8 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_fpuAvxConstMatchers[] =
 
 	{ OP_FP_TOSINGLE_I32,    MATCH_FP_VARIABLE32, MATCH_FP_REGISTER32, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp_Avx_ToSingleI32_VarReg   },
 	{ OP_FP_TOSINGLE_I32,    MATCH_FP_VARIABLE32, MATCH_FP_MEMORY32,   MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp_Avx_ToSingleI32_VarMem   },
-	{ OP_FP_TOINT32_TRUNC_S, MATCH_FP_REGISTER32, MATCH_FP_VARIABLE32, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp_Avx_ToInt32TruncS_RegVar },
+	{ OP_FP_TOINT32_TRUNC_S, MATCH_FP_REGISTER32, MATCH_FP_REGISTER32, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp_Avx_ToInt32TruncS_RegReg },
+	{ OP_FP_TOINT32_TRUNC_S, MATCH_FP_REGISTER32, MATCH_FP_MEMORY32,   MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp_Avx_ToInt32TruncS_RegMem },
 	{ OP_FP_TOINT32_TRUNC_S, MATCH_FP_MEMORY32,   MATCH_FP_VARIABLE32, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp_Avx_ToInt32TruncS_MemVar },
 
 	{ OP_MOV,      MATCH_FP_REGISTER32, MATCH_FP_MEMORY32,   MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp32_Avx_Mov_RegMem },
@@ -334,6 +607,35 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_fpuAvxConstMatchers[] =
 
 	{ OP_FP_SETROUNDINGMODE, MATCH_NIL, MATCH_CONSTANT, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp_Avx_SetRoundingMode_Cst },
 
+	{ OP_FP_ADD_D, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_NIL, &CCodeGen_x86::Emit_Fp64_Avx_VarVarVar<FP64OP_ADD> },
+	{ OP_FP_SUB_D, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_NIL, &CCodeGen_x86::Emit_Fp64_Avx_VarVarVar<FP64OP_SUB> },
+	{ OP_FP_MUL_D, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_NIL, &CCodeGen_x86::Emit_Fp64_Avx_VarVarVar<FP64OP_MUL> },
+	{ OP_FP_DIV_D, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_NIL, &CCodeGen_x86::Emit_Fp64_Avx_VarVarVar<FP64OP_DIV> },
+	{ OP_FP_MAX_D, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_NIL, &CCodeGen_x86::Emit_Fp64_Avx_VarVarVar<FP64OP_MAX> },
+	{ OP_FP_MIN_D, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_NIL, &CCodeGen_x86::Emit_Fp64_Avx_VarVarVar<FP64OP_MIN> },
+
+	{ OP_FP_CMP_D, MATCH_VARIABLE, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_NIL, &CCodeGen_x86::Emit_Fp_Avx_CmpD_VarVarVar },
+
+	{ OP_FP_SQRT_D, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp64_Avx_VarVar<FP64OP_SQRT> },
+	{ OP_FP_ABS_D,  MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp_Avx_AbsD_VarVar           },
+	{ OP_FP_NEG_D,  MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp_Avx_NegD_VarVar           },
+
+	{ OP_FP_TODOUBLE_S,      MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE32, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp_Avx_ToDoubleS_VarVar     },
+	{ OP_FP_TOSINGLE_D,      MATCH_FP_VARIABLE32, MATCH_FP_VARIABLE64, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp_Avx_ToSingleD_VarVar     },
+	{ OP_FP_TOINT32_TRUNC_D, MATCH_FP_VARIABLE32, MATCH_FP_VARIABLE64, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp_Avx_ToInt32TruncD_VarVar },
+	{ OP_FP_TODOUBLE_I32,    MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE32, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp_Avx_ToDoubleI32_VarVar   },
+
+	{ OP_MOV,      MATCH_FP_REGISTER64, MATCH_FP_MEMORY64,   MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp64_Avx_Mov_RegMem   },
+	{ OP_MOV,      MATCH_FP_MEMORY64,   MATCH_FP_REGISTER64, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp64_Avx_Mov_MemReg   },
+	{ OP_FP_LDCST, MATCH_FP_VARIABLE64, MATCH_CONSTANT64,    MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp64_Avx_LdCst_VarCst },
+
+	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
+};
+
+CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_fpuFmaConstMatchers[] = 
+{
+	{ OP_FP_FMA_S, MATCH_FP_VARIABLE32, MATCH_FP_VARIABLE32, MATCH_FP_VARIABLE32, MATCH_FP_VARIABLE32, &CCodeGen_x86::Emit_Fp_Fma_FmaS_VarVarVarVar },
+
 	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
 };
 // clang-format on
@@ -20,13 +20,70 @@ void CCodeGen_x86::CommitSymbolRegisterFp32Sse(CSymbol* symbol, CX86Assembler::X
 	}
 }
 
+void CCodeGen_x86::CommitSymbolRegisterFp64Sse(CSymbol* symbol, CX86Assembler::XMMREGISTER usedRegister)
+{
+	switch(symbol->m_type)
+	{
+	case SYM_FP_REGISTER64:
+		assert(usedRegister == m_mdRegisters[symbol->m_valueLow]);
+		break;
+	case SYM_FP_TEMPORARY64:
+	case SYM_FP_RELATIVE64:
+		m_assembler.MovsdEd(MakeMemoryFp64SymbolAddress(symbol), usedRegister);
+		break;
+	default:
+		throw std::runtime_error("Invalid symbol type.");
+		break;
+	}
+}
+
+void CCodeGen_x86::LoadSymbolFp32Sse(CX86Assembler::XMMREGISTER dstRegister, CSymbol* symbol)
+{
+	//MOVSS between registers merges into the destination, copy the whole register instead
+	if(symbol->m_type == SYM_FP_REGISTER32)
+	{
+		m_assembler.MovapsVo(dstRegister, CX86Assembler::MakeXmmRegisterAddress(m_mdRegisters[symbol->m_valueLow]));
+	}
+	else
+	{
+		m_assembler.MovssEd(dstRegister, MakeMemoryFp32SymbolAddress(symbol));
+	}
+}
+
+void CCodeGen_x86::LoadSymbolFp64Sse(CX86Assembler::XMMREGISTER dstRegister, CSymbol* symbol)
+{
+	if(symbol->m_type == SYM_FP_REGISTER64)
+	{
+		m_assembler.MovapsVo(dstRegister, CX86Assembler::MakeXmmRegisterAddress(m_mdRegisters[symbol->m_valueLow]));
+	}
+	else
+	{
+		m_assembler.MovsdEd(dstRegister, MakeMemoryFp64SymbolAddress(symbol));
+	}
+}
+
+void CCodeGen_x86::BreakFpDependencySse(CX86Assembler::XMMREGISTER dstRegister, CSymbol* src)
+{
+	//Scalar conversions and SQRTSS/SD only write the lower lane of their destination and
+	//thus depend on its previous value. Clear it, unless it's also the source.
+	if(src && ((src->m_type == SYM_FP_REGISTER32) || (src->m_type == SYM_FP_REGISTER64)) &&
+	   (m_mdRegisters[src->m_valueLow] == dstRegister))
+	{
+		return;
+	}
+	m_assembler.XorpsVo(dstRegister, CX86Assembler::MakeXmmRegisterAddress(dstRegister));
+}
+
 template <typename FPUOP>
 void CCodeGen_x86::Emit_Fp32_RegVar(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
 	auto src1 = statement.src1->GetSymbol().get();
 
-	((m_assembler).*(FPUOP::OpEd()))(m_mdRegisters[dst->m_valueLow], MakeVariableFp32SymbolAddress(src1));
+	auto dstRegister = m_mdRegisters[dst->m_valueLow];
+
+	BreakFpDependencySse(dstRegister, src1);
+	((m_assembler).*(FPUOP::OpEd()))(dstRegister, MakeVariableFp32SymbolAddress(src1));
 }
 
 template <typename FPOP>
@@ -37,6 +94,7 @@ void CCodeGen_x86::Emit_Fp32_MemVar(const STATEMENT& statement)
 
 	auto dstRegister = CX86Assembler::xMM0;
 
+	BreakFpDependencySse(dstRegister, src1);
 	((m_assembler).*(FPOP::OpEd()))(dstRegister, MakeVariableFp32SymbolAddress(src1));
 	m_assembler.MovssEd(MakeMemoryFp32SymbolAddress(dst), dstRegister);
 }
@@ -59,11 +117,11 @@ void CCodeGen_x86::Emit_Fp32_RegRegReg(const STATEMENT& statement)
 
 		if(dst->Equals(src2))
 		{
-			m_assembler.MovssEd(CX86Assembler::xMM0, CX86Assembler::MakeXmmRegisterAddress(m_mdRegisters[src2->m_valueLow]));
+			m_assembler.MovapsVo(CX86Assembler::xMM0, CX86Assembler::MakeXmmRegisterAddress(m_mdRegisters[src2->m_valueLow]));
 			src2Register = CX86Assembler::xMM0;
 		}
 
-		m_assembler.MovssEd(m_mdRegisters[dst->m_valueLow], CX86Assembler::MakeXmmRegisterAddress(m_mdRegisters[src1->m_valueLow]));
+		m_assembler.MovapsVo(m_mdRegisters[dst->m_valueLow], CX86Assembler::MakeXmmRegisterAddress(m_mdRegisters[src1->m_valueLow]));
 		((m_assembler).*(FPOP::OpEd()))(m_mdRegisters[dst->m_valueLow], CX86Assembler::MakeXmmRegisterAddress(src2Register));
 	}
 }
@@ -80,7 +138,7 @@ void CCodeGen_x86::Emit_Fp32_RegMemReg(const STATEMENT& statement)
 
 	if(dst->Equals(src2))
 	{
-		m_assembler.MovssEd(CX86Assembler::xMM0, CX86Assembler::MakeXmmRegisterAddress(src2Register));
+		m_assembler.MovapsVo(CX86Assembler::xMM0, CX86Assembler::MakeXmmRegisterAddress(src2Register));
 		src2Register = CX86Assembler::xMM0;
 	}
 
@@ -103,7 +161,7 @@ void CCodeGen_x86::Emit_Fp32_RegVarVar(const STATEMENT& statement)
 
 	if(!dst->Equals(src1))
 	{
-		m_assembler.MovssEd(dstRegister, MakeVariableFp32SymbolAddress(src1));
+		LoadSymbolFp32Sse(dstRegister, src1);
 	}
 
 	((m_assembler).*(FPOP::OpEd()))(dstRegister, MakeVariableFp32SymbolAddress(src2));
@@ -118,7 +176,7 @@ void CCodeGen_x86::Emit_Fp32_MemVarVar(const STATEMENT& statement)
 
 	auto dstRegister = CX86Assembler::xMM0;
 
-	m_assembler.MovssEd(dstRegister, MakeVariableFp32SymbolAddress(src1));
+	LoadSymbolFp32Sse(dstRegister, src1);
 	((m_assembler).*(FPUOP::OpEd()))(dstRegister, MakeVariableFp32SymbolAddress(src2));
 	m_assembler.MovssEd(MakeMemoryFp32SymbolAddress(dst), dstRegister);
 }
@@ -133,7 +191,7 @@ void CCodeGen_x86::Emit_Fp32_SingleOp_RegVar(const STATEMENT& statement)
 
 	if(!dst->Equals(src1))
 	{
-		m_assembler.MovssEd(resultRegister, MakeVariableFp32SymbolAddress(src1));
+		LoadSymbolFp32Sse(resultRegister, src1);
 	}
 
 	((*this).*(MDOPSINGLEOP::OpVr()))(resultRegister);
@@ -147,7 +205,7 @@ void CCodeGen_x86::Emit_Fp32_SingleOp_MemVar(const STATEMENT& statement)
 
 	auto resultRegister = CX86Assembler::xMM0;
 
-	m_assembler.MovssEd(resultRegister, MakeVariableFp32SymbolAddress(src1));
+	LoadSymbolFp32Sse(resultRegister, src1);
 	((*this).*(MDOPSINGLEOP::OpVr()))(resultRegister);
 	m_assembler.MovssEd(MakeMemoryFp32SymbolAddress(dst), resultRegister);
 }
@@ -195,7 +253,7 @@ void CCodeGen_x86::Emit_Fp_CmpS_VarVarVar(const STATEMENT& statement)
 	auto dstReg = PrepareSymbolRegisterDef(dst, CX86Assembler::rAX);
 
 	auto conditionCode = GetSseConditionCode(statement.jmpCondition);
-	m_assembler.MovssEd(CX86Assembler::xMM0, MakeVariableFp32SymbolAddress(src1));
+	LoadSymbolFp32Sse(CX86Assembler::xMM0, src1);
 	m_assembler.CmpssEd(CX86Assembler::xMM0, MakeVariableFp32SymbolAddress(src2), conditionCode);
 	m_assembler.MovdVo(CX86Assembler::MakeRegisterAddress(dstReg), CX86Assembler::xMM0);
 
@@ -243,6 +301,7 @@ void CCodeGen_x86::Emit_Fp_RsqrtS_VarVar(const STATEMENT& statement)
 	auto dstRegister = PrepareSymbolRegisterDefFp32(dst, CX86Assembler::xMM0);
 	auto sqrtRegister = CX86Assembler::xMM1;
 
+	BreakFpDependencySse(sqrtRegister, src1);
 	m_assembler.SqrtssEd(sqrtRegister, MakeVariableFp32SymbolAddress(src1));
 	m_assembler.MovId(tmpIntRegister, 0x3F800000);
 	m_assembler.MovdVo(dstRegister, CX86Assembler::MakeRegisterAddress(tmpIntRegister));
@@ -265,7 +324,7 @@ void CCodeGen_x86::Emit_Fp_RcplS_RegVar(const STATEMENT& statement)
 	if(dst->Equals(src1))
 	{
 		auto src1Register = CX86Assembler::xMM1;
-		m_assembler.MovssEd(src1Register, CX86Assembler::MakeXmmRegisterAddress(m_mdRegisters[src1->m_valueLow]));
+		m_assembler.MovapsVo(src1Register, CX86Assembler::MakeXmmRegisterAddress(m_mdRegisters[src1->m_valueLow]));
 		m_assembler.MovdVo(dstRegister, CX86Assembler::MakeRegisterAddress(tmpIntRegister));
 		m_assembler.DivssEd(dstRegister, CX86Assembler::MakeXmmRegisterAddress(src1Register));
 	}
@@ -299,7 +358,7 @@ void CCodeGen_x86::Emit_Fp_ClampS_RegVar(const STATEMENT& statement)
 
 	if(!dst->Equals(src1))
 	{
-		m_assembler.MovssEd(dstRegister, MakeVariableFp32SymbolAddress(src1));
+		LoadSymbolFp32Sse(dstRegister, src1);
 	}
 
 	m_assembler.PminsdVo(dstRegister, MakeConstant128Address(g_fpClampMask1));
@@ -313,7 +372,7 @@ void CCodeGen_x86::Emit_Fp_ClampS_MemVar(const STATEMENT& statement)
 
 	auto dstRegister = CX86Assembler::xMM0;
 
-	m_assembler.MovssEd(dstRegister, MakeVariableFp32SymbolAddress(src1));
+	LoadSymbolFp32Sse(dstRegister, src1);
 	m_assembler.PminsdVo(dstRegister, MakeConstant128Address(g_fpClampMask1));
 	m_assembler.PminudVo(dstRegister, MakeConstant128Address(g_fpClampMask2));
 	m_assembler.MovssEd(MakeMemoryFp32SymbolAddress(dst), dstRegister);
@@ -330,6 +389,7 @@ void CCodeGen_x86::Emit_Fp_ToSingleI32_VarReg(const STATEMENT& statement)
 	auto tmpIntRegister = CX86Assembler::rAX;
 
 	m_assembler.MovdVo(CX86Assembler::MakeRegisterAddress(tmpIntRegister), m_mdRegisters[src1->m_valueLow]);
+	BreakFpDependencySse(dstRegister);
 	m_assembler.Cvtsi2ssEd(dstRegister, CX86Assembler::MakeRegisterAddress(tmpIntRegister));
 
 	CommitSymbolRegisterFp32Sse(dst, dstRegister);
@@ -342,6 +402,7 @@ void CCodeGen_x86::Emit_Fp_ToSingleI32_VarMem(const STATEMENT& statement)
 
 	auto dstRegister = PrepareSymbolRegisterDefFp32(dst, CX86Assembler::xMM0);
 
+	BreakFpDependencySse(dstRegister);
 	m_assembler.Cvtsi2ssEd(dstRegister, MakeVariableFp32SymbolAddress(src1));
 
 	CommitSymbolRegisterFp32Sse(dst, dstRegister);
@@ -393,6 +454,209 @@ void CCodeGen_x86::Emit_Fp_Sse_SetRoundingMode_Cst(const STATEMENT& statement)
 	m_assembler.Pop(CX86Assembler::rAX);
 }
 
+template <typename FPOP>
+void CCodeGen_x86::Emit_Fp64_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDefFp64(dst, CX86Assembler::xMM0);
+
+	BreakFpDependencySse(dstRegister, src1);
+	((m_assembler).*(FPOP::OpEd()))(dstRegister, MakeVariableFp64SymbolAddress(src1));
+
+	CommitSymbolRegisterFp64Sse(dst, dstRegister);
+}
+
+template <typename FPOP>
+void CCodeGen_x86::Emit_Fp64_VarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDefFp64(dst, CX86Assembler::xMM0);
+	auto src2Address = MakeVariableFp64SymbolAddress(src2);
+	bool dstIsRegister = (dst->m_type == SYM_FP_REGISTER64);
+
+	if(dstIsRegister && dst->Equals(src2) && !dst->Equals(src1))
+	{
+		//Loading src1 in dst would overwrite src2, keep a copy of it
+		LoadSymbolFp64Sse(CX86Assembler::xMM1, src2);
+		src2Address = CX86Assembler::MakeXmmRegisterAddress(CX86Assembler::xMM1);
+	}
+
+	if(!dstIsRegister || !dst->Equals(src1))
+	{
+		LoadSymbolFp64Sse(dstRegister, src1);
+	}
+
+	((m_assembler).*(FPOP::OpEd()))(dstRegister, src2Address);
+
+	CommitSymbolRegisterFp64Sse(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Fp64_Mov_RegMem(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	assert(dst->m_type == SYM_FP_REGISTER64);
+
+	m_assembler.MovsdEd(m_mdRegisters[dst->m_valueLow], MakeMemoryFp64SymbolAddress(src1));
+}
+
+void CCodeGen_x86::Emit_Fp64_Mov_MemReg(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	assert(src1->m_type == SYM_FP_REGISTER64);
+
+	m_assembler.MovsdEd(MakeMemoryFp64SymbolAddress(dst), m_mdRegisters[src1->m_valueLow]);
+}
+
+void CCodeGen_x86::Emit_Fp64_LdCst_VarCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	assert(src1->m_type == SYM_CONSTANT64);
+
+	auto dstRegister = PrepareSymbolRegisterDefFp64(dst, CX86Assembler::xMM0);
+	auto hiRegister = CX86Assembler::xMM1;
+	auto tmpIntRegister = CX86Assembler::rAX;
+
+	m_assembler.MovId(tmpIntRegister, src1->m_valueLow);
+	m_assembler.MovdVo(dstRegister, CX86Assembler::MakeRegisterAddress(tmpIntRegister));
+	m_assembler.MovId(tmpIntRegister, src1->m_valueHigh);
+	m_assembler.MovdVo(hiRegister, CX86Assembler::MakeRegisterAddress(tmpIntRegister));
+	m_assembler.PunpckldqVo(dstRegister, CX86Assembler::MakeXmmRegisterAddress(hiRegister));
+
+	CommitSymbolRegisterFp64Sse(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Fp_CmpD_VarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstReg = PrepareSymbolRegisterDef(dst, CX86Assembler::rAX);
+
+	auto conditionCode = GetSseConditionCode(statement.jmpCondition);
+	LoadSymbolFp64Sse(CX86Assembler::xMM0, src1);
+	m_assembler.CmpsdEd(CX86Assembler::xMM0, MakeVariableFp64SymbolAddress(src2), conditionCode);
+	m_assembler.MovdVo(CX86Assembler::MakeRegisterAddress(dstReg), CX86Assembler::xMM0);
+
+	CommitSymbolRegister(dst, dstReg);
+}
+
+void CCodeGen_x86::Emit_Fp_AbsD_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDefFp64(dst, CX86Assembler::xMM0);
+	auto maskRegister = CX86Assembler::xMM1;
+
+	if((dst->m_type != SYM_FP_REGISTER64) || !dst->Equals(src1))
+	{
+		LoadSymbolFp64Sse(dstRegister, src1);
+	}
+
+	m_assembler.PcmpeqdVo(maskRegister, CX86Assembler::MakeXmmRegisterAddress(maskRegister));
+	m_assembler.PsrlqVo(maskRegister, 1);
+	m_assembler.PandVo(dstRegister, CX86Assembler::MakeXmmRegisterAddress(maskRegister));
+
+	CommitSymbolRegisterFp64Sse(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Fp_NegD_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDefFp64(dst, CX86Assembler::xMM0);
+	auto signRegister = CX86Assembler::xMM1;
+
+	if((dst->m_type != SYM_FP_REGISTER64) || !dst->Equals(src1))
+	{
+		LoadSymbolFp64Sse(dstRegister, src1);
+	}
+
+	m_assembler.PcmpeqdVo(signRegister, CX86Assembler::MakeXmmRegisterAddress(signRegister));
+	m_assembler.PsllqVo(signRegister, 63);
+	m_assembler.PxorVo(dstRegister, CX86Assembler::MakeXmmRegisterAddress(signRegister));
+
+	CommitSymbolRegisterFp64Sse(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Fp_ToDoubleS_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDefFp64(dst, CX86Assembler::xMM0);
+
+	BreakFpDependencySse(dstRegister, src1);
+	m_assembler.Cvtss2sdEd(dstRegister, MakeVariableFp32SymbolAddress(src1));
+
+	CommitSymbolRegisterFp64Sse(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Fp_ToSingleD_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDefFp32(dst, CX86Assembler::xMM0);
+
+	BreakFpDependencySse(dstRegister, src1);
+	m_assembler.Cvtsd2ssEd(dstRegister, MakeVariableFp64SymbolAddress(src1));
+
+	CommitSymbolRegisterFp32Sse(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Fp_ToInt32TruncD_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto tmpIntRegister = CX86Assembler::rAX;
+
+	m_assembler.Cvttsd2siEd(tmpIntRegister, MakeVariableFp64SymbolAddress(src1));
+	if(dst->m_type == SYM_FP_REGISTER32)
+	{
+		m_assembler.MovdVo(m_mdRegisters[dst->m_valueLow], CX86Assembler::MakeRegisterAddress(tmpIntRegister));
+	}
+	else
+	{
+		m_assembler.MovGd(MakeMemoryFp32SymbolAddress(dst), tmpIntRegister);
+	}
+}
+
+void CCodeGen_x86::Emit_Fp_ToDoubleI32_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDefFp64(dst, CX86Assembler::xMM0);
+	auto src1Address = MakeVariableFp32SymbolAddress(src1);
+
+	if(src1->m_type == SYM_FP_REGISTER32)
+	{
+		auto tmpIntRegister = CX86Assembler::rAX;
+		m_assembler.MovdVo(CX86Assembler::MakeRegisterAddress(tmpIntRegister), m_mdRegisters[src1->m_valueLow]);
+		src1Address = CX86Assembler::MakeRegisterAddress(tmpIntRegister);
+	}
+
+	BreakFpDependencySse(dstRegister);
+	m_assembler.Cvtsi2sdEd(dstRegister, src1Address);
+
+	CommitSymbolRegisterFp64Sse(dst, dstRegister);
+}
+
 // clang-format off
 #define FP_CONST_MATCHERS_3OPS(FPOP_CST, FPOP) \
 	{ FPOP_CST, MATCH_FP_REGISTER32, MATCH_FP_REGISTER32, MATCH_FP_REGISTER32, MATCH_NIL, &CCodeGen_x86::Emit_Fp32_RegRegReg<FPOP> }, \
@@ -439,6 +703,28 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_fpuSseConstMatchers[] =
 
 	{ OP_FP_SETROUNDINGMODE, MATCH_NIL, MATCH_CONSTANT, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp_Sse_SetRoundingMode_Cst },
 
+	{ OP_FP_ADD_D, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_NIL, &CCodeGen_x86::Emit_Fp64_VarVarVar<FP64OP_ADD> },
+	{ OP_FP_SUB_D, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_NIL, &CCodeGen_x86::Emit_Fp64_VarVarVar<FP64OP_SUB> },
+	{ OP_FP_MUL_D, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_NIL, &CCodeGen_x86::Emit_Fp64_VarVarVar<FP64OP_MUL> },
+	{ OP_FP_DIV_D, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_NIL, &CCodeGen_x86::Emit_Fp64_VarVarVar<FP64OP_DIV> },
+	{ OP_FP_MAX_D, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_NIL, &CCodeGen_x86::Emit_Fp64_VarVarVar<FP64OP_MAX> },
+	{ OP_FP_MIN_D, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_NIL, &CCodeGen_x86::Emit_Fp64_VarVarVar<FP64OP_MIN> },
+
+	{ OP_FP_CMP_D, MATCH_VARIABLE, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_NIL, &CCodeGen_x86::Emit_Fp_CmpD_VarVarVar },
+
+	{ OP_FP_SQRT_D, MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp64_VarVar<FP64OP_SQRT> },
+	{ OP_FP_ABS_D,  MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp_AbsD_VarVar           },
+	{ OP_FP_NEG_D,  MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE64, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp_NegD_VarVar           },
+
+	{ OP_FP_TODOUBLE_S,      MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE32, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp_ToDoubleS_VarVar      },
+	{ OP_FP_TOSINGLE_D,      MATCH_FP_VARIABLE32, MATCH_FP_VARIABLE64, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp_ToSingleD_VarVar      },
+	{ OP_FP_TOINT32_TRUNC_D, MATCH_FP_VARIABLE32, MATCH_FP_VARIABLE64, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp_ToInt32TruncD_VarVar  },
+	{ OP_FP_TODOUBLE_I32,    MATCH_FP_VARIABLE64, MATCH_FP_VARIABLE32, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp_ToDoubleI32_VarVar    },
+
+	{ OP_MOV,      MATCH_FP_REGISTER64, MATCH_FP_MEMORY64,   MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp64_Mov_RegMem   },
+	{ OP_MOV,      MATCH_FP_MEMORY64,   MATCH_FP_REGISTER64, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp64_Mov_MemReg   },
+	{ OP_FP_LDCST, MATCH_FP_VARIABLE64, MATCH_CONSTANT64,    MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Fp64_LdCst_VarCst },
+
 	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
 };
 // clang-format on
@@ -76,3 +76,35 @@ CX86Assembler::CAddress CCodeGen_x86::MakeMemory128SymbolElementAddress(CSymbol*
 		break;
 	}
 }
+
+CX86Assembler::CAddress CCodeGen_x86::MakeMdInsertValueAddress(CSymbol* symbol)
+{
+	if(symbol->IsConstant())
+	{
+		m_assembler.MovId(CX86Assembler::rAX, symbol->m_valueLow);
+		return CX86Assembler::MakeRegisterAddress(CX86Assembler::rAX);
+	}
+	return MakeVariableSymbolAddress(symbol);
+}
+
+std::vector<std::pair<int32, LITERAL128>> CCodeGen_x86::GetMdShuffleBShiftMasks(uint64 patternLow, uint64 patternHigh)
+{
+	//Without pshufb, bytes travelling the same distance are moved together
+	//with a byte shift and then isolated with a mask
+	std::map<int32, std::pair<uint64, uint64>> masks;
+	for(unsigned int i = 0; i < 16; i++)
+	{
+		uint64 pattern = (i < 8) ? patternLow : patternHigh;
+		uint32 index = (pattern >> ((i & 7) * 8)) & 0xFF;
+		if(index >= 0x10) continue;
+		auto& mask = masks[static_cast<int32>(i) - static_cast<int32>(index)];
+		uint64& maskPart = (i < 8) ? mask.first : mask.second;
+		maskPart |= 0xFFULL << ((i & 7) * 8);
+	}
+	std::vector<std::pair<int32, LITERAL128>> result;
+	for(const auto& maskPair : masks)
+	{
+		result.push_back(std::make_pair(maskPair.first, LITERAL128(maskPair.second.first, maskPair.second.second)));
+	}
+	return result;
+}
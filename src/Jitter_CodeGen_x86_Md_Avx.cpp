@@ -172,8 +172,8 @@ void CCodeGen_x86::Emit_Md_Avx_AddSSW_VarVarVar(const STATEMENT& statement)
 
 	auto uxRegister = CX86Assembler::xMM0;
 	auto uyRegister = CX86Assembler::xMM1;
-	auto resRegister = CX86Assembler::xMM2;
-	auto cstRegister = CX86Assembler::xMM3;
+	auto resRegister = GetMdTempRegister(0);
+	auto cstRegister = GetMdTempRegister(1);
 
 	//	This is based on code from http://locklessinc.com/articles/sat_arithmetic/ modified to work without cmovns
 	//	s32b sat_adds32b(s32b x, s32b y)
@@ -253,8 +253,8 @@ void CCodeGen_x86::Emit_Md_Avx_SubSSW_VarVarVar(const STATEMENT& statement)
 
 	auto uxRegister = CX86Assembler::xMM0;
 	auto uyRegister = CX86Assembler::xMM1;
-	auto resRegister = CX86Assembler::xMM2;
-	auto cstRegister = CX86Assembler::xMM3;
+	auto resRegister = GetMdTempRegister(0);
+	auto cstRegister = GetMdTempRegister(1);
 
 	//	This is based on code from http://locklessinc.com/articles/sat_arithmetic/ modified to work without cmovns
 	//	s32b sat_subs32b(s32b x, s32b y)
@@ -328,8 +328,8 @@ void CCodeGen_x86::Emit_Md_Avx_AddUSW_VarVarVar(const STATEMENT& statement)
 
 	auto xRegister = CX86Assembler::xMM0;
 	auto resRegister = CX86Assembler::xMM1;
-	auto tmpRegister = CX86Assembler::xMM2;
-	auto tmp2Register = CX86Assembler::xMM3;
+	auto tmpRegister = GetMdTempRegister(0);
+	auto tmp2Register = GetMdTempRegister(1);
 
 	//	This is based on code from http://locklessinc.com/articles/sat_arithmetic/
 	//	u32b sat_addu32b(u32b x, u32b y)
@@ -371,8 +371,8 @@ void CCodeGen_x86::Emit_Md_Avx_SubUSW_VarVarVar(const STATEMENT& statement)
 
 	auto xRegister = CX86Assembler::xMM0;
 	auto resRegister = CX86Assembler::xMM1;
-	auto tmpRegister = CX86Assembler::xMM2;
-	auto tmp2Register = CX86Assembler::xMM3;
+	auto tmpRegister = GetMdTempRegister(0);
+	auto tmp2Register = GetMdTempRegister(1);
 
 	//	This is based on code from http://locklessinc.com/articles/sat_arithmetic/
 	//	u32b sat_subu32b(u32b x, u32b y)
@@ -422,6 +422,76 @@ void CCodeGen_x86::Emit_Md_Avx_ClampS_VarVar(const STATEMENT& statement)
 	CommitSymbolRegisterMdAvx(dst, dstRegister);
 }
 
+void CCodeGen_x86::Emit_Md_Avx_RsqrtS_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDefMd(dst, CX86Assembler::xMM0);
+	auto sqrtRegister = CX86Assembler::xMM1;
+
+	m_assembler.VsqrtpsVo(sqrtRegister, MakeVariable128SymbolAddress(src1));
+	m_assembler.VmovapsVo(dstRegister, MakeConstant128Address(g_fpCstOne));
+	m_assembler.VdivpsVo(dstRegister, dstRegister, CX86Assembler::MakeXmmRegisterAddress(sqrtRegister));
+
+	CommitSymbolRegisterMdAvx(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Md_Avx_RcplS_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDefMd(dst, CX86Assembler::xMM0);
+	auto src1Register = PrepareSymbolRegisterUseMdAvx(src1, CX86Assembler::xMM1);
+
+	m_assembler.VmovapsVo(CX86Assembler::xMM0, MakeConstant128Address(g_fpCstOne));
+	m_assembler.VdivpsVo(dstRegister, CX86Assembler::xMM0, CX86Assembler::MakeXmmRegisterAddress(src1Register));
+
+	CommitSymbolRegisterMdAvx(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Md_Avx_DotS_VarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	uint8 mask = static_cast<uint8>(statement.jmpCondition);
+
+	auto dstRegister = PrepareSymbolRegisterDefMd(dst, CX86Assembler::xMM0);
+	auto src1Register = PrepareSymbolRegisterUseMdAvx(src1, CX86Assembler::xMM1);
+
+	m_assembler.VdppsVo(dstRegister, src1Register, MakeVariable128SymbolAddress(src2), mask);
+
+	CommitSymbolRegisterMdAvx(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Md_Fma_FmaS_VarVarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	auto resultRegister = CX86Assembler::xMM0;
+
+	auto src3Register = PrepareSymbolRegisterUseMdAvx(src3, resultRegister);
+	if(src3Register != resultRegister)
+	{
+		m_assembler.VmovapsVo(resultRegister, CX86Assembler::MakeXmmRegisterAddress(src3Register));
+	}
+
+	auto src1Register = PrepareSymbolRegisterUseMdAvx(src1, CX86Assembler::xMM1);
+	m_assembler.Vfmadd231psVo(resultRegister, src1Register, MakeVariable128SymbolAddress(src2));
+
+	auto dstRegister = PrepareSymbolRegisterDefMd(dst, resultRegister);
+	if(dstRegister != resultRegister)
+	{
+		m_assembler.VmovapsVo(dstRegister, CX86Assembler::MakeXmmRegisterAddress(resultRegister));
+	}
+	CommitSymbolRegisterMdAvx(dst, dstRegister);
+}
+
 void CCodeGen_x86::Emit_Md_Avx_PackHB_VarVarVar(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -430,8 +500,8 @@ void CCodeGen_x86::Emit_Md_Avx_PackHB_VarVarVar(const STATEMENT& statement)
 
 	auto dstRegister = PrepareSymbolRegisterDefMd(dst, CX86Assembler::xMM0);
 	auto tempRegister = CX86Assembler::xMM1;
-	auto temp2Register = CX86Assembler::xMM2;
-	auto maskRegister = CX86Assembler::xMM3;
+	auto temp2Register = GetMdTempRegister(0);
+	auto maskRegister = GetMdTempRegister(1);
 
 	//Generate mask (0x00FF x8)
 	m_assembler.VpcmpeqdVo(maskRegister, maskRegister, CX86Assembler::MakeXmmRegisterAddress(maskRegister));
@@ -455,7 +525,7 @@ void CCodeGen_x86::Emit_Md_Avx_PackWH_VarVarVar(const STATEMENT& statement)
 
 	auto dstRegister = PrepareSymbolRegisterDefMd(dst, CX86Assembler::xMM0);
 	auto resultRegister = CX86Assembler::xMM1;
-	auto tempRegister = CX86Assembler::xMM2;
+	auto tempRegister = GetMdTempRegister(0);
 
 	m_assembler.VmovapsVo(resultRegister, MakeVariable128SymbolAddress(src2));
 	m_assembler.VmovapsVo(tempRegister, MakeVariable128SymbolAddress(src1));
@@ -534,8 +604,8 @@ void CCodeGen_x86::Emit_Md_Avx_MakeClip_VarVarVarVar(const STATEMENT& statement)
 	auto valueReg = PrepareSymbolRegisterUseMdAvx(src1, CX86Assembler::xMM0);
 
 	auto gtReg = CX86Assembler::xMM1;
-	auto ltReg = CX86Assembler::xMM2;
-	auto tmpReg = CX86Assembler::xMM3;
+	auto ltReg = GetMdTempRegister(0);
+	auto tmpReg = GetMdTempRegister(1);
 
 	//Comparisons
 	m_assembler.VcmpgtpsVo(gtReg, valueReg, MakeVariable128SymbolAddress(src2));
@@ -559,7 +629,7 @@ void CCodeGen_x86::Emit_Md_Avx_MakeSz_VarVar(const STATEMENT& statement)
 	auto dstRegister = PrepareSymbolRegisterDef(dst, CX86Assembler::rDX);
 	auto src1Register = PrepareSymbolRegisterUseMdAvx(src1, CX86Assembler::xMM0);
 	auto szRegister = CX86Assembler::xMM1;
-	auto zeroRegister = CX86Assembler::xMM2;
+	auto zeroRegister = GetMdTempRegister(0);
 
 	//Compute sign
 	m_assembler.VpsradVo(szRegister, src1Register, 31);
@@ -624,6 +694,95 @@ void CCodeGen_x86::Emit_Md_Avx_ExpandW_VarVarCst(const STATEMENT& statement)
 	CommitSymbolRegisterMdAvx(dst, dstRegister);
 }
 
+void CCodeGen_x86::Emit_Md_Avx_ShuffleW_VarVarCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDefMd(dst, CX86Assembler::xMM0);
+
+	m_assembler.VpshufdVo(dstRegister, MakeVariable128SymbolAddress(src1), static_cast<uint8>(src2->m_valueLow));
+
+	CommitSymbolRegisterMdAvx(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Md_Avx_ShuffleB_VarVarCstCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDefMd(dst, CX86Assembler::xMM0);
+	auto src1Register = PrepareSymbolRegisterUseMdAvx(src1, CX86Assembler::xMM1);
+
+	m_assembler.VpshufbVo(dstRegister, src1Register, MakeConstant128Address(MakeMdShuffleBLiteral(src2->GetConstant64(), src3->GetConstant64())));
+
+	CommitSymbolRegisterMdAvx(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Md_Avx_InsertW_VarVarAnyCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDefMd(dst, CX86Assembler::xMM0);
+	auto src1Register = PrepareSymbolRegisterUseMdAvx(src1, CX86Assembler::xMM1);
+
+	m_assembler.VpinsrdVo(dstRegister, src1Register, MakeMdInsertValueAddress(src2), static_cast<uint8>(src3->m_valueLow));
+
+	CommitSymbolRegisterMdAvx(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Md_Avx_InsertW_VarVarFpvarCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDefMd(dst, CX86Assembler::xMM0);
+	auto src1Register = PrepareSymbolRegisterUseMdAvx(src1, CX86Assembler::xMM1);
+
+	m_assembler.VinsertpsVo(dstRegister, src1Register, MakeVariableFp32SymbolAddress(src2), static_cast<uint8>(src3->m_valueLow << 4));
+
+	CommitSymbolRegisterMdAvx(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Md_Avx_ExtractW_VarVarCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto src1Register = PrepareSymbolRegisterUseMdAvx(src1, CX86Assembler::xMM0);
+
+	m_assembler.VpextrdVo(MakeVariableSymbolAddress(dst), src1Register, static_cast<uint8>(src2->m_valueLow));
+}
+
+void CCodeGen_x86::Emit_Md_Avx_ExtractW_FpvarVarCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	uint8 lane = static_cast<uint8>(src2->m_valueLow);
+	auto laneRegister = CX86Assembler::xMM0;
+
+	if(lane == 0)
+	{
+		laneRegister = PrepareSymbolRegisterUseMdAvx(src1, laneRegister);
+	}
+	else
+	{
+		m_assembler.VpshufdVo(laneRegister, MakeVariable128SymbolAddress(src1), lane);
+	}
+	m_assembler.VmovssEd(MakeVariableFp32SymbolAddress(dst), laneRegister);
+}
+
 void CCodeGen_x86::Emit_Md_Avx2_ExpandW_VarReg(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -778,8 +937,6 @@ void CCodeGen_x86::Emit_Md_Avx_LoadFromRef_VarVarAny(const STATEMENT& statement)
 	auto src2 = statement.src2->GetSymbol().get();
 	uint8 scale = static_cast<uint8>(statement.jmpCondition);
 
-	assert(scale == 1);
-
 	auto dstReg = PrepareSymbolRegisterDefMd(dst, CX86Assembler::xMM0);
 	m_assembler.VmovapsVo(dstReg, MakeRefBaseScaleSymbolAddress(src1, CX86Assembler::rAX, src2, CX86Assembler::rCX, scale));
 	CommitSymbolRegisterMdAvx(dst, dstReg);
@@ -803,8 +960,6 @@ void CCodeGen_x86::Emit_Md_Avx_StoreAtRef_VarAnyVar(const STATEMENT& statement)
 	uint8 scale = static_cast<uint8>(statement.jmpCondition);
 	auto src3 = statement.src3->GetSymbol().get();
 
-	assert(scale == 1);
-
 	auto valueReg = PrepareSymbolRegisterUseMdAvx(src3, CX86Assembler::xMM0);
 	m_assembler.VmovapsVo(MakeRefBaseScaleSymbolAddress(src1, CX86Assembler::rAX, src2, CX86Assembler::rCX, scale), valueReg);
 }
@@ -839,6 +994,104 @@ void CCodeGen_x86::Emit_Md_Avx_StoreAtRefMasked_VarAnyVar(const STATEMENT& state
 	m_assembler.VmovapsVo(dstAddress, tmpReg);
 }
 
+void CCodeGen_x86::Emit_Md_Avx512_AddSSW_VarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto uxRegister = CX86Assembler::xMM0;
+	auto uyRegister = CX86Assembler::xMM1;
+	auto resRegister = GetMdTempRegister(0);
+	auto cstRegister = GetMdTempRegister(1);
+
+	//Same algorithm as the AVX version, but logic combinations are done with vpternlogd
+
+	m_assembler.VmovdqaVo(uxRegister, MakeVariable128SymbolAddress(src1));
+	m_assembler.VmovdqaVo(uyRegister, MakeVariable128SymbolAddress(src2));
+
+	//res = ux + uy
+	m_assembler.VpadddVo(resRegister, uxRegister, CX86Assembler::MakeXmmRegisterAddress(uyRegister));
+
+	//ux = (ux >> 31) + 0x7FFFFFFF
+	m_assembler.VpcmpeqdVo(cstRegister, cstRegister, CX86Assembler::MakeXmmRegisterAddress(cstRegister));
+	m_assembler.VpsrldVo(cstRegister, cstRegister, 1);
+	m_assembler.VpsrldVo(uxRegister, uxRegister, 31);
+	m_assembler.VpadddVo(uxRegister, uxRegister, CX86Assembler::MakeXmmRegisterAddress(cstRegister));
+
+	//uy = ((ux ^ uy) | ~(uy ^ res)) >> 31; (signed operation)
+	m_assembler.VpternlogdVo(uyRegister, uxRegister, CX86Assembler::MakeXmmRegisterAddress(resRegister), 0xBD);
+	m_assembler.VpsradVo(uyRegister, uyRegister, 31);
+
+	//res = (res & uy) | (ux & ~uy)
+	m_assembler.VpternlogdVo(resRegister, uyRegister, CX86Assembler::MakeXmmRegisterAddress(uxRegister), 0xE2);
+
+	m_assembler.VmovdqaVo(MakeVariable128SymbolAddress(dst), resRegister);
+}
+
+void CCodeGen_x86::Emit_Md_Avx512_SubSSW_VarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto uxRegister = CX86Assembler::xMM0;
+	auto uyRegister = CX86Assembler::xMM1;
+	auto resRegister = GetMdTempRegister(0);
+	auto cstRegister = GetMdTempRegister(1);
+
+	m_assembler.VmovdqaVo(uxRegister, MakeVariable128SymbolAddress(src1));
+	m_assembler.VmovdqaVo(uyRegister, MakeVariable128SymbolAddress(src2));
+
+	//res = ux - uy
+	m_assembler.VpsubdVo(resRegister, uxRegister, CX86Assembler::MakeXmmRegisterAddress(uyRegister));
+
+	//ux = (ux >> 31) + 0x7FFFFFFF
+	m_assembler.VpcmpeqdVo(cstRegister, cstRegister, CX86Assembler::MakeXmmRegisterAddress(cstRegister));
+	m_assembler.VpsrldVo(cstRegister, cstRegister, 1);
+	m_assembler.VpsrldVo(uxRegister, uxRegister, 31);
+	m_assembler.VpadddVo(uxRegister, uxRegister, CX86Assembler::MakeXmmRegisterAddress(cstRegister));
+
+	//uy = ((ux ^ uy) & (ux ^ res)) >> 31; (signed operation)
+	m_assembler.VpternlogdVo(uyRegister, uxRegister, CX86Assembler::MakeXmmRegisterAddress(resRegister), 0x24);
+	m_assembler.VpsradVo(uyRegister, uyRegister, 31);
+
+	//res = (res & ~uy) | (ux & uy)
+	m_assembler.VpternlogdVo(resRegister, uyRegister, CX86Assembler::MakeXmmRegisterAddress(uxRegister), 0xB8);
+
+	m_assembler.VmovdqaVo(MakeVariable128SymbolAddress(dst), resRegister);
+}
+
+void CCodeGen_x86::Emit_Md_Avx512_Not_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDefMd(dst, CX86Assembler::xMM0);
+
+	//Table 0x55 only depends on the third operand (~C), no all ones constant needed
+	m_assembler.VpternlogdVo(dstRegister, dstRegister, MakeVariable128SymbolAddress(src1), 0x55);
+
+	CommitSymbolRegisterMdAvx(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Md_Avx512_StoreAtRefMasked_VarAnyVar(const STATEMENT& statement)
+{
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+	uint8 mask = static_cast<uint8>(statement.jmpCondition);
+
+	auto valueReg = PrepareSymbolRegisterUseMdAvx(src3, CX86Assembler::xMM0);
+
+	//Load mask before computing address since address computation might use rAX
+	m_assembler.MovId(CX86Assembler::rAX, mask);
+	m_assembler.KmovwKd(CX86Assembler::kMASK1, CX86Assembler::rAX);
+
+	auto dstAddress = MakeRefBaseScaleSymbolAddress(src1, CX86Assembler::rAX, src2, CX86Assembler::rCX, 1);
+	m_assembler.Vmovdqa32Vo(dstAddress, valueReg, CX86Assembler::kMASK1);
+}
+
 // clang-format off
 CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_mdAvxConstMatchers[] = 
 {
@@ -882,6 +1135,13 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_mdAvxConstMatchers[] =
 	{ OP_MD_MAX_H, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_Avx_VarVarVar<MDOP_MAXH> },
 	{ OP_MD_MAX_W, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_Avx_VarVarVar<MDOP_MAXW> },
 
+	{ OP_MD_MUL_H,   MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_Avx_VarVarVar<MDOP_MULH>   },
+	{ OP_MD_MULHS_H, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_Avx_VarVarVar<MDOP_MULHSH> },
+	{ OP_MD_MULHU_H, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_Avx_VarVarVar<MDOP_MULHUH> },
+	{ OP_MD_MUL_W,   MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_Avx_VarVarVar<MDOP_MULW>   },
+	{ OP_MD_MULS_WD, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_Avx_VarVarVar<MDOP_MULSWD> },
+	{ OP_MD_MULU_WD, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_Avx_VarVarVar<MDOP_MULUWD> },
+
 	{ OP_MD_AND, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_Avx_VarVarVar<MDOP_AND> },
 	{ OP_MD_OR,  MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_Avx_VarVarVar<MDOP_OR>  },
 	{ OP_MD_XOR, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_Avx_VarVarVar<MDOP_XOR> },
@@ -918,6 +1178,20 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_mdAvxConstMatchers[] =
 	{ OP_MD_MIN_S, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_Avx_VarVarVar<MDOP_MINS> },
 	{ OP_MD_MAX_S, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_Avx_VarVarVar<MDOP_MAXS> },
 
+	{ OP_MD_SQRT_S,  MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Md_Avx_VarVar<MDOP_SQRTS>   },
+	{ OP_MD_RSQRT_S, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Md_Avx_RsqrtS_VarVar        },
+	{ OP_MD_RCPL_S,  MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Md_Avx_RcplS_VarVar         },
+
+	{ OP_MD_DOT_S,  MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_Avx_DotS_VarVarVar          },
+
+	{ OP_MD_SHUFFLE_W, MATCH_VARIABLE128,   MATCH_VARIABLE128, MATCH_CONSTANT,      MATCH_NIL,        &CCodeGen_x86::Emit_Md_Avx_ShuffleW_VarVarCst      },
+	{ OP_MD_SHUFFLE_B, MATCH_VARIABLE128,   MATCH_VARIABLE128, MATCH_CONSTANT64,    MATCH_CONSTANT64, &CCodeGen_x86::Emit_Md_Avx_ShuffleB_VarVarCstCst   },
+	{ OP_MD_INSERT_W,  MATCH_VARIABLE128,   MATCH_VARIABLE128, MATCH_ANY32,         MATCH_CONSTANT,   &CCodeGen_x86::Emit_Md_Avx_InsertW_VarVarAnyCst    },
+	{ OP_MD_INSERT_W,  MATCH_VARIABLE128,   MATCH_VARIABLE128, MATCH_FP_VARIABLE32, MATCH_CONSTANT,   &CCodeGen_x86::Emit_Md_Avx_InsertW_VarVarFpvarCst  },
+	{ OP_MD_EXTRACT_W, MATCH_VARIABLE,      MATCH_VARIABLE128, MATCH_CONSTANT,      MATCH_NIL,        &CCodeGen_x86::Emit_Md_Avx_ExtractW_VarVarCst      },
+	{ OP_MD_EXTRACT_W, MATCH_FP_VARIABLE32, MATCH_VARIABLE128, MATCH_CONSTANT,      MATCH_NIL,        &CCodeGen_x86::Emit_Md_Avx_ExtractW_FpvarVarCst    },
+	{ OP_MD_HADD_S, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_Avx_VarVarVar<MDOP_HADDS> },
+
 	{ OP_MD_TOINT32_TRUNC_S, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Md_Avx_VarVar<MDOP_TOINT32_TRUNC_S> },
 	{ OP_MD_TOSINGLE_I32,    MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Md_Avx_VarVar<MDOP_TOSINGLE_I32>    },
 
@@ -970,4 +1244,27 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_mdAvx2ConstMatchers[] =
 
 	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
 };
+
+CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_mdFmaConstMatchers[] =
+{
+	{ OP_MD_FMA_S, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, &CCodeGen_x86::Emit_Md_Fma_FmaS_VarVarVarVar },
+
+	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
+};
+
+//Only covers ops that EVEX makes shorter. Not done on purpose:
+//- xmm16-xmm31 allocation: every MD/FP emitter would need an EVEX version to address them.
+//- Masked moves and loads: already a single vblendps, a k register would add a mov and a kmovw.
+//- Min/max/clamp: already single VEX instructions per step, EVEX forms are equivalent.
+CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_mdAvx512ConstMatchers[] =
+{
+	{ OP_MD_ADDSS_W, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_Avx512_AddSSW_VarVarVar },
+	{ OP_MD_SUBSS_W, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_Avx512_SubSSW_VarVarVar },
+
+	{ OP_MD_NOT, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Md_Avx512_Not_VarVar },
+
+	{ OP_MD_STOREATREF_MASKED, MATCH_NIL, MATCH_VAR_REF, MATCH_ANY32, MATCH_VARIABLE128, &CCodeGen_x86::Emit_Md_Avx512_StoreAtRefMasked_VarAnyVar },
+
+	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
+};
 // clang-format on
@@ -291,8 +291,8 @@ void CCodeGen_x86::Emit_Md_AddSSW_VarVarVar(const STATEMENT& statement)
 
 	auto uxRegister = CX86Assembler::xMM0;
 	auto uyRegister = CX86Assembler::xMM1;
-	auto resRegister = CX86Assembler::xMM2;
-	auto cstRegister = CX86Assembler::xMM3;
+	auto resRegister = GetMdTempRegister(0);
+	auto cstRegister = GetMdTempRegister(1);
 
 	//	This is based on code from http://locklessinc.com/articles/sat_arithmetic/ modified to work without cmovns
 	//	s32b sat_adds32b(s32b x, s32b y)
@@ -374,8 +374,8 @@ void CCodeGen_x86::Emit_Md_SubSSW_VarVarVar(const STATEMENT& statement)
 
 	auto uxRegister = CX86Assembler::xMM0;
 	auto uyRegister = CX86Assembler::xMM1;
-	auto resRegister = CX86Assembler::xMM2;
-	auto cstRegister = CX86Assembler::xMM3;
+	auto resRegister = GetMdTempRegister(0);
+	auto cstRegister = GetMdTempRegister(1);
 
 	//	This is based on code from http://locklessinc.com/articles/sat_arithmetic/ modified to work without cmovns
 	//	s32b sat_subs32b(s32b x, s32b y)
@@ -453,8 +453,8 @@ void CCodeGen_x86::Emit_Md_AddUSW_VarVarVar(const STATEMENT& statement)
 
 	auto xRegister = CX86Assembler::xMM0;
 	auto resRegister = CX86Assembler::xMM1;
-	auto tmpRegister = CX86Assembler::xMM2;
-	auto tmp2Register = CX86Assembler::xMM3;
+	auto tmpRegister = GetMdTempRegister(0);
+	auto tmp2Register = GetMdTempRegister(1);
 
 	//	This is based on code from http://locklessinc.com/articles/sat_arithmetic/
 	//	u32b sat_addu32b(u32b x, u32b y)
@@ -497,8 +497,8 @@ void CCodeGen_x86::Emit_Md_SubUSW_VarVarVar(const STATEMENT& statement)
 
 	auto xRegister = CX86Assembler::xMM0;
 	auto resRegister = CX86Assembler::xMM1;
-	auto tmpRegister = CX86Assembler::xMM2;
-	auto tmp2Register = CX86Assembler::xMM3;
+	auto tmpRegister = GetMdTempRegister(0);
+	auto tmp2Register = GetMdTempRegister(1);
 
 	//	This is based on code from http://locklessinc.com/articles/sat_arithmetic/
 	//	u32b sat_subu32b(u32b x, u32b y)
@@ -545,8 +545,8 @@ void CCodeGen_x86::Emit_Md_MinW_VarVarVar(const STATEMENT& statement)
 
 	auto src1Register = CX86Assembler::xMM0;
 	auto src2Register = CX86Assembler::xMM1;
-	auto mask1Register = CX86Assembler::xMM2;
-	auto mask2Register = CX86Assembler::xMM3;
+	auto mask1Register = GetMdTempRegister(0);
+	auto mask2Register = GetMdTempRegister(1);
 
 	m_assembler.MovdqaVo(src1Register, MakeVariable128SymbolAddress(src1));
 	m_assembler.MovdqaVo(src2Register, MakeVariable128SymbolAddress(src2));
@@ -570,8 +570,8 @@ void CCodeGen_x86::Emit_Md_MaxW_VarVarVar(const STATEMENT& statement)
 
 	auto src1Register = CX86Assembler::xMM0;
 	auto src2Register = CX86Assembler::xMM1;
-	auto mask1Register = CX86Assembler::xMM2;
-	auto mask2Register = CX86Assembler::xMM3;
+	auto mask1Register = GetMdTempRegister(0);
+	auto mask2Register = GetMdTempRegister(1);
 
 	m_assembler.MovdqaVo(src1Register, MakeVariable128SymbolAddress(src1));
 	m_assembler.MovdqaVo(src2Register, MakeVariable128SymbolAddress(src2));
@@ -587,6 +587,65 @@ void CCodeGen_x86::Emit_Md_MaxW_VarVarVar(const STATEMENT& statement)
 	m_assembler.MovdqaVo(MakeVariable128SymbolAddress(dst), mask1Register);
 }
 
+void CCodeGen_x86::Emit_Md_MulW_VarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto src1Register = CX86Assembler::xMM0;
+	auto src2Register = CX86Assembler::xMM1;
+	auto resultRegister = GetMdTempRegister(0);
+
+	m_assembler.MovdqaVo(src1Register, MakeVariable128SymbolAddress(src1));
+	m_assembler.MovdqaVo(src2Register, MakeVariable128SymbolAddress(src2));
+
+	//Even lanes
+	m_assembler.MovdqaVo(resultRegister, CX86Assembler::MakeXmmRegisterAddress(src1Register));
+	m_assembler.PmuludqVo(resultRegister, CX86Assembler::MakeXmmRegisterAddress(src2Register));
+
+	//Odd lanes
+	m_assembler.PsrlqVo(src1Register, 32);
+	m_assembler.PsrlqVo(src2Register, 32);
+	m_assembler.PmuludqVo(src1Register, CX86Assembler::MakeXmmRegisterAddress(src2Register));
+
+	m_assembler.PshufdVo(resultRegister, CX86Assembler::MakeXmmRegisterAddress(resultRegister), 0x08);
+	m_assembler.PshufdVo(src1Register, CX86Assembler::MakeXmmRegisterAddress(src1Register), 0x08);
+	m_assembler.PunpckldqVo(resultRegister, CX86Assembler::MakeXmmRegisterAddress(src1Register));
+
+	m_assembler.MovdqaVo(MakeVariable128SymbolAddress(dst), resultRegister);
+}
+
+void CCodeGen_x86::Emit_Md_MulSWD_VarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto src1Register = CX86Assembler::xMM0;
+	auto src2Register = CX86Assembler::xMM1;
+	auto resultRegister = GetMdTempRegister(0);
+	auto fixupRegister = GetMdTempRegister(1);
+
+	m_assembler.MovdqaVo(src1Register, MakeVariable128SymbolAddress(src1));
+	m_assembler.MovdqaVo(src2Register, MakeVariable128SymbolAddress(src2));
+
+	m_assembler.MovdqaVo(resultRegister, CX86Assembler::MakeXmmRegisterAddress(src1Register));
+	m_assembler.PmuludqVo(resultRegister, CX86Assembler::MakeXmmRegisterAddress(src2Register));
+
+	//Signed product is the unsigned product minus ((src1 < 0) ? src2 : 0) + ((src2 < 0) ? src1 : 0) in the upper half
+	m_assembler.MovdqaVo(fixupRegister, CX86Assembler::MakeXmmRegisterAddress(src1Register));
+	m_assembler.PsradVo(fixupRegister, 31);
+	m_assembler.PandVo(fixupRegister, CX86Assembler::MakeXmmRegisterAddress(src2Register));
+	m_assembler.PsradVo(src2Register, 31);
+	m_assembler.PandVo(src2Register, CX86Assembler::MakeXmmRegisterAddress(src1Register));
+	m_assembler.PadddVo(fixupRegister, CX86Assembler::MakeXmmRegisterAddress(src2Register));
+	m_assembler.PsllqVo(fixupRegister, 32);
+	m_assembler.PsubqVo(resultRegister, CX86Assembler::MakeXmmRegisterAddress(fixupRegister));
+
+	m_assembler.MovdqaVo(MakeVariable128SymbolAddress(dst), resultRegister);
+}
+
 void CCodeGen_x86::Emit_Md_ClampS_RegVar(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -615,6 +674,90 @@ void CCodeGen_x86::Emit_Md_ClampS_MemVar(const STATEMENT& statement)
 	m_assembler.MovdqaVo(MakeVariable128SymbolAddress(dst), dstRegister);
 }
 
+void CCodeGen_x86::Emit_Md_RsqrtS_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto resultRegister = CX86Assembler::xMM0;
+	auto sqrtRegister = CX86Assembler::xMM1;
+
+	m_assembler.SqrtpsVo(sqrtRegister, MakeVariable128SymbolAddress(src1));
+	m_assembler.MovapsVo(resultRegister, MakeConstant128Address(g_fpCstOne));
+	m_assembler.DivpsVo(resultRegister, CX86Assembler::MakeXmmRegisterAddress(sqrtRegister));
+	m_assembler.MovapsVo(MakeVariable128SymbolAddress(dst), resultRegister);
+}
+
+void CCodeGen_x86::Emit_Md_RcplS_VarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+
+	auto resultRegister = CX86Assembler::xMM0;
+
+	m_assembler.MovapsVo(resultRegister, MakeConstant128Address(g_fpCstOne));
+	m_assembler.DivpsVo(resultRegister, MakeVariable128SymbolAddress(src1));
+	m_assembler.MovapsVo(MakeVariable128SymbolAddress(dst), resultRegister);
+}
+
+void CCodeGen_x86::Emit_Md_DotS_VarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	uint8 mask = static_cast<uint8>(statement.jmpCondition);
+
+	auto resultRegister = CX86Assembler::xMM0;
+	auto tempRegister = CX86Assembler::xMM1;
+
+	//Sum is done as (p0 + p1) + (p2 + p3) to match DPPS
+	m_assembler.MovapsVo(resultRegister, MakeVariable128SymbolAddress(src1));
+	m_assembler.MulpsVo(resultRegister, MakeVariable128SymbolAddress(src2));
+	m_assembler.PandVo(resultRegister, MakeConstant128Address(MakeMdLaneMaskLiteral(mask >> 4)));
+
+	m_assembler.MovapsVo(tempRegister, CX86Assembler::MakeXmmRegisterAddress(resultRegister));
+	m_assembler.ShufpsVo(tempRegister, CX86Assembler::MakeXmmRegisterAddress(tempRegister), 0xB1);
+	m_assembler.AddpsVo(resultRegister, CX86Assembler::MakeXmmRegisterAddress(tempRegister));
+
+	m_assembler.MovapsVo(tempRegister, CX86Assembler::MakeXmmRegisterAddress(resultRegister));
+	m_assembler.ShufpsVo(tempRegister, CX86Assembler::MakeXmmRegisterAddress(tempRegister), 0x4E);
+	m_assembler.AddpsVo(resultRegister, CX86Assembler::MakeXmmRegisterAddress(tempRegister));
+
+	m_assembler.PandVo(resultRegister, MakeConstant128Address(MakeMdLaneMaskLiteral(mask & 0x0F)));
+	m_assembler.MovapsVo(MakeVariable128SymbolAddress(dst), resultRegister);
+}
+
+void CCodeGen_x86::Emit_Md_DotS_Sse41_VarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	uint8 mask = static_cast<uint8>(statement.jmpCondition);
+
+	auto resultRegister = CX86Assembler::xMM0;
+
+	m_assembler.MovapsVo(resultRegister, MakeVariable128SymbolAddress(src1));
+	m_assembler.DppsVo(resultRegister, MakeVariable128SymbolAddress(src2), mask);
+	m_assembler.MovapsVo(MakeVariable128SymbolAddress(dst), resultRegister);
+}
+
+void CCodeGen_x86::Emit_Md_HaddS_VarVarVar(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto evenRegister = CX86Assembler::xMM0;
+	auto oddRegister = CX86Assembler::xMM1;
+
+	m_assembler.MovapsVo(evenRegister, MakeVariable128SymbolAddress(src1));
+	m_assembler.MovapsVo(oddRegister, MakeVariable128SymbolAddress(src1));
+	m_assembler.ShufpsVo(evenRegister, MakeVariable128SymbolAddress(src2), 0x88);
+	m_assembler.ShufpsVo(oddRegister, MakeVariable128SymbolAddress(src2), 0xDD);
+	m_assembler.AddpsVo(evenRegister, CX86Assembler::MakeXmmRegisterAddress(oddRegister));
+	m_assembler.MovapsVo(MakeVariable128SymbolAddress(dst), evenRegister);
+}
+
 void CCodeGen_x86::Emit_Md_PackHB_VarVarVar(const STATEMENT& statement)
 {
 	auto dst = statement.dst->GetSymbol().get();
@@ -623,7 +766,7 @@ void CCodeGen_x86::Emit_Md_PackHB_VarVarVar(const STATEMENT& statement)
 
 	auto resultRegister = CX86Assembler::xMM0;
 	auto tempRegister = CX86Assembler::xMM1;
-	auto maskRegister = CX86Assembler::xMM2;
+	auto maskRegister = GetMdTempRegister(0);
 
 	m_assembler.MovapsVo(resultRegister, MakeVariable128SymbolAddress(src2));
 	m_assembler.MovapsVo(tempRegister, MakeVariable128SymbolAddress(src1));
@@ -847,7 +990,7 @@ void CCodeGen_x86::Emit_Md_MakeClip_VarVarVarVar(const STATEMENT& statement)
 
 	auto clipRegister = CX86Assembler::xMM0;
 	auto gtRegister = CX86Assembler::xMM1;
-	auto ltRegister = CX86Assembler::xMM2;
+	auto ltRegister = GetMdTempRegister(0);
 	auto dstRegister = PrepareSymbolRegisterDef(dst, CX86Assembler::rDX);
 
 	m_assembler.MovdqaVo(gtRegister, MakeVariable128SymbolAddress(src1));
@@ -1017,6 +1160,215 @@ void CCodeGen_x86::Emit_Md_ExpandW_VarVarCst(const STATEMENT& statement)
 	CommitSymbolRegisterMdSse(dst, dstRegister);
 }
 
+void CCodeGen_x86::Emit_Md_ShuffleW_VarVarCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDefMd(dst, CX86Assembler::xMM0);
+
+	m_assembler.PshufdVo(dstRegister, MakeVariable128SymbolAddress(src1), static_cast<uint8>(src2->m_valueLow));
+
+	CommitSymbolRegisterMdSse(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Md_ShuffleB_VarVarCstCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	auto resultRegister = CX86Assembler::xMM0;
+	auto tempRegister = CX86Assembler::xMM1;
+
+	m_assembler.PxorVo(resultRegister, CX86Assembler::MakeXmmRegisterAddress(resultRegister));
+	for(const auto& shiftMask : GetMdShuffleBShiftMasks(src2->GetConstant64(), src3->GetConstant64()))
+	{
+		int32 shiftAmount = shiftMask.first;
+		m_assembler.MovdqaVo(tempRegister, MakeVariable128SymbolAddress(src1));
+		if(shiftAmount > 0)
+		{
+			m_assembler.PslldqVo(tempRegister, static_cast<uint8>(shiftAmount));
+		}
+		else if(shiftAmount < 0)
+		{
+			m_assembler.PsrldqVo(tempRegister, static_cast<uint8>(-shiftAmount));
+		}
+		m_assembler.PandVo(tempRegister, MakeConstant128Address(shiftMask.second));
+		m_assembler.PorVo(resultRegister, CX86Assembler::MakeXmmRegisterAddress(tempRegister));
+	}
+	m_assembler.MovdqaVo(MakeVariable128SymbolAddress(dst), resultRegister);
+}
+
+void CCodeGen_x86::Emit_Md_ShuffleB_Ssse3_VarVarCstCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDefMd(dst, CX86Assembler::xMM0);
+
+	if(!dst->IsRegister() || !dst->Equals(src1))
+	{
+		m_assembler.MovdqaVo(dstRegister, MakeVariable128SymbolAddress(src1));
+	}
+	m_assembler.PshufbVo(dstRegister, MakeConstant128Address(MakeMdShuffleBLiteral(src2->GetConstant64(), src3->GetConstant64())));
+
+	CommitSymbolRegisterMdSse(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Md_InsertW(CSymbol* dst, CSymbol* src1, uint8 lane, CX86Assembler::XMMREGISTER valueRegister)
+{
+	auto dstRegister = PrepareSymbolRegisterDefMd(dst, CX86Assembler::xMM0);
+
+	//Swap the target lane with lane 0, replace lane 0 and swap back
+	uint8 swapSelector = 0;
+	for(unsigned int i = 0; i < 4; i++)
+	{
+		unsigned int srcLane = (i == 0) ? lane : ((i == lane) ? 0 : i);
+		swapSelector |= srcLane << (i * 2);
+	}
+
+	if(!dst->IsRegister() || !dst->Equals(src1))
+	{
+		m_assembler.MovapsVo(dstRegister, MakeVariable128SymbolAddress(src1));
+	}
+	if(lane != 0)
+	{
+		m_assembler.PshufdVo(dstRegister, CX86Assembler::MakeXmmRegisterAddress(dstRegister), swapSelector);
+	}
+	m_assembler.MovssEd(dstRegister, CX86Assembler::MakeXmmRegisterAddress(valueRegister));
+	if(lane != 0)
+	{
+		m_assembler.PshufdVo(dstRegister, CX86Assembler::MakeXmmRegisterAddress(dstRegister), swapSelector);
+	}
+
+	CommitSymbolRegisterMdSse(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Md_InsertW_VarVarAnyCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	auto valueRegister = CX86Assembler::xMM1;
+
+	m_assembler.MovdVo(valueRegister, MakeMdInsertValueAddress(src2));
+	Emit_Md_InsertW(dst, src1, static_cast<uint8>(src3->m_valueLow), valueRegister);
+}
+
+void CCodeGen_x86::Emit_Md_InsertW_VarVarFpvarCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	auto valueRegister = CX86Assembler::xMM1;
+
+	LoadSymbolFp32Sse(valueRegister, src2);
+	Emit_Md_InsertW(dst, src1, static_cast<uint8>(src3->m_valueLow), valueRegister);
+}
+
+void CCodeGen_x86::Emit_Md_InsertW_Sse41_VarVarAnyCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDefMd(dst, CX86Assembler::xMM0);
+
+	if(!dst->IsRegister() || !dst->Equals(src1))
+	{
+		m_assembler.MovdqaVo(dstRegister, MakeVariable128SymbolAddress(src1));
+	}
+	m_assembler.PinsrdVo(dstRegister, MakeMdInsertValueAddress(src2), static_cast<uint8>(src3->m_valueLow));
+
+	CommitSymbolRegisterMdSse(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Md_InsertW_Sse41_VarVarFpvarCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+	auto src3 = statement.src3->GetSymbol().get();
+
+	auto dstRegister = PrepareSymbolRegisterDefMd(dst, CX86Assembler::xMM0);
+
+	if(!dst->IsRegister() || !dst->Equals(src1))
+	{
+		m_assembler.MovapsVo(dstRegister, MakeVariable128SymbolAddress(src1));
+	}
+	m_assembler.InsertpsVo(dstRegister, MakeVariableFp32SymbolAddress(src2), static_cast<uint8>(src3->m_valueLow << 4));
+
+	CommitSymbolRegisterMdSse(dst, dstRegister);
+}
+
+void CCodeGen_x86::Emit_Md_ExtractW_VarVarCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	uint8 lane = static_cast<uint8>(src2->m_valueLow);
+	auto laneRegister = CX86Assembler::xMM0;
+
+	if(lane == 0)
+	{
+		laneRegister = PrepareSymbolRegisterUseMdSse(src1, laneRegister);
+	}
+	else
+	{
+		m_assembler.PshufdVo(laneRegister, MakeVariable128SymbolAddress(src1), lane);
+	}
+	m_assembler.MovdVo(MakeVariableSymbolAddress(dst), laneRegister);
+}
+
+void CCodeGen_x86::Emit_Md_ExtractW_Sse41_VarVarCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	auto src1Register = PrepareSymbolRegisterUseMdSse(src1, CX86Assembler::xMM0);
+
+	m_assembler.PextrdVo(MakeVariableSymbolAddress(dst), src1Register, static_cast<uint8>(src2->m_valueLow));
+}
+
+void CCodeGen_x86::Emit_Md_ExtractW_FpvarVarCst(const STATEMENT& statement)
+{
+	auto dst = statement.dst->GetSymbol().get();
+	auto src1 = statement.src1->GetSymbol().get();
+	auto src2 = statement.src2->GetSymbol().get();
+
+	uint8 lane = static_cast<uint8>(src2->m_valueLow);
+	auto laneRegister = CX86Assembler::xMM0;
+
+	if(lane == 0)
+	{
+		laneRegister = PrepareSymbolRegisterUseMdSse(src1, laneRegister);
+	}
+	else
+	{
+		m_assembler.PshufdVo(laneRegister, MakeVariable128SymbolAddress(src1), lane);
+	}
+	if(dst->m_type == SYM_FP_REGISTER32)
+	{
+		m_assembler.MovapsVo(m_mdRegisters[dst->m_valueLow], CX86Assembler::MakeXmmRegisterAddress(laneRegister));
+	}
+	else
+	{
+		m_assembler.MovssEd(MakeMemoryFp32SymbolAddress(dst), laneRegister);
+	}
+}
+
 void CCodeGen_x86::Emit_Md_Srl256_VarMem(CSymbol* dst, CSymbol* src1, const CX86Assembler::CAddress& offsetAddress)
 {
 	auto offsetRegister = CX86Assembler::rAX;
@@ -1100,8 +1452,6 @@ void CCodeGen_x86::Emit_Md_LoadFromRef_VarVarAny(const STATEMENT& statement)
 	auto src2 = statement.src2->GetSymbol().get();
 	uint8 scale = static_cast<uint8>(statement.jmpCondition);
 
-	assert(scale == 1);
-
 	auto dstReg = PrepareSymbolRegisterDefMd(dst, CX86Assembler::xMM0);
 	m_assembler.MovapsVo(dstReg, MakeRefBaseScaleSymbolAddress(src1, CX86Assembler::rAX, src2, CX86Assembler::rCX, scale));
 	CommitSymbolRegisterMdSse(dst, dstReg);
@@ -1125,8 +1475,6 @@ void CCodeGen_x86::Emit_Md_StoreAtRef_VarAnyVar(const STATEMENT& statement)
 	uint8 scale = static_cast<uint8>(statement.jmpCondition);
 	auto src3 = statement.src3->GetSymbol().get();
 
-	assert(scale == 1);
-
 	auto valueReg = PrepareSymbolRegisterUseMdSse(src3, CX86Assembler::xMM0);
 	m_assembler.MovapsVo(MakeRefBaseScaleSymbolAddress(src1, CX86Assembler::rAX, src2, CX86Assembler::rCX, scale), valueReg);
 }
@@ -1193,6 +1541,11 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_mdSseConstMatchers[] =
 
 	MD_CONST_MATCHERS_3OPS(OP_MD_MAX_H, MDOP_MAXH)
 
+	MD_CONST_MATCHERS_3OPS(OP_MD_MUL_H,   MDOP_MULH)
+	MD_CONST_MATCHERS_3OPS(OP_MD_MULHS_H, MDOP_MULHSH)
+	MD_CONST_MATCHERS_3OPS(OP_MD_MULHU_H, MDOP_MULHUH)
+	MD_CONST_MATCHERS_3OPS(OP_MD_MULU_WD, MDOP_MULUWD)
+
 	MD_CONST_MATCHERS_3OPS(OP_MD_AND, MDOP_AND)
 	MD_CONST_MATCHERS_3OPS(OP_MD_OR,  MDOP_OR)
 	MD_CONST_MATCHERS_3OPS(OP_MD_XOR, MDOP_XOR)
@@ -1214,6 +1567,10 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_mdSseConstMatchers[] =
 
 	{ OP_MD_EXPAND_W, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_CONSTANT, MATCH_NIL, &CCodeGen_x86::Emit_Md_ExpandW_VarVarCst },
 
+	{ OP_MD_SHUFFLE_W, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_CONSTANT, MATCH_NIL, &CCodeGen_x86::Emit_Md_ShuffleW_VarVarCst },
+
+	{ OP_MD_EXTRACT_W, MATCH_FP_VARIABLE32, MATCH_VARIABLE128, MATCH_CONSTANT, MATCH_NIL, &CCodeGen_x86::Emit_Md_ExtractW_FpvarVarCst },
+
 	{ OP_MD_PACK_HB, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_PackHB_VarVarVar },
 	{ OP_MD_PACK_WH, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_PackWH_VarVarVar },
 
@@ -1235,6 +1592,10 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_mdSseConstMatchers[] =
 	MD_CONST_MATCHERS_3OPS(OP_MD_MIN_S, MDOP_MINS)
 	MD_CONST_MATCHERS_3OPS(OP_MD_MAX_S, MDOP_MAXS)
 
+	MD_CONST_MATCHERS_2OPS(OP_MD_SQRT_S, MDOP_SQRTS)
+	{ OP_MD_RSQRT_S, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Md_RsqrtS_VarVar },
+	{ OP_MD_RCPL_S,  MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, MATCH_NIL, &CCodeGen_x86::Emit_Md_RcplS_VarVar  },
+
 	MD_CONST_MATCHERS_SINGLEOP(OP_MD_ABS_S, MDOP_ABS)
 	MD_CONST_MATCHERS_SINGLEOP(OP_MD_NEG_S, MDOP_NEG)
 	MD_CONST_MATCHERS_SINGLEOP(OP_MD_NOT,   MDOP_NOT)
@@ -1262,11 +1623,20 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_mdNoSse41ConstMatchers[] =
 	{ OP_MD_MIN_W, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_MinW_VarVarVar },
 	{ OP_MD_MAX_W, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_MaxW_VarVarVar },
 
+	{ OP_MD_MUL_W,   MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_MulW_VarVarVar   },
+	{ OP_MD_MULS_WD, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_MulSWD_VarVarVar },
+
 	{ OP_MD_LOADFROMREF_MASKED, MATCH_VARIABLE128, MATCH_VAR_REF, MATCH_ANY32, MATCH_VARIABLE128, &CCodeGen_x86::Emit_Md_LoadFromRefMasked_VarVarAnyVar },
 	{ OP_MD_STOREATREF_MASKED,  MATCH_NIL,         MATCH_VAR_REF, MATCH_ANY32, MATCH_VARIABLE128, &CCodeGen_x86::Emit_Md_StoreAtRefMasked_VarAnyVar     },
 
 	{ OP_MD_MOV_MASKED, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_MovMasked_VarVarVar },
 
+	{ OP_MD_DOT_S, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_DotS_VarVarVar },
+
+	{ OP_MD_INSERT_W,  MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_ANY32,         MATCH_CONSTANT, &CCodeGen_x86::Emit_Md_InsertW_VarVarAnyCst   },
+	{ OP_MD_INSERT_W,  MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_FP_VARIABLE32, MATCH_CONSTANT, &CCodeGen_x86::Emit_Md_InsertW_VarVarFpvarCst },
+	{ OP_MD_EXTRACT_W, MATCH_VARIABLE,    MATCH_VARIABLE128, MATCH_CONSTANT,      MATCH_NIL,      &CCodeGen_x86::Emit_Md_ExtractW_VarVarCst     },
+
 	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
 };
 
@@ -1275,11 +1645,20 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_mdSse41ConstMatchers[] =
 	MD_CONST_MATCHERS_3OPS(OP_MD_MIN_W, MDOP_MINW)
 	MD_CONST_MATCHERS_3OPS(OP_MD_MAX_W, MDOP_MAXW)
 
+	MD_CONST_MATCHERS_3OPS(OP_MD_MUL_W,   MDOP_MULW)
+	MD_CONST_MATCHERS_3OPS(OP_MD_MULS_WD, MDOP_MULSWD)
+
 	{ OP_MD_LOADFROMREF_MASKED, MATCH_VARIABLE128, MATCH_VAR_REF, MATCH_ANY32, MATCH_VARIABLE128, &CCodeGen_x86::Emit_Md_LoadFromRefMasked_Sse41_VarVarAnyVar },
 	{ OP_MD_STOREATREF_MASKED,  MATCH_NIL,         MATCH_VAR_REF, MATCH_ANY32, MATCH_VARIABLE128, &CCodeGen_x86::Emit_Md_StoreAtRefMasked_Sse41_VarAnyVar     },
 
 	{ OP_MD_MOV_MASKED, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_MovMasked_Sse41_VarVarVar },
 
+	{ OP_MD_DOT_S, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_DotS_Sse41_VarVarVar },
+
+	{ OP_MD_INSERT_W,  MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_ANY32,         MATCH_CONSTANT, &CCodeGen_x86::Emit_Md_InsertW_Sse41_VarVarAnyCst   },
+	{ OP_MD_INSERT_W,  MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_FP_VARIABLE32, MATCH_CONSTANT, &CCodeGen_x86::Emit_Md_InsertW_Sse41_VarVarFpvarCst },
+	{ OP_MD_EXTRACT_W, MATCH_VARIABLE,    MATCH_VARIABLE128, MATCH_CONSTANT,      MATCH_NIL,      &CCodeGen_x86::Emit_Md_ExtractW_Sse41_VarVarCst     },
+
 	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
 };
 
@@ -1288,6 +1667,10 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_mdNoSsse3ConstMatchers[] =
 	{ OP_MD_MAKECLIP,   MATCH_VARIABLE, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, &CCodeGen_x86::Emit_Md_MakeClip_VarVarVarVar },
 	{ OP_MD_MAKESZ,     MATCH_VARIABLE, MATCH_VARIABLE128, MATCH_NIL,         MATCH_NIL,         &CCodeGen_x86::Emit_Md_MakeSz_VarVar         },
 
+	{ OP_MD_HADD_S, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_NIL, &CCodeGen_x86::Emit_Md_HaddS_VarVarVar },
+
+	{ OP_MD_SHUFFLE_B, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_CONSTANT64, MATCH_CONSTANT64, &CCodeGen_x86::Emit_Md_ShuffleB_VarVarCstCst },
+
 	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
 };
 
@@ -1295,6 +1678,10 @@ CCodeGen_x86::CONSTMATCHER CCodeGen_x86::g_mdSsse3ConstMatchers[] =
 {
 	{ OP_MD_MAKECLIP,   MATCH_VARIABLE, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_VARIABLE128, &CCodeGen_x86::Emit_Md_MakeClip_Ssse3_VarVarVarVar },
 	{ OP_MD_MAKESZ,     MATCH_VARIABLE, MATCH_VARIABLE128, MATCH_NIL,         MATCH_NIL,         &CCodeGen_x86::Emit_Md_MakeSz_Ssse3_VarVar         },
+
+	MD_CONST_MATCHERS_3OPS(OP_MD_HADD_S, MDOP_HADDS)
+
+	{ OP_MD_SHUFFLE_B, MATCH_VARIABLE128, MATCH_VARIABLE128, MATCH_CONSTANT64, MATCH_CONSTANT64, &CCodeGen_x86::Emit_Md_ShuffleB_Ssse3_VarVarCstCst },
 	
 	{ OP_MOV, MATCH_NIL, MATCH_NIL, MATCH_NIL, MATCH_NIL, nullptr },
 };
@@ -52,6 +52,14 @@ void CCodeGen_x86::Emit_Shift_RegRegCst(const STATEMENT& statement)
 	assert(dst->m_type == SYM_REGISTER);
 	assert(src1->m_type == SYM_REGISTER);
 
+	if((statement.op == OP_SLL) && (src2->m_valueLow == 1) && !dst->Equals(src1))
+	{
+		//x << 1 = x + x, doesn't need src1 to be copied in dst first
+		auto src1Register = m_registers[src1->m_valueLow];
+		m_assembler.LeaGd(m_registers[dst->m_valueLow], CX86Assembler::MakeBaseOffIndexScaleAddress(src1Register, 0, src1Register, 1));
+		return;
+	}
+
 	if(!dst->Equals(src1))
 	{
 		m_assembler.MovEd(m_registers[dst->m_valueLow], CX86Assembler::MakeRegisterAddress(m_registers[src1->m_valueLow]));
@@ -276,6 +284,42 @@ void CCodeGen_x86::Emit_Shift_MemCstMem(const STATEMENT& statement)
 	m_assembler.MovGd(MakeMemorySymbolAddress(dst), CX86Assembler::rAX);
 }
 
+template <typename SHIFTOP>
+void CCodeGen_x86::Emit_Shift_Bmi2_VarAnyVar(const STATEMENT& statement)
+{
+	CSymbol* dst = statement.dst->GetSymbol().get();
+	CSymbol* src1 = statement.src1->GetSymbol().get();
+	CSymbol* src2 = statement.src2->GetSymbol().get();
+
+	auto amountRegister = PrepareSymbolRegisterUse(src2, CX86Assembler::rCX);
+	auto src1Address = CX86Assembler::MakeRegisterAddress(CX86Assembler::rAX);
+	if(src1->m_type == SYM_CONSTANT)
+	{
+		m_assembler.MovId(CX86Assembler::rAX, src1->m_valueLow);
+	}
+	else
+	{
+		src1Address = MakeVariableSymbolAddress(src1);
+	}
+	auto dstRegister = PrepareSymbolRegisterDef(dst, CX86Assembler::rAX);
+	((m_assembler).*(SHIFTOP::OpVarBmi2()))(dstRegister, src1Address, amountRegister);
+	CommitSymbolRegister(dst, dstRegister);
+}
+
+template <typename SHIFTOP>
+void CCodeGen_x86::Emit_Rotate_Bmi2_VarVarCst(const STATEMENT& statement)
+{
+	CSymbol* dst = statement.dst->GetSymbol().get();
+	CSymbol* src1 = statement.src1->GetSymbol().get();
+	CSymbol* src2 = statement.src2->GetSymbol().get();
+
+	assert(src2->m_type == SYM_CONSTANT);
+
+	auto dstRegister = PrepareSymbolRegisterDef(dst, CX86Assembler::rAX);
+	m_assembler.RorxEd(dstRegister, MakeVariableSymbolAddress(src1), SHIFTOP::RorxAmount(static_cast<uint8>(src2->m_valueLow)));
+	CommitSymbolRegister(dst, dstRegister);
+}
+
 // clang-format off
 #define SHIFT_CONST_MATCHERS(SHIFTOP_CST, SHIFTOP) \
 	{ SHIFTOP_CST, MATCH_REGISTER, MATCH_REGISTER, MATCH_REGISTER, MATCH_NIL, &CCodeGen_x86::Emit_Shift_RegRegReg<SHIFTOP> }, \
@@ -60,6 +60,13 @@ CJitter::VERSIONED_STATEMENT_LIST CJitter::GenerateVersionedStatementList(const
 				unsigned int currentVersion = relativeVersions.GetRelativeVersion(symbol->m_valueLow);
 				symbolRef = std::make_shared<CSymbolRef>(symbolRef->GetSymbol(), currentVersion);
 			}
+			else if(CSymbol* symbol = dynamic_symbolref_cast(SYM_FP_RELATIVE64, symbolRef))
+			{
+				unsigned int currentVersion =
+				    relativeVersions.GetRelativeVersion(symbol->m_valueLow + 0x0) +
+				    relativeVersions.GetRelativeVersion(symbol->m_valueLow + 0x4);
+				symbolRef = std::make_shared<CSymbolRef>(symbolRef->GetSymbol(), currentVersion);
+			}
 			else if(CSymbol* symbol = dynamic_symbolref_cast(SYM_RELATIVE128, symbolRef))
 			{
 				//Since this symbol can be aliased, use the sum of the versions of all
@@ -94,6 +101,11 @@ CJitter::VERSIONED_STATEMENT_LIST CJitter::GenerateVersionedStatementList(const
 		{
 			result.relativeVersions.IncrementRelativeVersion(dst->m_valueLow);
 		}
+		else if(auto dst = dynamic_symbolref_cast(SYM_FP_RELATIVE64, newStatement.dst))
+		{
+			result.relativeVersions.IncrementRelativeVersion(dst->m_valueLow + 0);
+			result.relativeVersions.IncrementRelativeVersion(dst->m_valueLow + 4);
+		}
 		else if(auto dst = dynamic_symbolref_cast(SYM_RELATIVE64, newStatement.dst))
 		{
 			result.relativeVersions.IncrementRelativeVersion(dst->m_valueLow + 0);
@@ -155,6 +167,10 @@ void CJitter::Compile()
 				{
 					MergeCmpSelectOps(basicBlock.statements);
 				}
+				if(m_fpContractionEnabled && m_codeGenSupportsFma)
+				{
+					ContractMulAddOps(basicBlock.statements);
+				}
 
 				auto versionedStatements = GenerateVersionedStatementList(basicBlock.statements);
 
@@ -163,7 +179,10 @@ void CJitter::Compile()
 					bool dirty = false;
 					dirty |= ConstantPropagation(versionedStatements.statements);
 					dirty |= ConstantFolding(versionedStatements.statements);
+					dirty |= AlgebraicSimplification(versionedStatements.statements);
+					dirty |= StrengthReduction(versionedStatements.statements);
 					dirty |= ReorderAdd(versionedStatements.statements);
+					dirty |= AddressModeFolding(versionedStatements.statements);
 					dirty |= CopyPropagation(versionedStatements.statements);
 					dirty |= DeadcodeElimination(versionedStatements);
 					dirty |= CommonExpressionElimination(versionedStatements);
@@ -180,10 +199,14 @@ void CJitter::Compile()
 		bool dirty = false;
 		dirty |= PruneBlocks();
 		dirty |= MergeBlocks();
+		dirty |= IfConversion();
 
 		if(!dirty) break;
 	}
 
+	//This needs to be done once blocks are final since moved temporaries will live across blocks
+	HoistLoopInvariants();
+
 	unsigned int stackSize = 0;
 
 	//Allocate registers
@@ -202,6 +225,8 @@ void CJitter::Compile()
 		NormalizeStatements(basicBlock);
 	}
 
+	stackSize = AllocateCrossBlockTemporaries(stackSize);
+
 	auto result = ConcatBlocks(m_basicBlocks);
 
 #ifdef DUMP_STATEMENTS
@@ -478,6 +503,67 @@ bool CJitter::FoldConstantOperation(STATEMENT& statement)
 			changed = true;
 		}
 	}
+	else if(statement.op == OP_TZC)
+	{
+		if(src1cst)
+		{
+			uint32 value = src1cst->m_valueLow;
+			uint32 result = (value == 0) ? 32 : __builtin_ctz(value);
+			statement.op = OP_MOV;
+			statement.src1 = MakeSymbolRef(MakeSymbol(SYM_CONSTANT, result));
+			changed = true;
+		}
+	}
+	else if(statement.op == OP_POPCNT)
+	{
+		if(src1cst)
+		{
+			uint32 result = __builtin_popcount(src1cst->m_valueLow);
+			statement.op = OP_MOV;
+			statement.src1 = MakeSymbolRef(MakeSymbol(SYM_CONSTANT, result));
+			changed = true;
+		}
+	}
+	else if((statement.op == OP_ROTL) || (statement.op == OP_ROTR))
+	{
+		if(src1cst && src2cst)
+		{
+			uint32 amount = src2cst->m_valueLow & 0x1F;
+			if(statement.op == OP_ROTR) amount = (32 - amount) & 0x1F;
+			uint32 result = __builtin_rotateleft32(src1cst->m_valueLow, amount);
+			statement.op = OP_MOV;
+			statement.src1 = MakeSymbolRef(MakeSymbol(SYM_CONSTANT, result));
+			statement.src2.reset();
+			changed = true;
+		}
+		else if(src2cst && ((src2cst->m_valueLow & 0x1F) == 0))
+		{
+			statement.op = OP_MOV;
+			statement.src2.reset();
+			changed = true;
+		}
+	}
+	else if(statement.op == OP_BSWAP16)
+	{
+		if(src1cst)
+		{
+			uint32 value = src1cst->m_valueLow;
+			uint32 result = ((value & 0xFF) << 8) | ((value >> 8) & 0xFF);
+			statement.op = OP_MOV;
+			statement.src1 = MakeSymbolRef(MakeSymbol(SYM_CONSTANT, result));
+			changed = true;
+		}
+	}
+	else if(statement.op == OP_BSWAP)
+	{
+		if(src1cst)
+		{
+			uint32 result = __builtin_bswap32(src1cst->m_valueLow);
+			statement.op = OP_MOV;
+			statement.src1 = MakeSymbolRef(MakeSymbol(SYM_CONSTANT, result));
+			changed = true;
+		}
+	}
 	else if(statement.op == OP_MERGETO64)
 	{
 		if(src1cst && src2cst)
@@ -531,11 +617,6 @@ bool CJitter::FoldConstantOperation(STATEMENT& statement)
 			statement.src2.reset();
 			changed = true;
 		}
-		//else if(src2cst && IsPowerOfTwo(src2cst->m_valueLow))
-		//{
-		//	statement.op = OP_SRL;
-		//	src2cst->m_valueLow = GetPowerOf2(src2cst->m_valueLow);
-		//}
 	}
 	else if(statement.op == OP_DIVS)
 	{
@@ -618,6 +699,17 @@ bool CJitter::FoldConstantOperation(STATEMENT& statement)
 			changed = true;
 		}
 	}
+	else if(statement.op == OP_SELECT64)
+	{
+		if(src1cst)
+		{
+			statement.op = OP_MOV;
+			statement.src1 = (src1cst->m_valueLow != 0) ? statement.src2 : statement.src3;
+			statement.src2.reset();
+			statement.src3.reset();
+			changed = true;
+		}
+	}
 	else if(statement.op == OP_CONDJMP)
 	{
 		if(src1cst && src2cst)
@@ -634,6 +726,18 @@ bool CJitter::FoldConstantOperation(STATEMENT& statement)
 			case CONDITION_BL:
 				result = static_cast<uint32>(src1cst->m_valueLow) < static_cast<uint32>(src2cst->m_valueLow);
 				break;
+			case CONDITION_BE:
+				result = static_cast<uint32>(src1cst->m_valueLow) <= static_cast<uint32>(src2cst->m_valueLow);
+				break;
+			case CONDITION_AB:
+				result = static_cast<uint32>(src1cst->m_valueLow) > static_cast<uint32>(src2cst->m_valueLow);
+				break;
+			case CONDITION_AE:
+				result = static_cast<uint32>(src1cst->m_valueLow) >= static_cast<uint32>(src2cst->m_valueLow);
+				break;
+			case CONDITION_LT:
+				result = static_cast<int32>(src1cst->m_valueLow) < static_cast<int32>(src2cst->m_valueLow);
+				break;
 			case CONDITION_LE:
 				result = static_cast<int32>(src1cst->m_valueLow) <= static_cast<int32>(src2cst->m_valueLow);
 				break;
@@ -660,6 +764,33 @@ bool CJitter::FoldConstantOperation(STATEMENT& statement)
 			statement.src2.reset();
 		}
 	}
+	else if(statement.op == OP_TESTJMP)
+	{
+		if(src1cst && src2cst)
+		{
+			bool isZero = (src1cst->m_valueLow & src2cst->m_valueLow) == 0;
+			assert((statement.jmpCondition == CONDITION_EQ) || (statement.jmpCondition == CONDITION_NE));
+			changed = true;
+			statement.op = (isZero == (statement.jmpCondition == CONDITION_EQ)) ? OP_JMP : OP_NOP;
+			statement.src1.reset();
+			statement.src2.reset();
+		}
+	}
+	else if((statement.op == OP_SWITCH) || (statement.op == OP_JMPTABLE))
+	{
+		if(src1cst)
+		{
+			uint32 index = src1cst->m_valueLow;
+			if(index < statement.jmpTable->size())
+			{
+				statement.jmpBlock = (*statement.jmpTable)[index];
+			}
+			statement.op = (statement.op == OP_SWITCH) ? OP_GOTO : OP_JMP;
+			statement.src1.reset();
+			statement.jmpTable.reset();
+			changed = true;
+		}
+	}
 
 	return changed;
 }
@@ -747,6 +878,105 @@ bool CJitter::FoldConstant64Operation(STATEMENT& statement)
 			changed = true;
 		}
 	}
+	else if(statement.op == OP_OR64)
+	{
+		if(src1cst && src2cst)
+		{
+			uint64 result = src1cst->GetConstant64() | src2cst->GetConstant64();
+			statement.op = OP_MOV;
+			statement.src1 = MakeSymbolRef(MakeConstant64(result));
+			statement.src2.reset();
+			changed = true;
+		}
+	}
+	else if(statement.op == OP_XOR64)
+	{
+		if(src1cst && src2cst)
+		{
+			uint64 result = src1cst->GetConstant64() ^ src2cst->GetConstant64();
+			statement.op = OP_MOV;
+			statement.src1 = MakeSymbolRef(MakeConstant64(result));
+			statement.src2.reset();
+			changed = true;
+		}
+	}
+	else if(statement.op == OP_NOT64)
+	{
+		if(src1cst)
+		{
+			uint64 result = ~src1cst->GetConstant64();
+			statement.op = OP_MOV;
+			statement.src1 = MakeSymbolRef(MakeConstant64(result));
+			changed = true;
+		}
+	}
+	else if(statement.op == OP_BSWAP64)
+	{
+		if(src1cst)
+		{
+			uint64 result = __builtin_bswap64(src1cst->GetConstant64());
+			statement.op = OP_MOV;
+			statement.src1 = MakeSymbolRef(MakeConstant64(result));
+			changed = true;
+		}
+	}
+	else if(statement.op == OP_MUL64)
+	{
+		if(src1cst && src2cst)
+		{
+			uint64 result = src1cst->GetConstant64() * src2cst->GetConstant64();
+			statement.op = OP_MOV;
+			statement.src1 = MakeSymbolRef(MakeConstant64(result));
+			statement.src2.reset();
+			changed = true;
+		}
+		else if(src2cst && (src2cst->GetConstant64() == 1))
+		{
+			statement.op = OP_MOV;
+			statement.src2.reset();
+			changed = true;
+		}
+		else if(src1cst && (src1cst->GetConstant64() == 1))
+		{
+			statement.op = OP_MOV;
+			statement.src1 = statement.src2;
+			statement.src2.reset();
+			changed = true;
+		}
+	}
+	else if((statement.op == OP_DIV64) || (statement.op == OP_DIVS64))
+	{
+		if(src1cst && src2cst)
+		{
+			uint64 cst1 = src1cst->GetConstant64();
+			uint64 cst2 = src2cst->GetConstant64();
+			//Result of a division by 0 is undefined, just produce 0
+			uint64 result = 0;
+			if(cst2 != 0)
+			{
+				if(statement.op == OP_DIVS64)
+				{
+					//INT64_MIN / -1 overflows and wraps around to INT64_MIN
+					bool overflows = (cst1 == 0x8000000000000000ULL) && (cst2 == ~0ULL);
+					result = overflows ? cst1 : static_cast<uint64>(static_cast<int64>(cst1) / static_cast<int64>(cst2));
+				}
+				else
+				{
+					result = cst1 / cst2;
+				}
+			}
+			statement.op = OP_MOV;
+			statement.src1 = MakeSymbolRef(MakeConstant64(result));
+			statement.src2.reset();
+			changed = true;
+		}
+		else if(src2cst && (src2cst->GetConstant64() == 1))
+		{
+			statement.op = OP_MOV;
+			statement.src2.reset();
+			changed = true;
+		}
+	}
 	else if(statement.op == OP_CMP64)
 	{
 		if(src1cst && src2cst)
@@ -819,6 +1049,26 @@ bool CJitter::FoldConstant6432Operation(STATEMENT& statement)
 			changed = true;
 		}
 	}
+	else if((statement.op == OP_ROTL64) || (statement.op == OP_ROTR64))
+	{
+		if(src1cst && src2cst)
+		{
+			uint64 value = src1cst->GetConstant64();
+			uint32 amount = src2cst->m_valueLow & 0x3F;
+			if(statement.op == OP_ROTR64) amount = (64 - amount) & 0x3F;
+			uint64 result = (amount == 0) ? value : ((value << amount) | (value >> (64 - amount)));
+			statement.op = OP_MOV;
+			statement.src1 = MakeSymbolRef(MakeConstant64(result));
+			statement.src2.reset();
+			changed = true;
+		}
+		else if(src2cst && ((src2cst->m_valueLow & 0x3F) == 0))
+		{
+			statement.op = OP_MOV;
+			statement.src2.reset();
+			changed = true;
+		}
+	}
 
 	return changed;
 }
@@ -873,88 +1123,605 @@ bool CJitter::ConstantFolding(StatementList& statements)
 	return changed;
 }
 
-void CJitter::FixFlowControl(StatementList& statements)
+CJitter::SymbolUseCountMap CJitter::CountTemporaryDefinitions(const StatementList& statements)
 {
-	//Resolve GOTO instructions
-	for(auto& statement : statements)
+	SymbolUseCountMap definitionCounts;
+	for(const auto& statement : statements)
 	{
-		if(statement.op == OP_GOTO)
+		if(statement.dst && statement.dst->GetSymbol()->IsTemporary())
 		{
-			LabelMapType::const_iterator labelIterator = m_labels.find(statement.jmpBlock);
-			assert(labelIterator != m_labels.end());
-			if(labelIterator == m_labels.end()) continue;
-
-			statement.op = OP_JMP;
-			statement.jmpBlock = labelIterator->second;
+			definitionCounts[statement.dst->GetSymbol().get()]++;
 		}
 	}
+	return definitionCounts;
+}
 
-	//Remove any excess flow control instructions
-	for(StatementList::iterator statementIterator(statements.begin());
-	    statementIterator != statements.end(); ++statementIterator)
+static bool IsSymbolModifiedBetween(StatementList::const_iterator beginIterator, StatementList::const_iterator endIterator, const SymbolRefPtr& symbolRef)
+{
+	auto symbol = symbolRef->GetSymbol();
+	if(symbol->IsConstant()) return false;
+	for(auto statementIterator(beginIterator); statementIterator != endIterator; ++statementIterator)
 	{
-		const STATEMENT& statement(*statementIterator);
-
-		if(statement.op == OP_JMP || statement.op == OP_CONDJMP)
-		{
-			++statementIterator;
-			statements.erase(statementIterator, statements.end());
-			break;
-		}
+		const auto& statement(*statementIterator);
+		//Calls can modify anything in the context
+		if((statement.op == OP_CALL) && !symbol->IsTemporary()) return true;
+		if(!statement.dst) continue;
+		auto dstSymbol = statement.dst->GetSymbol();
+		if(dstSymbol->Equals(symbol.get()) || dstSymbol->Aliases(symbol.get())) return true;
 	}
+	return false;
 }
 
-void CJitter::MergeBasicBlocks(BASIC_BLOCK& dstBlock, const BASIC_BLOCK& srcBlock)
+// clang-format off
+const CJitter::ALGEBRAIC_RULE CJitter::g_algebraicRules[] =
 {
-	auto& dstSymbolTable = dstBlock.symbolTable;
-
-	for(auto statement : srcBlock.statements)
+	{ OP_ADD,        OPERAND_ANY,  OPERAND_ZERO, RESULT_SRC1 },
+	{ OP_ADD,        OPERAND_ZERO, OPERAND_ANY,  RESULT_SRC2 },
+	{ OP_SUB,        OPERAND_ANY,  OPERAND_ZERO, RESULT_SRC1 },
+	{ OP_SUB,        OPERAND_ANY,  OPERAND_SAME, RESULT_ZERO },
+	{ OP_AND,        OPERAND_ANY,  OPERAND_ZERO, RESULT_ZERO },
+	{ OP_AND,        OPERAND_ZERO, OPERAND_ANY,  RESULT_ZERO },
+	{ OP_AND,        OPERAND_ANY,  OPERAND_ONES, RESULT_SRC1 },
+	{ OP_AND,        OPERAND_ONES, OPERAND_ANY,  RESULT_SRC2 },
+	{ OP_AND,        OPERAND_ANY,  OPERAND_SAME, RESULT_SRC1 },
+	{ OP_OR,         OPERAND_ANY,  OPERAND_ZERO, RESULT_SRC1 },
+	{ OP_OR,         OPERAND_ZERO, OPERAND_ANY,  RESULT_SRC2 },
+	{ OP_OR,         OPERAND_ANY,  OPERAND_ONES, RESULT_ONES },
+	{ OP_OR,         OPERAND_ONES, OPERAND_ANY,  RESULT_ONES },
+	{ OP_OR,         OPERAND_ANY,  OPERAND_SAME, RESULT_SRC1 },
+	{ OP_XOR,        OPERAND_ANY,  OPERAND_ZERO, RESULT_SRC1 },
+	{ OP_XOR,        OPERAND_ZERO, OPERAND_ANY,  RESULT_SRC2 },
+	{ OP_XOR,        OPERAND_ANY,  OPERAND_SAME, RESULT_ZERO },
+	{ OP_SLL,        OPERAND_ZERO, OPERAND_ANY,  RESULT_ZERO },
+	{ OP_SRL,        OPERAND_ZERO, OPERAND_ANY,  RESULT_ZERO },
+	{ OP_SRA,        OPERAND_ZERO, OPERAND_ANY,  RESULT_ZERO },
+	{ OP_SRA,        OPERAND_ONES, OPERAND_ANY,  RESULT_ONES },
+	{ OP_ROTL,       OPERAND_ZERO, OPERAND_ANY,  RESULT_ZERO },
+	{ OP_ROTL,       OPERAND_ONES, OPERAND_ANY,  RESULT_ONES },
+	{ OP_ROTR,       OPERAND_ZERO, OPERAND_ANY,  RESULT_ZERO },
+	{ OP_ROTR,       OPERAND_ONES, OPERAND_ANY,  RESULT_ONES },
+
+	{ OP_ADD64,      OPERAND_ANY,  OPERAND_ZERO, RESULT_SRC1 },
+	{ OP_ADD64,      OPERAND_ZERO, OPERAND_ANY,  RESULT_SRC2 },
+	{ OP_SUB64,      OPERAND_ANY,  OPERAND_ZERO, RESULT_SRC1 },
+	{ OP_SUB64,      OPERAND_ANY,  OPERAND_SAME, RESULT_ZERO },
+	{ OP_AND64,      OPERAND_ANY,  OPERAND_ZERO, RESULT_ZERO },
+	{ OP_AND64,      OPERAND_ZERO, OPERAND_ANY,  RESULT_ZERO },
+	{ OP_AND64,      OPERAND_ANY,  OPERAND_ONES, RESULT_SRC1 },
+	{ OP_AND64,      OPERAND_ONES, OPERAND_ANY,  RESULT_SRC2 },
+	{ OP_AND64,      OPERAND_ANY,  OPERAND_SAME, RESULT_SRC1 },
+	{ OP_OR64,       OPERAND_ANY,  OPERAND_ZERO, RESULT_SRC1 },
+	{ OP_OR64,       OPERAND_ZERO, OPERAND_ANY,  RESULT_SRC2 },
+	{ OP_OR64,       OPERAND_ANY,  OPERAND_ONES, RESULT_ONES },
+	{ OP_OR64,       OPERAND_ONES, OPERAND_ANY,  RESULT_ONES },
+	{ OP_OR64,       OPERAND_ANY,  OPERAND_SAME, RESULT_SRC1 },
+	{ OP_XOR64,      OPERAND_ANY,  OPERAND_ZERO, RESULT_SRC1 },
+	{ OP_XOR64,      OPERAND_ZERO, OPERAND_ANY,  RESULT_SRC2 },
+	{ OP_XOR64,      OPERAND_ANY,  OPERAND_SAME, RESULT_ZERO },
+	{ OP_MUL64,      OPERAND_ANY,  OPERAND_ZERO, RESULT_ZERO },
+	{ OP_MUL64,      OPERAND_ZERO, OPERAND_ANY,  RESULT_ZERO },
+	{ OP_SLL64,      OPERAND_ZERO, OPERAND_ANY,  RESULT_ZERO },
+	{ OP_SRL64,      OPERAND_ZERO, OPERAND_ANY,  RESULT_ZERO },
+	{ OP_SRA64,      OPERAND_ZERO, OPERAND_ANY,  RESULT_ZERO },
+	{ OP_ROTL64,     OPERAND_ZERO, OPERAND_ANY,  RESULT_ZERO },
+	{ OP_ROTL64,     OPERAND_ONES, OPERAND_ANY,  RESULT_ONES },
+	{ OP_ROTR64,     OPERAND_ZERO, OPERAND_ANY,  RESULT_ZERO },
+	{ OP_ROTR64,     OPERAND_ONES, OPERAND_ANY,  RESULT_ONES },
+
+	{ OP_MD_AND,     OPERAND_ANY,  OPERAND_ZERO, RESULT_ZERO },
+	{ OP_MD_AND,     OPERAND_ZERO, OPERAND_ANY,  RESULT_ZERO },
+	{ OP_MD_AND,     OPERAND_ANY,  OPERAND_ONES, RESULT_SRC1 },
+	{ OP_MD_AND,     OPERAND_ONES, OPERAND_ANY,  RESULT_SRC2 },
+	{ OP_MD_AND,     OPERAND_ANY,  OPERAND_SAME, RESULT_SRC1 },
+	{ OP_MD_OR,      OPERAND_ANY,  OPERAND_ZERO, RESULT_SRC1 },
+	{ OP_MD_OR,      OPERAND_ZERO, OPERAND_ANY,  RESULT_SRC2 },
+	{ OP_MD_OR,      OPERAND_ANY,  OPERAND_ONES, RESULT_ONES },
+	{ OP_MD_OR,      OPERAND_ONES, OPERAND_ANY,  RESULT_ONES },
+	{ OP_MD_OR,      OPERAND_ANY,  OPERAND_SAME, RESULT_SRC1 },
+	{ OP_MD_XOR,     OPERAND_ANY,  OPERAND_ZERO, RESULT_SRC1 },
+	{ OP_MD_XOR,     OPERAND_ZERO, OPERAND_ANY,  RESULT_SRC2 },
+	{ OP_MD_XOR,     OPERAND_ANY,  OPERAND_SAME, RESULT_ZERO },
+	{ OP_MD_ADD_B,   OPERAND_ANY,  OPERAND_ZERO, RESULT_SRC1 },
+	{ OP_MD_ADD_B,   OPERAND_ZERO, OPERAND_ANY,  RESULT_SRC2 },
+	{ OP_MD_ADD_H,   OPERAND_ANY,  OPERAND_ZERO, RESULT_SRC1 },
+	{ OP_MD_ADD_H,   OPERAND_ZERO, OPERAND_ANY,  RESULT_SRC2 },
+	{ OP_MD_ADD_W,   OPERAND_ANY,  OPERAND_ZERO, RESULT_SRC1 },
+	{ OP_MD_ADD_W,   OPERAND_ZERO, OPERAND_ANY,  RESULT_SRC2 },
+	{ OP_MD_SUB_B,   OPERAND_ANY,  OPERAND_ZERO, RESULT_SRC1 },
+	{ OP_MD_SUB_B,   OPERAND_ANY,  OPERAND_SAME, RESULT_ZERO },
+	{ OP_MD_SUB_H,   OPERAND_ANY,  OPERAND_ZERO, RESULT_SRC1 },
+	{ OP_MD_SUB_H,   OPERAND_ANY,  OPERAND_SAME, RESULT_ZERO },
+	{ OP_MD_SUB_W,   OPERAND_ANY,  OPERAND_ZERO, RESULT_SRC1 },
+	{ OP_MD_SUB_W,   OPERAND_ANY,  OPERAND_SAME, RESULT_ZERO },
+	{ OP_MD_CMPEQ_B, OPERAND_ANY,  OPERAND_SAME, RESULT_ONES },
+	{ OP_MD_CMPEQ_H, OPERAND_ANY,  OPERAND_SAME, RESULT_ONES },
+	{ OP_MD_CMPEQ_W, OPERAND_ANY,  OPERAND_SAME, RESULT_ONES },
+	{ OP_MD_CMPGT_B, OPERAND_ANY,  OPERAND_SAME, RESULT_ZERO },
+	{ OP_MD_CMPGT_H, OPERAND_ANY,  OPERAND_SAME, RESULT_ZERO },
+	{ OP_MD_CMPGT_W, OPERAND_ANY,  OPERAND_SAME, RESULT_ZERO },
+	{ OP_MD_MIN_H,   OPERAND_ANY,  OPERAND_SAME, RESULT_SRC1 },
+	{ OP_MD_MIN_W,   OPERAND_ANY,  OPERAND_SAME, RESULT_SRC1 },
+	{ OP_MD_MAX_H,   OPERAND_ANY,  OPERAND_SAME, RESULT_SRC1 },
+	{ OP_MD_MAX_W,   OPERAND_ANY,  OPERAND_SAME, RESULT_SRC1 },
+};
+// clang-format on
+
+CJitter::ALGEBRAIC_OPERAND CJitter::ClassifyOperand(const SymbolRefPtr& symbolRef, const DefinitionMap& definitions) const
+{
+	if(!symbolRef) return OPERAND_ANY;
+	auto symbol = symbolRef->GetSymbol().get();
+	if(symbol->m_type == SYM_CONSTANT)
 	{
-		statement.VisitOperands(
-		    [&dstSymbolTable](SymbolRefPtr& symbolRef, bool) {
-			    auto symbol = symbolRef->GetSymbol();
-			    symbolRef = std::make_shared<CSymbolRef>(dstSymbolTable.MakeSymbol(symbol));
-		    });
-		dstBlock.statements.push_back(statement);
+		if(symbol->m_valueLow == 0) return OPERAND_ZERO;
+		if(symbol->m_valueLow == ~0U) return OPERAND_ONES;
 	}
-
-	dstBlock.optimized = false;
+	else if(symbol->m_type == SYM_CONSTANT64)
+	{
+		if(symbol->GetConstant64() == 0) return OPERAND_ZERO;
+		if(symbol->GetConstant64() == ~0ULL) return OPERAND_ONES;
+	}
+	else if(symbol->m_type == SYM_TEMPORARY128)
+	{
+		//Check if it has been defined by a constant expansion
+		auto definitionIterator = definitions.find(symbol);
+		if(definitionIterator == std::end(definitions)) return OPERAND_ANY;
+		const auto& definition = *definitionIterator->second;
+		if(definition.op != OP_MD_EXPAND_W) return OPERAND_ANY;
+		if(definition.src2) return OPERAND_ANY;
+		auto cst = dynamic_symbolref_cast(SYM_CONSTANT, definition.src1);
+		if(!cst) return OPERAND_ANY;
+		if(cst->m_valueLow == 0) return OPERAND_ZERO;
+		if(cst->m_valueLow == ~0U) return OPERAND_ONES;
+	}
+	return OPERAND_ANY;
 }
 
-CJitter::BASIC_BLOCK CJitter::ConcatBlocks(const BasicBlockList& blocks)
+void CJitter::SetStatementToConstant(STATEMENT& statement, uint32 value)
 {
-	BASIC_BLOCK result;
-	for(const auto& basicBlock : blocks)
+	switch(statement.dst->GetSymbol()->GetSize())
 	{
-		//First, add a mark label statement
-		STATEMENT labelStatement;
-		labelStatement.op = OP_LABEL;
-		labelStatement.jmpBlock = basicBlock.id;
-		result.statements.push_back(labelStatement);
-
-		MergeBasicBlocks(result, basicBlock);
+	case 4:
+		statement.op = OP_MOV;
+		statement.src1 = MakeSymbolRef(MakeSymbol(SYM_CONSTANT, value));
+		break;
+	case 8:
+		statement.op = OP_MOV;
+		statement.src1 = MakeSymbolRef(MakeConstant64((value == 0) ? 0ULL : ~0ULL));
+		break;
+	case 16:
+		statement.op = OP_MD_EXPAND_W;
+		statement.src1 = MakeSymbolRef(MakeSymbol(SYM_CONSTANT, value));
+		break;
+	default:
+		assert(false);
+		break;
 	}
-	return result;
+	statement.src2.reset();
+	statement.src3.reset();
+	statement.jmpCondition = CONDITION_NEVER;
 }
 
-bool CJitter::PruneBlocks()
+bool CJitter::ApplyAlgebraicRules(STATEMENT& statement, const DefinitionMap& definitions)
 {
-	bool changed = true;
-	int deletedBlocks = 0;
+	if(!statement.dst || !statement.src1 || !statement.src2) return false;
 
-	while(changed)
-	{
-		changed = false;
+	auto src1Operand = ClassifyOperand(statement.src1, definitions);
+	auto src2Operand = ClassifyOperand(statement.src2, definitions);
+	bool sameOperands = statement.src1->Equals(statement.src2.get());
 
-		auto toDeleteIterator = m_basicBlocks.cend();
-		for(auto outerBlockIterator(m_basicBlocks.cbegin());
-		    outerBlockIterator != m_basicBlocks.cend(); outerBlockIterator++)
+	for(const auto& rule : g_algebraicRules)
+	{
+		if(rule.op != statement.op) continue;
+		if((rule.src1 != OPERAND_ANY) && (rule.src1 != src1Operand)) continue;
+		if(rule.src2 == OPERAND_SAME)
 		{
-			//First block is always referenced
-			if(outerBlockIterator == m_basicBlocks.begin()) continue;
-
-			auto candidateBlockIterator = outerBlockIterator;
-			bool referenced = false;
+			if(!sameOperands) continue;
+		}
+		else if((rule.src2 != OPERAND_ANY) && (rule.src2 != src2Operand))
+		{
+			continue;
+		}
+
+		switch(rule.result)
+		{
+		case RESULT_SRC1:
+			statement.op = OP_MOV;
+			statement.src2.reset();
+			break;
+		case RESULT_SRC2:
+			statement.op = OP_MOV;
+			statement.src1 = statement.src2;
+			statement.src2.reset();
+			break;
+		case RESULT_ZERO:
+			SetStatementToConstant(statement, 0);
+			break;
+		case RESULT_ONES:
+			SetStatementToConstant(statement, ~0U);
+			break;
+		}
+		return true;
+	}
+
+	return false;
+}
+
+bool CJitter::ApplyPeepholeRules(StatementList::iterator statementIterator, const DefinitionMap& definitions)
+{
+	auto& statement(*statementIterator);
+
+	auto getDefinition = [&](const SymbolRefPtr& symbolRef) -> const STATEMENT* {
+		if(!symbolRef) return nullptr;
+		auto definitionIterator = definitions.find(symbolRef->GetSymbol().get());
+		if(definitionIterator == std::end(definitions)) return nullptr;
+		return &(*definitionIterator->second);
+	};
+	//Checks if a source of an earlier statement still holds the same value here
+	auto isAvailable = [&](const SymbolRefPtr& symbolRef, const SymbolRefPtr& definedSymbolRef) {
+		auto definitionIterator = definitions.find(definedSymbolRef->GetSymbol().get());
+		assert(definitionIterator != std::end(definitions));
+		return !IsSymbolModifiedBetween(definitionIterator->second, statementIterator, symbolRef);
+	};
+	auto getConstant = [](const SymbolRefPtr& symbolRef) -> CSymbol* {
+		return dynamic_symbolref_cast(SYM_CONSTANT, symbolRef);
+	};
+
+	switch(statement.op)
+	{
+	case OP_NOT:
+	case OP_MD_NOT:
+		//~(~x) = x
+		if(auto definition = getDefinition(statement.src1))
+		{
+			if((definition->op == statement.op) && isAvailable(definition->src1, statement.src1))
+			{
+				statement.op = OP_MOV;
+				statement.src1 = definition->src1;
+				return true;
+			}
+		}
+		break;
+	case OP_SLL:
+	case OP_SRL:
+	case OP_SRA:
+	{
+		auto shiftCst = getConstant(statement.src2);
+		if(!shiftCst) break;
+		uint32 shiftAmount = shiftCst->m_valueLow & 0x1F;
+		auto definition = getDefinition(statement.src1);
+		if(!definition) break;
+		auto definitionShiftCst = getConstant(definition->src2);
+		if(!definitionShiftCst) break;
+		uint32 definitionShiftAmount = definitionShiftCst->m_valueLow & 0x1F;
+		if(definition->op == statement.op)
+		{
+			//(x >> a) >> b = x >> (a + b)
+			if(!isAvailable(definition->src1, statement.src1)) break;
+			uint32 totalShiftAmount = shiftAmount + definitionShiftAmount;
+			if(totalShiftAmount >= 32)
+			{
+				if(statement.op == OP_SRA)
+				{
+					totalShiftAmount = 31;
+				}
+				else
+				{
+					SetStatementToConstant(statement, 0);
+					return true;
+				}
+			}
+			statement.src1 = definition->src1;
+			statement.src2 = MakeSymbolRef(MakeSymbol(SYM_CONSTANT, totalShiftAmount));
+			return true;
+		}
+		else if((statement.op == OP_SRA) && (definition->op == OP_SLL) && (shiftAmount == definitionShiftAmount))
+		{
+			//Sign extending something that is already sign extended
+			//(x is the result of a right arithmetic shift of at least the same amount)
+			auto valueDefinition = getDefinition(definition->src1);
+			if(!valueDefinition || (valueDefinition->op != OP_SRA)) break;
+			auto valueShiftCst = getConstant(valueDefinition->src2);
+			if(!valueShiftCst || ((valueShiftCst->m_valueLow & 0x1F) < shiftAmount)) break;
+			if(!isAvailable(definition->src1, statement.src1)) break;
+			statement.op = OP_MOV;
+			statement.src1 = definition->src1;
+			statement.src2.reset();
+			return true;
+		}
+		else if((statement.op == OP_SLL) && ((definition->op == OP_SRA) || (definition->op == OP_SRL)) && (shiftAmount == definitionShiftAmount))
+		{
+			//((x << b) >> a) << a = x << b, only if both a and b are constants and b >= a:
+			//the low a bits of (x << b) are zero, so shifting right then left by the same
+			//amount gives it back whether the right shift is logical or arithmetic
+			auto valueDefinition = getDefinition(definition->src1);
+			if(!valueDefinition || (valueDefinition->op != OP_SLL)) break;
+			auto valueShiftCst = getConstant(valueDefinition->src2);
+			if(!valueShiftCst || ((valueShiftCst->m_valueLow & 0x1F) < shiftAmount)) break;
+			if(!isAvailable(definition->src1, statement.src1)) break;
+			statement.op = OP_MOV;
+			statement.src1 = definition->src1;
+			statement.src2.reset();
+			return true;
+		}
+	}
+	break;
+	case OP_AND:
+	case OP_OR:
+	case OP_XOR:
+	{
+		auto maskCst = getConstant(statement.src2);
+		if(!maskCst) break;
+		auto definition = getDefinition(statement.src1);
+		if(!definition) break;
+		uint32 mask = maskCst->m_valueLow;
+		if(definition->op == statement.op)
+		{
+			//(x & c1) & c2 = x & (c1 & c2)
+			auto definitionMaskCst = getConstant(definition->src2);
+			if(!definitionMaskCst) break;
+			if(!isAvailable(definition->src1, statement.src1)) break;
+			uint32 definitionMask = definitionMaskCst->m_valueLow;
+			uint32 result = 0;
+			switch(statement.op)
+			{
+			case OP_AND:
+				result = mask & definitionMask;
+				break;
+			case OP_OR:
+				result = mask | definitionMask;
+				break;
+			case OP_XOR:
+				result = mask ^ definitionMask;
+				break;
+			default:
+				assert(false);
+				break;
+			}
+			statement.src1 = definition->src1;
+			statement.src2 = MakeSymbolRef(MakeSymbol(SYM_CONSTANT, result));
+			return true;
+		}
+		else if((statement.op == OP_AND) && (definition->op == OP_SRL))
+		{
+			//Mask doesn't remove any bit that could be set
+			auto shiftCst = getConstant(definition->src2);
+			if(!shiftCst) break;
+			uint32 usedBits = (~0U) >> (shiftCst->m_valueLow & 0x1F);
+			if((usedBits & ~mask) != 0) break;
+			statement.op = OP_MOV;
+			statement.src2.reset();
+			return true;
+		}
+	}
+	break;
+	case OP_EXTLOW64:
+	case OP_EXTHIGH64:
+		if(auto definition = getDefinition(statement.src1))
+		{
+			if(definition->op != OP_MERGETO64) break;
+			auto& part = (statement.op == OP_EXTLOW64) ? definition->src1 : definition->src2;
+			if(!isAvailable(part, statement.src1)) break;
+			statement.op = OP_MOV;
+			statement.src1 = part;
+			return true;
+		}
+		break;
+	case OP_CMP:
+	case OP_CMP64:
+		if(statement.src1->Equals(statement.src2.get()))
+		{
+			switch(statement.jmpCondition)
+			{
+			case CONDITION_EQ:
+			case CONDITION_BE:
+			case CONDITION_AE:
+			case CONDITION_LE:
+			case CONDITION_GE:
+				SetStatementToConstant(statement, 1);
+				return true;
+			case CONDITION_NE:
+			case CONDITION_BL:
+			case CONDITION_AB:
+			case CONDITION_LT:
+			case CONDITION_GT:
+				SetStatementToConstant(statement, 0);
+				return true;
+			default:
+				break;
+			}
+		}
+		break;
+	case OP_CONDJMP:
+	{
+		//Branch directly on the operands of a comparison instead of testing its result
+		auto testCst = getConstant(statement.src2);
+		if(!testCst) break;
+		if((statement.jmpCondition != CONDITION_EQ) && (statement.jmpCondition != CONDITION_NE)) break;
+		auto definition = getDefinition(statement.src1);
+		if(!definition) break;
+		auto isWordOperand = [](const SymbolRefPtr& symbolRef) {
+			auto type = symbolRef->GetSymbol()->m_type;
+			return (type == SYM_CONSTANT) || (type == SYM_RELATIVE) || (type == SYM_TEMPORARY);
+		};
+		bool canFuse = false;
+		switch(definition->op)
+		{
+		case OP_CMP:
+			//(a cmp b) != 0 -> a cmp b
+			//(a cmp b) == 1 -> a cmp b
+			canFuse = (testCst->m_valueLow == 0) || (testCst->m_valueLow == 1);
+			break;
+		case OP_SUB:
+		case OP_XOR:
+			//(a - b) == 0 -> a == b
+			//(a ^ b) == 0 -> a == b
+			canFuse = (testCst->m_valueLow == 0);
+			break;
+		case OP_AND:
+			//(a & b) == 0 -> test a, b
+			canFuse = m_codeGenSupportsTestJumps && (testCst->m_valueLow == 0);
+			break;
+		default:
+			break;
+		}
+		if(!canFuse) break;
+		if(!isWordOperand(definition->src1) || !isWordOperand(definition->src2)) break;
+		if(!isAvailable(definition->src1, statement.src1)) break;
+		if(!isAvailable(definition->src2, statement.src1)) break;
+		if(definition->op == OP_CMP)
+		{
+			bool isTrueTest = (statement.jmpCondition == CONDITION_NE) == (testCst->m_valueLow == 0);
+			statement.jmpCondition = isTrueTest ? definition->jmpCondition : NegateCondition(definition->jmpCondition);
+		}
+		else if(definition->op == OP_AND)
+		{
+			statement.op = OP_TESTJMP;
+		}
+		statement.src1 = definition->src1;
+		statement.src2 = definition->src2;
+		return true;
+	}
+	case OP_SELECT:
+	case OP_SELECT64:
+		//If true and false values are the same, we don't care about the test
+		if(statement.src2 && statement.src3 && statement.src2->Equals(statement.src3.get()))
+		{
+			statement.op = OP_MOV;
+			statement.src1 = statement.src2;
+			statement.src2.reset();
+			statement.src3.reset();
+			return true;
+		}
+		break;
+	default:
+		break;
+	}
+
+	return false;
+}
+
+bool CJitter::AlgebraicSimplification(StatementList& statements)
+{
+	bool changed = false;
+
+	//Only temporaries that are defined once can be used to match on patterns
+	auto definitionCounts = CountTemporaryDefinitions(statements);
+
+	DefinitionMap definitions;
+
+	for(auto statementIterator(statements.begin());
+	    statements.end() != statementIterator; ++statementIterator)
+	{
+		auto& statement(*statementIterator);
+
+		changed |= ApplyAlgebraicRules(statement, definitions);
+		changed |= ApplyPeepholeRules(statementIterator, definitions);
+
+		if(statement.dst && statement.dst->GetSymbol()->IsTemporary())
+		{
+			auto dstSymbol = statement.dst->GetSymbol().get();
+			if(definitionCounts[dstSymbol] == 1)
+			{
+				definitions[dstSymbol] = statementIterator;
+			}
+		}
+	}
+
+	return changed;
+}
+
+void CJitter::FixFlowControl(StatementList& statements)
+{
+	//Resolve GOTO and SWITCH instructions
+	for(auto& statement : statements)
+	{
+		if(statement.op == OP_GOTO)
+		{
+			LabelMapType::const_iterator labelIterator = m_labels.find(statement.jmpBlock);
+			assert(labelIterator != m_labels.end());
+			if(labelIterator == m_labels.end()) continue;
+
+			statement.op = OP_JMP;
+			statement.jmpBlock = labelIterator->second;
+		}
+		else if(statement.op == OP_SWITCH)
+		{
+			statement.op = OP_JMPTABLE;
+			statement.VisitJumpTargets(
+			    [&](uint32& target) {
+				    auto labelIterator = m_labels.find(target);
+				    assert(labelIterator != m_labels.end());
+				    target = labelIterator->second;
+			    });
+		}
+	}
+
+	//Remove any excess flow control instructions
+	for(StatementList::iterator statementIterator(statements.begin());
+	    statementIterator != statements.end(); ++statementIterator)
+	{
+		const STATEMENT& statement(*statementIterator);
+
+		if(statement.IsJump())
+		{
+			++statementIterator;
+			statements.erase(statementIterator, statements.end());
+			break;
+		}
+	}
+}
+
+void CJitter::MergeBasicBlocks(BASIC_BLOCK& dstBlock, const BASIC_BLOCK& srcBlock)
+{
+	auto& dstSymbolTable = dstBlock.symbolTable;
+
+	for(auto statement : srcBlock.statements)
+	{
+		statement.VisitOperands(
+		    [&dstSymbolTable](SymbolRefPtr& symbolRef, bool) {
+			    auto symbol = symbolRef->GetSymbol();
+			    symbolRef = std::make_shared<CSymbolRef>(dstSymbolTable.MakeSymbol(symbol));
+		    });
+		dstBlock.statements.push_back(statement);
+	}
+
+	dstBlock.optimized = false;
+}
+
+CJitter::BASIC_BLOCK CJitter::ConcatBlocks(const BasicBlockList& blocks)
+{
+	BASIC_BLOCK result;
+	for(const auto& basicBlock : blocks)
+	{
+		//First, add a mark label statement
+		STATEMENT labelStatement;
+		labelStatement.op = OP_LABEL;
+		labelStatement.jmpBlock = basicBlock.id;
+		result.statements.push_back(labelStatement);
+
+		MergeBasicBlocks(result, basicBlock);
+	}
+	return result;
+}
+
+bool CJitter::PruneBlocks()
+{
+	bool changed = true;
+	int deletedBlocks = 0;
+
+	while(changed)
+	{
+		changed = false;
+
+		auto toDeleteIterator = m_basicBlocks.cend();
+		for(auto outerBlockIterator(m_basicBlocks.cbegin());
+		    outerBlockIterator != m_basicBlocks.cend(); outerBlockIterator++)
+		{
+			//First block is always referenced
+			if(outerBlockIterator == m_basicBlocks.begin()) continue;
+
+			auto candidateBlockIterator = outerBlockIterator;
+			bool referenced = false;
 
 			//Check if there's a reference to this block in here
 			for(auto innerBlockIterator(m_basicBlocks.cbegin());
@@ -976,17 +1743,17 @@ bool CJitter::PruneBlocks()
 					const auto& statement(*lastInstruction);
 
 					//It jumps to a block, so check if it references the one we're looking for
-					if(statement.op == OP_JMP || statement.op == OP_CONDJMP)
-					{
-						if(statement.jmpBlock == candidateBlockIterator->id)
-						{
-							referenced = true;
-							break;
-						}
-					}
+					statement.VisitJumpTargets(
+					    [&](uint32 target) {
+						    if(target == candidateBlockIterator->id)
+						    {
+							    referenced = true;
+						    }
+					    });
+					if(referenced) break;
 
 					//Otherwise, it references the next one if it's not a jump
-					if(statement.op != OP_JMP)
+					if((statement.op != OP_JMP) && (statement.op != OP_JMPTABLE))
 					{
 						referencesNext = true;
 					}
@@ -1063,142 +1830,1325 @@ void CJitter::HarmonizeBlocks()
 			--lastInstruction;
 			const STATEMENT& statement(*lastInstruction);
 
-			//It jumps to a block, so check if it references the one we're looking for
-			if(statement.op == OP_JMP || statement.op == OP_CONDJMP)
+			//It jumps to a block, so check if it references the one we're looking for
+			statement.VisitJumpTargets(
+			    [&](uint32 target) {
+				    if(target == outerBlockIterator->id)
+				    {
+					    outerBlock.hasJumpRef = true;
+				    }
+			    });
+			if(outerBlock.hasJumpRef) break;
+		}
+	}
+}
+
+static bool IsIfConversionCandidate(const STATEMENT& statement)
+{
+	switch(statement.op)
+	{
+	case OP_MOV:
+	case OP_ADD:
+	case OP_SUB:
+	case OP_AND:
+	case OP_OR:
+	case OP_XOR:
+	case OP_NOT:
+	case OP_SRA:
+	case OP_SRL:
+	case OP_SLL:
+		break;
+	default:
+		return false;
+	}
+	if(!statement.dst) return false;
+	bool valid = true;
+	statement.VisitOperands(
+	    [&](const SymbolRefPtr& symbolRef, bool) {
+		    switch(symbolRef->GetSymbol()->m_type)
+		    {
+		    case SYM_CONSTANT:
+		    case SYM_RELATIVE:
+		    case SYM_TEMPORARY:
+			    break;
+		    default:
+			    valid = false;
+			    break;
+		    }
+	    });
+	return valid;
+}
+
+bool CJitter::IfConversion()
+{
+	//Both sides of the condition will be executed, so keep this small
+	static const unsigned int maxArmStatementCount = 4;
+	static const unsigned int maxSelectCount = 2;
+
+	bool changed = false;
+
+	auto isJumpTarget = [&](uint32 blockId, uint32 expectedSourceBlockId) {
+		for(const auto& basicBlock : m_basicBlocks)
+		{
+			if(basicBlock.id == expectedSourceBlockId) continue;
+			if(basicBlock.statements.empty()) continue;
+			bool found = false;
+			basicBlock.statements.back().VisitJumpTargets(
+			    [&](uint32 target) {
+				    found |= (target == blockId);
+			    });
+			if(found) return true;
+		}
+		return false;
+	};
+
+	for(auto blockIterator = m_basicBlocks.begin(); blockIterator != m_basicBlocks.end(); blockIterator++)
+	{
+		auto& basicBlock = *blockIterator;
+		if(basicBlock.statements.empty()) continue;
+
+		auto jumpStatementIterator = std::prev(basicBlock.statements.end());
+		const auto& jumpStatement = *jumpStatementIterator;
+		if((jumpStatement.op != OP_CONDJMP) && (jumpStatement.op != OP_TESTJMP)) continue;
+		if(jumpStatement.jmpBlock == basicBlock.id) continue;
+
+		//CMP needs its first operand to be a variable
+		auto condSrc1Type = jumpStatement.src1->GetSymbol()->m_type;
+		auto condSrc2Type = jumpStatement.src2->GetSymbol()->m_type;
+		if((condSrc1Type != SYM_RELATIVE) && (condSrc1Type != SYM_TEMPORARY)) continue;
+		if((condSrc2Type != SYM_RELATIVE) && (condSrc2Type != SYM_TEMPORARY) && (condSrc2Type != SYM_CONSTANT)) continue;
+
+		//Match either:
+		//  A: CONDJMP -> C; B: (then); C: (join)
+		//  A: CONDJMP -> C; B: (then) JMP -> D; C: (else); D: (join)
+		auto thenBlockIterator = std::next(blockIterator);
+		if(thenBlockIterator == m_basicBlocks.end()) continue;
+		auto elseBlockIterator = m_basicBlocks.end();
+		auto joinBlockIterator = std::next(thenBlockIterator);
+		if(joinBlockIterator == m_basicBlocks.end()) continue;
+
+		StatementList thenStatements = thenBlockIterator->statements;
+		StatementList elseStatements;
+		if(!thenStatements.empty() && (thenStatements.back().op == OP_JMP))
+		{
+			elseBlockIterator = joinBlockIterator;
+			joinBlockIterator = std::next(elseBlockIterator);
+			if(joinBlockIterator == m_basicBlocks.end()) continue;
+			if(jumpStatement.jmpBlock != elseBlockIterator->id) continue;
+			if(thenStatements.back().jmpBlock != joinBlockIterator->id) continue;
+			if(isJumpTarget(elseBlockIterator->id, basicBlock.id)) continue;
+			thenStatements.pop_back();
+			elseStatements = elseBlockIterator->statements;
+		}
+		else
+		{
+			if(jumpStatement.jmpBlock != joinBlockIterator->id) continue;
+		}
+		if(isJumpTarget(thenBlockIterator->id, basicBlock.id)) continue;
+
+		if(thenStatements.size() > maxArmStatementCount) continue;
+		if(elseStatements.size() > maxArmStatementCount) continue;
+
+		//Gather relatives written by both sides and make sure all operations can be executed unconditionally
+		bool valid = true;
+		std::vector<SymbolPtr> writtenRelatives;
+		std::vector<SymbolPtr> usedRelatives;
+		for(const auto* statements : {&thenStatements, &elseStatements})
+		{
+			for(const auto& statement : *statements)
+			{
+				valid = valid && IsIfConversionCandidate(statement);
+				if(!valid) break;
+				statement.VisitOperands(
+				    [&](const SymbolRefPtr& symbolRef, bool isDst) {
+					    auto symbol = symbolRef->GetSymbol();
+					    if(symbol->m_type != SYM_RELATIVE) return;
+					    usedRelatives.push_back(symbol);
+					    if(!isDst) return;
+					    auto writtenIterator = std::find_if(writtenRelatives.begin(), writtenRelatives.end(),
+					                                        [&](const SymbolPtr& writtenSymbol) { return writtenSymbol->Equals(symbol.get()); });
+					    if(writtenIterator == std::end(writtenRelatives))
+					    {
+						    writtenRelatives.push_back(symbol);
+					    }
+				    });
+			}
+		}
+		if(!valid) continue;
+		if(writtenRelatives.size() > maxSelectCount) continue;
+
+		//Partially overlapping relatives would make the result depend on the order of the selects
+		for(const auto& writtenSymbol : writtenRelatives)
+		{
+			for(const auto& usedSymbol : usedRelatives)
+			{
+				if(!writtenSymbol->Equals(usedSymbol.get()) && writtenSymbol->Aliases(usedSymbol.get()))
+				{
+					valid = false;
+				}
+			}
+		}
+		if(!valid) continue;
+
+		//Rewrite both sides to write to temporaries instead of relatives
+		bool isTestJump = (jumpStatement.op == OP_TESTJMP);
+		auto condition = jumpStatement.jmpCondition;
+		auto condSrc1 = jumpStatement.src1;
+		auto condSrc2 = jumpStatement.src2;
+		basicBlock.statements.erase(jumpStatementIterator);
+
+		auto& symbolTable = basicBlock.symbolTable;
+		auto appendArm = [&](const StatementList& statements) {
+			std::vector<std::pair<SymbolPtr, SymbolPtr>> renames;
+			auto findRename = [&](const SymbolPtr& symbol) {
+				return std::find_if(renames.begin(), renames.end(),
+				                    [&](const std::pair<SymbolPtr, SymbolPtr>& rename) { return rename.first->Equals(symbol.get()); });
+			};
+			for(auto statement : statements)
+			{
+				statement.VisitSources(
+				    [&](SymbolRefPtr& symbolRef, bool) {
+					    auto symbol = symbolTable.MakeSymbol(symbolRef->GetSymbol());
+					    auto renameIterator = findRename(symbol);
+					    if(renameIterator != std::end(renames))
+					    {
+						    symbol = renameIterator->second;
+					    }
+					    symbolRef = MakeSymbolRef(symbol);
+				    });
+				auto dstSymbol = symbolTable.MakeSymbol(statement.dst->GetSymbol());
+				if(dstSymbol->m_type == SYM_RELATIVE)
+				{
+					auto tempSymbol = MakeSymbol(&basicBlock, SYM_TEMPORARY, m_nextTemporary++, 0);
+					auto renameIterator = findRename(dstSymbol);
+					if(renameIterator == std::end(renames))
+					{
+						renames.push_back(std::make_pair(dstSymbol, tempSymbol));
+					}
+					else
+					{
+						renameIterator->second = tempSymbol;
+					}
+					dstSymbol = tempSymbol;
+				}
+				statement.dst = MakeSymbolRef(dstSymbol);
+				basicBlock.statements.push_back(statement);
+			}
+			return renames;
+		};
+
+		auto thenRenames = appendArm(thenStatements);
+		auto elseRenames = appendArm(elseStatements);
+
+		auto getArmValue = [&](const std::vector<std::pair<SymbolPtr, SymbolPtr>>& renames, const SymbolPtr& symbol) {
+			for(const auto& rename : renames)
+			{
+				if(rename.first->Equals(symbol.get())) return rename.second;
+			}
+			return symbol;
+		};
+
+		auto predicateSymbol = MakeSymbol(&basicBlock, SYM_TEMPORARY, m_nextTemporary++, 0);
+
+		if(isTestJump)
+		{
+			//Test jumps compare the AND of their operands against zero
+			auto maskedSymbol = MakeSymbol(&basicBlock, SYM_TEMPORARY, m_nextTemporary++, 0);
+
+			STATEMENT statement;
+			statement.op = OP_AND;
+			statement.src1 = MakeSymbolRef(symbolTable.MakeSymbol(condSrc1->GetSymbol()));
+			statement.src2 = MakeSymbolRef(symbolTable.MakeSymbol(condSrc2->GetSymbol()));
+			statement.dst = MakeSymbolRef(maskedSymbol);
+			basicBlock.statements.push_back(statement);
+
+			condSrc1 = statement.dst;
+			condSrc2 = MakeSymbolRef(MakeSymbol(&basicBlock, SYM_CONSTANT, 0, 0));
+		}
+
+		{
+			STATEMENT statement;
+			statement.op = OP_CMP;
+			statement.src1 = MakeSymbolRef(symbolTable.MakeSymbol(condSrc1->GetSymbol()));
+			statement.src2 = MakeSymbolRef(symbolTable.MakeSymbol(condSrc2->GetSymbol()));
+			statement.jmpCondition = condition;
+			statement.dst = MakeSymbolRef(predicateSymbol);
+			basicBlock.statements.push_back(statement);
+		}
+
+		//The original jump skipped the 'then' side when the condition was true
+		for(const auto& writtenSymbol : writtenRelatives)
+		{
+			auto symbol = symbolTable.MakeSymbol(writtenSymbol);
+
+			STATEMENT statement;
+			statement.op = OP_SELECT;
+			statement.src1 = MakeSymbolRef(predicateSymbol);
+			statement.src2 = MakeSymbolRef(getArmValue(elseRenames, symbol));
+			statement.src3 = MakeSymbolRef(getArmValue(thenRenames, symbol));
+			statement.dst = MakeSymbolRef(symbol);
+			basicBlock.statements.push_back(statement);
+		}
+
+		if(elseBlockIterator != m_basicBlocks.end())
+		{
+			m_basicBlocks.erase(elseBlockIterator);
+		}
+		m_basicBlocks.erase(thenBlockIterator);
+		basicBlock.optimized = false;
+
+		changed = true;
+	}
+
+	if(changed)
+	{
+		HarmonizeBlocks();
+	}
+
+	return changed;
+}
+
+static bool IsLoopInvariantCandidate(const STATEMENT& statement)
+{
+	switch(statement.op)
+	{
+	case OP_MOV:
+	case OP_ADD:
+	case OP_SUB:
+	case OP_CMP:
+	case OP_SELECT:
+	case OP_AND:
+	case OP_OR:
+	case OP_XOR:
+	case OP_NOT:
+	case OP_SRA:
+	case OP_SRL:
+	case OP_SLL:
+	case OP_MUL:
+	case OP_MULS:
+	case OP_LZC:
+	case OP_TZC:
+	case OP_POPCNT:
+	case OP_ROTL:
+	case OP_ROTR:
+	case OP_BSWAP16:
+	case OP_BSWAP:
+	case OP_ADDREF:
+	case OP_ADD64:
+	case OP_SUB64:
+	case OP_AND64:
+	case OP_OR64:
+	case OP_XOR64:
+	case OP_NOT64:
+	case OP_MUL64:
+	case OP_SELECT64:
+	case OP_CMP64:
+	case OP_MERGETO64:
+	case OP_EXTLOW64:
+	case OP_EXTHIGH64:
+	case OP_SRA64:
+	case OP_SRL64:
+	case OP_SLL64:
+	case OP_ROTL64:
+	case OP_ROTR64:
+	case OP_BSWAP64:
+	case OP_MD_EXPAND_W:
+	case OP_MD_AND:
+	case OP_MD_OR:
+	case OP_MD_XOR:
+	case OP_MD_NOT:
+		break;
+	default:
+		return false;
+	}
+	if(!statement.dst) return false;
+	switch(statement.dst->GetSymbol()->m_type)
+	{
+	case SYM_TEMPORARY:
+	case SYM_TEMPORARY64:
+	case SYM_TEMPORARY128:
+	case SYM_TMP_REFERENCE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool CJitter::IsCrossBlockTemporary(const CSymbol* symbol) const
+{
+	if(!symbol->IsTemporary()) return false;
+	return m_crossBlockTemporaries.find(symbol->m_valueLow) != std::end(m_crossBlockTemporaries);
+}
+
+StatementList CJitter::CollectLoopInvariants(BasicBlockList::iterator headerIterator, BasicBlockList::iterator latchIterator)
+{
+	auto endIterator = std::next(latchIterator);
+
+	//Gather everything that is modified inside the loop
+	bool hasSideEffects = false;
+	std::vector<CSymbol*> writtenSymbols;
+	std::unordered_map<uint32, unsigned int> temporaryDefinitionCounts;
+	for(auto blockIterator = headerIterator; blockIterator != endIterator; blockIterator++)
+	{
+		for(const auto& statement : blockIterator->statements)
+		{
+			switch(statement.op)
+			{
+			case OP_CALL:
+			case OP_PARAM_RET:
+			case OP_RELTOREF:
+				//Context can be modified without us knowing about it
+				hasSideEffects = true;
+				break;
+			default:
+				break;
+			}
+			statement.VisitOperands(
+			    [&](const SymbolRefPtr& symbolRef, bool) {
+				    if(symbolRef->GetSymbol()->m_type == SYM_CONTEXT)
+				    {
+					    hasSideEffects = true;
+				    }
+			    });
+			if(!statement.dst) continue;
+			auto dstSymbol = statement.dst->GetSymbol().get();
+			if(dstSymbol->IsTemporary())
+			{
+				temporaryDefinitionCounts[dstSymbol->m_valueLow]++;
+			}
+			else
+			{
+				writtenSymbols.push_back(dstSymbol);
+			}
+		}
+	}
+
+	auto isInvariant = [&](const SymbolRefPtr& symbolRef) {
+		auto symbol = symbolRef->GetSymbol().get();
+		switch(symbol->m_type)
+		{
+		case SYM_CONSTANT:
+		case SYM_CONSTANT64:
+		case SYM_CONSTANTPTR:
+			return true;
+		case SYM_RELATIVE:
+		case SYM_RELATIVE64:
+		case SYM_RELATIVE128:
+		case SYM_REL_REFERENCE:
+			if(hasSideEffects) return false;
+			for(const auto& writtenSymbol : writtenSymbols)
+			{
+				if(writtenSymbol->Equals(symbol) || writtenSymbol->Aliases(symbol)) return false;
+			}
+			return true;
+		default:
+			if(symbol->IsTemporary())
+			{
+				//Temporaries that are not defined in the loop have been moved out of it already
+				auto definitionCountIterator = temporaryDefinitionCounts.find(symbol->m_valueLow);
+				return (definitionCountIterator == std::end(temporaryDefinitionCounts)) || (definitionCountIterator->second == 0);
+			}
+			return false;
+		}
+	};
+
+	StatementList invariants;
+	bool changed = true;
+	while(changed)
+	{
+		changed = false;
+		for(auto blockIterator = headerIterator; blockIterator != endIterator; blockIterator++)
+		{
+			auto& statements = blockIterator->statements;
+			for(auto statementIterator = statements.begin(); statementIterator != statements.end();)
+			{
+				const auto& statement(*statementIterator);
+				bool canHoist = IsLoopInvariantCandidate(statement) &&
+				                (temporaryDefinitionCounts[statement.dst->GetSymbol()->m_valueLow] == 1);
+				statement.VisitSources(
+				    [&](const SymbolRefPtr& symbolRef, bool) {
+					    canHoist = canHoist && isInvariant(symbolRef);
+				    });
+				if(!canHoist)
+				{
+					statementIterator++;
+					continue;
+				}
+				auto dstSymbol = statement.dst->GetSymbol().get();
+				temporaryDefinitionCounts[dstSymbol->m_valueLow] = 0;
+				m_crossBlockTemporaries.insert(dstSymbol->m_valueLow);
+				invariants.push_back(statement);
+				statementIterator = statements.erase(statementIterator);
+				changed = true;
+			}
+		}
+	}
+
+	return invariants;
+}
+
+bool CJitter::HoistLoopInvariants()
+{
+	bool changed = false;
+
+	//Find loops (blocks that have a jump going backwards), keeping the farthest jump for each header
+	std::map<uint32, uint32> loops;
+	{
+		std::unordered_set<uint32> visitedBlocks;
+		for(const auto& basicBlock : m_basicBlocks)
+		{
+			visitedBlocks.insert(basicBlock.id);
+			if(basicBlock.statements.empty()) continue;
+			basicBlock.statements.back().VisitJumpTargets(
+			    [&](uint32 target) {
+				    if(visitedBlocks.find(target) != std::end(visitedBlocks))
+				    {
+					    loops[target] = basicBlock.id;
+				    }
+			    });
+		}
+	}
+
+	auto findBlock = [&](uint32 blockId) {
+		return std::find_if(m_basicBlocks.begin(), m_basicBlocks.end(),
+		                    [blockId](const BASIC_BLOCK& basicBlock) { return basicBlock.id == blockId; });
+	};
+
+	//Process inner loops first, invariants moved to their preheader can then be moved out of outer loops
+	std::vector<std::pair<uint32, uint32>> sortedLoops(loops.begin(), loops.end());
+	auto getLoopSize = [&](const std::pair<uint32, uint32>& loop) {
+		return std::distance(findBlock(loop.first), findBlock(loop.second));
+	};
+	std::stable_sort(sortedLoops.begin(), sortedLoops.end(),
+	                 [&](const std::pair<uint32, uint32>& loop1, const std::pair<uint32, uint32>& loop2) {
+		                 return getLoopSize(loop1) < getLoopSize(loop2);
+	                 });
+
+	for(const auto& loop : sortedLoops)
+	{
+		auto headerIterator = findBlock(loop.first);
+		auto latchIterator = findBlock(loop.second);
+		auto endIterator = std::next(latchIterator);
+
+		//Make sure the loop can only be entered through its header
+		std::unordered_set<uint32> loopBlocks;
+		for(auto blockIterator = headerIterator; blockIterator != endIterator; blockIterator++)
+		{
+			loopBlocks.insert(blockIterator->id);
+		}
+
+		bool hasSingleEntry = true;
+		for(const auto& basicBlock : m_basicBlocks)
+		{
+			if(loopBlocks.find(basicBlock.id) != std::end(loopBlocks)) continue;
+			if(basicBlock.statements.empty()) continue;
+			basicBlock.statements.back().VisitJumpTargets(
+			    [&](uint32 target) {
+				    if(target == headerIterator->id) return;
+				    if(loopBlocks.find(target) != std::end(loopBlocks))
+				    {
+					    hasSingleEntry = false;
+				    }
+			    });
+			if(!hasSingleEntry) break;
+		}
+		if(!hasSingleEntry) continue;
+
+		auto invariants = CollectLoopInvariants(headerIterator, latchIterator);
+		if(invariants.empty()) continue;
+
+		//Create a preheader that will run before the loop is entered
+		uint32 preheaderId = m_nextBlockId++;
+		for(auto& basicBlock : m_basicBlocks)
+		{
+			if(loopBlocks.find(basicBlock.id) != std::end(loopBlocks)) continue;
+			if(basicBlock.statements.empty()) continue;
+			basicBlock.statements.back().VisitJumpTargets(
+			    [&](uint32& target) {
+				    if(target == headerIterator->id)
+				    {
+					    target = preheaderId;
+				    }
+			    });
+		}
+
+		auto preheaderIterator = m_basicBlocks.emplace(headerIterator, BASIC_BLOCK());
+		auto& preheader = *preheaderIterator;
+		preheader.id = preheaderId;
+		preheader.optimized = true;
+		for(auto statement : invariants)
+		{
+			statement.VisitOperands(
+			    [&preheader](SymbolRefPtr& symbolRef, bool) {
+				    auto symbol = symbolRef->GetSymbol();
+				    symbolRef = std::make_shared<CSymbolRef>(preheader.symbolTable.MakeSymbol(symbol));
+			    });
+			preheader.statements.push_back(statement);
+		}
+
+		changed = true;
+	}
+
+	if(changed)
+	{
+		HarmonizeBlocks();
+	}
+
+	return changed;
+}
+
+unsigned int CJitter::AllocateCrossBlockTemporaries(unsigned int stackSize)
+{
+	if(m_crossBlockTemporaries.empty()) return stackSize;
+
+	//These are placed after the area used by blocks and are at the same location in every block
+	unsigned int stackAlloc = (stackSize + 0xF) & ~0xF;
+	std::unordered_map<uint32, unsigned int> locations;
+	for(auto& basicBlock : m_basicBlocks)
+	{
+		for(const auto& symbol : basicBlock.symbolTable.GetSymbols())
+		{
+			if(!IsCrossBlockTemporary(symbol.get())) continue;
+			auto locationIterator = locations.find(symbol->m_valueLow);
+			if(locationIterator == std::end(locations))
+			{
+				unsigned int symbolSize = symbol->GetSize();
+				if((stackAlloc % symbolSize) != 0)
+				{
+					stackAlloc += symbolSize - (stackAlloc % symbolSize);
+				}
+				locationIterator = locations.insert(std::make_pair(symbol->m_valueLow, stackAlloc)).first;
+				stackAlloc += symbolSize;
+			}
+			symbol->m_stackLocation = locationIterator->second;
+		}
+	}
+	return stackAlloc;
+}
+
+bool CJitter::MergeBlocks()
+{
+	int deletedBlocks = 0;
+	bool changed = true;
+	while(changed)
+	{
+		changed = false;
+		for(BasicBlockList::iterator blockIterator(m_basicBlocks.begin());
+		    m_basicBlocks.end() != blockIterator; ++blockIterator)
+		{
+			BasicBlockList::iterator nextBlockIterator(blockIterator);
+			++nextBlockIterator;
+			if(nextBlockIterator == m_basicBlocks.end()) continue;
+
+			auto& basicBlock(*blockIterator);
+			auto& nextBlock(*nextBlockIterator);
+
+			if(nextBlock.hasJumpRef) continue;
+
+			//Check if the last statement is a jump
+			if(!basicBlock.statements.empty())
+			{
+				auto lastStatementIterator(basicBlock.statements.end());
+				--lastStatementIterator;
+				const auto& statement(*lastStatementIterator);
+				if(statement.IsJump()) continue;
+			}
+
+			//Blocks can be merged
+			MergeBasicBlocks(basicBlock, nextBlock);
+
+			m_basicBlocks.erase(nextBlockIterator);
+
+			++deletedBlocks;
+			changed = true;
+			break;
+		}
+	}
+	return deletedBlocks != 0;
+}
+
+bool CJitter::ConstantPropagation(StatementList& statements)
+{
+	bool changed = false;
+
+	for(StatementList::iterator outerStatementIterator(statements.begin());
+	    statements.end() != outerStatementIterator; ++outerStatementIterator)
+	{
+		STATEMENT& outerStatement(*outerStatementIterator);
+
+		if(outerStatement.op != OP_MOV) continue;
+
+		CSymbol* constant = dynamic_symbolref_cast(SYM_CONSTANT, outerStatement.src1);
+		if(constant == NULL)
+		{
+			constant = dynamic_symbolref_cast(SYM_CONSTANT64, outerStatement.src1);
+		}
+		if(!constant) continue;
+
+		//Find anything that uses this operand and replace it with the constant
+		for(StatementList::iterator innerStatementIterator(outerStatementIterator);
+		    statements.end() != innerStatementIterator; ++innerStatementIterator)
+		{
+			if(outerStatementIterator == innerStatementIterator) continue;
+
+			auto& innerStatement(*innerStatementIterator);
+
+			innerStatement.VisitSources(
+			    [&](SymbolRefPtr& symbol, bool) {
+				    if(symbol->Equals(outerStatement.dst.get()))
+				    {
+					    symbol = outerStatement.src1;
+					    changed = true;
+				    }
+			    });
+		}
+	}
+	return changed;
+}
+
+bool CJitter::ReorderAdd(StatementList& statements)
+{
+	bool changed = false;
+
+	//Only temporaries that are defined once can be used to match on patterns
+	auto definitionCounts = CountTemporaryDefinitions(statements);
+
+	DefinitionMap definitions;
+
+	for(auto statementIterator(statements.begin());
+	    statements.end() != statementIterator; ++statementIterator)
+	{
+		auto& statement(*statementIterator);
+
+		if(statement.dst && statement.dst->GetSymbol()->IsTemporary())
+		{
+			auto dstSymbol = statement.dst->GetSymbol().get();
+			if(definitionCounts[dstSymbol] == 1)
+			{
+				definitions[dstSymbol] = statementIterator;
+			}
+		}
+
+		//Look for OP_SLL that uses the result of an addition with a constant and propagate the shift
+		//(x + c1) << c2 -> (x << c2) + (c1 << c2)
+		if(statement.op != OP_SLL) continue;
+
+		auto shiftSrc2Cst = dynamic_symbolref_cast(SYM_CONSTANT, statement.src2);
+		if(!shiftSrc2Cst) continue;
+
+		auto definitionIterator = definitions.find(statement.src1->GetSymbol().get());
+		if(definitionIterator == std::end(definitions)) continue;
+
+		auto addStatementIterator = definitionIterator->second;
+		const auto& addStatement(*addStatementIterator);
+		if(addStatement.op != OP_ADD) continue;
+
+		auto addSrc2Cst = dynamic_symbolref_cast(SYM_CONSTANT, addStatement.src2);
+		if(!addSrc2Cst) continue;
+
+		//Make sure the addition's operand still holds the same value
+		if(IsSymbolModifiedBetween(addStatementIterator, statementIterator, addStatement.src1)) continue;
+
+		uint32 result = addSrc2Cst->m_valueLow << shiftSrc2Cst->m_valueLow;
+
+		auto shiftedSymbol = MakeSymbolRef(MakeSymbol(SYM_TEMPORARY, m_nextTemporary++));
+
+		STATEMENT shiftStatement;
+		shiftStatement.op = OP_SLL;
+		shiftStatement.src1 = addStatement.src1;
+		shiftStatement.src2 = statement.src2;
+		shiftStatement.dst = shiftedSymbol;
+		statements.insert(statementIterator, shiftStatement);
+
+		statement.op = OP_ADD;
+		statement.src1 = shiftedSymbol;
+		statement.src2 = MakeSymbolRef(MakeSymbol(SYM_CONSTANT, result));
+		changed = true;
+	}
+	return changed;
+}
+
+static bool IsMemoryAccessOperation(OPERATION op)
+{
+	switch(op)
+	{
+	case OP_LOADFROMREF:
+	case OP_LOAD8FROMREF:
+	case OP_LOAD16FROMREF:
+	case OP_STOREATREF:
+	case OP_STORE8ATREF:
+	case OP_STORE16ATREF:
+		return true;
+	default:
+		return false;
+	}
+}
+
+//Returns the size of the value accessed by a memory access statement or 0 if the access can't be folded
+static uint32 GetFoldableAccessSize(const STATEMENT& statement, bool indexed)
+{
+	switch(statement.op)
+	{
+	case OP_LOAD8FROMREF:
+	case OP_STORE8ATREF:
+		return 1;
+	case OP_LOAD16FROMREF:
+	case OP_STORE16ATREF:
+		return 2;
+	case OP_LOADFROMREF:
+	case OP_STOREATREF:
+	{
+		bool isLoad = (statement.op == OP_LOADFROMREF);
+		const auto& valueRef = isLoad ? statement.dst : (indexed ? statement.src3 : statement.src2);
+		auto valueSymbol = valueRef->GetSymbol();
+		switch(valueSymbol->m_type)
+		{
+		case SYM_REL_REFERENCE:
+		case SYM_TMP_REFERENCE:
+		case SYM_REG_REFERENCE:
+			//Indexed reference loads need to use the pointer size as scale
+			return 0;
+		default:
+			return valueSymbol->GetSize();
+		}
+	}
+	default:
+		assert(false);
+		return 0;
+	}
+}
+
+bool CJitter::AddressModeFolding(StatementList& statements)
+{
+	bool changed = false;
+
+	//Only temporaries that are defined once can be used to match on patterns
+	auto definitionCounts = CountTemporaryDefinitions(statements);
+
+	DefinitionMap definitions;
+
+	for(auto statementIterator(statements.begin());
+	    statements.end() != statementIterator; ++statementIterator)
+	{
+		auto& statement(*statementIterator);
+
+		//Returns the statement defining a symbol if it still holds the same operands
+		auto getDefinition = [&](const SymbolRefPtr& symbolRef, OPERATION op) -> const STATEMENT* {
+			auto definitionIterator = definitions.find(symbolRef->GetSymbol().get());
+			if(definitionIterator == std::end(definitions)) return nullptr;
+			const auto& definition = *definitionIterator->second;
+			if(definition.op != op) return nullptr;
+			if(IsSymbolModifiedBetween(definitionIterator->second, statementIterator, definition.src1)) return nullptr;
+			if(IsSymbolModifiedBetween(definitionIterator->second, statementIterator, definition.src2)) return nullptr;
+			return &definition;
+		};
+
+		//Returns how many upper bits of a value are known to be zero
+		auto getKnownLeadingZeroCount = [&](const SymbolRefPtr& symbolRef) -> uint32 {
+			auto definitionIterator = definitions.find(symbolRef->GetSymbol().get());
+			if(definitionIterator == std::end(definitions)) return 0;
+			const auto& definition = *definitionIterator->second;
+			switch(definition.op)
+			{
+			case OP_AND:
+				if(auto maskCst = dynamic_symbolref_cast(SYM_CONSTANT, definition.src2))
+				{
+					return (maskCst->m_valueLow == 0) ? 32 : __builtin_clz(maskCst->m_valueLow);
+				}
+				break;
+			case OP_SRL:
+				if(auto shiftCst = dynamic_symbolref_cast(SYM_CONSTANT, definition.src2))
+				{
+					return shiftCst->m_valueLow & 0x1F;
+				}
+				break;
+			case OP_LOAD8FROMREF:
+				return 24;
+			case OP_LOAD16FROMREF:
+				return 16;
+			default:
+				break;
+			}
+			return 0;
+		};
+
+		if(statement.op == OP_ADDREF)
+		{
+			//(ref + c1) + c2 -> ref + (c1 + c2)
+			auto offsetCst = dynamic_symbolref_cast(SYM_CONSTANT, statement.src2);
+			auto addRef = getDefinition(statement.src1, OP_ADDREF);
+			if(offsetCst && addRef)
 			{
-				if(statement.jmpBlock == outerBlockIterator->id)
+				if(auto addRefOffsetCst = dynamic_symbolref_cast(SYM_CONSTANT, addRef->src2))
 				{
-					outerBlock.hasJumpRef = true;
-					break;
+					statement.src1 = addRef->src1;
+					statement.src2 = MakeSymbolRef(MakeSymbol(SYM_CONSTANT, addRefOffsetCst->m_valueLow + offsetCst->m_valueLow));
+					changed = true;
 				}
 			}
 		}
-	}
-}
-
-bool CJitter::MergeBlocks()
-{
-	int deletedBlocks = 0;
-	bool changed = true;
-	while(changed)
-	{
-		changed = false;
-		for(BasicBlockList::iterator blockIterator(m_basicBlocks.begin());
-		    m_basicBlocks.end() != blockIterator; ++blockIterator)
+		else if(IsMemoryAccessOperation(statement.op))
 		{
-			BasicBlockList::iterator nextBlockIterator(blockIterator);
-			++nextBlockIterator;
-			if(nextBlockIterator == m_basicBlocks.end()) continue;
-
-			auto& basicBlock(*blockIterator);
-			auto& nextBlock(*nextBlockIterator);
+			bool isLoad = (statement.op == OP_LOADFROMREF) || (statement.op == OP_LOAD8FROMREF) || (statement.op == OP_LOAD16FROMREF);
+			bool indexed = isLoad ? (statement.src2 != nullptr) : (statement.src3 != nullptr);
+			uint32 accessSize = GetFoldableAccessSize(statement, indexed);
+			if(accessSize != 0)
+			{
+				auto addRef = getDefinition(statement.src1, OP_ADDREF);
+				if(!indexed)
+				{
+					//Use the offset added to the reference as index
+					auto addRefOffsetCst = addRef ? dynamic_symbolref_cast(SYM_CONSTANT, addRef->src2) : nullptr;
+					if(addRef && (!addRefOffsetCst || ((addRefOffsetCst->m_valueLow % accessSize) == 0)))
+					{
+						if(!isLoad)
+						{
+							statement.src3 = statement.src2;
+						}
+						statement.src1 = addRef->src1;
+						statement.src2 = addRef->src2;
+						statement.jmpCondition = static_cast<CONDITION>(1);
+						indexed = true;
+						changed = true;
+					}
+				}
+				else if(addRef)
+				{
+					uint32 scale = static_cast<uint32>(statement.jmpCondition);
+					auto indexCst = dynamic_symbolref_cast(SYM_CONSTANT, statement.src2);
+					auto addRefOffsetCst = dynamic_symbolref_cast(SYM_CONSTANT, addRef->src2);
+					if(indexCst && addRefOffsetCst)
+					{
+						//Merge both offsets as a constant index, only if it stays naturally aligned
+						//to make sure backends can encode it as an immediate offset
+						uint32 offset = addRefOffsetCst->m_valueLow + (indexCst->m_valueLow * scale);
+						if((offset % accessSize) == 0)
+						{
+							statement.src1 = addRef->src1;
+							statement.src2 = MakeSymbolRef(MakeSymbol(SYM_CONSTANT, offset));
+							statement.jmpCondition = static_cast<CONDITION>(1);
+							changed = true;
+						}
+					}
+					else if(indexCst && (indexCst->m_valueLow == 0))
+					{
+						statement.src1 = addRef->src1;
+						statement.src2 = addRef->src2;
+						statement.jmpCondition = static_cast<CONDITION>(1);
+						changed = true;
+					}
+				}
 
-			if(nextBlock.hasJumpRef) continue;
+				if(indexed)
+				{
+					//Fold shifted index into scale. Backends scale the index at address width, so
+					//this is only valid if the 32-bit shift can't drop any bit of the index.
+					uint32 scale = static_cast<uint32>(statement.jmpCondition);
+					if(auto shift = getDefinition(statement.src2, OP_SLL))
+					{
+						auto shiftCst = dynamic_symbolref_cast(SYM_CONSTANT, shift->src2);
+						if(shiftCst && (shiftCst->m_valueLow < 4) &&
+						   (getKnownLeadingZeroCount(shift->src1) >= shiftCst->m_valueLow))
+						{
+							uint32 newScale = scale << shiftCst->m_valueLow;
+							if(m_codeGen->SupportsIndexScale(accessSize, newScale))
+							{
+								statement.src2 = shift->src1;
+								statement.jmpCondition = static_cast<CONDITION>(newScale);
+								changed = true;
+							}
+						}
+					}
+				}
+			}
+		}
 
-			//Check if the last statement is a jump
-			if(!basicBlock.statements.empty())
+		if(statement.dst && statement.dst->GetSymbol()->IsTemporary())
+		{
+			auto dstSymbol = statement.dst->GetSymbol().get();
+			if(definitionCounts[dstSymbol] == 1)
 			{
-				auto lastStatementIterator(basicBlock.statements.end());
-				--lastStatementIterator;
-				const auto& statement(*lastStatementIterator);
-				if(statement.op == OP_CONDJMP) continue;
-				if(statement.op == OP_JMP) continue;
+				definitions[dstSymbol] = statementIterator;
 			}
+		}
+	}
 
-			//Blocks can be merged
-			MergeBasicBlocks(basicBlock, nextBlock);
+	return changed;
+}
 
-			m_basicBlocks.erase(nextBlockIterator);
+static bool IsPowerOfTwo(uint32 value)
+{
+	return (value != 0) && ((value & (value - 1)) == 0);
+}
 
-			++deletedBlocks;
-			changed = true;
-			break;
+//Computes the magic number needed to replace an unsigned division by a multiply
+//From Hacker's Delight, Chapter 10 (magicu)
+static void ComputeUnsignedDivisionMagic(uint32 divisor, uint32& multiplier, bool& needsAdd, uint32& shift)
+{
+	assert(divisor > 1);
+	uint32 nc = ~0U - ((0U - divisor) % divisor);
+	uint32 p = 31;
+	uint32 q1 = 0x80000000 / nc;
+	uint32 r1 = 0x80000000 - (q1 * nc);
+	uint32 q2 = 0x7FFFFFFF / divisor;
+	uint32 r2 = 0x7FFFFFFF - (q2 * divisor);
+	uint32 delta = 0;
+	needsAdd = false;
+	do
+	{
+		p++;
+		if(r1 >= (nc - r1))
+		{
+			q1 = (2 * q1) + 1;
+			r1 = (2 * r1) - nc;
 		}
-	}
-	return deletedBlocks != 0;
+		else
+		{
+			q1 = 2 * q1;
+			r1 = 2 * r1;
+		}
+		if((r2 + 1) >= (divisor - r2))
+		{
+			if(q2 >= 0x7FFFFFFF) needsAdd = true;
+			q2 = (2 * q2) + 1;
+			r2 = (2 * r2) + 1 - divisor;
+		}
+		else
+		{
+			if(q2 >= 0x80000000) needsAdd = true;
+			q2 = 2 * q2;
+			r2 = (2 * r2) + 1;
+		}
+		delta = divisor - 1 - r2;
+	} while((p < 64) && ((q1 < delta) || ((q1 == delta) && (r1 == 0))));
+	multiplier = q2 + 1;
+	shift = p - 32;
 }
 
-bool CJitter::ConstantPropagation(StatementList& statements)
+//Computes the magic number needed to replace a signed division by a multiply
+//From Hacker's Delight, Chapter 10 (magic)
+static void ComputeSignedDivisionMagic(int32 divisor, int32& multiplier, uint32& shift)
+{
+	uint32 absDivisor = (divisor < 0) ? (0U - static_cast<uint32>(divisor)) : divisor;
+	assert(absDivisor > 1);
+	uint32 t = 0x80000000 + (static_cast<uint32>(divisor) >> 31);
+	uint32 anc = t - 1 - (t % absDivisor);
+	uint32 p = 31;
+	uint32 q1 = 0x80000000 / anc;
+	uint32 r1 = 0x80000000 - (q1 * anc);
+	uint32 q2 = 0x80000000 / absDivisor;
+	uint32 r2 = 0x80000000 - (q2 * absDivisor);
+	uint32 delta = 0;
+	do
+	{
+		p++;
+		q1 = 2 * q1;
+		r1 = 2 * r1;
+		if(r1 >= anc)
+		{
+			q1++;
+			r1 -= anc;
+		}
+		q2 = 2 * q2;
+		r2 = 2 * r2;
+		if(r2 >= absDivisor)
+		{
+			q2++;
+			r2 -= absDivisor;
+		}
+		delta = absDivisor - r2;
+	} while((q1 < delta) || ((q1 == delta) && (r1 == 0)));
+	multiplier = static_cast<int32>(q2 + 1);
+	if(divisor < 0) multiplier = -multiplier;
+	shift = p - 32;
+}
+
+bool CJitter::StrengthReduction(StatementList& statements)
 {
 	bool changed = false;
 
-	for(StatementList::iterator outerStatementIterator(statements.begin());
-	    statements.end() != outerStatementIterator; ++outerStatementIterator)
+	for(auto statementIterator(statements.begin());
+	    statements.end() != statementIterator;)
 	{
-		STATEMENT& outerStatement(*outerStatementIterator);
-
-		if(outerStatement.op != OP_MOV) continue;
+		auto& statement(*statementIterator);
 
-		CSymbol* constant = dynamic_symbolref_cast(SYM_CONSTANT, outerStatement.src1);
-		if(constant == NULL)
+		bool isMul = (statement.op == OP_MUL) || (statement.op == OP_MULS);
+		bool isDiv = (statement.op == OP_DIV) || (statement.op == OP_DIVS);
+		if(!isMul && !isDiv)
 		{
-			constant = dynamic_symbolref_cast(SYM_CONSTANT64, outerStatement.src1);
+			++statementIterator;
+			continue;
 		}
-		if(!constant) continue;
 
-		//Find anything that uses this operand and replace it with the constant
-		for(StatementList::iterator innerStatementIterator(outerStatementIterator);
-		    statements.end() != innerStatementIterator; ++innerStatementIterator)
+		//Multiplications are commutative, make sure the constant is the second operand
+		if(isMul && statement.src1->GetSymbol()->IsConstant())
 		{
-			if(outerStatementIterator == innerStatementIterator) continue;
+			std::swap(statement.src1, statement.src2);
+		}
 
-			auto& innerStatement(*innerStatementIterator);
+		//Constant / constant cases are handled by constant folding
+		auto src2cst = dynamic_symbolref_cast(SYM_CONSTANT, statement.src2);
+		if(!src2cst || statement.src1->GetSymbol()->IsConstant())
+		{
+			++statementIterator;
+			continue;
+		}
 
+		//Check how the 64-bits result is used. If it's only used through EXTLOW64/EXTHIGH64,
+		//uses can be replaced by the 32-bits results we'll compute.
+		bool hasLowUses = false;
+		bool hasHighUses = false;
+		bool hasOtherUses = !statement.dst->GetSymbol()->IsTemporary();
+		for(auto innerStatementIterator(std::next(statementIterator));
+		    statements.end() != innerStatementIterator; ++innerStatementIterator)
+		{
+			const auto& innerStatement(*innerStatementIterator);
 			innerStatement.VisitSources(
-			    [&](SymbolRefPtr& symbol, bool) {
-				    if(symbol->Equals(outerStatement.dst.get()))
+			    [&](const SymbolRefPtr& symbolRef, bool) {
+				    if(!symbolRef->Equals(statement.dst.get())) return;
+				    switch(innerStatement.op)
 				    {
-					    symbol = outerStatement.src1;
-					    changed = true;
+				    case OP_EXTLOW64:
+					    hasLowUses = true;
+					    break;
+				    case OP_EXTHIGH64:
+					    hasHighUses = true;
+					    break;
+				    default:
+					    hasOtherUses = true;
+					    break;
 				    }
 			    });
 		}
-	}
-	return changed;
-}
-
-bool CJitter::ReorderAdd(StatementList& statements)
-{
-	bool changed = false;
-
-	for(auto statementIterator(statements.begin());
-	    statements.end() != statementIterator; ++statementIterator)
-	{
-		auto& statement(*statementIterator);
 
-		//We're only interested by additions
-		if(statement.op != OP_ADD) continue;
+		StatementList reducedStatements;
+		auto emit = [&](OPERATION op, SYM_TYPE dstType, const SymbolRefPtr& src1, const SymbolRefPtr& src2) {
+			STATEMENT newStatement;
+			newStatement.op = op;
+			newStatement.src1 = src1;
+			newStatement.src2 = src2;
+			newStatement.dst = MakeSymbolRef(MakeSymbol(dstType, m_nextTemporary++));
+			reducedStatements.push_back(newStatement);
+			return newStatement.dst;
+		};
+		auto makeCst = [&](uint32 value) {
+			return MakeSymbolRef(MakeSymbol(SYM_CONSTANT, value));
+		};
+		auto emitOp = [&](OPERATION op, const SymbolRefPtr& src1, const SymbolRefPtr& src2) {
+			return emit(op, SYM_TEMPORARY, src1, src2);
+		};
+		auto emitCopy = [&](const SymbolRefPtr& src) {
+			//Relatives might be modified before the result is used, make sure we keep their current value
+			return src->GetSymbol()->IsTemporary() ? src : emit(OP_MOV, SYM_TEMPORARY, src, SymbolRefPtr());
+		};
+		auto emitMulHigh = [&](OPERATION op, const SymbolRefPtr& src1, uint32 multiplier) {
+			auto product = emit(op, SYM_TEMPORARY64, src1, makeCst(multiplier));
+			return emit(OP_EXTHIGH64, SYM_TEMPORARY, product, SymbolRefPtr());
+		};
+		auto emitMulLow = [&](const SymbolRefPtr& src1, uint32 multiplier) {
+			//This will be reduced further if possible
+			auto product = emit(OP_MUL, SYM_TEMPORARY64, src1, makeCst(multiplier));
+			return emit(OP_EXTLOW64, SYM_TEMPORARY, product, SymbolRefPtr());
+		};
+
+		auto src1 = statement.src1;
+		uint32 constant = src2cst->m_valueLow;
+		SymbolRefPtr resultLow;
+		SymbolRefPtr resultHigh;
 
-		//Do some more checks
-		auto addDst = statement.dst.get();
-		assert(addDst);
+		switch(statement.op)
+		{
+		case OP_MUL:
+			if(constant == 0)
+			{
+				resultLow = resultHigh = makeCst(0);
+			}
+			else if(IsPowerOfTwo(constant))
+			{
+				uint32 shiftAmount = __builtin_ctz(constant);
+				resultLow = (shiftAmount == 0) ? emitCopy(src1) : emitOp(OP_SLL, src1, makeCst(shiftAmount));
+				resultHigh = (shiftAmount == 0) ? makeCst(0) : emitOp(OP_SRL, src1, makeCst(32 - shiftAmount));
+			}
+			break;
+		case OP_MULS:
+			if(constant == 0)
+			{
+				resultLow = resultHigh = makeCst(0);
+			}
+			else if(IsPowerOfTwo(constant) && (constant != 0x80000000))
+			{
+				uint32 shiftAmount = __builtin_ctz(constant);
+				resultLow = (shiftAmount == 0) ? emitCopy(src1) : emitOp(OP_SLL, src1, makeCst(shiftAmount));
+				resultHigh = emitOp(OP_SRA, src1, makeCst((shiftAmount == 0) ? 31 : (32 - shiftAmount)));
+			}
+			break;
+		case OP_DIV:
+			if(constant == 1)
+			{
+				resultLow = emitCopy(src1);
+				resultHigh = makeCst(0);
+			}
+			else if(IsPowerOfTwo(constant))
+			{
+				resultLow = emitOp(OP_SRL, src1, makeCst(__builtin_ctz(constant)));
+				resultHigh = emitOp(OP_AND, src1, makeCst(constant - 1));
+			}
+			else if(constant != 0)
+			{
+				uint32 multiplier = 0;
+				bool needsAdd = false;
+				uint32 shiftAmount = 0;
+				ComputeUnsignedDivisionMagic(constant, multiplier, needsAdd, shiftAmount);
+				auto quotient = emitMulHigh(OP_MUL, src1, multiplier);
+				if(needsAdd)
+				{
+					assert(shiftAmount != 0);
+					auto diff = emitOp(OP_SUB, src1, quotient);
+					diff = emitOp(OP_SRL, diff, makeCst(1));
+					quotient = emitOp(OP_ADD, diff, quotient);
+					shiftAmount--;
+				}
+				if(shiftAmount != 0)
+				{
+					quotient = emitOp(OP_SRL, quotient, makeCst(shiftAmount));
+				}
+				resultLow = quotient;
+				resultHigh = emitOp(OP_SUB, src1, emitMulLow(quotient, constant));
+			}
+			break;
+		case OP_DIVS:
+			if(constant == 1)
+			{
+				resultLow = emitCopy(src1);
+				resultHigh = makeCst(0);
+			}
+			else if(constant == ~0U)
+			{
+				resultLow = emitOp(OP_SUB, makeCst(0), src1);
+				resultHigh = makeCst(0);
+			}
+			else if(constant != 0)
+			{
+				int32 divisor = static_cast<int32>(constant);
+				uint32 absDivisor = (divisor < 0) ? (0U - constant) : constant;
+				if(IsPowerOfTwo(absDivisor))
+				{
+					//Bias negative dividends to make sure we round towards zero
+					uint32 shiftAmount = __builtin_ctz(absDivisor);
+					auto bias = emitOp(OP_SRA, src1, makeCst(31));
+					bias = emitOp(OP_SRL, bias, makeCst(32 - shiftAmount));
+					auto biased = emitOp(OP_ADD, src1, bias);
+					auto quotient = emitOp(OP_SRA, biased, makeCst(shiftAmount));
+					auto truncated = emitOp(OP_AND, biased, makeCst(~(absDivisor - 1)));
+					resultLow = (divisor < 0) ? emitOp(OP_SUB, makeCst(0), quotient) : quotient;
+					resultHigh = emitOp(OP_SUB, src1, truncated);
+				}
+				else
+				{
+					int32 multiplier = 0;
+					uint32 shiftAmount = 0;
+					ComputeSignedDivisionMagic(divisor, multiplier, shiftAmount);
+					auto quotient = emitMulHigh(OP_MULS, src1, multiplier);
+					if((divisor > 0) && (multiplier < 0))
+					{
+						quotient = emitOp(OP_ADD, quotient, src1);
+					}
+					else if((divisor < 0) && (multiplier > 0))
+					{
+						quotient = emitOp(OP_SUB, quotient, src1);
+					}
+					if(shiftAmount != 0)
+					{
+						quotient = emitOp(OP_SRA, quotient, makeCst(shiftAmount));
+					}
+					auto sign = emitOp(OP_SRL, quotient, makeCst(31));
+					quotient = emitOp(OP_ADD, quotient, sign);
+					resultLow = quotient;
+					resultHigh = emitOp(OP_SUB, src1, emitMulLow(quotient, constant));
+				}
+			}
+			break;
+		default:
+			assert(false);
+			break;
+		}
 
-		auto addSrc2Cst = dynamic_symbolref_cast(SYM_CONSTANT, statement.src2);
+		//If only the lower part of a product is used, we can use shifts and adds
+		if(isMul && !resultLow && hasLowUses && !hasHighUses && !hasOtherUses)
+		{
+			if(constant == ~0U)
+			{
+				resultLow = emitOp(OP_SUB, makeCst(0), src1);
+			}
+			else if(IsPowerOfTwo(constant & (constant - 1)))
+			{
+				//x * (2^a + 2^b) = (x << a) + (x << b)
+				uint32 lowShift = __builtin_ctz(constant);
+				uint32 highShift = __builtin_ctz(constant & (constant - 1));
+				auto lowTerm = (lowShift == 0) ? src1 : emitOp(OP_SLL, src1, makeCst(lowShift));
+				auto highTerm = emitOp(OP_SLL, src1, makeCst(highShift));
+				resultLow = emitOp(OP_ADD, highTerm, lowTerm);
+			}
+			else if(IsPowerOfTwo(constant + 1))
+			{
+				//x * (2^a - 1) = (x << a) - x
+				auto shifted = emitOp(OP_SLL, src1, makeCst(__builtin_ctz(constant + 1)));
+				resultLow = emitOp(OP_SUB, shifted, src1);
+			}
+			else if(IsPowerOfTwo(0U - constant))
+			{
+				//x * -(2^a) = 0 - (x << a)
+				auto shifted = emitOp(OP_SLL, src1, makeCst(__builtin_ctz(0U - constant)));
+				resultLow = emitOp(OP_SUB, makeCst(0), shifted);
+			}
+		}
 
-		//Don't mess with relatives
-		if(addDst->GetSymbol()->IsRelative() || !addSrc2Cst)
+		if(!resultLow)
 		{
+			++statementIterator;
 			continue;
 		}
 
-		//Check for OP_SLL that uses the result of this operation and propagate the shift
-		auto nextStatementIterator = std::next(statementIterator);
-		auto& nextStatement(*nextStatementIterator);
-		if(nextStatement.op == OP_SLL && nextStatement.src1->Equals(addDst))
+		assert(resultHigh || !(hasHighUses || hasOtherUses));
+
+		//Replace uses of the result by the parts we've computed
+		if(statement.dst->GetSymbol()->IsTemporary())
 		{
-			auto shiftSrc2Cst = dynamic_symbolref_cast(SYM_CONSTANT, nextStatement.src2);
-			if(shiftSrc2Cst)
+			for(auto innerStatementIterator(std::next(statementIterator));
+			    statements.end() != innerStatementIterator; ++innerStatementIterator)
 			{
-				uint32 result = addSrc2Cst->m_valueLow << shiftSrc2Cst->m_valueLow;
-
-				std::swap(statement, nextStatement);
-				std::swap(statement.src1, nextStatement.src1);
-				std::swap(statement.dst, nextStatement.dst);
-				nextStatement.src2 = MakeSymbolRef(MakeSymbol(SYM_CONSTANT, result));
-				changed = true;
+				auto& innerStatement(*innerStatementIterator);
+				if(!innerStatement.src1 || !innerStatement.src1->Equals(statement.dst.get())) continue;
+				if(innerStatement.op == OP_EXTLOW64)
+				{
+					innerStatement.op = OP_MOV;
+					innerStatement.src1 = resultLow;
+				}
+				else if(innerStatement.op == OP_EXTHIGH64)
+				{
+					innerStatement.op = OP_MOV;
+					innerStatement.src1 = resultHigh;
+				}
 			}
 		}
+
+		statements.splice(statementIterator, reducedStatements);
+
+		if(hasOtherUses)
+		{
+			statement.op = OP_MERGETO64;
+			statement.src1 = resultLow;
+			statement.src2 = resultHigh;
+			++statementIterator;
+		}
+		else
+		{
+			statementIterator = statements.erase(statementIterator);
+		}
+
+		changed = true;
 	}
+
 	return changed;
 }
 
@@ -1499,6 +3449,79 @@ bool CJitter::MergeCmpSelectOps(StatementList& statements)
 	return changed;
 }
 
+bool CJitter::ContractMulAddOps(StatementList& statements)
+{
+	//Fuses a multiply and an add using its result into a single FMA.
+	//Result might differ from the separate ops since the product isn't rounded.
+	bool changed = false;
+
+	for(auto statementIterator(statements.begin());
+	    statements.end() != statementIterator;)
+	{
+		auto& statement = *statementIterator;
+		auto nextStatementIterator = statementIterator;
+		nextStatementIterator++;
+
+		if(nextStatementIterator == std::end(statements)) break;
+		auto& nextStatement = *nextStatementIterator;
+
+		OPERATION fmaOp = OP_NOP;
+		if((statement.op == OP_FP_MUL_S) && (nextStatement.op == OP_FP_ADD_S))
+		{
+			fmaOp = OP_FP_FMA_S;
+		}
+		else if((statement.op == OP_MD_MUL_S) && (nextStatement.op == OP_MD_ADD_S))
+		{
+			fmaOp = OP_MD_FMA_S;
+		}
+
+		if(fmaOp == OP_NOP)
+		{
+			statementIterator++;
+			continue;
+		}
+
+		auto productSymbol = statement.dst;
+		assert(productSymbol->GetSymbol()->IsTemporary());
+
+		bool src1IsProduct = nextStatement.src1->Equals(productSymbol.get());
+		bool src2IsProduct = nextStatement.src2->Equals(productSymbol.get());
+		if(src1IsProduct == src2IsProduct)
+		{
+			statementIterator++;
+			continue;
+		}
+
+		auto innerStatementIterator = nextStatementIterator;
+		innerStatementIterator++;
+
+		//Make sure product isn't used later
+		bool used = false;
+		for(; innerStatementIterator != statements.end(); ++innerStatementIterator)
+		{
+			const auto& innerStatement = *innerStatementIterator;
+			innerStatement.VisitSources([&](const SymbolRefPtr& src, bool isDst) { used |= src->Equals(productSymbol.get()); });
+			if(used) break;
+		}
+
+		if(used)
+		{
+			statementIterator++;
+			continue;
+		}
+
+		nextStatement.op = fmaOp;
+		nextStatement.src3 = src1IsProduct ? nextStatement.src2 : nextStatement.src1;
+		nextStatement.src1 = statement.src1;
+		nextStatement.src2 = statement.src2;
+
+		statementIterator = statements.erase(statementIterator);
+		changed = true;
+	}
+
+	return changed;
+}
+
 bool CJitter::DeadcodeElimination(VERSIONED_STATEMENT_LIST& versionedStatementList)
 {
 	bool changed = false;
@@ -1515,6 +3538,8 @@ bool CJitter::DeadcodeElimination(VERSIONED_STATEMENT_LIST& versionedStatementLi
 		CSymbol* candidate = nullptr;
 		if(symbolRef && symbolRef->GetSymbol()->IsTemporary())
 		{
+			//Might be used by other blocks
+			if(IsCrossBlockTemporary(symbolRef->GetSymbol().get())) continue;
 			candidate = symbolRef->GetSymbol().get();
 		}
 		else if(auto relativeSymbol = dynamic_symbolref_cast(SYM_RELATIVE, symbolRef))
@@ -1585,6 +3610,7 @@ void CJitter::CoalesceTemporaries(BASIC_BLOCK& basicBlock)
 
 		if(!outerStatement.dst) continue;
 		if(!outerStatement.dst->GetSymbol()->IsTemporary()) continue;
+		if(IsCrossBlockTemporary(outerStatement.dst->GetSymbol().get())) continue;
 
 		auto tempSymbol = outerStatement.dst->GetSymbol().get();
 		CSymbol* candidate = nullptr;
@@ -1729,6 +3755,9 @@ unsigned int CJitter::AllocateStack(BASIC_BLOCK& basicBlock)
 	unsigned int stackAlloc = 0;
 	for(const auto& symbol : basicBlock.symbolTable.GetSymbols())
 	{
+		//Those are allocated in a separate area shared by all blocks
+		if(IsCrossBlockTemporary(symbol.get())) continue;
+
 		if((symbol->m_type == SYM_TEMPORARY) || (symbol->m_type == SYM_FP_TEMPORARY32))
 		{
 			symbol->m_stackLocation = stackAlloc;
@@ -1746,7 +3775,7 @@ unsigned int CJitter::AllocateStack(BASIC_BLOCK& basicBlock)
 			symbol->m_stackLocation = stackAlloc;
 			stackAlloc += symbolSize;
 		}
-		else if(symbol->m_type == SYM_TEMPORARY64)
+		else if((symbol->m_type == SYM_TEMPORARY64) || (symbol->m_type == SYM_FP_TEMPORARY64))
 		{
 			if((stackAlloc & 7) != 0)
 			{
@@ -1798,9 +3827,12 @@ void CJitter::NormalizeStatements(BASIC_BLOCK& basicBlock)
 		case OP_AND:
 		case OP_AND64:
 		case OP_OR:
+		case OP_OR64:
 		case OP_XOR:
+		case OP_XOR64:
 		case OP_MUL:
 		case OP_MULS:
+		case OP_MUL64:
 		case OP_MD_AND:
 		case OP_MD_OR:
 		case OP_MD_XOR:
@@ -1818,10 +3850,17 @@ void CJitter::NormalizeStatements(BASIC_BLOCK& basicBlock)
 		case OP_MD_MIN_W:
 		case OP_MD_MAX_H:
 		case OP_MD_MAX_W:
+		case OP_MD_MUL_H:
+		case OP_MD_MULHS_H:
+		case OP_MD_MULHU_H:
+		case OP_MD_MUL_W:
+		case OP_MD_MULS_WD:
+		case OP_MD_MULU_WD:
 		case OP_MD_ADD_S:
 		case OP_MD_MUL_S:
 		case OP_MD_MIN_S:
 		case OP_MD_MAX_S:
+		case OP_MD_DOT_S:
 			isCommutative = true;
 			break;
 		case OP_CMP:
@@ -1830,6 +3869,10 @@ void CJitter::NormalizeStatements(BASIC_BLOCK& basicBlock)
 			isCommutative = true;
 			conditionSwapRequired = true;
 			break;
+		case OP_TESTJMP:
+			//Only tests against zero, swapping doesn't change the condition
+			isCommutative = true;
+			break;
 		default:
 			isCommutative = false;
 			break;
@@ -1,6 +1,7 @@
 #include "Jitter.h"
 #include <iostream>
 #include <set>
+#include <algorithm>
 
 #ifdef _DEBUG
 //#define DUMP_STATEMENTS
@@ -24,7 +25,8 @@ void CJitter::AllocateRegisters(BASIC_BLOCK& basicBlock)
 #endif
 
 	//Register allocation is done per "range". A range is a sequence of instructions
-	//that ends with a OP_CALL or with the block's end. We do allocation per range
+	//that ends with a OP_CALL (or an operation the code generator implements with a helper
+	//call) or with the block's end. We do allocation per range
 	//because changes to relative symbols might need to be visible by functions
 	//called by the block.
 
@@ -42,7 +44,7 @@ void CJitter::AllocateRegisters(BASIC_BLOCK& basicBlock)
 
 		MarkAliasedSymbols(basicBlock, allocRange, symbolRegAllocs);
 
-		AssociateSymbolsToRegisters(symbolRegAllocs);
+		AssociateSymbolsToRegisters(symbolRegAllocs, GetMdTempRegisterCount(basicBlock, allocRange));
 
 		//Replace all references to symbols by references to allocated registers
 		for(const auto& statementInfo : IndexedStatementList(basicBlock.statements))
@@ -94,7 +96,8 @@ void CJitter::AllocateRegisters(BASIC_BLOCK& basicBlock)
 
 			//If symbol is defined, we need to save it at the end
 			//Exception: Temporaries can be discarded if we're in the last range of the block
-			bool deadTemporary = symbol->IsTemporary() && isLastRange;
+			//unless they are used by other blocks
+			bool deadTemporary = symbol->IsTemporary() && isLastRange && !IsCrossBlockTemporary(symbol.get());
 			if(!deadTemporary && (symbolRegAlloc.firstDef != -1))
 			{
 				STATEMENT statement;
@@ -136,8 +139,11 @@ void CJitter::AllocateRegisters(BASIC_BLOCK& basicBlock)
 			auto statementIterator = statementInfo.iterator;
 			if(
 			    (statement.op != OP_CONDJMP) &&
+			    (statement.op != OP_TESTJMP) &&
 			    (statement.op != OP_JMP) &&
+			    (statement.op != OP_JMPTABLE) &&
 			    (statement.op != OP_CALL) &&
+			    !m_codeGen->IsHelperCall(statement) &&
 			    (statement.op != OP_EXTERNJMP) &&
 			    (statement.op != OP_EXTERNJMP_DYN))
 			{
@@ -179,35 +185,52 @@ void CJitter::AllocateRegisters(BASIC_BLOCK& basicBlock)
 #endif
 }
 
-void CJitter::AssociateSymbolsToRegisters(SymbolRegAllocInfo& symbolRegAllocs) const
+void CJitter::AssociateSymbolsToRegisters(SymbolRegAllocInfo& symbolRegAllocs, unsigned int mdTempRegCount) const
 {
 	//Some notes:
 	//- MD and FP registers are lumped together since MD registers are used for both
 	//  MD and FP operations on all of our target platforms.
+	//- 64-bit values share the general purpose register pool on hosts that have
+	//  64-bit wide general purpose registers.
+	//- Caller-saved registers are used first since they don't need to be saved in the
+	//  prolog. They can hold anything but call parameters: allocations never span a
+	//  call, but parameter registers get overwritten while the call is set up.
 
 	std::multimap<SYM_TYPE, unsigned int> availableRegisters;
+	unsigned int calleeSavedRegCount = m_codeGen->GetAvailableRegisterCount();
 	{
-		unsigned int regCount = m_codeGen->GetAvailableRegisterCount();
-		for(unsigned int i = 0; i < regCount; i++)
+		unsigned int callerSavedRegCount = m_codeGen->GetAvailableCallerSavedRegisterCount();
+		for(unsigned int i = 0; i < callerSavedRegCount; i++)
+		{
+			availableRegisters.insert(std::make_pair(SYM_REGISTER, calleeSavedRegCount + i));
+		}
+		for(unsigned int i = 0; i < calleeSavedRegCount; i++)
 		{
 			availableRegisters.insert(std::make_pair(SYM_REGISTER, i));
 		}
 	}
 
 	{
+		//Registers borrowed by the code generator for temporaries are taken from the end
 		unsigned int regCount = m_codeGen->GetAvailableMdRegisterCount();
+		assert(mdTempRegCount <= regCount);
+		regCount -= mdTempRegCount;
 		for(unsigned int i = 0; i < regCount; i++)
 		{
 			availableRegisters.insert(std::make_pair(SYM_REGISTER128, i));
 		}
 	}
 
+	bool has64BitsRegisters = m_codeGen->Has64BitsRegisters();
+
 	auto isRegisterAllocatable =
-	    [](SYM_TYPE symbolType) {
+	    [has64BitsRegisters](SYM_TYPE symbolType) {
 		    return (symbolType == SYM_RELATIVE) || (symbolType == SYM_TEMPORARY) ||
 		           (symbolType == SYM_REL_REFERENCE) || (symbolType == SYM_TMP_REFERENCE) ||
 		           (symbolType == SYM_FP_RELATIVE32) || (symbolType == SYM_FP_TEMPORARY32) ||
-		           (symbolType == SYM_RELATIVE128) || (symbolType == SYM_TEMPORARY128);
+		           (symbolType == SYM_FP_RELATIVE64) || (symbolType == SYM_FP_TEMPORARY64) ||
+		           (symbolType == SYM_RELATIVE128) || (symbolType == SYM_TEMPORARY128) ||
+		           (has64BitsRegisters && ((symbolType == SYM_RELATIVE64) || (symbolType == SYM_TEMPORARY64)));
 	    };
 
 	//Sort symbols by usage count
@@ -266,18 +289,37 @@ void CJitter::AssociateSymbolsToRegisters(SymbolRegAllocInfo& symbolRegAllocs) c
 			registerIteratorEnd = availableRegisters.upper_bound(SYM_REGISTER);
 			registerSymbolType = SYM_REG_REFERENCE;
 		}
+		else if((symbol->m_type == SYM_RELATIVE64) || (symbol->m_type == SYM_TEMPORARY64))
+		{
+			registerIterator = availableRegisters.lower_bound(SYM_REGISTER);
+			registerIteratorEnd = availableRegisters.upper_bound(SYM_REGISTER);
+			registerSymbolType = SYM_REGISTER64;
+		}
 		else if((symbol->m_type == SYM_FP_RELATIVE32) || (symbol->m_type == SYM_FP_TEMPORARY32))
 		{
 			registerIterator = availableRegisters.lower_bound(SYM_REGISTER128);
 			registerIteratorEnd = availableRegisters.upper_bound(SYM_REGISTER128);
 			registerSymbolType = SYM_FP_REGISTER32;
 		}
+		else if((symbol->m_type == SYM_FP_RELATIVE64) || (symbol->m_type == SYM_FP_TEMPORARY64))
+		{
+			registerIterator = availableRegisters.lower_bound(SYM_REGISTER128);
+			registerIteratorEnd = availableRegisters.upper_bound(SYM_REGISTER128);
+			registerSymbolType = SYM_FP_REGISTER64;
+		}
 		else if((symbol->m_type == SYM_RELATIVE128) || (symbol->m_type == SYM_TEMPORARY128))
 		{
 			registerIterator = availableRegisters.lower_bound(SYM_REGISTER128);
 			registerIteratorEnd = availableRegisters.upper_bound(SYM_REGISTER128);
 			registerSymbolType = SYM_REGISTER128;
 		}
+		if(symbolRegAlloc.callParam)
+		{
+			registerIterator = std::find_if(registerIterator, registerIteratorEnd,
+			                                [calleeSavedRegCount](const auto& availableRegister) {
+				                                return (availableRegister.first != SYM_REGISTER) || (availableRegister.second < calleeSavedRegCount);
+			                                });
+		}
 		if(registerIterator != registerIteratorEnd)
 		{
 			symbolRegAlloc.registerType = registerSymbolType;
@@ -287,7 +329,7 @@ void CJitter::AssociateSymbolsToRegisters(SymbolRegAllocInfo& symbolRegAllocs) c
 	}
 }
 
-CJitter::AllocationRangeArray CJitter::ComputeAllocationRanges(const BASIC_BLOCK& basicBlock)
+CJitter::AllocationRangeArray CJitter::ComputeAllocationRanges(const BASIC_BLOCK& basicBlock) const
 {
 	AllocationRangeArray result;
 	unsigned int currentStart = 0;
@@ -295,7 +337,7 @@ CJitter::AllocationRangeArray CJitter::ComputeAllocationRanges(const BASIC_BLOCK
 	{
 		const auto& statement(statementInfo.statement);
 		const auto& statementIdx(statementInfo.index);
-		if(statement.op == OP_CALL)
+		if((statement.op == OP_CALL) || m_codeGen->IsHelperCall(statement))
 		{
 			//Gotta split here
 			result.push_back(std::make_pair(currentStart, statementIdx));
@@ -306,6 +348,19 @@ CJitter::AllocationRangeArray CJitter::ComputeAllocationRanges(const BASIC_BLOCK
 	return result;
 }
 
+unsigned int CJitter::GetMdTempRegisterCount(const BASIC_BLOCK& basicBlock, const AllocationRange& allocRange) const
+{
+	unsigned int result = 0;
+	for(const auto& statementInfo : ConstIndexedStatementList(basicBlock.statements))
+	{
+		unsigned int statementIdx(statementInfo.index);
+		if(statementIdx < allocRange.first) continue;
+		if(statementIdx > allocRange.second) break;
+		result = std::max(result, m_codeGen->GetMdTempRegisterCount(statementInfo.statement));
+	}
+	return result;
+}
+
 void CJitter::ComputeLivenessForRange(const BASIC_BLOCK& basicBlock, const AllocationRange& allocRange, SymbolRegAllocInfo& symbolRegAllocs) const
 {
 	for(const auto& statementInfo : ConstIndexedStatementList(basicBlock.statements))
@@ -335,6 +390,10 @@ void CJitter::ComputeLivenessForRange(const BASIC_BLOCK& basicBlock, const Alloc
 			    auto symbol(symbolRef->GetSymbol());
 			    auto& symbolRegAlloc = symbolRegAllocs[symbol];
 			    symbolRegAlloc.useCount++;
+			    if((statement.op == OP_PARAM) || (statement.op == OP_PARAM_RET))
+			    {
+				    symbolRegAlloc.callParam = true;
+			    }
 			    if(symbolRegAlloc.firstUse == -1)
 			    {
 				    symbolRegAlloc.firstUse = statementIdx;
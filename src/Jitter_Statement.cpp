@@ -91,26 +91,34 @@ void Jitter::DumpStatementList(std::ostream& outputStream, const StatementList&
 		case OP_ADD64:
 		case OP_ADDREF:
 		case OP_FP_ADD_S:
+		case OP_FP_ADD_D:
 			outputStream << " + ";
 			break;
 		case OP_SUB:
 		case OP_SUB64:
 		case OP_FP_SUB_S:
+		case OP_FP_SUB_D:
 			outputStream << " - ";
 			break;
 		case OP_CMP:
 		case OP_CMP64:
 		case OP_FP_CMP_S:
+		case OP_FP_CMP_D:
 			outputStream << " CMP(" << ConditionToString(statement.jmpCondition) << ") ";
 			break;
 		case OP_MUL:
 		case OP_MULS:
+		case OP_MUL64:
 		case OP_FP_MUL_S:
+		case OP_FP_MUL_D:
 			outputStream << " * ";
 			break;
 		case OP_DIV:
 		case OP_DIVS:
+		case OP_DIV64:
+		case OP_DIVS64:
 		case OP_FP_DIV_S:
+		case OP_FP_DIV_D:
 			outputStream << " / ";
 			break;
 		case OP_AND:
@@ -121,15 +129,33 @@ void Jitter::DumpStatementList(std::ostream& outputStream, const StatementList&
 		case OP_LZC:
 			outputStream << " LZC";
 			break;
+		case OP_TZC:
+			outputStream << " TZC";
+			break;
+		case OP_POPCNT:
+			outputStream << " POPCNT";
+			break;
+		case OP_BSWAP16:
+			outputStream << " BSWAP16";
+			break;
+		case OP_BSWAP:
+			outputStream << " BSWAP";
+			break;
+		case OP_BSWAP64:
+			outputStream << " BSWAP64";
+			break;
 		case OP_OR:
+		case OP_OR64:
 		case OP_MD_OR:
 			outputStream << " | ";
 			break;
 		case OP_XOR:
+		case OP_XOR64:
 		case OP_MD_XOR:
 			outputStream << " ^ ";
 			break;
 		case OP_NOT:
+		case OP_NOT64:
 		case OP_MD_NOT:
 			outputStream << " ! ";
 			break;
@@ -145,12 +171,21 @@ void Jitter::DumpStatementList(std::ostream& outputStream, const StatementList&
 		case OP_SLL64:
 			outputStream << " << ";
 			break;
+		case OP_ROTL:
+		case OP_ROTL64:
+			outputStream << " <<< ";
+			break;
+		case OP_ROTR:
+		case OP_ROTR64:
+			outputStream << " >>> ";
+			break;
 		case OP_NOP:
 			outputStream << " NOP ";
 			break;
 		case OP_MOV:
 			break;
 		case OP_SELECT:
+		case OP_SELECT64:
 			outputStream << " SEL ";
 			break;
 		case OP_CMPSELECT_P1:
@@ -165,6 +200,9 @@ void Jitter::DumpStatementList(std::ostream& outputStream, const StatementList&
 		case OP_LOADFROMREF:
 			outputStream << " LOADFROM ";
 			break;
+		case OP_LOOKUP:
+			outputStream << " LOOKUP ";
+			break;
 		case OP_RELTOREF:
 			outputStream << " TOREF ";
 			break;
@@ -184,6 +222,18 @@ void Jitter::DumpStatementList(std::ostream& outputStream, const StatementList&
 		case OP_CONDJMP:
 			outputStream << " JMP{" << statement.jmpBlock << "}(" << ConditionToString(statement.jmpCondition) << ") ";
 			break;
+		case OP_TESTJMP:
+			outputStream << " TESTJMP{" << statement.jmpBlock << "}(" << ConditionToString(statement.jmpCondition) << ") ";
+			break;
+		case OP_SWITCH:
+		case OP_JMPTABLE:
+			outputStream << " JMPTABLE{";
+			for(const auto& target : *statement.jmpTable)
+			{
+				outputStream << target << ", ";
+			}
+			outputStream << "default: " << statement.jmpBlock << "} ";
+			break;
 		case OP_EXTERNJMP:
 			outputStream << " EXTJMP ";
 			break;
@@ -206,18 +256,26 @@ void Jitter::DumpStatementList(std::ostream& outputStream, const StatementList&
 			outputStream << " MERGETO256 ";
 			break;
 		case OP_FP_ABS_S:
+		case OP_FP_ABS_D:
 			outputStream << " ABS";
 			break;
 		case OP_FP_NEG_S:
+		case OP_FP_NEG_D:
 			outputStream << " NEG";
 			break;
 		case OP_FP_MIN_S:
+		case OP_FP_MIN_D:
 			outputStream << " MIN ";
 			break;
 		case OP_FP_MAX_S:
+		case OP_FP_MAX_D:
 			outputStream << " MAX ";
 			break;
+		case OP_FP_FMA_S:
+			outputStream << " FMA ";
+			break;
 		case OP_FP_SQRT_S:
+		case OP_FP_SQRT_D:
 			outputStream << " SQRT";
 			break;
 		case OP_FP_RSQRT_S:
@@ -227,8 +285,24 @@ void Jitter::DumpStatementList(std::ostream& outputStream, const StatementList&
 			outputStream << " RCPL";
 			break;
 		case OP_FP_TOINT32_TRUNC_S:
+		case OP_FP_TOINT32_TRUNC_D:
 			outputStream << " INT32(TRUNC)";
 			break;
+		case OP_FP_TOINT64_TRUNC_D:
+			outputStream << " INT64(TRUNC)";
+			break;
+		case OP_FP_TOSINGLE_D:
+			outputStream << " SINGLE";
+			break;
+		case OP_FP_TODOUBLE_S:
+			outputStream << " DOUBLE";
+			break;
+		case OP_FP_TODOUBLE_I32:
+			outputStream << " DOUBLE(INT32)";
+			break;
+		case OP_FP_TODOUBLE_I64:
+			outputStream << " DOUBLE(INT64)";
+			break;
 		case OP_FP_LDCST:
 			outputStream << " LOAD ";
 			break;
@@ -343,6 +417,9 @@ void Jitter::DumpStatementList(std::ostream& outputStream, const StatementList&
 		case OP_MD_DIV_S:
 			outputStream << " /(S) ";
 			break;
+		case OP_MD_FMA_S:
+			outputStream << " FMA(S) ";
+			break;
 		case OP_MD_MIN_H:
 			outputStream << " MIN(H) ";
 			break;
@@ -358,12 +435,45 @@ void Jitter::DumpStatementList(std::ostream& outputStream, const StatementList&
 		case OP_MD_MAX_W:
 			outputStream << " MAX(W) ";
 			break;
+		case OP_MD_MUL_H:
+			outputStream << " MUL(H) ";
+			break;
+		case OP_MD_MULHS_H:
+			outputStream << " MULHS(H) ";
+			break;
+		case OP_MD_MULHU_H:
+			outputStream << " MULHU(H) ";
+			break;
+		case OP_MD_MUL_W:
+			outputStream << " MUL(W) ";
+			break;
+		case OP_MD_MULS_WD:
+			outputStream << " MULS(WD) ";
+			break;
+		case OP_MD_MULU_WD:
+			outputStream << " MULU(WD) ";
+			break;
 		case OP_MD_MAX_S:
 			outputStream << " MAX(S) ";
 			break;
 		case OP_MD_ABS_S:
 			outputStream << " ABS(S)";
 			break;
+		case OP_MD_SQRT_S:
+			outputStream << " SQRT(S)";
+			break;
+		case OP_MD_RSQRT_S:
+			outputStream << " RSQRT(S)";
+			break;
+		case OP_MD_RCPL_S:
+			outputStream << " RCPL(S)";
+			break;
+		case OP_MD_DOT_S:
+			outputStream << " DOT(S," << std::hex << static_cast<uint32>(statement.jmpCondition) << std::dec << ") ";
+			break;
+		case OP_MD_HADD_S:
+			outputStream << " HADD(S) ";
+			break;
 		case OP_MD_CMPGT_S:
 			outputStream << " CMP(GT,S) ";
 			break;
@@ -376,6 +486,18 @@ void Jitter::DumpStatementList(std::ostream& outputStream, const StatementList&
 		case OP_MD_EXPAND_W:
 			outputStream << " EXPAND(W)";
 			break;
+		case OP_MD_SHUFFLE_W:
+			outputStream << " SHUFFLE(W) ";
+			break;
+		case OP_MD_SHUFFLE_B:
+			outputStream << " SHUFFLE(B) ";
+			break;
+		case OP_MD_INSERT_W:
+			outputStream << " INSERT(W) ";
+			break;
+		case OP_MD_EXTRACT_W:
+			outputStream << " EXTRACT(W) ";
+			break;
 		case OP_MD_TOSINGLE_I32:
 			outputStream << " TOSINGLE_I32";
 			break;
@@ -9,6 +9,9 @@
 // clang-format off
 
 #define BLOCK_ALIGN 0x10
+//Heap blocks are aligned enough for 32-byte loop alignment to hold in the final code,
+//other paths allocate whole pages
+#define WIN32_BLOCK_ALIGN 0x20
 
 #ifdef _WIN32
 	#define MEMFUNC_USE_WIN32
@@ -92,7 +95,7 @@ CMemoryFunction::CMemoryFunction(const void* code, size_t size)
 {
 #if defined(MEMFUNC_USE_WIN32)
 	m_size = size;
-	m_code = framework_aligned_alloc(size, BLOCK_ALIGN);
+	m_code = framework_aligned_alloc(size, WIN32_BLOCK_ALIGN);
 	memcpy(m_code, code, size);
 	
 	DWORD oldProtect = 0;
@@ -172,12 +172,14 @@ void CWasmModuleBuilder::WriteModule(Framework::CStream& stream)
 		assert(function.localI32Count < 0x80);
 		assert(function.localI64Count < 0x80);
 		assert(function.localF32Count < 0x80);
+		assert(function.localF64Count < 0x80);
 		assert(function.localV128Count < 0x80);
 
 		uint32 localDeclCount = 0;
 		if(function.localI32Count != 0) localDeclCount++;
 		if(function.localI64Count != 0) localDeclCount++;
 		if(function.localF32Count != 0) localDeclCount++;
+		if(function.localF64Count != 0) localDeclCount++;
 		if(function.localV128Count != 0) localDeclCount++;
 		uint32 localDeclSize = (localDeclCount * 2) + 1;
 		uint32 functionBodySize = function.code.size() + localDeclSize;
@@ -209,6 +211,11 @@ void CWasmModuleBuilder::WriteModule(Framework::CStream& stream)
 			WriteULeb128(stream, function.localF32Count);
 			stream.Write8(Wasm::TYPE_F32);
 		}
+		if(function.localF64Count != 0)
+		{
+			WriteULeb128(stream, function.localF64Count);
+			stream.Write8(Wasm::TYPE_F64);
+		}
 		if(function.localV128Count != 0)
 		{
 			WriteULeb128(stream, function.localV128Count);
@@ -1,4 +1,5 @@
 #include "X86Assembler.h"
+#include <algorithm>
 #include <cassert>
 #include <stdexcept>
 #include "LiteralPool.h"
@@ -8,7 +9,11 @@ void CX86Assembler::Begin()
 {
 	m_nextLabelId = 1;
 	m_nextLiteral128Id = 1;
+	m_literal128Ids.clear();
+	m_literal128s.clear();
 	m_currentLabel = nullptr;
+	m_fusibleCompareStart = 0;
+	m_fusibleCompareEnd = 0;
 	m_tmpStream.ResetBuffer();
 	m_labels.clear();
 	m_labelOrder.clear();
@@ -23,63 +28,36 @@ void CX86Assembler::End()
 		m_currentLabel->size = currentPos - m_currentLabel->start;
 	}
 
-	//Initialize
+	//Start with short jumps and grow them if needed.
+	//Jumps never shrink back, so this is bound to terminate.
 	for(auto& labelPair : m_labels)
 	{
-		auto& label = labelPair.second;
-		label.projectedStart = label.start;
+		for(auto& labelRef : labelPair.second.labelRefs)
+		{
+			labelRef.length = JMP_NEAR;
+		}
 	}
 
 	while(1)
 	{
-		bool changed = false;
+		UpdateProjectedOffsets();
 
-		for(LabelArray::const_iterator labelIterator(m_labelOrder.begin());
-		    labelIterator != m_labelOrder.end(); ++labelIterator)
+		bool changed = false;
+		for(auto& labelPair : m_labels)
 		{
-			auto& label = m_labels[*labelIterator];
-
-			for(LabelRefArray::iterator labelRefIterator(label.labelRefs.begin());
-			    labelRefIterator != label.labelRefs.end(); ++labelRefIterator)
+			for(auto& labelRef : labelPair.second.labelRefs)
 			{
-				auto& labelRef(*labelRefIterator);
-				switch(labelRef.length)
-				{
-				case JMP_NOTSET:
+				if(labelRef.length != JMP_NEAR) continue;
+				//We need to verify if the jump is still good for us, since sizes might have changed
+				const auto& referencedLabel(m_labels[labelRef.label]);
+				unsigned int smallJumpSize = GetJumpSize(labelRef.type, JMP_NEAR);
+				uint32 offset = referencedLabel.projectedStart - (labelRef.projectedOffset + smallJumpSize);
+				uint32 offsetSize = GetMinimumConstantSize(offset);
+				if(offsetSize != 1)
 				{
-					//Assume a short jump first.
-					unsigned int jumpSize = GetJumpSize(labelRef.type, JMP_NEAR);
-					labelRef.length = JMP_NEAR;
-					IncrementJumpOffsetsLocal(label, labelRefIterator + 1, jumpSize);
-					IncrementJumpOffsets(labelIterator + 1, jumpSize);
+					labelRef.length = JMP_FAR;
 					changed = true;
 				}
-				break;
-				case JMP_NEAR:
-				{
-					//We need to verify if the jump is still good for us, since sizes might have changed
-					LABELINFO& referencedLabel(m_labels[labelRef.label]);
-					unsigned int smallJumpSize = GetJumpSize(labelRef.type, JMP_NEAR);
-					uint32 offset = referencedLabel.projectedStart - (labelRef.offset + smallJumpSize);
-					uint32 offsetSize = GetMinimumConstantSize(offset);
-					if(offsetSize != 1)
-					{
-						//Doesn't fit, recompute offsets
-						labelRef.length = JMP_FAR;
-						unsigned int longJumpSize = GetJumpSize(labelRef.type, JMP_FAR);
-						unsigned int incrementAmount = longJumpSize - smallJumpSize;
-						IncrementJumpOffsetsLocal(label, labelRefIterator + 1, incrementAmount);
-						IncrementJumpOffsets(labelIterator + 1, incrementAmount);
-						changed = true;
-					}
-				}
-				break;
-				case JMP_FAR:
-					break;
-				default:
-					assert(false);
-					break;
-				}
 			}
 		}
 
@@ -94,68 +72,88 @@ void CX86Assembler::End()
 		const auto& label = m_labels[labelId];
 
 		unsigned int currentPos = label.start;
-		unsigned int currentProjectedPos = label.projectedStart;
 		unsigned int endPos = label.start + label.size;
 
+		WriteNops(m_outputStream, label.padding);
+
+		auto copyCode =
+		    [&](unsigned int copySize) {
+			    if(copySize == 0) return;
+			    m_copyBuffer.resize(copySize);
+			    m_tmpStream.Read(m_copyBuffer.data(), copySize);
+			    m_outputStream->Write(m_copyBuffer.data(), copySize);
+		    };
+
 		for(const auto& labelRef : label.labelRefs)
 		{
 			const auto& referencedLabel(m_labels[labelRef.label]);
 
-			unsigned int readSize = labelRef.offset - currentProjectedPos;
-			if(readSize != 0)
-			{
-				m_copyBuffer.resize(readSize);
-				m_tmpStream.Read(m_copyBuffer.data(), readSize);
-				m_outputStream->Write(m_copyBuffer.data(), readSize);
-			}
+			//Padding goes before the compare fused with the jump, if any
+			copyCode(labelRef.fusedOffset - currentPos);
+			WriteNops(m_outputStream, labelRef.padding);
+			copyCode(labelRef.offset - labelRef.fusedOffset);
 
 			//Write our jump here.
 			unsigned int jumpSize = GetJumpSize(labelRef.type, labelRef.length);
-			uint32 distance = referencedLabel.projectedStart - (labelRef.offset + jumpSize);
+			uint32 distance = referencedLabel.projectedStart - (labelRef.projectedOffset + jumpSize);
 			WriteJump(m_outputStream, labelRef.type, labelRef.length, distance);
 
-			currentProjectedPos += readSize + jumpSize;
-			currentPos += readSize;
+			currentPos = labelRef.offset;
 		}
 
-		unsigned int lastCopySize = endPos - currentPos;
-		if(lastCopySize != 0)
-		{
-			m_copyBuffer.resize(lastCopySize);
-			m_tmpStream.Read(m_copyBuffer.data(), lastCopySize);
-			m_outputStream->Write(m_copyBuffer.data(), lastCopySize);
-		}
+		copyCode(endPos - currentPos);
 	}
 
+	ResolveLabelDistanceReferences();
 	ResolveLiteralReferences();
 }
 
-void CX86Assembler::IncrementJumpOffsets(LabelArray::const_iterator startLabel, unsigned int amount)
+void CX86Assembler::UpdateProjectedOffsets()
 {
-	for(LabelArray::const_iterator labelIterator(startLabel);
-	    labelIterator != m_labelOrder.end(); ++labelIterator)
-	{
-		LABELINFO& label = m_labels[*labelIterator];
-		label.projectedStart += amount;
-		IncrementJumpOffsetsLocal(label, label.labelRefs.begin(), amount);
-	}
-}
-
-void CX86Assembler::IncrementJumpOffsetsLocal(LABELINFO& label, LabelRefArray::iterator startJump, unsigned int amount)
-{
-	for(LabelRefArray::iterator labelRefIterator(startJump);
-	    labelRefIterator != label.labelRefs.end(); ++labelRefIterator)
+	//Computes final positions of labels and jumps from the current jump lengths,
+	//inserting alignment and JCC erratum padding along the way
+	uint32 shift = 0;
+	for(const auto& labelId : m_labelOrder)
 	{
-		auto& labelRef(*labelRefIterator);
+		auto& label = m_labels[labelId];
 
-		//Make sure any literal ref happens before a label ref
-		for(const auto& literalRefPair : label.literal128Refs)
+		label.padding = 0;
+		if(label.alignment != 0)
 		{
-			FRAMEWORK_MAYBE_UNUSED const auto& literalRef = literalRefPair.second;
-			assert(literalRef.offset < labelRef.offset);
+			uint32 position = label.start + shift;
+			label.padding = (label.alignment - (position & (label.alignment - 1))) & (label.alignment - 1);
+			shift += label.padding;
 		}
+		label.projectedStart = label.start + shift;
 
-		labelRef.offset += amount;
+		for(auto& labelRef : label.labelRefs)
+		{
+			//Make sure any literal ref happens before a label ref
+			for(FRAMEWORK_MAYBE_UNUSED const auto& literalRef : label.literal128Refs)
+			{
+				assert(literalRef.offset < labelRef.offset);
+			}
+
+			//Same for label distance refs
+			for(FRAMEWORK_MAYBE_UNUSED const auto& distanceRef : label.labelDistanceRefs)
+			{
+				assert(distanceRef.offset < labelRef.offset);
+			}
+
+			//A macro-fused compare and jump pair is checked as a whole, padding it
+			//before the compare keeps both instructions next to each other
+			unsigned int jumpSize = GetJumpSize(labelRef.type, labelRef.length);
+			unsigned int fusedSize = labelRef.offset - labelRef.fusedOffset;
+			uint32 position = labelRef.fusedOffset + shift;
+			labelRef.padding = 0;
+			if(m_jccErratumPaddingEnabled && (((position & 0x1F) + fusedSize + jumpSize) >= 0x20))
+			{
+				labelRef.padding = 0x20 - (position & 0x1F);
+				shift += labelRef.padding;
+			}
+			labelRef.projectedOffset = labelRef.offset + shift;
+			shift += jumpSize;
+		}
 	}
 }
 
@@ -382,13 +380,29 @@ uint32 CX86Assembler::GetLabelOffset(LABEL label) const
 	return labelInfo.projectedStart;
 }
 
+void CX86Assembler::AlignLabel(LABEL label, uint32 alignment)
+{
+	assert((alignment != 0) && ((alignment & (alignment - 1)) == 0));
+	auto labelIterator(m_labels.find(label));
+	assert(labelIterator != m_labels.end());
+	labelIterator->second.alignment = alignment;
+}
+
+void CX86Assembler::SetJccErratumPaddingEnabled(bool enabled)
+{
+	m_jccErratumPaddingEnabled = enabled;
+}
+
 CX86Assembler::LITERAL128ID CX86Assembler::CreateLiteral128(const LITERAL128& literal)
 {
+	auto literalIdIterator = m_literal128Ids.find(literal);
+	if(literalIdIterator != std::end(m_literal128Ids))
+	{
+		return literalIdIterator->second;
+	}
 	auto literalId = m_nextLiteral128Id++;
-	LITERAL128REF literalRef;
-	literalRef.value = literal;
-	assert(m_currentLabel);
-	m_currentLabel->literal128Refs.insert(std::make_pair(literalId, literalRef));
+	m_literal128Ids.insert(std::make_pair(literal, literalId));
+	m_literal128s.insert(std::make_pair(literalId, literal));
 	return literalId;
 }
 
@@ -402,13 +416,12 @@ void CX86Assembler::ResolveLiteralReferences()
 		const auto& label = m_labels[labelId];
 		assert(label.projectedStart >= label.start);
 		uint32 projectedDiff = label.projectedStart - label.start;
-		for(const auto& literalRefPair : label.literal128Refs)
+		for(const auto& literalRef : label.literal128Refs)
 		{
-			const auto& literal = literalRefPair.second;
-			auto literalPos = static_cast<uint32>(literalPool.GetLiteralPosition(literal.value));
-			//offset == 0 is most likely a missing assignation
-			assert(literal.offset != 0);
-			uint32 projectedOffset = literal.offset + projectedDiff;
+			auto literalIterator = m_literal128s.find(literalRef.literalId);
+			assert(literalIterator != std::end(m_literal128s));
+			auto literalPos = static_cast<uint32>(literalPool.GetLiteralPosition(literalIterator->second));
+			uint32 projectedOffset = literalRef.offset + projectedDiff;
 			m_outputStream->Seek(projectedOffset, Framework::STREAM_SEEK_SET);
 			static const uint32 opcodeSize = 4;
 			auto offset = literalPos - projectedOffset - opcodeSize;
@@ -419,17 +432,55 @@ void CX86Assembler::ResolveLiteralReferences()
 	m_outputStream->Seek(0, Framework::STREAM_SEEK_END);
 }
 
+void CX86Assembler::ResolveLabelDistanceReferences()
+{
+	for(const auto& labelId : m_labelOrder)
+	{
+		const auto& label = m_labels[labelId];
+		uint32 projectedDiff = label.projectedStart - label.start;
+		for(const auto& distanceRef : label.labelDistanceRefs)
+		{
+			const auto& referencedLabel = m_labels[distanceRef.label];
+			uint32 distance = referencedLabel.projectedStart - (distanceRef.origin + projectedDiff);
+			m_outputStream->Seek(distanceRef.offset + projectedDiff, Framework::STREAM_SEEK_SET);
+			m_outputStream->Write32(distance);
+		}
+	}
+
+	m_outputStream->Seek(0, Framework::STREAM_SEEK_END);
+}
+
+void CX86Assembler::WriteLabelDistancePlaceholder(LABEL label, uint32 origin)
+{
+	assert(m_currentLabel);
+	LABELDISTANCEREF distanceRef;
+	distanceRef.label = label;
+	distanceRef.offset = static_cast<uint32>(m_tmpStream.Tell());
+	distanceRef.origin = origin;
+	m_currentLabel->labelDistanceRefs.push_back(distanceRef);
+	//Write placeholder
+	m_tmpStream.Write32(0);
+}
+
+void CX86Assembler::DdLabelOffset(LABEL label, LABEL baseLabel)
+{
+	auto baseLabelIterator = m_labels.find(baseLabel);
+	assert(baseLabelIterator != std::end(m_labels));
+	assert(&baseLabelIterator->second == m_currentLabel);
+	WriteLabelDistancePlaceholder(label, baseLabelIterator->second.start);
+}
+
 void CX86Assembler::WriteLiteralPlaceholder(const CAddress& address)
 {
 	//Check for rIP relative addressing
 	if(address.ModRm.nByte == 0x05)
 	{
 		assert(m_currentLabel);
-		auto literalIterator = m_currentLabel->literal128Refs.find(address.literal128Id);
-		assert(literalIterator != std::end(m_currentLabel->literal128Refs));
-		auto& literal = literalIterator->second;
-		assert(literal.offset == 0);
-		literal.offset = static_cast<uint32>(m_tmpStream.Tell());
+		assert(m_literal128s.find(address.literal128Id) != std::end(m_literal128s));
+		LITERAL128REF literalRef;
+		literalRef.offset = static_cast<uint32>(m_tmpStream.Tell());
+		literalRef.literalId = address.literal128Id;
+		m_currentLabel->literal128Refs.push_back(literalRef);
 		//Write placeholder
 		m_tmpStream.Write32(0);
 	}
@@ -488,7 +539,12 @@ void CX86Assembler::AndId(const CAddress& address, uint32 constant)
 
 void CX86Assembler::AndIq(const CAddress& address, uint64 constant)
 {
-	assert(0);
+	WriteEvIq(0x04, address, constant);
+}
+
+void CX86Assembler::BsfEd(REGISTER registerId, const CAddress& address)
+{
+	WriteEvGvOp0F(0xBC, false, address, registerId);
 }
 
 void CX86Assembler::BsrEd(REGISTER registerId, const CAddress& address)
@@ -496,6 +552,22 @@ void CX86Assembler::BsrEd(REGISTER registerId, const CAddress& address)
 	WriteEvGvOp0F(0xBD, false, address, registerId);
 }
 
+void CX86Assembler::BswapEd(REGISTER registerId)
+{
+	CAddress address(MakeRegisterAddress(registerId));
+	WriteRexByte(false, address);
+	WriteByte(0x0F);
+	WriteByte(0xC8 | address.ModRm.nRM);
+}
+
+void CX86Assembler::BswapEq(REGISTER registerId)
+{
+	CAddress address(MakeRegisterAddress(registerId));
+	WriteRexByte(true, address);
+	WriteByte(0x0F);
+	WriteByte(0xC8 | address.ModRm.nRM);
+}
+
 void CX86Assembler::CallEd(const CAddress& address)
 {
 	WriteEvOp(0xFF, 0x02, false, address);
@@ -511,6 +583,11 @@ void CX86Assembler::CmovneEd(REGISTER registerId, const CAddress& address)
 	WriteEvGvOp0F(0x45, false, address, registerId);
 }
 
+void CX86Assembler::CmovneEq(REGISTER registerId, const CAddress& address)
+{
+	WriteEvGvOp0F(0x45, true, address, registerId);
+}
+
 void CX86Assembler::CmovleEd(REGISTER registerId, const CAddress& address)
 {
 	WriteEvGvOp0F(0x4E, false, address, registerId);
@@ -521,6 +598,36 @@ void CX86Assembler::CmovgEd(REGISTER registerId, const CAddress& address)
 	WriteEvGvOp0F(0x4F, false, address, registerId);
 }
 
+void CX86Assembler::CmovlEd(REGISTER registerId, const CAddress& address)
+{
+	WriteEvGvOp0F(0x4C, false, address, registerId);
+}
+
+void CX86Assembler::CmovgeEd(REGISTER registerId, const CAddress& address)
+{
+	WriteEvGvOp0F(0x4D, false, address, registerId);
+}
+
+void CX86Assembler::CmovbEd(REGISTER registerId, const CAddress& address)
+{
+	WriteEvGvOp0F(0x42, false, address, registerId);
+}
+
+void CX86Assembler::CmovbeEd(REGISTER registerId, const CAddress& address)
+{
+	WriteEvGvOp0F(0x46, false, address, registerId);
+}
+
+void CX86Assembler::CmovaEd(REGISTER registerId, const CAddress& address)
+{
+	WriteEvGvOp0F(0x47, false, address, registerId);
+}
+
+void CX86Assembler::CmovaeEd(REGISTER registerId, const CAddress& address)
+{
+	WriteEvGvOp0F(0x43, false, address, registerId);
+}
+
 void CX86Assembler::CmovsEd(REGISTER registerId, const CAddress& address)
 {
 	WriteEvGvOp0F(0x48, false, address, registerId);
@@ -533,12 +640,16 @@ void CX86Assembler::CmovnsEd(REGISTER registerId, const CAddress& address)
 
 void CX86Assembler::CmpEd(REGISTER registerId, const CAddress& address)
 {
+	uint32 start = static_cast<uint32>(m_tmpStream.Tell());
 	WriteEvGvOp(0x3B, false, address, registerId);
+	MarkFusibleCompare(start);
 }
 
 void CX86Assembler::CmpEq(REGISTER nRegister, const CAddress& Address)
 {
+	uint32 start = static_cast<uint32>(m_tmpStream.Tell());
 	WriteEvGvOp(0x3B, true, Address, nRegister);
+	MarkFusibleCompare(start);
 }
 
 void CX86Assembler::CmpIb(const CAddress& address, uint8 constant)
@@ -549,12 +660,16 @@ void CX86Assembler::CmpIb(const CAddress& address, uint8 constant)
 
 void CX86Assembler::CmpId(const CAddress& address, uint32 constant)
 {
+	uint32 start = static_cast<uint32>(m_tmpStream.Tell());
 	WriteEvId(0x07, address, constant);
+	MarkFusibleCompare(start);
 }
 
 void CX86Assembler::CmpIq(const CAddress& Address, uint64 nConstant)
 {
+	uint32 start = static_cast<uint32>(m_tmpStream.Tell());
 	WriteEvIq(0x07, Address, nConstant);
+	MarkFusibleCompare(start);
 }
 
 void CX86Assembler::Cdq()
@@ -562,16 +677,32 @@ void CX86Assembler::Cdq()
 	WriteByte(0x99);
 }
 
+void CX86Assembler::Cqo()
+{
+	WriteByte(0x48);
+	WriteByte(0x99);
+}
+
 void CX86Assembler::DivEd(const CAddress& address)
 {
 	WriteEvOp(0xF7, 0x06, false, address);
 }
 
+void CX86Assembler::DivEq(const CAddress& address)
+{
+	WriteEvOp(0xF7, 0x06, true, address);
+}
+
 void CX86Assembler::IdivEd(const CAddress& address)
 {
 	WriteEvOp(0xF7, 0x07, false, address);
 }
 
+void CX86Assembler::IdivEq(const CAddress& address)
+{
+	WriteEvOp(0xF7, 0x07, true, address);
+}
+
 void CX86Assembler::ImulEw(const CAddress& address)
 {
 	WriteByte(0x66);
@@ -583,6 +714,11 @@ void CX86Assembler::ImulEd(const CAddress& address)
 	WriteEvOp(0xF7, 0x05, false, address);
 }
 
+void CX86Assembler::ImulEq(REGISTER registerId, const CAddress& address)
+{
+	WriteEvGvOp0F(0xAF, true, address, registerId);
+}
+
 void CX86Assembler::Int3()
 {
 	WriteByte(0xCC);
@@ -663,11 +799,38 @@ void CX86Assembler::LeaGd(REGISTER registerId, const CAddress& address)
 	WriteEvGvOp(0x8D, false, address, registerId);
 }
 
+void CX86Assembler::LeaGd(REGISTER registerId, LABEL label)
+{
+	//Call the next instruction to get its address, then add the distance to the label
+	WriteByte(0xE8);
+	WriteDWord(0);
+	uint32 origin = static_cast<uint32>(m_tmpStream.Tell());
+	Pop(registerId);
+	WriteEvOp(0x81, 0x00, false, MakeRegisterAddress(registerId));
+	WriteLabelDistancePlaceholder(label, origin);
+}
+
 void CX86Assembler::LeaGq(REGISTER registerId, const CAddress& address)
 {
 	WriteEvGvOp(0x8D, true, address, registerId);
 }
 
+void CX86Assembler::LeaGq(REGISTER registerId, LABEL label)
+{
+	//rIP relative addressing, displacement is relative to the end of the instruction
+	CAddress address;
+	address.ModRm.nMod = 0;
+	address.ModRm.nRM = 5;
+	WriteEvGvOp(0x8D, true, address, registerId);
+	WriteLabelDistancePlaceholder(label, static_cast<uint32>(m_tmpStream.Tell()) + 4);
+}
+
+void CX86Assembler::LzcntEd(REGISTER registerId, const CAddress& address)
+{
+	WriteByte(0xF3);
+	WriteEvGvOp0F(0xBD, false, address, registerId);
+}
+
 void CX86Assembler::MovEw(REGISTER registerId, const CAddress& address)
 {
 	WriteByte(0x66);
@@ -778,6 +941,31 @@ void CX86Assembler::MovIq(const CX86Assembler::CAddress& address, uint32 constan
 	WriteDWord(constant);
 }
 
+void CX86Assembler::MovbeEd(REGISTER registerId, const CAddress& address)
+{
+	//MOVBE only accepts memory operands
+	assert(address.ModRm.nMod != 3);
+	WriteRexByte(false, address, registerId);
+	WriteByte(0x0F);
+	WriteByte(0x38);
+	CAddress newAddress(address);
+	newAddress.ModRm.nFnReg = registerId;
+	WriteByte(0xF0);
+	newAddress.Write(&m_tmpStream);
+}
+
+void CX86Assembler::MovbeEq(REGISTER registerId, const CAddress& address)
+{
+	assert(address.ModRm.nMod != 3);
+	WriteRexByte(true, address, registerId);
+	WriteByte(0x0F);
+	WriteByte(0x38);
+	CAddress newAddress(address);
+	newAddress.ModRm.nFnReg = registerId;
+	WriteByte(0xF0);
+	newAddress.Write(&m_tmpStream);
+}
+
 void CX86Assembler::MovsxEb(REGISTER registerId, const CAddress& address)
 {
 	WriteEbGvOp0F(0xBE, false, address, registerId);
@@ -788,6 +976,11 @@ void CX86Assembler::MovsxEw(REGISTER registerId, const CAddress& address)
 	WriteEvGvOp0F(0xBF, false, address, registerId);
 }
 
+void CX86Assembler::MovsxdEq(REGISTER registerId, const CAddress& address)
+{
+	WriteEvGvOp(0x63, true, address, registerId);
+}
+
 void CX86Assembler::MovzxEb(REGISTER registerId, const CAddress& address)
 {
 	WriteEbGvOp0F(0xB6, false, address, registerId);
@@ -818,16 +1011,31 @@ void CX86Assembler::NotEd(const CAddress& address)
 	WriteEvOp(0xF7, 0x02, false, address);
 }
 
+void CX86Assembler::NotEq(const CAddress& address)
+{
+	WriteEvOp(0xF7, 0x02, true, address);
+}
+
 void CX86Assembler::OrEd(REGISTER registerId, const CAddress& address)
 {
 	WriteEvGvOp(0x0B, false, address, registerId);
 }
 
+void CX86Assembler::OrEq(REGISTER registerId, const CAddress& address)
+{
+	WriteEvGvOp(0x0B, true, address, registerId);
+}
+
 void CX86Assembler::OrId(const CAddress& address, uint32 constant)
 {
 	WriteEvId(0x01, address, constant);
 }
 
+void CX86Assembler::OrIq(const CAddress& address, uint64 constant)
+{
+	WriteEvIq(0x01, address, constant);
+}
+
 void CX86Assembler::Pop(REGISTER registerId)
 {
 	CAddress Address(MakeRegisterAddress(registerId));
@@ -842,6 +1050,12 @@ void CX86Assembler::Push(REGISTER registerId)
 	WriteByte(0x50 | Address.ModRm.nRM);
 }
 
+void CX86Assembler::PopcntEd(REGISTER registerId, const CAddress& address)
+{
+	WriteByte(0xF3);
+	WriteEvGvOp0F(0xB8, false, address, registerId);
+}
+
 void CX86Assembler::PushEd(const CAddress& address)
 {
 	WriteEvOp(0xFF, 0x06, false, address);
@@ -870,6 +1084,62 @@ void CX86Assembler::Ret()
 	WriteByte(0xC3);
 }
 
+void CX86Assembler::RolEd(const CAddress& address)
+{
+	WriteEvOp(0xD3, 0x00, false, address);
+}
+
+void CX86Assembler::RolEd(const CAddress& address, uint8 amount)
+{
+	WriteEvOp(0xC1, 0x00, false, address);
+	WriteByte(amount);
+}
+
+void CX86Assembler::RolEq(const CAddress& address)
+{
+	WriteEvOp(0xD3, 0x00, true, address);
+}
+
+void CX86Assembler::RolEq(const CAddress& address, uint8 amount)
+{
+	WriteEvOp(0xC1, 0x00, true, address);
+	WriteByte(amount);
+}
+
+void CX86Assembler::RorEd(const CAddress& address)
+{
+	WriteEvOp(0xD3, 0x01, false, address);
+}
+
+void CX86Assembler::RorEd(const CAddress& address, uint8 amount)
+{
+	WriteEvOp(0xC1, 0x01, false, address);
+	WriteByte(amount);
+}
+
+void CX86Assembler::RorEq(const CAddress& address)
+{
+	WriteEvOp(0xD3, 0x01, true, address);
+}
+
+void CX86Assembler::RorEq(const CAddress& address, uint8 amount)
+{
+	WriteEvOp(0xC1, 0x01, true, address);
+	WriteByte(amount);
+}
+
+void CX86Assembler::RorxEd(REGISTER registerId, const CAddress& address, uint8 amount)
+{
+	WriteVexGvOp(VEX_OPCODE_MAP_F2_3A, 0xF0, false, registerId, rAX, address);
+	WriteByte(amount);
+}
+
+void CX86Assembler::RorxEq(REGISTER registerId, const CAddress& address, uint8 amount)
+{
+	WriteVexGvOp(VEX_OPCODE_MAP_F2_3A, 0xF0, true, registerId, rAX, address);
+	WriteByte(amount);
+}
+
 void CX86Assembler::SarEd(const CAddress& address)
 {
 	WriteEvOp(0xD3, 0x07, false, address);
@@ -892,6 +1162,16 @@ void CX86Assembler::SarEq(const CAddress& address, uint8 amount)
 	WriteByte(amount);
 }
 
+void CX86Assembler::SarxEd(REGISTER registerId, const CAddress& address, REGISTER amount)
+{
+	WriteVexGvOp(VEX_OPCODE_MAP_F3_38, 0xF7, false, registerId, amount, address);
+}
+
+void CX86Assembler::SarxEq(REGISTER registerId, const CAddress& address, REGISTER amount)
+{
+	WriteVexGvOp(VEX_OPCODE_MAP_F3_38, 0xF7, true, registerId, amount, address);
+}
+
 void CX86Assembler::SbbEd(REGISTER registerId, const CAddress& address)
 {
 	WriteEvGvOp(0x1B, false, address, registerId);
@@ -974,6 +1254,16 @@ void CX86Assembler::ShlEq(const CAddress& address, uint8 amount)
 	WriteByte(amount);
 }
 
+void CX86Assembler::ShlxEd(REGISTER registerId, const CAddress& address, REGISTER amount)
+{
+	WriteVexGvOp(VEX_OPCODE_MAP_66_38, 0xF7, false, registerId, amount, address);
+}
+
+void CX86Assembler::ShlxEq(REGISTER registerId, const CAddress& address, REGISTER amount)
+{
+	WriteVexGvOp(VEX_OPCODE_MAP_66_38, 0xF7, true, registerId, amount, address);
+}
+
 void CX86Assembler::ShrEd(const CAddress& address)
 {
 	WriteEvOp(0xD3, 0x05, false, address);
@@ -996,6 +1286,16 @@ void CX86Assembler::ShrEq(const CAddress& address, uint8 amount)
 	WriteByte(amount);
 }
 
+void CX86Assembler::ShrxEd(REGISTER registerId, const CAddress& address, REGISTER amount)
+{
+	WriteVexGvOp(VEX_OPCODE_MAP_F2_38, 0xF7, false, registerId, amount, address);
+}
+
+void CX86Assembler::ShrxEq(REGISTER registerId, const CAddress& address, REGISTER amount)
+{
+	WriteVexGvOp(VEX_OPCODE_MAP_F2_38, 0xF7, true, registerId, amount, address);
+}
+
 void CX86Assembler::ShldEd(const CAddress& address, REGISTER registerId)
 {
 	WriteByte(0x0F);
@@ -1053,12 +1353,30 @@ void CX86Assembler::TestEb(BYTEREGISTER registerId, const CAddress& address)
 
 void CX86Assembler::TestEd(REGISTER registerId, const CAddress& address)
 {
+	uint32 start = static_cast<uint32>(m_tmpStream.Tell());
 	WriteEvGvOp(0x85, false, address, registerId);
+	MarkFusibleCompare(start);
 }
 
 void CX86Assembler::TestEq(REGISTER registerId, const CAddress& address)
 {
+	uint32 start = static_cast<uint32>(m_tmpStream.Tell());
 	WriteEvGvOp(0x85, true, address, registerId);
+	MarkFusibleCompare(start);
+}
+
+void CX86Assembler::TestId(const CAddress& address, uint32 constant)
+{
+	uint32 start = static_cast<uint32>(m_tmpStream.Tell());
+	WriteEvOp(0xF7, 0x00, false, address);
+	WriteDWord(constant);
+	MarkFusibleCompare(start);
+}
+
+void CX86Assembler::TzcntEd(REGISTER registerId, const CAddress& address)
+{
+	WriteByte(0xF3);
+	WriteEvGvOp0F(0xBC, false, address, registerId);
 }
 
 void CX86Assembler::XorEd(REGISTER registerId, const CAddress& address)
@@ -1066,11 +1384,21 @@ void CX86Assembler::XorEd(REGISTER registerId, const CAddress& address)
 	WriteEvGvOp(0x33, false, address, registerId);
 }
 
+void CX86Assembler::XorEq(REGISTER registerId, const CAddress& address)
+{
+	WriteEvGvOp(0x33, true, address, registerId);
+}
+
 void CX86Assembler::XorId(const CAddress& address, uint32 constant)
 {
 	WriteEvId(0x06, address, constant);
 }
 
+void CX86Assembler::XorIq(const CAddress& address, uint64 constant)
+{
+	WriteEvIq(0x06, address, constant);
+}
+
 void CX86Assembler::XorGd(const CAddress& Address, REGISTER nRegister)
 {
 	WriteEvGvOp(0x31, false, Address, nRegister);
@@ -1235,11 +1563,37 @@ void CX86Assembler::CreateLabelReference(LABEL label, JMP_TYPE type)
 	LABELREF reference;
 	reference.label = label;
 	reference.offset = static_cast<uint32>(m_tmpStream.Tell());
+	reference.fusedOffset = reference.offset;
 	reference.type = type;
 
+	//Conditional jumps right after a compare in the same label can be macro-fused with it.
+	//Literal and label distance references must not move, so don't pad before those.
+	if((type != JMP_ALWAYS) && (m_fusibleCompareEnd == reference.offset) && (m_fusibleCompareStart >= m_currentLabel->start))
+	{
+		bool hasRefInCompare = false;
+		for(const auto& literalRef : m_currentLabel->literal128Refs)
+		{
+			hasRefInCompare |= (literalRef.offset >= m_fusibleCompareStart);
+		}
+		for(const auto& distanceRef : m_currentLabel->labelDistanceRefs)
+		{
+			hasRefInCompare |= (distanceRef.offset >= m_fusibleCompareStart);
+		}
+		if(!hasRefInCompare)
+		{
+			reference.fusedOffset = m_fusibleCompareStart;
+		}
+	}
+
 	m_currentLabel->labelRefs.push_back(reference);
 }
 
+void CX86Assembler::MarkFusibleCompare(uint32 start)
+{
+	m_fusibleCompareStart = start;
+	m_fusibleCompareEnd = static_cast<uint32>(m_tmpStream.Tell());
+}
+
 bool CX86Assembler::HasByteRegister(REGISTER registerId)
 {
 	return (registerId < rSP);
@@ -1323,6 +1677,29 @@ void CX86Assembler::WriteJump(Framework::CStream* stream, JMP_TYPE type, JMP_LEN
 	}
 }
 
+void CX86Assembler::WriteNops(Framework::CStream* stream, uint32 size)
+{
+	//Recommended multi-byte NOP sequences
+	static const uint8 nops[9][9] =
+	    {
+	        {0x90},
+	        {0x66, 0x90},
+	        {0x0F, 0x1F, 0x00},
+	        {0x0F, 0x1F, 0x40, 0x00},
+	        {0x0F, 0x1F, 0x44, 0x00, 0x00},
+	        {0x66, 0x0F, 0x1F, 0x44, 0x00, 0x00},
+	        {0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00},
+	        {0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},
+	        {0x66, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},
+	    };
+	while(size != 0)
+	{
+		uint32 nopSize = std::min<uint32>(size, 9);
+		stream->Write(nops[nopSize - 1], nopSize);
+		size -= nopSize;
+	}
+}
+
 void CX86Assembler::WriteByte(uint8 nByte)
 {
 	m_tmpStream.Write8(nByte);
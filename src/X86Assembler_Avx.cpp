@@ -67,6 +67,91 @@ void CX86Assembler::WriteVexShiftVoOp(uint8 op, uint8 subOp, XMMREGISTER dst, XM
 	WriteByte(amount);
 }
 
+void CX86Assembler::WriteVexGvOp(VEX_OPCODE_MAP opMap, uint8 op, bool is64, REGISTER dst, REGISTER src1, const CAddress& src2)
+{
+	uint8 prefix = (opMap >> 4) & 0x0F;
+	uint8 map = (opMap & 0x0F);
+
+	assert(prefix < 4);
+	assert(map < 4);
+
+	bool isExtendedR = (dst > rDI);
+
+	//Always use three byte VEX since we might need VEX.W
+	uint8 b1 = 0;
+	b1 |= map;
+	b1 |= (src2.nIsExtendedModRM ? 0 : 1) << 5;
+	b1 |= (src2.nIsExtendedSib ? 0 : 1) << 6;
+	b1 |= (isExtendedR ? 0 : 1) << 7;
+
+	uint8 b2 = 0;
+	b2 |= prefix;
+	b2 |= (~static_cast<uint8>(src1) & 0xF) << 3;
+	b2 |= (is64 ? 1 : 0) << 7;
+
+	WriteByte(0xC4);
+	WriteByte(b1);
+	WriteByte(b2);
+	WriteByte(op);
+	CAddress newAddress(src2);
+	newAddress.ModRm.nFnReg = dst & 7;
+	newAddress.Write(&m_tmpStream);
+}
+
+void CX86Assembler::WriteEvexVoOp(VEX_OPCODE_MAP opMap, uint8 op, bool isW, XMMREGISTER dst, XMMREGISTER src1, const CAddress& src2, OPMASKREGISTER mask)
+{
+	//Only 128-bit operations on xMM0-xMM15 are supported for now
+	uint8 prefix = (opMap >> 4) & 0x0F;
+	uint8 map = (opMap & 0x0F);
+
+	assert(prefix < 4);
+	assert(map < 4);
+
+	bool isExtendedR = (dst > xMM7);
+
+	uint8 p0 = 0;
+	p0 |= map;
+	p0 |= 1 << 4; //R'
+	p0 |= (src2.nIsExtendedModRM ? 0 : 1) << 5;
+	p0 |= (src2.nIsExtendedSib ? 0 : 1) << 6;
+	p0 |= (isExtendedR ? 0 : 1) << 7;
+
+	uint8 p1 = 0;
+	p1 |= prefix;
+	p1 |= 1 << 2;
+	p1 |= (~static_cast<uint8>(src1) & 0xF) << 3;
+	p1 |= (isW ? 1 : 0) << 7;
+
+	uint8 p2 = 0;
+	p2 |= mask;
+	p2 |= 1 << 3; //V'
+
+	WriteByte(0x62);
+	WriteByte(p0);
+	WriteByte(p1);
+	WriteByte(p2);
+	WriteByte(op);
+
+	CAddress newAddress(src2);
+	newAddress.ModRm.nFnReg = dst & 7;
+	if(newAddress.ModRm.nMod == 1)
+	{
+		//8-bit displacements are scaled by the operand size (16 bytes) in EVEX
+		auto disp8 = static_cast<int8>(newAddress.nOffset);
+		if((disp8 % 16) == 0)
+		{
+			newAddress.nOffset = static_cast<uint8>(disp8 / 16);
+		}
+		else
+		{
+			newAddress.ModRm.nMod = 2;
+			newAddress.nOffset = static_cast<int32>(disp8);
+		}
+	}
+	newAddress.Write(&m_tmpStream);
+	WriteLiteralPlaceholder(src2);
+}
+
 void CX86Assembler::VmovdVo(XMMREGISTER dst, const CAddress& src)
 {
 	WriteVexVoOp(VEX_OPCODE_MAP_66, 0x6E, dst, CX86Assembler::xMM0, src);
@@ -138,6 +223,11 @@ void CX86Assembler::VsqrtssEd(XMMREGISTER dst, XMMREGISTER src1, const CAddress&
 	WriteVexVoOp(VEX_OPCODE_MAP_F3, 0x51, dst, src1, src2);
 }
 
+void CX86Assembler::Vfmadd231ssEd(XMMREGISTER dst, XMMREGISTER src1, const CAddress& src2)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_66_38, 0xB9, dst, src1, src2);
+}
+
 void CX86Assembler::Vcvtsi2ssEd(XMMREGISTER dst, const CAddress& src)
 {
 	WriteVexVoOp(VEX_OPCODE_MAP_F3, 0x2A, dst, CX86Assembler::xMM0, src);
@@ -148,6 +238,77 @@ void CX86Assembler::Vcvttss2siEd(REGISTER dst, const CAddress& src)
 	WriteVexVoOp(VEX_OPCODE_MAP_F3, 0x2C, static_cast<XMMREGISTER>(dst), CX86Assembler::xMM0, src);
 }
 
+void CX86Assembler::VmovsdEd(XMMREGISTER dst, const CAddress& src)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_F2, 0x10, dst, CX86Assembler::xMM0, src);
+}
+
+void CX86Assembler::VmovsdEd(const CAddress& dst, XMMREGISTER src)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_F2, 0x11, src, CX86Assembler::xMM0, dst);
+}
+
+void CX86Assembler::VaddsdEd(XMMREGISTER dst, XMMREGISTER src1, const CAddress& src2)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_F2, 0x58, dst, src1, src2);
+}
+
+void CX86Assembler::VsubsdEd(XMMREGISTER dst, XMMREGISTER src1, const CAddress& src2)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_F2, 0x5C, dst, src1, src2);
+}
+
+void CX86Assembler::VmulsdEd(XMMREGISTER dst, XMMREGISTER src1, const CAddress& src2)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_F2, 0x59, dst, src1, src2);
+}
+
+void CX86Assembler::VdivsdEd(XMMREGISTER dst, XMMREGISTER src1, const CAddress& src2)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_F2, 0x5E, dst, src1, src2);
+}
+
+void CX86Assembler::VmaxsdEd(XMMREGISTER dst, XMMREGISTER src1, const CAddress& src2)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_F2, 0x5F, dst, src1, src2);
+}
+
+void CX86Assembler::VminsdEd(XMMREGISTER dst, XMMREGISTER src1, const CAddress& src2)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_F2, 0x5D, dst, src1, src2);
+}
+
+void CX86Assembler::VcmpsdEd(XMMREGISTER dst, XMMREGISTER src1, const CAddress& src2, SSE_CMP_TYPE condition)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_F2, 0xC2, dst, src1, src2);
+	WriteByte(static_cast<uint8>(condition));
+}
+
+void CX86Assembler::VsqrtsdEd(XMMREGISTER dst, XMMREGISTER src1, const CAddress& src2)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_F2, 0x51, dst, src1, src2);
+}
+
+void CX86Assembler::Vcvtss2sdEd(XMMREGISTER dst, XMMREGISTER src1, const CAddress& src2)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_F3, 0x5A, dst, src1, src2);
+}
+
+void CX86Assembler::Vcvtsd2ssEd(XMMREGISTER dst, XMMREGISTER src1, const CAddress& src2)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_F2, 0x5A, dst, src1, src2);
+}
+
+void CX86Assembler::Vcvtsi2sdEd(XMMREGISTER dst, const CAddress& src)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_F2, 0x2A, dst, CX86Assembler::xMM0, src);
+}
+
+void CX86Assembler::Vcvttsd2siEd(REGISTER dst, const CAddress& src)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_F2, 0x2C, static_cast<XMMREGISTER>(dst), CX86Assembler::xMM0, src);
+}
+
 void CX86Assembler::VmovdqaVo(XMMREGISTER dst, const CAddress& src)
 {
 	WriteVexVoOp(VEX_OPCODE_MAP_66, 0x6F, dst, CX86Assembler::xMM0, src);
@@ -283,6 +444,16 @@ void CX86Assembler::VpsrldVo(XMMREGISTER dst, XMMREGISTER src, uint8 amount)
 	WriteVexShiftVoOp(0x72, 0x02, dst, src, amount);
 }
 
+void CX86Assembler::VpsllqVo(XMMREGISTER dst, XMMREGISTER src, uint8 amount)
+{
+	WriteVexShiftVoOp(0x73, 0x06, dst, src, amount);
+}
+
+void CX86Assembler::VpsrlqVo(XMMREGISTER dst, XMMREGISTER src, uint8 amount)
+{
+	WriteVexShiftVoOp(0x73, 0x02, dst, src, amount);
+}
+
 void CX86Assembler::VpsradVo(XMMREGISTER dst, XMMREGISTER src, uint8 amount)
 {
 	WriteVexShiftVoOp(0x72, 0x04, dst, src, amount);
@@ -343,6 +514,36 @@ void CX86Assembler::VpminudVo(XMMREGISTER dst, XMMREGISTER src1, const CAddress&
 	WriteVexVoOp(VEX_OPCODE_MAP_66_38, 0x3B, dst, src1, src2);
 }
 
+void CX86Assembler::VpmullwVo(XMMREGISTER dst, XMMREGISTER src1, const CAddress& src2)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_66, 0xD5, dst, src1, src2);
+}
+
+void CX86Assembler::VpmulhwVo(XMMREGISTER dst, XMMREGISTER src1, const CAddress& src2)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_66, 0xE5, dst, src1, src2);
+}
+
+void CX86Assembler::VpmulhuwVo(XMMREGISTER dst, XMMREGISTER src1, const CAddress& src2)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_66, 0xE4, dst, src1, src2);
+}
+
+void CX86Assembler::VpmulldVo(XMMREGISTER dst, XMMREGISTER src1, const CAddress& src2)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_66_38, 0x40, dst, src1, src2);
+}
+
+void CX86Assembler::VpmuldqVo(XMMREGISTER dst, XMMREGISTER src1, const CAddress& src2)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_66_38, 0x28, dst, src1, src2);
+}
+
+void CX86Assembler::VpmuludqVo(XMMREGISTER dst, XMMREGISTER src1, const CAddress& src2)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_66, 0xF4, dst, src1, src2);
+}
+
 void CX86Assembler::VpackssdwVo(XMMREGISTER dst, XMMREGISTER src1, const CAddress& src2)
 {
 	WriteVexVoOp(VEX_OPCODE_MAP_66, 0x6B, dst, src1, src2);
@@ -388,6 +589,30 @@ void CX86Assembler::VpshufbVo(XMMREGISTER dst, XMMREGISTER src1, const CAddress&
 	WriteVexVoOp(VEX_OPCODE_MAP_66_38, 0x00, dst, src1, src2);
 }
 
+void CX86Assembler::VpshufdVo(XMMREGISTER dst, const CAddress& src, uint8 shuffleByte)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_66, 0x70, dst, CX86Assembler::xMM0, src);
+	WriteByte(shuffleByte);
+}
+
+void CX86Assembler::VpextrdVo(const CAddress& dst, XMMREGISTER src, uint8 lane)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_66_3A, 0x16, src, CX86Assembler::xMM0, dst);
+	WriteByte(lane);
+}
+
+void CX86Assembler::VpinsrdVo(XMMREGISTER dst, XMMREGISTER src1, const CAddress& src2, uint8 lane)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_66_3A, 0x22, dst, src1, src2);
+	WriteByte(lane);
+}
+
+void CX86Assembler::VinsertpsVo(XMMREGISTER dst, XMMREGISTER src1, const CAddress& src2, uint8 control)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_66_3A, 0x21, dst, src1, src2);
+	WriteByte(control);
+}
+
 void CX86Assembler::VpmovmskbVo(REGISTER dst, XMMREGISTER src)
 {
 	WriteVexVoOp(VEX_OPCODE_MAP_66, 0xD7, static_cast<XMMREGISTER>(dst), CX86Assembler::xMM0, CX86Assembler::MakeXmmRegisterAddress(src));
@@ -418,6 +643,27 @@ void CX86Assembler::VdivpsVo(XMMREGISTER dst, XMMREGISTER src1, const CAddress&
 	WriteVexVoOp(VEX_OPCODE_MAP_NONE, 0x5E, dst, src1, src2);
 }
 
+void CX86Assembler::Vfmadd231psVo(XMMREGISTER dst, XMMREGISTER src1, const CAddress& src2)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_66_38, 0xB8, dst, src1, src2);
+}
+
+void CX86Assembler::VsqrtpsVo(XMMREGISTER dst, const CAddress& src)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_NONE, 0x51, dst, CX86Assembler::xMM0, src);
+}
+
+void CX86Assembler::VhaddpsVo(XMMREGISTER dst, XMMREGISTER src1, const CAddress& src2)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_F2, 0x7C, dst, src1, src2);
+}
+
+void CX86Assembler::VdppsVo(XMMREGISTER dst, XMMREGISTER src1, const CAddress& src2, uint8 mask)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_66_3A, 0x40, dst, src1, src2);
+	WriteByte(mask);
+}
+
 void CX86Assembler::VcmpltpsVo(XMMREGISTER dst, XMMREGISTER src1, const CAddress& src2)
 {
 	VcmppsVo(dst, src1, src2, SSE_CMP_LT);
@@ -448,6 +694,16 @@ void CX86Assembler::Vcvttps2dqVo(XMMREGISTER dst, const CAddress& src)
 	WriteVexVoOp(VEX_OPCODE_MAP_F3, 0x5B, dst, CX86Assembler::xMM0, src);
 }
 
+void CX86Assembler::Vcvtdq2pdVo(XMMREGISTER dst, const CAddress& src)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_F3, 0xE6, dst, CX86Assembler::xMM0, src);
+}
+
+void CX86Assembler::Vcvttpd2dqVo(XMMREGISTER dst, const CAddress& src)
+{
+	WriteVexVoOp(VEX_OPCODE_MAP_66, 0xE6, dst, CX86Assembler::xMM0, src);
+}
+
 void CX86Assembler::VcmppsVo(XMMREGISTER dst, XMMREGISTER src1, const CAddress& src2, SSE_CMP_TYPE condition)
 {
 	WriteVexVoOp(VEX_OPCODE_MAP_NONE, 0xC2, dst, src1, src2);
@@ -465,3 +721,19 @@ void CX86Assembler::VshufpsVo(XMMREGISTER dst, XMMREGISTER src1, const CAddress&
 	WriteVexVoOp(VEX_OPCODE_MAP_NONE, 0xC6, dst, src1, src2);
 	WriteByte(shuffleByte);
 }
+
+void CX86Assembler::KmovwKd(OPMASKREGISTER dst, REGISTER src)
+{
+	WriteVexGvOp(VEX_OPCODE_MAP_NONE, 0x92, false, static_cast<REGISTER>(dst), CX86Assembler::rAX, MakeRegisterAddress(src));
+}
+
+void CX86Assembler::Vmovdqa32Vo(const CAddress& dst, XMMREGISTER src, OPMASKREGISTER mask)
+{
+	WriteEvexVoOp(VEX_OPCODE_MAP_66, 0x7F, false, src, CX86Assembler::xMM0, dst, mask);
+}
+
+void CX86Assembler::VpternlogdVo(XMMREGISTER dst, XMMREGISTER src1, const CAddress& src2, uint8 table)
+{
+	WriteEvexVoOp(VEX_OPCODE_MAP_66_3A, 0x25, false, dst, src1, src2);
+	WriteByte(table);
+}
@@ -31,6 +31,30 @@ void CX86Assembler::FisttpEd(const CAddress& address)
 	WriteEvOp(0xDB, 0x01, false, address);
 }
 
+void CX86Assembler::FldEq(const CAddress& address)
+{
+	if(address.ModRm.nMod == 3) throw std::runtime_error("Invalid address mod.");
+	WriteEvOp(0xDD, 0x00, false, address);
+}
+
+void CX86Assembler::FildEq(const CAddress& address)
+{
+	if(address.ModRm.nMod == 3) throw std::runtime_error("Invalid address mod.");
+	WriteEvOp(0xDF, 0x05, false, address);
+}
+
+void CX86Assembler::FstpEq(const CAddress& address)
+{
+	if(address.ModRm.nMod == 3) throw std::runtime_error("Invalid address mod.");
+	WriteEvOp(0xDD, 0x03, false, address);
+}
+
+void CX86Assembler::FisttpEq(const CAddress& address)
+{
+	if(address.ModRm.nMod == 3) throw std::runtime_error("Invalid address mod.");
+	WriteEvOp(0xDD, 0x01, false, address);
+}
+
 void CX86Assembler::FaddpSt(uint8 stackId)
 {
 	WriteStOp(0xDE, 0x00, stackId);
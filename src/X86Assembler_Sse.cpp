@@ -92,6 +92,87 @@ void CX86Assembler::Cvttss2siEd(REGISTER registerId, const CAddress& address)
 	WriteEdVdOp_F3_0F(0x2C, address, static_cast<XMMREGISTER>(registerId));
 }
 
+void CX86Assembler::MovsdEd(const CAddress& address, XMMREGISTER registerId)
+{
+	WriteEdVdOp_F2_0F(0x11, address, registerId);
+}
+
+void CX86Assembler::MovsdEd(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_F2_0F(0x10, address, registerId);
+}
+
+void CX86Assembler::AddsdEd(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_F2_0F(0x58, address, registerId);
+}
+
+void CX86Assembler::SubsdEd(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_F2_0F(0x5C, address, registerId);
+}
+
+void CX86Assembler::MaxsdEd(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_F2_0F(0x5F, address, registerId);
+}
+
+void CX86Assembler::MinsdEd(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_F2_0F(0x5D, address, registerId);
+}
+
+void CX86Assembler::MulsdEd(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_F2_0F(0x59, address, registerId);
+}
+
+void CX86Assembler::DivsdEd(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_F2_0F(0x5E, address, registerId);
+}
+
+void CX86Assembler::SqrtsdEd(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_F2_0F(0x51, address, registerId);
+}
+
+void CX86Assembler::CmpsdEd(XMMREGISTER registerId, const CAddress& address, SSE_CMP_TYPE condition)
+{
+	WriteEdVdOp_F2_0F(0xC2, address, registerId);
+	WriteByte(static_cast<uint8>(condition));
+}
+
+void CX86Assembler::Cvtss2sdEd(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_F3_0F(0x5A, address, registerId);
+}
+
+void CX86Assembler::Cvtsd2ssEd(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_F2_0F(0x5A, address, registerId);
+}
+
+void CX86Assembler::Cvtsi2sdEd(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_F2_0F(0x2A, address, registerId);
+}
+
+void CX86Assembler::Cvtsi2sdEq(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_F2_0F(0x2A, address, registerId, true);
+}
+
+void CX86Assembler::Cvttsd2siEd(REGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_F2_0F(0x2C, address, static_cast<XMMREGISTER>(registerId));
+}
+
+void CX86Assembler::Cvttsd2siEq(REGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_F2_0F(0x2C, address, static_cast<XMMREGISTER>(registerId), true);
+}
+
 //------------------------------------------------
 //Packed Instructions
 //------------------------------------------------
@@ -111,6 +192,11 @@ void CX86Assembler::MovqVo(XMMREGISTER registerId, const CAddress& address)
 	WriteEdVdOp_66_0F_64b(0x6E, address, registerId);
 }
 
+void CX86Assembler::MovqVo(const CAddress& address, XMMREGISTER registerId)
+{
+	WriteEdVdOp_66_0F_64b(0x7E, address, registerId);
+}
+
 void CX86Assembler::MovdqaVo(XMMREGISTER registerId, const CAddress& address)
 {
 	WriteEdVdOp_66_0F(0x6F, address, registerId);
@@ -241,6 +327,18 @@ void CX86Assembler::PcmpgtdVo(XMMREGISTER registerId, const CAddress& address)
 	WriteEdVdOp_66_0F(0x66, address, registerId);
 }
 
+void CX86Assembler::PextrdVo(const CAddress& address, XMMREGISTER registerId, uint8 lane)
+{
+	WriteEdVdOp_66_0F_3A(0x16, address, registerId);
+	WriteByte(lane);
+}
+
+void CX86Assembler::PinsrdVo(XMMREGISTER registerId, const CAddress& address, uint8 lane)
+{
+	WriteEdVdOp_66_0F_3A(0x22, address, registerId);
+	WriteByte(lane);
+}
+
 void CX86Assembler::PmaxswVo(XMMREGISTER registerId, const CAddress& address)
 {
 	WriteEdVdOp_66_0F(0xEE, address, registerId);
@@ -271,6 +369,36 @@ void CX86Assembler::PmovmskbVo(REGISTER srcReg, XMMREGISTER dstReg)
 	WriteEdVdOp_66_0F(0xD7, CX86Assembler::MakeRegisterAddress(static_cast<REGISTER>(dstReg)), static_cast<XMMREGISTER>(srcReg));
 }
 
+void CX86Assembler::PmuldqVo(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_66_0F_38(0x28, address, registerId);
+}
+
+void CX86Assembler::PmulhwVo(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_66_0F(0xE5, address, registerId);
+}
+
+void CX86Assembler::PmulhuwVo(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_66_0F(0xE4, address, registerId);
+}
+
+void CX86Assembler::PmulldVo(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_66_0F_38(0x40, address, registerId);
+}
+
+void CX86Assembler::PmullwVo(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_66_0F(0xD5, address, registerId);
+}
+
+void CX86Assembler::PmuludqVo(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_66_0F(0xF4, address, registerId);
+}
+
 void CX86Assembler::PorVo(XMMREGISTER registerId, const CAddress& address)
 {
 	WriteEdVdOp_66_0F(0xEB, address, registerId);
@@ -323,6 +451,30 @@ void CX86Assembler::PsrldVo(XMMREGISTER registerId, uint8 amount)
 	WriteByte(amount);
 }
 
+void CX86Assembler::PsllqVo(XMMREGISTER registerId, uint8 amount)
+{
+	WriteVrOp_66_0F(0x73, 0x06, registerId);
+	WriteByte(amount);
+}
+
+void CX86Assembler::PsrlqVo(XMMREGISTER registerId, uint8 amount)
+{
+	WriteVrOp_66_0F(0x73, 0x02, registerId);
+	WriteByte(amount);
+}
+
+void CX86Assembler::PslldqVo(XMMREGISTER registerId, uint8 amount)
+{
+	WriteVrOp_66_0F(0x73, 0x07, registerId);
+	WriteByte(amount);
+}
+
+void CX86Assembler::PsrldqVo(XMMREGISTER registerId, uint8 amount)
+{
+	WriteVrOp_66_0F(0x73, 0x03, registerId);
+	WriteByte(amount);
+}
+
 void CX86Assembler::PsubbVo(XMMREGISTER registerId, const CAddress& address)
 {
 	WriteEdVdOp_66_0F(0xF8, address, registerId);
@@ -358,6 +510,11 @@ void CX86Assembler::PsubdVo(XMMREGISTER registerId, const CAddress& address)
 	WriteEdVdOp_66_0F(0xFA, address, registerId);
 }
 
+void CX86Assembler::PsubqVo(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_66_0F(0xFB, address, registerId);
+}
+
 void CX86Assembler::PunpcklbwVo(XMMREGISTER registerId, const CAddress& address)
 {
 	WriteEdVdOp_66_0F(0x60, address, registerId);
@@ -409,6 +566,23 @@ void CX86Assembler::DivpsVo(XMMREGISTER registerId, const CAddress& address)
 	WriteEdVdOp_0F(0x5E, address, registerId);
 }
 
+void CX86Assembler::DppsVo(XMMREGISTER registerId, const CAddress& address, uint8 mask)
+{
+	WriteEdVdOp_66_0F_3A(0x40, address, registerId);
+	WriteByte(mask);
+}
+
+void CX86Assembler::HaddpsVo(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_F2_0F(0x7C, address, registerId);
+}
+
+void CX86Assembler::InsertpsVo(XMMREGISTER registerId, const CAddress& address, uint8 control)
+{
+	WriteEdVdOp_66_0F_3A(0x21, address, registerId);
+	WriteByte(control);
+}
+
 void CX86Assembler::Cvtdq2psVo(XMMREGISTER registerId, const CAddress& address)
 {
 	WriteEdVdOp_0F(0x5B, address, registerId);
@@ -445,6 +619,16 @@ void CX86Assembler::ShufpsVo(XMMREGISTER registerId, const CAddress& address, ui
 	WriteByte(shuffleByte);
 }
 
+void CX86Assembler::SqrtpsVo(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_0F(0x51, address, registerId);
+}
+
+void CX86Assembler::XorpsVo(XMMREGISTER registerId, const CAddress& address)
+{
+	WriteEdVdOp_0F(0x57, address, registerId);
+}
+
 //------------------------------------------------
 //Addressing utils
 //------------------------------------------------
@@ -481,6 +665,7 @@ void CX86Assembler::WriteEdVdOp_66_0F(uint8 opcode, const CAddress& address, XMM
 	NewAddress.ModRm.nFnReg = registerId;
 	WriteByte(opcode);
 	NewAddress.Write(&m_tmpStream);
+	WriteLiteralPlaceholder(address);
 }
 
 void CX86Assembler::WriteEdVdOp_66_0F_64b(uint8 opcode, const CAddress& address, XMMREGISTER xmmRegisterId)
@@ -536,6 +721,18 @@ void CX86Assembler::WriteEdVdOp_F3_0F(uint8 opcode, const CAddress& address, XMM
 	NewAddress.Write(&m_tmpStream);
 }
 
+void CX86Assembler::WriteEdVdOp_F2_0F(uint8 opcode, const CAddress& address, XMMREGISTER xmmRegisterId, bool is64)
+{
+	auto registerId = static_cast<REGISTER>(xmmRegisterId);
+	WriteByte(0xF2);
+	WriteRexByte(is64, address, registerId);
+	WriteByte(0x0F);
+	CAddress newAddress(address);
+	newAddress.ModRm.nFnReg = registerId;
+	WriteByte(opcode);
+	newAddress.Write(&m_tmpStream);
+}
+
 void CX86Assembler::WriteVrOp_66_0F(uint8 opcode, uint8 subOpcode, XMMREGISTER registerId)
 {
 	CAddress address(MakeXmmRegisterAddress(registerId));
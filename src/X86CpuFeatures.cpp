@@ -32,28 +32,67 @@ CX86CpuFeatures CX86CpuFeatures::AutoDetect()
 
 #ifdef HAS_CPUID
 	static const uint32 CPUID_FLAG_SSSE3 = 0x000200;
+	static const uint32 CPUID_FLAG_FMA = 0x001000;
 	static const uint32 CPUID_FLAG_SSE41 = 0x080000;
+	static const uint32 CPUID_FLAG_MOVBE = 0x400000;
+	static const uint32 CPUID_FLAG_POPCNT = 0x800000;
 	static const uint32 CPUID_FLAG_AVX = 0x10000000;
 	static const uint32 CPUID_FLAG_AVX2 = 0x20;
+	static const uint32 CPUID_FLAG_BMI1 = 0x08;
+	static const uint32 CPUID_FLAG_BMI2 = 0x100;
+	static const uint32 CPUID_FLAG_LZCNT = 0x20;
+	static const uint32 CPUID_FLAG_OSXSAVE = 0x8000000;
+	static const uint32 CPUID_FLAG_AVX512F = 0x10000;
+	static const uint32 CPUID_FLAG_AVX512DQ = 0x20000;
+	static const uint32 CPUID_FLAG_AVX512BW = 0x40000000;
+	static const uint32 CPUID_FLAG_AVX512VL = 0x80000000;
+	static const uint32 CPUID_FLAGS_AVX512 = CPUID_FLAG_AVX512F | CPUID_FLAG_AVX512DQ | CPUID_FLAG_AVX512BW | CPUID_FLAG_AVX512VL;
+
+	//XMM, YMM, opmask and ZMM state must be enabled by the OS
+	static const uint64 XCR0_FLAGS_AVX512 = 0xE6;
+	uint64 xcr0 = 0;
 
 #ifdef HAS_CPUID_MSVC
 	std::array<int, 4> cpuInfo1;
 	std::array<int, 4> cpuInfo7;
+	std::array<int, 4> cpuInfoExt1;
 	__cpuid(cpuInfo1.data(), 1);
-	__cpuid(cpuInfo7.data(), 7);
+	__cpuidex(cpuInfo7.data(), 7, 0);
+	__cpuid(cpuInfoExt1.data(), 0x80000001);
+	if(cpuInfo1[2] & CPUID_FLAG_OSXSAVE)
+	{
+		xcr0 = _xgetbv(0);
+	}
 #endif //HAS_CPUID_MSVC
 
 #ifdef HAS_CPUID_GCC
 	std::array<unsigned int, 4> cpuInfo1;
-	std::array<unsigned int, 4> cpuInfo7;
+	std::array<unsigned int, 4> cpuInfo7 = {};
+	std::array<unsigned int, 4> cpuInfoExt1 = {};
 	__get_cpuid(1, &cpuInfo1[0], &cpuInfo1[1], &cpuInfo1[2], &cpuInfo1[3]);
 	__get_cpuid_count(7, 0, &cpuInfo7[0], &cpuInfo7[1], &cpuInfo7[2], &cpuInfo7[3]);
+	__get_cpuid(0x80000001, &cpuInfoExt1[0], &cpuInfoExt1[1], &cpuInfoExt1[2], &cpuInfoExt1[3]);
+	if(cpuInfo1[2] & CPUID_FLAG_OSXSAVE)
+	{
+		uint32 xcr0Lo = 0, xcr0Hi = 0;
+		__asm__ __volatile__("xgetbv"
+		                     : "=a"(xcr0Lo), "=d"(xcr0Hi)
+		                     : "c"(0));
+		xcr0 = static_cast<uint64>(xcr0Lo) | (static_cast<uint64>(xcr0Hi) << 32);
+	}
 #endif //HAS_CPUID_GCC
 
 	features.hasSsse3 = (cpuInfo1[2] & CPUID_FLAG_SSSE3) != 0;
 	features.hasSse41 = (cpuInfo1[2] & CPUID_FLAG_SSE41) != 0;
 	features.hasAvx = (cpuInfo1[2] & CPUID_FLAG_AVX) != 0;
 	features.hasAvx2 = (cpuInfo7[1] & CPUID_FLAG_AVX2) != 0;
+	features.hasFma = (cpuInfo1[2] & CPUID_FLAG_FMA) != 0;
+	features.hasPopcnt = (cpuInfo1[2] & CPUID_FLAG_POPCNT) != 0;
+	features.hasMovbe = (cpuInfo1[2] & CPUID_FLAG_MOVBE) != 0;
+	features.hasBmi1 = (cpuInfo7[1] & CPUID_FLAG_BMI1) != 0;
+	features.hasBmi2 = (cpuInfo7[1] & CPUID_FLAG_BMI2) != 0;
+	features.hasLzcnt = (cpuInfoExt1[2] & CPUID_FLAG_LZCNT) != 0;
+	features.hasAvx512 = ((cpuInfo7[1] & CPUID_FLAGS_AVX512) == CPUID_FLAGS_AVX512) && ((xcr0 & XCR0_FLAGS_AVX512) == XCR0_FLAGS_AVX512);
 
 #endif //HAS_CPUID
 
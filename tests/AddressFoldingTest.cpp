@@ -0,0 +1,179 @@
+#include "AddressFoldingTest.h"
+#include "MemStream.h"
+
+#define INDEX (5)
+#define WRAPPING_INDEX (0x40000000 + INDEX)
+#define BYTE_INDEX (13)
+#define STORE_VALUE (0xA5A5C3C3)
+
+void CAddressFoldingTest::Run()
+{
+	memset(&m_context, 0, sizeof(m_context));
+
+	for(unsigned int i = 0; i < MEMORY_SIZE; i++)
+	{
+		m_memory[i] = 0x01010101 * i + 0x00030507;
+	}
+
+	uint32 memory[MEMORY_SIZE];
+	memcpy(memory, m_memory, sizeof(memory));
+	auto memoryBytes = reinterpret_cast<const uint8*>(memory);
+
+	m_context.memory = m_memory;
+	m_context.index = INDEX;
+	m_context.wrappingIndex = WRAPPING_INDEX;
+	m_context.byteIndex = BYTE_INDEX;
+	m_context.storeValue = STORE_VALUE;
+
+	m_function(&m_context);
+
+	uint16 half = 0;
+	memcpy(&half, memoryBytes + 6, sizeof(uint16));
+	uint16 halfShifted = 0;
+	memcpy(&halfShifted, memoryBytes + (INDEX * 2), sizeof(uint16));
+	uint64 value64 = 0;
+	memcpy(&value64, memoryBytes + ((INDEX >> 2) * 8), sizeof(uint64));
+
+	TEST_VERIFY(m_context.resultShiftedIndex == memory[INDEX]);
+	TEST_VERIFY(m_context.resultWrappingIndex == memory[INDEX]);
+	TEST_VERIFY(m_context.resultByteIndex == memoryBytes[BYTE_INDEX]);
+	TEST_VERIFY(m_context.resultOffsetChain == memory[3]);
+	TEST_VERIFY(m_context.resultOffsetConstantIndex == memory[4]);
+	TEST_VERIFY(m_context.resultHalf == half);
+	TEST_VERIFY(m_context.resultHalfShifted == halfShifted);
+	TEST_VERIFY(m_context.resultScale8 == memory[INDEX * 2]);
+	TEST_VERIFY(m_context.resultScale16 == memory[INDEX * 4]);
+	TEST_VERIFY(m_context.resultReusedRef == STORE_VALUE);
+	TEST_VERIFY(m_context.result64 == value64);
+
+	TEST_VERIFY(m_memory[INDEX + 1] == STORE_VALUE);
+	TEST_VERIFY(m_memory[8] == STORE_VALUE + 1);
+	for(unsigned int i = 0; i < MEMORY_SIZE; i++)
+	{
+		if((i == (INDEX + 1)) || (i == 8)) continue;
+		TEST_VERIFY(m_memory[i] == memory[i]);
+	}
+}
+
+void CAddressFoldingTest::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		//Shifted index added to reference
+		jitter.PushRelRef(offsetof(CONTEXT, memory));
+		jitter.PushRel(offsetof(CONTEXT, index));
+		jitter.PushCst(0xFF);
+		jitter.And();
+		jitter.Shl(2);
+		jitter.AddRef();
+		jitter.LoadFromRef();
+		jitter.PullRel(offsetof(CONTEXT, resultShiftedIndex));
+
+		//Shifted index that wraps around, can't be folded into the scale
+		jitter.PushRelRef(offsetof(CONTEXT, memory));
+		jitter.PushRel(offsetof(CONTEXT, wrappingIndex));
+		jitter.Shl(2);
+		jitter.AddRef();
+		jitter.LoadFromRef();
+		jitter.PullRel(offsetof(CONTEXT, resultWrappingIndex));
+
+		//Byte index added to reference
+		jitter.PushRelRef(offsetof(CONTEXT, memory));
+		jitter.PushRel(offsetof(CONTEXT, byteIndex));
+		jitter.AddRef();
+		jitter.Load8FromRef();
+		jitter.PullRel(offsetof(CONTEXT, resultByteIndex));
+
+		//Constant offsets added to reference
+		jitter.PushRelRef(offsetof(CONTEXT, memory));
+		jitter.PushCst(4);
+		jitter.AddRef();
+		jitter.PushCst(8);
+		jitter.AddRef();
+		jitter.LoadFromRef();
+		jitter.PullRel(offsetof(CONTEXT, resultOffsetChain));
+
+		jitter.PushRelRef(offsetof(CONTEXT, memory));
+		jitter.PushCst(8);
+		jitter.AddRef();
+		jitter.PushCst(2);
+		jitter.LoadFromRefIdx(4);
+		jitter.PullRel(offsetof(CONTEXT, resultOffsetConstantIndex));
+
+		//16-bit accesses
+		jitter.PushRelRef(offsetof(CONTEXT, memory));
+		jitter.PushCst(6);
+		jitter.AddRef();
+		jitter.Load16FromRef();
+		jitter.PullRel(offsetof(CONTEXT, resultHalf));
+
+		jitter.PushRelRef(offsetof(CONTEXT, memory));
+		jitter.PushRel(offsetof(CONTEXT, index));
+		jitter.PushCst(0xFF);
+		jitter.And();
+		jitter.Shl(1);
+		jitter.AddRef();
+		jitter.Load16FromRef();
+		jitter.PullRel(offsetof(CONTEXT, resultHalfShifted));
+
+		//Scale larger than the access size
+		jitter.PushRelRef(offsetof(CONTEXT, memory));
+		jitter.PushRel(offsetof(CONTEXT, index));
+		jitter.PushCst(0xFF);
+		jitter.And();
+		jitter.Shl(3);
+		jitter.AddRef();
+		jitter.LoadFromRef();
+		jitter.PullRel(offsetof(CONTEXT, resultScale8));
+
+		//Scale that no backend can encode, index stays shifted
+		jitter.PushRelRef(offsetof(CONTEXT, memory));
+		jitter.PushRel(offsetof(CONTEXT, index));
+		jitter.PushCst(0xFF);
+		jitter.And();
+		jitter.Shl(4);
+		jitter.AddRef();
+		jitter.LoadFromRef();
+		jitter.PullRel(offsetof(CONTEXT, resultScale16));
+
+		//64-bit access
+		jitter.PushRelRef(offsetof(CONTEXT, memory));
+		jitter.PushRel(offsetof(CONTEXT, index));
+		jitter.Srl(2);
+		jitter.Shl(3);
+		jitter.AddRef();
+		jitter.Load64FromRef();
+		jitter.PullRel64(offsetof(CONTEXT, result64));
+
+		//Reference used by more than one access
+		jitter.PushRelRef(offsetof(CONTEXT, memory));
+		jitter.PushRel(offsetof(CONTEXT, index));
+		jitter.PushCst(1);
+		jitter.Add();
+		jitter.Shl(2);
+		jitter.AddRef();
+		jitter.PushTop();
+		jitter.PushRel(offsetof(CONTEXT, storeValue));
+		jitter.StoreAtRef();
+		jitter.LoadFromRef();
+		jitter.PullRel(offsetof(CONTEXT, resultReusedRef));
+
+		//Store with shifted index
+		jitter.PushRelRef(offsetof(CONTEXT, memory));
+		jitter.PushRel(offsetof(CONTEXT, index));
+		jitter.PushCst(3);
+		jitter.Add();
+		jitter.Shl(2);
+		jitter.AddRef();
+		jitter.PushRel(offsetof(CONTEXT, storeValue));
+		jitter.PushCst(1);
+		jitter.Add();
+		jitter.StoreAtRef();
+	}
+	jitter.End();
+
+	m_function = FunctionType(codeStream.GetBuffer(), codeStream.GetSize());
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Test.h"
+
+class CAddressFoldingTest : public CTest
+{
+public:
+	void Run() override;
+	void Compile(Jitter::CJitter&) override;
+
+private:
+	struct CONTEXT
+	{
+		void* memory;
+		uint32 index;
+		uint32 wrappingIndex;
+		uint32 byteIndex;
+		uint32 storeValue;
+
+		uint32 resultShiftedIndex;
+		uint32 resultWrappingIndex;
+		uint32 resultByteIndex;
+		uint32 resultOffsetChain;
+		uint32 resultOffsetConstantIndex;
+		uint32 resultHalf;
+		uint32 resultHalfShifted;
+		uint32 resultScale8;
+		uint32 resultScale16;
+		uint32 resultReusedRef;
+		uint64 result64;
+	};
+
+	enum
+	{
+		MEMORY_SIZE = 0x20,
+	};
+
+	CONTEXT m_context;
+	uint32 m_memory[MEMORY_SIZE];
+	FunctionType m_function;
+};
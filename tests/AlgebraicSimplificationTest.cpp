@@ -0,0 +1,257 @@
+#include "AlgebraicSimplificationTest.h"
+#include "MemStream.h"
+
+#define VALUE (0x8123F0A5)
+#define VALUE64 (0x8765432112345678ULL)
+#define SHIFT_AMOUNT (5)
+
+void CAlgebraicSimplificationTest::Run()
+{
+	memset(&m_context, 0, sizeof(m_context));
+
+	m_context.value = VALUE;
+	m_context.shiftAmount = SHIFT_AMOUNT;
+	m_context.value64 = VALUE64;
+	for(unsigned int i = 0; i < 4; i++)
+	{
+		m_context.mdValue[i] = VALUE + (i * 0x01020304);
+	}
+
+	m_function(&m_context);
+
+	TEST_VERIFY(m_context.resultAddZero == VALUE);
+	TEST_VERIFY(m_context.resultAndOnes == VALUE);
+	TEST_VERIFY(m_context.resultOrOnes == ~0U);
+	TEST_VERIFY(m_context.resultOrZero == VALUE);
+	TEST_VERIFY(m_context.resultXorSelf == 0);
+	TEST_VERIFY(m_context.resultSubSelf == 0);
+	TEST_VERIFY(m_context.resultShiftZero == 0);
+	TEST_VERIFY(m_context.resultNotNot == VALUE);
+	TEST_VERIFY(m_context.resultSrlChain == (VALUE >> 8));
+	TEST_VERIFY(m_context.resultShlChain == 0);
+	TEST_VERIFY(m_context.resultSraChain == static_cast<uint32>(static_cast<int32>(VALUE) >> 31));
+	TEST_VERIFY(m_context.resultSignExt == static_cast<uint32>(static_cast<int32>(VALUE) >> 24));
+	TEST_VERIFY(m_context.resultAndChain == (VALUE & 0x00FF00F0));
+	TEST_VERIFY(m_context.resultOrChain == (VALUE | 0x0F0F0000));
+	TEST_VERIFY(m_context.resultXorChain == (VALUE ^ 0x00FF00F0));
+	TEST_VERIFY(m_context.resultSrlMask == (VALUE >> 24));
+	TEST_VERIFY(m_context.resultReorderAdd == (VALUE + 0x10));
+	TEST_VERIFY(m_context.resultReorderAddShift == ((VALUE + 0x10) << 2));
+	TEST_VERIFY(m_context.resultCmpEqSelf == 1);
+	TEST_VERIFY(m_context.resultCmpLtSelf == 0);
+	TEST_VERIFY(m_context.resultSelectSame == VALUE);
+	TEST_VERIFY(m_context.resultExtMerge == (VALUE + SHIFT_AMOUNT));
+
+	TEST_VERIFY(m_context.result64AddZero == VALUE64);
+	TEST_VERIFY(m_context.result64AndOnes == VALUE64);
+	TEST_VERIFY(m_context.result64SubSelf == 0);
+
+	for(unsigned int i = 0; i < 4; i++)
+	{
+		uint32 mdValue = m_context.mdValue[i];
+		TEST_VERIFY(m_context.mdResultAndOnes[i] == mdValue);
+		TEST_VERIFY(m_context.mdResultOrZero[i] == mdValue);
+		TEST_VERIFY(m_context.mdResultXorSelf[i] == 0);
+		TEST_VERIFY(m_context.mdResultAddZero[i] == mdValue);
+		TEST_VERIFY(m_context.mdResultSubSelf[i] == 0);
+		TEST_VERIFY(m_context.mdResultCmpEqSelf[i] == ~0U);
+		TEST_VERIFY(m_context.mdResultCmpGtSelf[i] == 0);
+		TEST_VERIFY(m_context.mdResultNotNot[i] == mdValue);
+	}
+}
+
+void CAlgebraicSimplificationTest::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		//Identities
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.PushCst(0);
+		jitter.Add();
+		jitter.PullRel(offsetof(CONTEXT, resultAddZero));
+
+		jitter.PushCst(~0U);
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.And();
+		jitter.PullRel(offsetof(CONTEXT, resultAndOnes));
+
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.PushCst(~0U);
+		jitter.Or();
+		jitter.PullRel(offsetof(CONTEXT, resultOrOnes));
+
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.PushCst(0);
+		jitter.Or();
+		jitter.PullRel(offsetof(CONTEXT, resultOrZero));
+
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.Xor();
+		jitter.PullRel(offsetof(CONTEXT, resultXorSelf));
+
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.Sub();
+		jitter.PullRel(offsetof(CONTEXT, resultSubSelf));
+
+		jitter.PushCst(0);
+		jitter.PushRel(offsetof(CONTEXT, shiftAmount));
+		jitter.Shl();
+		jitter.PullRel(offsetof(CONTEXT, resultShiftZero));
+
+		//Double negation
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.Not();
+		jitter.Not();
+		jitter.PullRel(offsetof(CONTEXT, resultNotNot));
+
+		//Shift chains
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.Srl(3);
+		jitter.Srl(5);
+		jitter.PullRel(offsetof(CONTEXT, resultSrlChain));
+
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.Shl(20);
+		jitter.Shl(20);
+		jitter.PullRel(offsetof(CONTEXT, resultShlChain));
+
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.Sra(20);
+		jitter.Sra(20);
+		jitter.PullRel(offsetof(CONTEXT, resultSraChain));
+
+		//Sign extending a value that is already sign extended
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.Sra(24);
+		jitter.SignExt16();
+		jitter.PullRel(offsetof(CONTEXT, resultSignExt));
+
+		//Mask chains
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.PushCst(0x00FF0FF0);
+		jitter.And();
+		jitter.PushCst(0xF0FFF0FF);
+		jitter.And();
+		jitter.PullRel(offsetof(CONTEXT, resultAndChain));
+
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.PushCst(0x0F000000);
+		jitter.Or();
+		jitter.PushCst(0x000F0000);
+		jitter.Or();
+		jitter.PullRel(offsetof(CONTEXT, resultOrChain));
+
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.PushCst(0x00FFFF00);
+		jitter.Xor();
+		jitter.PushCst(0x0000FFF0);
+		jitter.Xor();
+		jitter.PullRel(offsetof(CONTEXT, resultXorChain));
+
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.Srl(24);
+		jitter.PushCst(0xFF);
+		jitter.And();
+		jitter.PullRel(offsetof(CONTEXT, resultSrlMask));
+
+		//Addition result used after being shifted
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.PushCst(0x10);
+		jitter.Add();
+		jitter.PushTop();
+		jitter.Shl(2);
+		jitter.PullRel(offsetof(CONTEXT, resultReorderAddShift));
+		jitter.PullRel(offsetof(CONTEXT, resultReorderAdd));
+
+		//Comparisons and selects with identical operands
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.Cmp(Jitter::CONDITION_EQ);
+		jitter.PullRel(offsetof(CONTEXT, resultCmpEqSelf));
+
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.Cmp(Jitter::CONDITION_LT);
+		jitter.PullRel(offsetof(CONTEXT, resultCmpLtSelf));
+
+		jitter.PushRel(offsetof(CONTEXT, shiftAmount));
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.Select();
+		jitter.PullRel(offsetof(CONTEXT, resultSelectSame));
+
+		//Extracting a part of a merged value
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.PushRel(offsetof(CONTEXT, shiftAmount));
+		jitter.Add();
+		jitter.PushRel(offsetof(CONTEXT, shiftAmount));
+		jitter.MergeTo64();
+		jitter.ExtLow64();
+		jitter.PullRel(offsetof(CONTEXT, resultExtMerge));
+
+		//64-bits identities
+		jitter.PushRel64(offsetof(CONTEXT, value64));
+		jitter.PushCst64(0);
+		jitter.Add64();
+		jitter.PullRel64(offsetof(CONTEXT, result64AddZero));
+
+		jitter.PushRel64(offsetof(CONTEXT, value64));
+		jitter.PushCst64(~0ULL);
+		jitter.And64();
+		jitter.PullRel64(offsetof(CONTEXT, result64AndOnes));
+
+		jitter.PushRel64(offsetof(CONTEXT, value64));
+		jitter.PushRel64(offsetof(CONTEXT, value64));
+		jitter.Sub64();
+		jitter.PullRel64(offsetof(CONTEXT, result64SubSelf));
+
+		//SIMD identities
+		jitter.MD_PushRel(offsetof(CONTEXT, mdValue));
+		jitter.MD_PushCstExpandW(~0U);
+		jitter.MD_And();
+		jitter.MD_PullRel(offsetof(CONTEXT, mdResultAndOnes));
+
+		jitter.MD_PushCstExpandW(0);
+		jitter.MD_PushRel(offsetof(CONTEXT, mdValue));
+		jitter.MD_Or();
+		jitter.MD_PullRel(offsetof(CONTEXT, mdResultOrZero));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, mdValue));
+		jitter.MD_PushRel(offsetof(CONTEXT, mdValue));
+		jitter.MD_Xor();
+		jitter.MD_PullRel(offsetof(CONTEXT, mdResultXorSelf));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, mdValue));
+		jitter.MD_PushCstExpandW(0);
+		jitter.MD_AddW();
+		jitter.MD_PullRel(offsetof(CONTEXT, mdResultAddZero));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, mdValue));
+		jitter.MD_PushRel(offsetof(CONTEXT, mdValue));
+		jitter.MD_SubH();
+		jitter.MD_PullRel(offsetof(CONTEXT, mdResultSubSelf));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, mdValue));
+		jitter.MD_PushRel(offsetof(CONTEXT, mdValue));
+		jitter.MD_CmpEqB();
+		jitter.MD_PullRel(offsetof(CONTEXT, mdResultCmpEqSelf));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, mdValue));
+		jitter.MD_PushRel(offsetof(CONTEXT, mdValue));
+		jitter.MD_CmpGtW();
+		jitter.MD_PullRel(offsetof(CONTEXT, mdResultCmpGtSelf));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, mdValue));
+		jitter.MD_Not();
+		jitter.MD_Not();
+		jitter.MD_PullRel(offsetof(CONTEXT, mdResultNotNot));
+	}
+	jitter.End();
+
+	m_function = FunctionType(codeStream.GetBuffer(), codeStream.GetSize());
+}
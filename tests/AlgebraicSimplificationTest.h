@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Test.h"
+#include "Align16.h"
+
+class CAlgebraicSimplificationTest : public CTest
+{
+public:
+	void Run() override;
+	void Compile(Jitter::CJitter&) override;
+
+private:
+	struct CONTEXT
+	{
+		ALIGN16
+
+		uint32 mdValue[4];
+
+		uint32 mdResultAndOnes[4];
+		uint32 mdResultOrZero[4];
+		uint32 mdResultXorSelf[4];
+		uint32 mdResultAddZero[4];
+		uint32 mdResultSubSelf[4];
+		uint32 mdResultCmpEqSelf[4];
+		uint32 mdResultCmpGtSelf[4];
+		uint32 mdResultNotNot[4];
+
+		uint64 value64;
+
+		uint64 result64AddZero;
+		uint64 result64AndOnes;
+		uint64 result64SubSelf;
+
+		uint32 value;
+		uint32 shiftAmount;
+
+		uint32 resultAddZero;
+		uint32 resultAndOnes;
+		uint32 resultOrOnes;
+		uint32 resultOrZero;
+		uint32 resultXorSelf;
+		uint32 resultSubSelf;
+		uint32 resultShiftZero;
+		uint32 resultNotNot;
+		uint32 resultSrlChain;
+		uint32 resultShlChain;
+		uint32 resultSraChain;
+		uint32 resultSignExt;
+		uint32 resultAndChain;
+		uint32 resultOrChain;
+		uint32 resultXorChain;
+		uint32 resultSrlMask;
+		uint32 resultReorderAdd;
+		uint32 resultReorderAddShift;
+		uint32 resultCmpEqSelf;
+		uint32 resultCmpLtSelf;
+		uint32 resultSelectSame;
+		uint32 resultExtMerge;
+	};
+
+	CONTEXT m_context;
+	FunctionType m_function;
+};
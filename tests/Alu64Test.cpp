@@ -6,6 +6,7 @@
 #define CONSTANT_3 (0xFEDCBA9800000000ULL)
 #define CONSTANT_4 (0x0000000076543210ULL)
 #define CONSTANT_5 (0xFFFFFFFFFFFFFFFFULL)
+#define CONSTANT_6 (0x0000000123456789ULL)
 
 void CAlu64Test::Run()
 {
@@ -15,6 +16,10 @@ void CAlu64Test::Run()
 	m_context.value1 = CONSTANT_2;
 	m_context.value2 = CONSTANT_3;
 	m_context.value3 = CONSTANT_4;
+	for(unsigned int i = 0; i < 4; i++)
+	{
+		m_context.mdValue[i] = i + 1;
+	}
 
 	m_function(&m_context);
 
@@ -26,6 +31,19 @@ void CAlu64Test::Run()
 	TEST_VERIFY(m_context.resultSub1 == (CONSTANT_3 - CONSTANT_4));
 	TEST_VERIFY(m_context.resultSubCst0 == (CONSTANT_5 - CONSTANT_1));
 	TEST_VERIFY(m_context.resultSubCst1 == (CONSTANT_2 - CONSTANT_3));
+
+	TEST_VERIFY(m_context.resultMul == (CONSTANT_1 * CONSTANT_2));
+	TEST_VERIFY(m_context.resultMulCst == (CONSTANT_3 * CONSTANT_6));
+	TEST_VERIFY(m_context.resultDiv == (CONSTANT_1 / CONSTANT_4));
+	TEST_VERIFY(m_context.resultDivCst == (CONSTANT_2 / CONSTANT_6));
+	TEST_VERIFY(m_context.resultDivS == static_cast<uint64>(static_cast<int64>(CONSTANT_1) / static_cast<int64>(CONSTANT_4)));
+	TEST_VERIFY(m_context.resultDivSCst == static_cast<uint64>(static_cast<int64>(CONSTANT_6) / static_cast<int64>(CONSTANT_3)));
+
+	//MD value kept alive across divisions (helper calls on some platforms)
+	for(unsigned int i = 0; i < 4; i++)
+	{
+		TEST_VERIFY(m_context.mdResult[i] == (i + 1) * 3);
+	}
 }
 
 void CAlu64Test::Compile(Jitter::CJitter& jitter)
@@ -35,6 +53,10 @@ void CAlu64Test::Compile(Jitter::CJitter& jitter)
 
 	jitter.Begin();
 	{
+		jitter.MD_PushRel(offsetof(CONTEXT, mdValue));
+		jitter.MD_PushRel(offsetof(CONTEXT, mdValue));
+		jitter.MD_AddW();
+		jitter.MD_PullRel(offsetof(CONTEXT, mdTemp));
 		jitter.PushRel64(offsetof(CONTEXT, value0));
 		jitter.PushRel64(offsetof(CONTEXT, value1));
 		jitter.Add64();
@@ -69,6 +91,41 @@ void CAlu64Test::Compile(Jitter::CJitter& jitter)
 		jitter.PushCst64(CONSTANT_3);
 		jitter.Sub64();
 		jitter.PullRel64(offsetof(CONTEXT, resultSubCst1));
+
+		jitter.PushRel64(offsetof(CONTEXT, value0));
+		jitter.PushRel64(offsetof(CONTEXT, value1));
+		jitter.Mult64();
+		jitter.PullRel64(offsetof(CONTEXT, resultMul));
+
+		jitter.PushRel64(offsetof(CONTEXT, value2));
+		jitter.PushCst64(CONSTANT_6);
+		jitter.Mult64();
+		jitter.PullRel64(offsetof(CONTEXT, resultMulCst));
+
+		jitter.PushRel64(offsetof(CONTEXT, value0));
+		jitter.PushRel64(offsetof(CONTEXT, value3));
+		jitter.Div64();
+		jitter.PullRel64(offsetof(CONTEXT, resultDiv));
+
+		jitter.PushRel64(offsetof(CONTEXT, value1));
+		jitter.PushCst64(CONSTANT_6);
+		jitter.Div64();
+		jitter.PullRel64(offsetof(CONTEXT, resultDivCst));
+
+		jitter.PushRel64(offsetof(CONTEXT, value0));
+		jitter.PushRel64(offsetof(CONTEXT, value3));
+		jitter.DivS64();
+		jitter.PullRel64(offsetof(CONTEXT, resultDivS));
+
+		jitter.PushCst64(CONSTANT_6);
+		jitter.PushRel64(offsetof(CONTEXT, value2));
+		jitter.DivS64();
+		jitter.PullRel64(offsetof(CONTEXT, resultDivSCst));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, mdTemp));
+		jitter.MD_PushRel(offsetof(CONTEXT, mdValue));
+		jitter.MD_AddW();
+		jitter.MD_PullRel(offsetof(CONTEXT, mdResult));
 	}
 	jitter.End();
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Test.h"
+#include "Align16.h"
 
 class CAlu64Test : public CTest
 {
@@ -11,6 +12,12 @@ public:
 private:
 	struct CONTEXT
 	{
+		ALIGN16
+
+		uint32 mdValue[4];
+		uint32 mdTemp[4];
+		uint32 mdResult[4];
+
 		uint64 value0;
 		uint64 value1;
 		uint64 value2;
@@ -23,6 +30,12 @@ private:
 		uint64 resultSub1;
 		uint64 resultSubCst0;
 		uint64 resultSubCst1;
+		uint64 resultMul;
+		uint64 resultMulCst;
+		uint64 resultDiv;
+		uint64 resultDivCst;
+		uint64 resultDivS;
+		uint64 resultDivSCst;
 	};
 
 	CONTEXT m_context;
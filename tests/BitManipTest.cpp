@@ -0,0 +1,105 @@
+#include "BitManipTest.h"
+#include "MemStream.h"
+
+#define CONSTANT_1 (0x12345678)
+#define CONSTANT_64 (0x0123456789ABCDEFULL)
+
+static const uint32 g_inputs[] = {0x00000000, 0x80000000, 0xF0F0F0F0, 0x12345678};
+
+void CBitManipTest::Run()
+{
+	memset(&m_context, 0, sizeof(m_context));
+
+	for(unsigned int i = 0; i < INPUT_COUNT; i++)
+	{
+		m_context.input[i] = g_inputs[i];
+	}
+	m_context.input64 = CONSTANT_64;
+
+	m_function(&m_context);
+
+	TEST_VERIFY(m_context.resultTzc[0] == 32);
+	TEST_VERIFY(m_context.resultTzc[1] == 31);
+	TEST_VERIFY(m_context.resultTzc[2] == 4);
+	TEST_VERIFY(m_context.resultTzc[3] == 3);
+
+	TEST_VERIFY(m_context.resultPopcnt[0] == 0);
+	TEST_VERIFY(m_context.resultPopcnt[1] == 1);
+	TEST_VERIFY(m_context.resultPopcnt[2] == 16);
+	TEST_VERIFY(m_context.resultPopcnt[3] == 13);
+
+	TEST_VERIFY(m_context.resultBswap[0] == 0x00000000);
+	TEST_VERIFY(m_context.resultBswap[1] == 0x00000080);
+	TEST_VERIFY(m_context.resultBswap[2] == 0xF0F0F0F0);
+	TEST_VERIFY(m_context.resultBswap[3] == 0x78563412);
+
+	//BSWAP16 only uses the low 16 bits of the input
+	TEST_VERIFY(m_context.resultBswap16[0] == 0x0000);
+	TEST_VERIFY(m_context.resultBswap16[1] == 0x0000);
+	TEST_VERIFY(m_context.resultBswap16[2] == 0xF0F0);
+	TEST_VERIFY(m_context.resultBswap16[3] == 0x7856);
+
+	TEST_VERIFY(m_context.resultBswap64 == 0xEFCDAB8967452301ULL);
+
+	TEST_VERIFY(m_context.resultTzcCst == 3);
+	TEST_VERIFY(m_context.resultPopcntCst == 13);
+	TEST_VERIFY(m_context.resultBswapCst == 0x78563412);
+	TEST_VERIFY(m_context.resultBswap16Cst == 0x7856);
+	TEST_VERIFY(m_context.resultBswap64Cst == 0xEFCDAB8967452301ULL);
+}
+
+void CBitManipTest::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		for(unsigned int i = 0; i < INPUT_COUNT; i++)
+		{
+			jitter.PushRel(offsetof(CONTEXT, input) + (i * sizeof(uint32)));
+			jitter.Tzc();
+			jitter.PullRel(offsetof(CONTEXT, resultTzc) + (i * sizeof(uint32)));
+
+			jitter.PushRel(offsetof(CONTEXT, input) + (i * sizeof(uint32)));
+			jitter.Popcnt();
+			jitter.PullRel(offsetof(CONTEXT, resultPopcnt) + (i * sizeof(uint32)));
+
+			jitter.PushRel(offsetof(CONTEXT, input) + (i * sizeof(uint32)));
+			jitter.Bswap();
+			jitter.PullRel(offsetof(CONTEXT, resultBswap) + (i * sizeof(uint32)));
+
+			jitter.PushRel(offsetof(CONTEXT, input) + (i * sizeof(uint32)));
+			jitter.Bswap16();
+			jitter.PullRel(offsetof(CONTEXT, resultBswap16) + (i * sizeof(uint32)));
+		}
+
+		jitter.PushRel64(offsetof(CONTEXT, input64));
+		jitter.Bswap64();
+		jitter.PullRel64(offsetof(CONTEXT, resultBswap64));
+
+		//Folded
+		jitter.PushCst(CONSTANT_1);
+		jitter.Tzc();
+		jitter.PullRel(offsetof(CONTEXT, resultTzcCst));
+
+		jitter.PushCst(CONSTANT_1);
+		jitter.Popcnt();
+		jitter.PullRel(offsetof(CONTEXT, resultPopcntCst));
+
+		jitter.PushCst(CONSTANT_1);
+		jitter.Bswap();
+		jitter.PullRel(offsetof(CONTEXT, resultBswapCst));
+
+		jitter.PushCst(CONSTANT_1);
+		jitter.Bswap16();
+		jitter.PullRel(offsetof(CONTEXT, resultBswap16Cst));
+
+		jitter.PushCst64(CONSTANT_64);
+		jitter.Bswap64();
+		jitter.PullRel64(offsetof(CONTEXT, resultBswap64Cst));
+	}
+	jitter.End();
+
+	m_function = FunctionType(codeStream.GetBuffer(), codeStream.GetSize());
+}
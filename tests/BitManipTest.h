@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Test.h"
+
+class CBitManipTest : public CTest
+{
+public:
+	void Run() override;
+	void Compile(Jitter::CJitter&) override;
+
+private:
+	enum
+	{
+		INPUT_COUNT = 4,
+	};
+
+	struct CONTEXT
+	{
+		uint32 input[INPUT_COUNT];
+		uint64 input64;
+
+		uint32 resultTzc[INPUT_COUNT];
+		uint32 resultPopcnt[INPUT_COUNT];
+		uint32 resultBswap[INPUT_COUNT];
+		uint32 resultBswap16[INPUT_COUNT];
+		uint64 resultBswap64;
+
+		uint32 resultTzcCst;
+		uint32 resultPopcntCst;
+		uint32 resultBswapCst;
+		uint32 resultBswap16Cst;
+		uint64 resultBswap64Cst;
+	};
+
+	CONTEXT m_context;
+	FunctionType m_function;
+};
@@ -12,6 +12,7 @@ void CConditionTest::Run()
 {
 	memset(&m_context, 0, sizeof(m_context));
 
+	m_context.self = &m_context;
 	m_context.value0 = m_value0;
 	m_context.value1 = m_value1;
 
@@ -20,6 +21,9 @@ void CConditionTest::Run()
 	m_context.resultEq = m_context.resultNe = 0xdeadbeef;
 	m_context.resultBl = m_context.resultBe = m_context.resultAe = m_context.resultLt = 0xdeadbeef;
 	m_context.resultLe = m_context.resultAb = m_context.resultGt = m_context.resultGe = 0xdeadbeef;
+	m_context.resultCmpEq = m_context.resultCmpNe = m_context.resultCmpBl = m_context.resultCmpAe = 0xdeadbeef;
+	m_context.resultCmpNotLt = m_context.resultCmpOneGt = m_context.resultSubEq = m_context.resultXorNe = 0xdeadbeef;
+	m_context.resultAndEq = m_context.resultAndNe = 0xdeadbeef;
 
 	m_function(&m_context);
 
@@ -48,6 +52,17 @@ void CConditionTest::Run()
 	TEST_VERIFY(m_context.resultLe == resultLe);
 	TEST_VERIFY(m_context.resultGt == resultGt);
 	TEST_VERIFY(m_context.resultGe == resultGe);
+
+	TEST_VERIFY(m_context.resultCmpEq == resultEq);
+	TEST_VERIFY(m_context.resultCmpNe == resultNe);
+	TEST_VERIFY(m_context.resultCmpBl == resultBl);
+	TEST_VERIFY(m_context.resultCmpAe == resultAe);
+	TEST_VERIFY(m_context.resultCmpNotLt == (resultLt ^ 1));
+	TEST_VERIFY(m_context.resultCmpOneGt == resultGt);
+	TEST_VERIFY(m_context.resultSubEq == resultEq);
+	TEST_VERIFY(m_context.resultXorNe == resultNe);
+	TEST_VERIFY(m_context.resultAndEq == (((m_value0 & m_value1) == 0) ? 1 : 0));
+	TEST_VERIFY(m_context.resultAndNe == (((m_value0 & m_value1) != 0) ? 1 : 0));
 }
 
 void CConditionTest::MakeBeginIfCase(Jitter::CJitter& jitter, Jitter::CONDITION cond, size_t result)
@@ -76,6 +91,89 @@ void CConditionTest::MakeBeginIfCase(Jitter::CJitter& jitter, Jitter::CONDITION
 	jitter.EndIf();
 }
 
+void CConditionTest::MakeCmpBeginIfCase(Jitter::CJitter& jitter, Jitter::CONDITION cmpCond, uint32 testValue, Jitter::CONDITION testCond, size_t result)
+{
+	jitter.PushRel(offsetof(CONTEXT, value0));
+
+	if(m_useConstant)
+	{
+		jitter.PushCst(m_value1);
+	}
+	else
+	{
+		jitter.PushRel(offsetof(CONTEXT, value1));
+	}
+
+	jitter.Cmp(cmpCond);
+	jitter.PushCst(testValue);
+
+	//Store through a reference so the arms aren't turned into selects
+	jitter.BeginIf(testCond);
+	{
+		jitter.PushRelRef(offsetof(CONTEXT, self));
+		jitter.PushCst(result);
+		jitter.AddRef();
+		jitter.PushCst(1);
+		jitter.StoreAtRef();
+	}
+	jitter.Else();
+	{
+		jitter.PushRelRef(offsetof(CONTEXT, self));
+		jitter.PushCst(result);
+		jitter.AddRef();
+		jitter.PushCst(0);
+		jitter.StoreAtRef();
+	}
+	jitter.EndIf();
+}
+
+void CConditionTest::MakeAluBeginIfCase(Jitter::CJitter& jitter, ALU_OP aluOp, Jitter::CONDITION testCond, size_t result)
+{
+	jitter.PushRel(offsetof(CONTEXT, value0));
+
+	if(m_useConstant)
+	{
+		jitter.PushCst(m_value1);
+	}
+	else
+	{
+		jitter.PushRel(offsetof(CONTEXT, value1));
+	}
+
+	switch(aluOp)
+	{
+	case ALU_SUB:
+		jitter.Sub();
+		break;
+	case ALU_XOR:
+		jitter.Xor();
+		break;
+	case ALU_AND:
+		jitter.And();
+		break;
+	}
+	jitter.PushCst(0);
+
+	//Store through a reference so the arms aren't turned into selects
+	jitter.BeginIf(testCond);
+	{
+		jitter.PushRelRef(offsetof(CONTEXT, self));
+		jitter.PushCst(result);
+		jitter.AddRef();
+		jitter.PushCst(1);
+		jitter.StoreAtRef();
+	}
+	jitter.Else();
+	{
+		jitter.PushRelRef(offsetof(CONTEXT, self));
+		jitter.PushCst(result);
+		jitter.AddRef();
+		jitter.PushCst(0);
+		jitter.StoreAtRef();
+	}
+	jitter.EndIf();
+}
+
 void CConditionTest::Compile(Jitter::CJitter& jitter)
 {
 	Framework::CMemStream codeStream;
@@ -95,6 +193,18 @@ void CConditionTest::Compile(Jitter::CJitter& jitter)
 		MakeBeginIfCase(jitter, Jitter::CONDITION_LE, offsetof(CONTEXT, resultLe));
 		MakeBeginIfCase(jitter, Jitter::CONDITION_GT, offsetof(CONTEXT, resultGt));
 		MakeBeginIfCase(jitter, Jitter::CONDITION_GE, offsetof(CONTEXT, resultGe));
+
+		MakeCmpBeginIfCase(jitter, Jitter::CONDITION_EQ, 0, Jitter::CONDITION_NE, offsetof(CONTEXT, resultCmpEq));
+		MakeCmpBeginIfCase(jitter, Jitter::CONDITION_NE, 0, Jitter::CONDITION_NE, offsetof(CONTEXT, resultCmpNe));
+		MakeCmpBeginIfCase(jitter, Jitter::CONDITION_BL, 0, Jitter::CONDITION_NE, offsetof(CONTEXT, resultCmpBl));
+		MakeCmpBeginIfCase(jitter, Jitter::CONDITION_AE, 0, Jitter::CONDITION_NE, offsetof(CONTEXT, resultCmpAe));
+		MakeCmpBeginIfCase(jitter, Jitter::CONDITION_LT, 0, Jitter::CONDITION_EQ, offsetof(CONTEXT, resultCmpNotLt));
+		MakeCmpBeginIfCase(jitter, Jitter::CONDITION_GT, 1, Jitter::CONDITION_EQ, offsetof(CONTEXT, resultCmpOneGt));
+
+		MakeAluBeginIfCase(jitter, ALU_SUB, Jitter::CONDITION_EQ, offsetof(CONTEXT, resultSubEq));
+		MakeAluBeginIfCase(jitter, ALU_XOR, Jitter::CONDITION_NE, offsetof(CONTEXT, resultXorNe));
+		MakeAluBeginIfCase(jitter, ALU_AND, Jitter::CONDITION_EQ, offsetof(CONTEXT, resultAndEq));
+		MakeAluBeginIfCase(jitter, ALU_AND, Jitter::CONDITION_NE, offsetof(CONTEXT, resultAndNe));
 	}
 	jitter.End();
 
@@ -11,10 +11,22 @@ public:
 	void Compile(Jitter::CJitter&) override;
 
 private:
+	enum ALU_OP
+	{
+		ALU_SUB,
+		ALU_XOR,
+		ALU_AND,
+	};
+
 	void MakeBeginIfCase(Jitter::CJitter& jitter, Jitter::CONDITION, size_t result);
+	void MakeCmpBeginIfCase(Jitter::CJitter& jitter, Jitter::CONDITION, uint32, Jitter::CONDITION, size_t result);
+	void MakeAluBeginIfCase(Jitter::CJitter& jitter, ALU_OP, Jitter::CONDITION, size_t result);
 
 	struct CONTEXT
 	{
+		//Points back to this context, used to store results through a reference
+		void* self;
+
 		uint32 value0;
 		uint32 value1;
 
@@ -28,6 +40,18 @@ private:
 		uint32 resultAb;
 		uint32 resultGt;
 		uint32 resultGe;
+
+		//Branches on the result of a CMP or ALU op
+		uint32 resultCmpEq;
+		uint32 resultCmpNe;
+		uint32 resultCmpBl;
+		uint32 resultCmpAe;
+		uint32 resultCmpNotLt;
+		uint32 resultCmpOneGt;
+		uint32 resultSubEq;
+		uint32 resultXorNe;
+		uint32 resultAndEq;
+		uint32 resultAndNe;
 	};
 
 	bool m_useConstant = false;
@@ -0,0 +1,104 @@
+#include "FmaTest.h"
+#include "MemStream.h"
+
+void CFmaTest::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.SetFpContractionEnabled(true);
+
+	jitter.Begin();
+	{
+		//src0 * src1 + src2
+		jitter.FP_PushRel32(offsetof(CONTEXT, src0));
+		jitter.FP_PushRel32(offsetof(CONTEXT, src1));
+		jitter.FP_PushRel32(offsetof(CONTEXT, src2));
+		jitter.FP_MulAddS();
+		jitter.FP_PullRel32(offsetof(CONTEXT, resMulAdd));
+
+		//Contracted (src0 * src1) + src2
+		jitter.FP_PushRel32(offsetof(CONTEXT, src0));
+		jitter.FP_PushRel32(offsetof(CONTEXT, src1));
+		jitter.FP_MulS();
+		jitter.FP_PushRel32(offsetof(CONTEXT, src2));
+		jitter.FP_AddS();
+		jitter.FP_PullRel32(offsetof(CONTEXT, resContract));
+
+		//Contracted src2 + (src0 * src1)
+		jitter.FP_PushRel32(offsetof(CONTEXT, src2));
+		jitter.FP_PushRel32(offsetof(CONTEXT, src0));
+		jitter.FP_PushRel32(offsetof(CONTEXT, src1));
+		jitter.FP_MulS();
+		jitter.FP_AddS();
+		jitter.FP_PullRel32(offsetof(CONTEXT, resContractRev));
+
+		//Product is stored, can't be contracted
+		jitter.FP_PushRel32(offsetof(CONTEXT, src0));
+		jitter.FP_PushRel32(offsetof(CONTEXT, src1));
+		jitter.FP_MulS();
+		jitter.FP_PullRel32(offsetof(CONTEXT, resMul));
+
+		//MD src0 * src1 + src2
+		jitter.MD_PushRel(offsetof(CONTEXT, mdSrc0));
+		jitter.MD_PushRel(offsetof(CONTEXT, mdSrc1));
+		jitter.MD_PushRel(offsetof(CONTEXT, mdSrc2));
+		jitter.MD_MulAddS();
+		jitter.MD_PullRel(offsetof(CONTEXT, mdResMulAdd));
+
+		//MD contracted (src0 * src1) + src2
+		jitter.MD_PushRel(offsetof(CONTEXT, mdSrc0));
+		jitter.MD_PushRel(offsetof(CONTEXT, mdSrc1));
+		jitter.MD_MulS();
+		jitter.MD_PushRel(offsetof(CONTEXT, mdSrc2));
+		jitter.MD_AddS();
+		jitter.MD_PullRel(offsetof(CONTEXT, mdResContract));
+	}
+	jitter.End();
+
+	jitter.SetFpContractionEnabled(false);
+
+	m_function = FunctionType(codeStream.GetBuffer(), codeStream.GetSize());
+}
+
+void CFmaTest::Run()
+{
+	CONTEXT ALIGN16 context;
+	memset(&context, 0, sizeof(CONTEXT));
+
+	context.src0 = 1.5f;
+	context.src1 = 2.0f;
+	context.src2 = 0.25f;
+
+	context.mdSrc0[0] = 1.0f;
+	context.mdSrc0[1] = 2.0f;
+	context.mdSrc0[2] = 3.0f;
+	context.mdSrc0[3] = 4.0f;
+
+	context.mdSrc1[0] = 0.5f;
+	context.mdSrc1[1] = 1.5f;
+	context.mdSrc1[2] = -2.0f;
+	context.mdSrc1[3] = 8.0f;
+
+	context.mdSrc2[0] = 10.0f;
+	context.mdSrc2[1] = 20.0f;
+	context.mdSrc2[2] = 30.0f;
+	context.mdSrc2[3] = 40.0f;
+
+	m_function(&context);
+
+	TEST_VERIFY(context.resMulAdd == 3.25f);
+	TEST_VERIFY(context.resContract == 3.25f);
+	TEST_VERIFY(context.resContractRev == 3.25f);
+	TEST_VERIFY(context.resMul == 3.0f);
+
+	TEST_VERIFY(context.mdResMulAdd[0] == 10.5f);
+	TEST_VERIFY(context.mdResMulAdd[1] == 23.0f);
+	TEST_VERIFY(context.mdResMulAdd[2] == 24.0f);
+	TEST_VERIFY(context.mdResMulAdd[3] == 72.0f);
+
+	TEST_VERIFY(context.mdResContract[0] == 10.5f);
+	TEST_VERIFY(context.mdResContract[1] == 23.0f);
+	TEST_VERIFY(context.mdResContract[2] == 24.0f);
+	TEST_VERIFY(context.mdResContract[3] == 72.0f);
+}
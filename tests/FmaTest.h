@@ -0,0 +1,35 @@
+#pragma once
+
+#include "Test.h"
+#include "Align16.h"
+
+class CFmaTest : public CTest
+{
+public:
+	void Compile(Jitter::CJitter&) override;
+	void Run() override;
+
+private:
+	struct CONTEXT
+	{
+		ALIGN16
+
+		float mdSrc0[4];
+		float mdSrc1[4];
+		float mdSrc2[4];
+
+		float mdResMulAdd[4];
+		float mdResContract[4];
+
+		float src0;
+		float src1;
+		float src2;
+
+		float resMulAdd;
+		float resContract;
+		float resContractRev;
+		float resMul;
+	};
+
+	FunctionType m_function;
+};
@@ -0,0 +1,150 @@
+#include "FpDoubleTest.h"
+#include "MemStream.h"
+
+void CFpDoubleTest::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		jitter.FP_PushRel64(offsetof(CONTEXT, number1));
+		jitter.FP_PushRel64(offsetof(CONTEXT, number2));
+		jitter.FP_AddD();
+		jitter.FP_PullRel64(offsetof(CONTEXT, resAdd));
+
+		jitter.FP_PushRel64(offsetof(CONTEXT, number2));
+		jitter.FP_PushRel64(offsetof(CONTEXT, number4));
+		jitter.FP_SubD();
+		jitter.FP_PullRel64(offsetof(CONTEXT, resSub));
+
+		jitter.FP_PushRel64(offsetof(CONTEXT, number2));
+		jitter.FP_PushRel64(offsetof(CONTEXT, number2));
+		jitter.FP_MulD();
+		jitter.FP_PullRel64(offsetof(CONTEXT, resMul));
+
+		jitter.FP_PushRel64(offsetof(CONTEXT, number1));
+		jitter.FP_PushRel64(offsetof(CONTEXT, number2));
+		jitter.FP_DivD();
+		jitter.FP_PullRel64(offsetof(CONTEXT, resDiv));
+
+		jitter.FP_PushRel64(offsetof(CONTEXT, number3));
+		jitter.FP_AbsD();
+		jitter.FP_PullRel64(offsetof(CONTEXT, resAbs));
+
+		jitter.FP_PushRel64(offsetof(CONTEXT, number3));
+		jitter.FP_NegD();
+		jitter.FP_PullRel64(offsetof(CONTEXT, resNeg));
+
+		jitter.FP_PushRel64(offsetof(CONTEXT, number4));
+		jitter.FP_SqrtD();
+		jitter.FP_PullRel64(offsetof(CONTEXT, resSqrt));
+
+		jitter.FP_PushRel64(offsetof(CONTEXT, number1));
+		jitter.FP_PushRel64(offsetof(CONTEXT, number3));
+		jitter.FP_MaxD();
+		jitter.FP_PullRel64(offsetof(CONTEXT, resMax));
+
+		jitter.FP_PushRel64(offsetof(CONTEXT, number1));
+		jitter.FP_PushRel64(offsetof(CONTEXT, number3));
+		jitter.FP_MinD();
+		jitter.FP_PullRel64(offsetof(CONTEXT, resMin));
+
+		jitter.FP_PushCst64(0.125);
+		jitter.FP_PushRel64(offsetof(CONTEXT, number2));
+		jitter.FP_MulD();
+		jitter.FP_PullRel64(offsetof(CONTEXT, resCst));
+
+		//((number1 + number2) * number3 - number4) / number2
+		jitter.FP_PushRel64(offsetof(CONTEXT, number1));
+		jitter.FP_PushRel64(offsetof(CONTEXT, number2));
+		jitter.FP_AddD();
+		jitter.FP_PushRel64(offsetof(CONTEXT, number3));
+		jitter.FP_MulD();
+		jitter.FP_PushRel64(offsetof(CONTEXT, number4));
+		jitter.FP_SubD();
+		jitter.FP_PushRel64(offsetof(CONTEXT, number2));
+		jitter.FP_DivD();
+		jitter.FP_PullRel64(offsetof(CONTEXT, resChain));
+
+		jitter.FP_PushRel32(offsetof(CONTEXT, single));
+		jitter.FP_ToDoubleS();
+		jitter.FP_PullRel64(offsetof(CONTEXT, resFromSingle));
+
+		jitter.FP_PushRel64(offsetof(CONTEXT, number3));
+		jitter.FP_ToSingleD();
+		jitter.FP_PullRel32(offsetof(CONTEXT, resToSingle));
+
+		jitter.FP_PushRel32(offsetof(CONTEXT, int32Value));
+		jitter.FP_ToDoubleI32();
+		jitter.FP_PullRel64(offsetof(CONTEXT, resFromInt32));
+
+		jitter.FP_PushRel64(offsetof(CONTEXT, number3));
+		jitter.FP_PushCst64(-0.75);
+		jitter.FP_AddD();
+		jitter.FP_ToInt32TruncateD();
+		jitter.FP_PullRel32(offsetof(CONTEXT, resToInt32));
+
+		jitter.FP_PushRel64(offsetof(CONTEXT, int64Value));
+		jitter.FP_ToDoubleI64();
+		jitter.FP_PullRel64(offsetof(CONTEXT, resFromInt64));
+
+		jitter.FP_PushRel64(offsetof(CONTEXT, number4));
+		jitter.FP_PushCst64(4294967296.0);
+		jitter.FP_MulD();
+		jitter.FP_NegD();
+		jitter.FP_ToInt64TruncateD();
+		jitter.FP_PullRel64(offsetof(CONTEXT, resToInt64));
+
+		jitter.FP_PushRel64(offsetof(CONTEXT, number1));
+		jitter.FP_PushRel64(offsetof(CONTEXT, number3));
+		jitter.FP_CmpD(Jitter::CONDITION_BL);
+		jitter.PullRel(offsetof(CONTEXT, ltTest));
+
+		jitter.FP_PushRel64(offsetof(CONTEXT, number3));
+		jitter.FP_PushRel64(offsetof(CONTEXT, number1));
+		jitter.FP_CmpD(Jitter::CONDITION_BE);
+		jitter.PullRel(offsetof(CONTEXT, leTest));
+
+		jitter.FP_PushRel64(offsetof(CONTEXT, number1));
+		jitter.FP_PushRel64(offsetof(CONTEXT, number1));
+		jitter.FP_CmpD(Jitter::CONDITION_EQ);
+		jitter.PullRel(offsetof(CONTEXT, eqTest));
+	}
+	jitter.End();
+
+	m_function = FunctionType(codeStream.GetBuffer(), codeStream.GetSize());
+}
+
+void CFpDoubleTest::Run()
+{
+	memset(&m_context, 0, sizeof(CONTEXT));
+	m_context.number1 = 1.0;
+	m_context.number2 = 2.0;
+	m_context.number3 = -4.5;
+	m_context.number4 = 16.0;
+	m_context.single = 0.1f;
+	m_context.int32Value = -123456789;
+	m_context.int64Value = INT64_C(-0x123456789AB);
+	m_function(&m_context);
+	TEST_VERIFY(m_context.resAdd == 3.0);
+	TEST_VERIFY(m_context.resSub == -14.0);
+	TEST_VERIFY(m_context.resMul == 4.0);
+	TEST_VERIFY(m_context.resDiv == 0.5);
+	TEST_VERIFY(m_context.resAbs == 4.5);
+	TEST_VERIFY(m_context.resNeg == 4.5);
+	TEST_VERIFY(m_context.resSqrt == 4.0);
+	TEST_VERIFY(m_context.resMax == 1.0);
+	TEST_VERIFY(m_context.resMin == -4.5);
+	TEST_VERIFY(m_context.resCst == 0.25);
+	TEST_VERIFY(m_context.resChain == -14.75);
+	TEST_VERIFY(m_context.resFromSingle == static_cast<double>(0.1f));
+	TEST_VERIFY(m_context.resToSingle == -4.5f);
+	TEST_VERIFY(m_context.resFromInt32 == -123456789.0);
+	TEST_VERIFY(m_context.resToInt32 == -5);
+	TEST_VERIFY(m_context.resFromInt64 == static_cast<double>(INT64_C(-0x123456789AB)));
+	TEST_VERIFY(m_context.resToInt64 == INT64_C(-0x1000000000));
+	TEST_VERIFY(m_context.ltTest == 0);
+	TEST_VERIFY(m_context.leTest != 0);
+	TEST_VERIFY(m_context.eqTest != 0);
+}
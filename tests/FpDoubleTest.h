@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Test.h"
+
+class CFpDoubleTest : public CTest
+{
+public:
+	void Compile(Jitter::CJitter&) override;
+	void Run() override;
+
+private:
+	struct CONTEXT
+	{
+		double number1;
+		double number2;
+		double number3;
+		double number4;
+
+		double resAdd;
+		double resSub;
+		double resMul;
+		double resDiv;
+		double resAbs;
+		double resNeg;
+		double resSqrt;
+		double resMax;
+		double resMin;
+		double resCst;
+		double resChain;
+
+		double resFromSingle;
+		double resFromInt32;
+		double resFromInt64;
+		int64 resToInt64;
+		int64 int64Value;
+
+		float single;
+		float resToSingle;
+		int32 int32Value;
+		int32 resToInt32;
+
+		uint32 ltTest;
+		uint32 leTest;
+		uint32 eqTest;
+		uint32 padding;
+	};
+
+	CONTEXT m_context;
+	FunctionType m_function;
+};
@@ -0,0 +1,200 @@
+#include "IfConversionTest.h"
+#include <algorithm>
+#include "MemStream.h"
+
+#define CLAMP_LIMIT (0x100)
+#define COUNTER_INIT (0x10)
+
+CIfConversionTest::CIfConversionTest(uint32 value0, uint32 value1)
+    : m_value0(value0)
+    , m_value1(value1)
+{
+}
+
+void CIfConversionTest::Run()
+{
+	memset(&m_context, 0, sizeof(m_context));
+
+	m_context.value0 = m_value0;
+	m_context.value1 = m_value1;
+	m_context.counter = COUNTER_INIT;
+
+	m_function(&m_context);
+
+	int32 signedValue0 = static_cast<int32>(m_value0);
+	int32 signedValue1 = static_cast<int32>(m_value1);
+
+	uint32 minValue = std::min(m_value0, m_value1);
+	uint32 maxValue = std::max(m_value0, m_value1);
+	uint32 clampedValue = std::min<uint32>(m_value0, CLAMP_LIMIT);
+
+	uint32 diamondResult0 = 0;
+	uint32 diamondResult1 = 0;
+	if(signedValue0 < signedValue1)
+	{
+		diamondResult0 = m_value1 - m_value0;
+		diamondResult0 = diamondResult0 << 1;
+	}
+	else
+	{
+		diamondResult0 = m_value0 ^ m_value1;
+		diamondResult1 = ~m_value0;
+	}
+
+	uint32 nestedResult = 0;
+	if(m_value0 != 0)
+	{
+		nestedResult = (m_value1 >= m_value0) ? 2 : 1;
+	}
+
+	uint32 longArmResult = m_value0;
+	if(m_value0 > m_value1)
+	{
+		longArmResult = ((((longArmResult + 1) << 2) ^ m_value1) >> 1) - 3;
+	}
+
+	TEST_VERIFY(m_context.minValue == minValue);
+	TEST_VERIFY(m_context.maxValue == maxValue);
+	TEST_VERIFY(m_context.clampedValue == clampedValue);
+	TEST_VERIFY(m_context.diamondResult0 == diamondResult0);
+	TEST_VERIFY(m_context.diamondResult1 == diamondResult1);
+	TEST_VERIFY(m_context.nestedResult == nestedResult);
+	TEST_VERIFY(m_context.longArmResult == longArmResult);
+	TEST_VERIFY(m_context.maskedResult == (((m_value0 & m_value1) != 0) ? m_value1 : 0));
+	TEST_VERIFY(m_context.counter == COUNTER_INIT - 1);
+}
+
+void CIfConversionTest::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		//Triangle assigning two relatives
+		jitter.PushRel(offsetof(CONTEXT, value0));
+		jitter.PullRel(offsetof(CONTEXT, minValue));
+		jitter.PushRel(offsetof(CONTEXT, value1));
+		jitter.PullRel(offsetof(CONTEXT, maxValue));
+
+		jitter.PushRel(offsetof(CONTEXT, value1));
+		jitter.PushRel(offsetof(CONTEXT, value0));
+		jitter.BeginIf(Jitter::CONDITION_BL);
+		{
+			jitter.PushRel(offsetof(CONTEXT, value1));
+			jitter.PullRel(offsetof(CONTEXT, minValue));
+			jitter.PushRel(offsetof(CONTEXT, value0));
+			jitter.PullRel(offsetof(CONTEXT, maxValue));
+		}
+		jitter.EndIf();
+
+		//Triangle against a constant
+		jitter.PushRel(offsetof(CONTEXT, value0));
+		jitter.PullRel(offsetof(CONTEXT, clampedValue));
+
+		jitter.PushRel(offsetof(CONTEXT, value0));
+		jitter.PushCst(CLAMP_LIMIT);
+		jitter.BeginIf(Jitter::CONDITION_AB);
+		{
+			jitter.PushCst(CLAMP_LIMIT);
+			jitter.PullRel(offsetof(CONTEXT, clampedValue));
+		}
+		jitter.EndIf();
+
+		//Diamond where one side reads back a value it has written
+		jitter.PushRel(offsetof(CONTEXT, value0));
+		jitter.PushRel(offsetof(CONTEXT, value1));
+		jitter.BeginIf(Jitter::CONDITION_LT);
+		{
+			jitter.PushRel(offsetof(CONTEXT, value1));
+			jitter.PushRel(offsetof(CONTEXT, value0));
+			jitter.Sub();
+			jitter.PullRel(offsetof(CONTEXT, diamondResult0));
+
+			jitter.PushRel(offsetof(CONTEXT, diamondResult0));
+			jitter.Shl(1);
+			jitter.PullRel(offsetof(CONTEXT, diamondResult0));
+		}
+		jitter.Else();
+		{
+			jitter.PushRel(offsetof(CONTEXT, value0));
+			jitter.PushRel(offsetof(CONTEXT, value1));
+			jitter.Xor();
+			jitter.PullRel(offsetof(CONTEXT, diamondResult0));
+
+			jitter.PushRel(offsetof(CONTEXT, value0));
+			jitter.Not();
+			jitter.PullRel(offsetof(CONTEXT, diamondResult1));
+		}
+		jitter.EndIf();
+
+		//Nested conditions, only the inner one can be converted
+		jitter.PushRel(offsetof(CONTEXT, value0));
+		jitter.PushCst(0);
+		jitter.BeginIf(Jitter::CONDITION_NE);
+		{
+			jitter.PushRel(offsetof(CONTEXT, value1));
+			jitter.PushRel(offsetof(CONTEXT, value0));
+			jitter.BeginIf(Jitter::CONDITION_AE);
+			{
+				jitter.PushCst(2);
+				jitter.PullRel(offsetof(CONTEXT, nestedResult));
+			}
+			jitter.Else();
+			{
+				jitter.PushCst(1);
+				jitter.PullRel(offsetof(CONTEXT, nestedResult));
+			}
+			jitter.EndIf();
+		}
+		jitter.EndIf();
+
+		//Too long to be converted
+		jitter.PushRel(offsetof(CONTEXT, value0));
+		jitter.PullRel(offsetof(CONTEXT, longArmResult));
+
+		jitter.PushRel(offsetof(CONTEXT, value0));
+		jitter.PushRel(offsetof(CONTEXT, value1));
+		jitter.BeginIf(Jitter::CONDITION_AB);
+		{
+			jitter.PushRel(offsetof(CONTEXT, longArmResult));
+			jitter.PushCst(1);
+			jitter.Add();
+			jitter.Shl(2);
+			jitter.PushRel(offsetof(CONTEXT, value1));
+			jitter.Xor();
+			jitter.Srl(1);
+			jitter.PushCst(3);
+			jitter.Sub();
+			jitter.PullRel(offsetof(CONTEXT, longArmResult));
+		}
+		jitter.EndIf();
+
+		//Condition on the AND of both values, branches on a bit test
+		jitter.PushRel(offsetof(CONTEXT, value0));
+		jitter.PushRel(offsetof(CONTEXT, value1));
+		jitter.And();
+		jitter.PushCst(0);
+		jitter.BeginIf(Jitter::CONDITION_NE);
+		{
+			jitter.PushRel(offsetof(CONTEXT, value1));
+			jitter.PullRel(offsetof(CONTEXT, maskedResult));
+		}
+		jitter.EndIf();
+
+		//Condition operand modified by the converted block
+		jitter.PushRel(offsetof(CONTEXT, counter));
+		jitter.PushCst(0);
+		jitter.BeginIf(Jitter::CONDITION_NE);
+		{
+			jitter.PushRel(offsetof(CONTEXT, counter));
+			jitter.PushCst(1);
+			jitter.Sub();
+			jitter.PullRel(offsetof(CONTEXT, counter));
+		}
+		jitter.EndIf();
+	}
+	jitter.End();
+
+	m_function = FunctionType(codeStream.GetBuffer(), codeStream.GetSize());
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Test.h"
+
+class CIfConversionTest : public CTest
+{
+public:
+	CIfConversionTest(uint32, uint32);
+
+	void Run() override;
+	void Compile(Jitter::CJitter&) override;
+
+private:
+	struct CONTEXT
+	{
+		uint32 value0;
+		uint32 value1;
+
+		uint32 minValue;
+		uint32 maxValue;
+		uint32 clampedValue;
+		uint32 diamondResult0;
+		uint32 diamondResult1;
+		uint32 nestedResult;
+		uint32 longArmResult;
+		uint32 maskedResult;
+		uint32 counter;
+	};
+
+	uint32 m_value0 = 0;
+	uint32 m_value1 = 0;
+	CONTEXT m_context;
+	FunctionType m_function;
+};
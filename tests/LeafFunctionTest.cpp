@@ -0,0 +1,89 @@
+#include "LeafFunctionTest.h"
+#include "MemStream.h"
+
+#define TEST_NUMBER1 (0xDEADDEAD)
+#define TEST_NUMBER2 (0xCAFECAFE)
+#define CALL_COUNT (4)
+
+static uint32 GetTempKey(unsigned int index)
+{
+	return 0x01010101 * (index + 1);
+}
+
+void CLeafFunctionTest::Compile(Jitter::CJitter& jitter)
+{
+	//No calls, no temporaries and no literals: the prolog and epilog should not need to touch the stack
+	{
+		Framework::CMemStream codeStream;
+		jitter.SetStream(&codeStream);
+
+		jitter.Begin();
+		{
+			jitter.PushRel(offsetof(CONTEXT, value0));
+			jitter.PushRel(offsetof(CONTEXT, value1));
+			jitter.Add();
+			jitter.PullRel(offsetof(CONTEXT, sumResult));
+
+			jitter.PushRel(offsetof(CONTEXT, value0));
+			jitter.PushRel(offsetof(CONTEXT, value1));
+			jitter.Xor();
+			jitter.PullRel(offsetof(CONTEXT, xorResult));
+		}
+		jitter.End();
+
+		m_noStackFunction = FunctionType(codeStream.GetBuffer(), codeStream.GetSize());
+	}
+
+	//No calls, but more live temporaries than there are registers: some will need a small stack frame
+	{
+		Framework::CMemStream codeStream;
+		jitter.SetStream(&codeStream);
+
+		jitter.Begin();
+		{
+			for(unsigned int i = 0; i < TEMP_COUNT; i++)
+			{
+				jitter.PushRel(offsetof(CONTEXT, values[0]) + (i * sizeof(uint32)));
+				jitter.PushCst(GetTempKey(i));
+				jitter.Xor();
+			}
+
+			for(unsigned int i = 1; i < TEMP_COUNT; i++)
+			{
+				jitter.Add();
+			}
+
+			jitter.PullRel(offsetof(CONTEXT, tempSumResult));
+		}
+		jitter.End();
+
+		m_smallStackFunction = FunctionType(codeStream.GetBuffer(), codeStream.GetSize());
+	}
+}
+
+void CLeafFunctionTest::Run()
+{
+	uint32 tempSum = 0;
+	for(unsigned int i = 0; i < TEMP_COUNT; i++)
+	{
+		m_context.values[i] = TEST_NUMBER1 + (i * TEST_NUMBER2);
+		tempSum += m_context.values[i] ^ GetTempKey(i);
+	}
+
+	m_context.value0 = TEST_NUMBER1;
+	m_context.value1 = TEST_NUMBER2;
+
+	//Call repeatedly to catch an unbalanced prolog/epilog pair
+	for(unsigned int i = 0; i < CALL_COUNT; i++)
+	{
+		m_context.sumResult = 0;
+		m_context.xorResult = 0;
+		m_noStackFunction(&m_context);
+		TEST_VERIFY(m_context.sumResult == (TEST_NUMBER1 + TEST_NUMBER2));
+		TEST_VERIFY(m_context.xorResult == (TEST_NUMBER1 ^ TEST_NUMBER2));
+
+		m_context.tempSumResult = 0;
+		m_smallStackFunction(&m_context);
+		TEST_VERIFY(m_context.tempSumResult == tempSum);
+	}
+}
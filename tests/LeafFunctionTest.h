@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Test.h"
+
+class CLeafFunctionTest : public CTest
+{
+public:
+	void Compile(Jitter::CJitter&) override;
+	void Run() override;
+
+private:
+	enum
+	{
+		TEMP_COUNT = 20,
+	};
+
+	struct CONTEXT
+	{
+		uint32 value0 = 0;
+		uint32 value1 = 0;
+		uint32 sumResult = 0;
+		uint32 xorResult = 0;
+		uint32 values[TEMP_COUNT] = {};
+		uint32 tempSumResult = 0;
+	};
+
+	CONTEXT m_context;
+	FunctionType m_noStackFunction;
+	FunctionType m_smallStackFunction;
+};
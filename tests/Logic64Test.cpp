@@ -3,6 +3,7 @@
 
 #define CONSTANT_1 (0xEEEEEEEE55555555ULL)
 #define CONSTANT_2 (0x22222222CCCCCCCCULL)
+#define CONSTANT_3 (0x0F0F0F0F00FF00FFULL)
 
 void CLogic64Test::Run()
 {
@@ -16,6 +17,11 @@ void CLogic64Test::Run()
 	TEST_VERIFY(m_context.resultAnd == (CONSTANT_1 & CONSTANT_2));
 	TEST_VERIFY(m_context.resultAndZero1 == 0);
 	TEST_VERIFY(m_context.resultAndZero2 == 0);
+	TEST_VERIFY(m_context.resultOr == (CONSTANT_1 | CONSTANT_2));
+	TEST_VERIFY(m_context.resultOrCst == (CONSTANT_1 | CONSTANT_3));
+	TEST_VERIFY(m_context.resultXor == (CONSTANT_1 ^ CONSTANT_2));
+	TEST_VERIFY(m_context.resultXorCst == (CONSTANT_3 ^ CONSTANT_2));
+	TEST_VERIFY(m_context.resultNot == ~CONSTANT_1);
 }
 
 void CLogic64Test::Compile(Jitter::CJitter& jitter)
@@ -39,6 +45,30 @@ void CLogic64Test::Compile(Jitter::CJitter& jitter)
 		jitter.PushRel64(offsetof(CONTEXT, op2));
 		jitter.And64();
 		jitter.PullRel64(offsetof(CONTEXT, resultAndZero2));
+
+		jitter.PushRel64(offsetof(CONTEXT, op1));
+		jitter.PushRel64(offsetof(CONTEXT, op2));
+		jitter.Or64();
+		jitter.PullRel64(offsetof(CONTEXT, resultOr));
+
+		jitter.PushRel64(offsetof(CONTEXT, op1));
+		jitter.PushCst64(CONSTANT_3);
+		jitter.Or64();
+		jitter.PullRel64(offsetof(CONTEXT, resultOrCst));
+
+		jitter.PushRel64(offsetof(CONTEXT, op1));
+		jitter.PushRel64(offsetof(CONTEXT, op2));
+		jitter.Xor64();
+		jitter.PullRel64(offsetof(CONTEXT, resultXor));
+
+		jitter.PushCst64(CONSTANT_3);
+		jitter.PushRel64(offsetof(CONTEXT, op2));
+		jitter.Xor64();
+		jitter.PullRel64(offsetof(CONTEXT, resultXorCst));
+
+		jitter.PushRel64(offsetof(CONTEXT, op1));
+		jitter.Not64();
+		jitter.PullRel64(offsetof(CONTEXT, resultNot));
 	}
 	jitter.End();
 
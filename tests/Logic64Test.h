@@ -17,6 +17,11 @@ private:
 		uint64 resultAnd;
 		uint64 resultAndZero1;
 		uint64 resultAndZero2;
+		uint64 resultOr;
+		uint64 resultOrCst;
+		uint64 resultXor;
+		uint64 resultXorCst;
+		uint64 resultNot;
 	};
 
 	CONTEXT m_context;
@@ -0,0 +1,109 @@
+#include "LookupTest.h"
+#include "MemStream.h"
+
+#define INDEX0 (0x12)
+#define INDEX1 (0x3F7)
+#define CST_INDEX (0xA5)
+#define CRC_INPUT (0x61626364)
+
+uint32 CLookupTest::m_table[TABLE_SIZE];
+
+void CLookupTest::BuildTable()
+{
+	uint32 polynomial = 0xEDB88320;
+
+	for(uint32 i = 0; i < TABLE_SIZE; i++)
+	{
+		uint32 crc = i;
+		for(unsigned int j = 0; j < 8; j++)
+		{
+			crc = (crc & 1) ? ((crc >> 1) ^ polynomial) : (crc >> 1);
+		}
+		m_table[i] = crc;
+	}
+}
+
+void CLookupTest::Run()
+{
+	memset(&m_context, 0, sizeof(m_context));
+	m_context.index0 = INDEX0;
+	m_context.index1 = INDEX1;
+	m_context.crcInput = CRC_INPUT;
+
+	m_function(&m_context);
+
+	uint32 crc = ~0U;
+	for(unsigned int i = 0; i < 4; i++)
+	{
+		uint8 inputByte = static_cast<uint8>(CRC_INPUT >> (i * 8));
+		crc = (crc >> 8) ^ m_table[(crc ^ inputByte) & 0xFF];
+	}
+
+	TEST_VERIFY(m_context.result0 == m_table[INDEX0]);
+	TEST_VERIFY(m_context.result1 == m_table[INDEX1 & 0xFF]);
+	TEST_VERIFY(m_context.resultCst == m_table[CST_INDEX]);
+	TEST_VERIFY(m_context.resultSum == (m_table[INDEX0] + m_table[INDEX1 & 0xFF]));
+	TEST_VERIFY(m_context.resultCrc == ~crc);
+}
+
+void CLookupTest::Compile(Jitter::CJitter& jitter)
+{
+	BuildTable();
+
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		jitter.PushRel(offsetof(CONTEXT, index0));
+		jitter.Lookup(m_table);
+		jitter.PullRel(offsetof(CONTEXT, result0));
+
+		jitter.PushRel(offsetof(CONTEXT, index1));
+		jitter.PushCst(0xFF);
+		jitter.And();
+		jitter.Lookup(m_table);
+		jitter.PullRel(offsetof(CONTEXT, result1));
+
+		jitter.PushCst(CST_INDEX);
+		jitter.Lookup(m_table);
+		jitter.PullRel(offsetof(CONTEXT, resultCst));
+
+		jitter.PushRel(offsetof(CONTEXT, index0));
+		jitter.Lookup(m_table);
+		jitter.PushRel(offsetof(CONTEXT, index1));
+		jitter.PushCst(0xFF);
+		jitter.And();
+		jitter.Lookup(m_table);
+		jitter.Add();
+		jitter.PullRel(offsetof(CONTEXT, resultSum));
+
+		//crc = (crc >> 8) ^ table[(crc ^ byte) & 0xFF] for each byte of input
+		jitter.PushCst(~0U);
+		jitter.PullRel(offsetof(CONTEXT, resultCrc));
+
+		for(unsigned int i = 0; i < 4; i++)
+		{
+			jitter.PushRel(offsetof(CONTEXT, resultCrc));
+			jitter.Srl(8);
+
+			jitter.PushRel(offsetof(CONTEXT, resultCrc));
+			jitter.PushRel(offsetof(CONTEXT, crcInput));
+			jitter.Srl(i * 8);
+			jitter.Xor();
+			jitter.PushCst(0xFF);
+			jitter.And();
+			jitter.Lookup(m_table);
+
+			jitter.Xor();
+			jitter.PullRel(offsetof(CONTEXT, resultCrc));
+		}
+
+		jitter.PushRel(offsetof(CONTEXT, resultCrc));
+		jitter.Not();
+		jitter.PullRel(offsetof(CONTEXT, resultCrc));
+	}
+	jitter.End();
+
+	m_function = FunctionType(codeStream.GetBuffer(), codeStream.GetSize());
+}
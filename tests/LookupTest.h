@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Test.h"
+
+class CLookupTest : public CTest
+{
+public:
+	void Run() override;
+	void Compile(Jitter::CJitter&) override;
+
+private:
+	struct CONTEXT
+	{
+		uint32 index0;
+		uint32 index1;
+		uint32 crcInput;
+
+		uint32 result0;
+		uint32 result1;
+		uint32 resultCst;
+		uint32 resultSum;
+		uint32 resultCrc;
+	};
+
+	enum
+	{
+		TABLE_SIZE = 0x100,
+	};
+
+	static void BuildTable();
+
+	static uint32 m_table[TABLE_SIZE];
+
+	CONTEXT m_context;
+	FunctionType m_function;
+};
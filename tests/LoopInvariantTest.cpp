@@ -0,0 +1,160 @@
+#include "LoopInvariantTest.h"
+#include "MemStream.h"
+
+#define ITERATION_COUNT (6)
+#define INNER_ITERATION_COUNT (3)
+#define BASE_VALUE (0x1234)
+#define SCALE_VALUE (5)
+#define STEP_VALUE (3)
+#define VECTOR_ADD (0x01020304)
+#define MEMORY_INDEX (7)
+
+void CLoopInvariantTest::Run()
+{
+	memset(&m_context, 0, sizeof(m_context));
+
+	for(unsigned int i = 0; i < MEMORY_SIZE; i++)
+	{
+		m_memory[i] = 0x100 + i;
+	}
+
+	m_context.memory = m_memory;
+	m_context.counter = ITERATION_COUNT;
+	m_context.base = BASE_VALUE;
+	m_context.scale = SCALE_VALUE;
+	m_context.step = STEP_VALUE;
+
+	m_function(&m_context);
+
+	uint32 invariantValue = ((BASE_VALUE + SCALE_VALUE) << 2) ^ 0xFF;
+	uint32 stepTotal = 0;
+	uint32 step = STEP_VALUE;
+	for(unsigned int i = 0; i < ITERATION_COUNT; i++)
+	{
+		step++;
+		stepTotal += step * 2;
+	}
+
+	TEST_VERIFY(m_context.counter == 0);
+	TEST_VERIFY(m_context.total == (invariantValue * ITERATION_COUNT));
+	TEST_VERIFY(m_context.memoryTotal == (m_memory[MEMORY_INDEX] * ITERATION_COUNT));
+	TEST_VERIFY(m_context.step == (STEP_VALUE + ITERATION_COUNT));
+	TEST_VERIFY(m_context.stepTotal == stepTotal);
+	TEST_VERIFY(m_context.innerTotal == (invariantValue * ITERATION_COUNT * INNER_ITERATION_COUNT));
+	TEST_VERIFY(m_context.evenCount == (ITERATION_COUNT / 2));
+	for(unsigned int i = 0; i < 4; i++)
+	{
+		TEST_VERIFY(m_context.vectorTotal[i] == (VECTOR_ADD * ITERATION_COUNT));
+	}
+}
+
+void CLoopInvariantTest::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		auto loopLabel = jitter.CreateLabel();
+		auto innerLoopLabel = jitter.CreateLabel();
+
+		jitter.MarkLabel(loopLabel);
+
+		//Invariant arithmetic on values that are not modified in the loop
+		jitter.PushRel(offsetof(CONTEXT, total));
+		jitter.PushRel(offsetof(CONTEXT, base));
+		jitter.PushRel(offsetof(CONTEXT, scale));
+		jitter.Add();
+		jitter.Shl(2);
+		jitter.PushCst(0xFF);
+		jitter.Xor();
+		jitter.Add();
+		jitter.PullRel(offsetof(CONTEXT, total));
+
+		//Invariant address computation
+		jitter.PushRel(offsetof(CONTEXT, memoryTotal));
+		jitter.PushRelRef(offsetof(CONTEXT, memory));
+		jitter.PushCst(MEMORY_INDEX * sizeof(uint32));
+		jitter.AddRef();
+		jitter.LoadFromRef();
+		jitter.Add();
+		jitter.PullRel(offsetof(CONTEXT, memoryTotal));
+
+		//Invariant vector constant
+		jitter.MD_PushRel(offsetof(CONTEXT, vectorTotal));
+		jitter.MD_PushCstExpandW(VECTOR_ADD);
+		jitter.MD_AddW();
+		jitter.MD_PullRel(offsetof(CONTEXT, vectorTotal));
+
+		//Value modified inside the loop, computations using it can't be moved
+		jitter.PushRel(offsetof(CONTEXT, step));
+		jitter.PushCst(1);
+		jitter.Add();
+		jitter.PullRel(offsetof(CONTEXT, step));
+
+		jitter.PushRel(offsetof(CONTEXT, stepTotal));
+		jitter.PushRel(offsetof(CONTEXT, step));
+		jitter.Shl(1);
+		jitter.Add();
+		jitter.PullRel(offsetof(CONTEXT, stepTotal));
+
+		//Conditional block inside the loop
+		jitter.PushRel(offsetof(CONTEXT, counter));
+		jitter.PushCst(1);
+		jitter.And();
+		jitter.PushCst(0);
+		jitter.BeginIf(Jitter::CONDITION_EQ);
+		{
+			jitter.PushRel(offsetof(CONTEXT, evenCount));
+			jitter.PushCst(1);
+			jitter.Add();
+			jitter.PullRel(offsetof(CONTEXT, evenCount));
+		}
+		jitter.EndIf();
+
+		//Inner loop using the same invariant computation
+		jitter.PushCst(INNER_ITERATION_COUNT);
+		jitter.PullRel(offsetof(CONTEXT, innerCounter));
+
+		jitter.MarkLabel(innerLoopLabel);
+
+		jitter.PushRel(offsetof(CONTEXT, innerTotal));
+		jitter.PushRel(offsetof(CONTEXT, base));
+		jitter.PushRel(offsetof(CONTEXT, scale));
+		jitter.Add();
+		jitter.Shl(2);
+		jitter.PushCst(0xFF);
+		jitter.Xor();
+		jitter.Add();
+		jitter.PullRel(offsetof(CONTEXT, innerTotal));
+
+		jitter.PushRel(offsetof(CONTEXT, innerCounter));
+		jitter.PushCst(1);
+		jitter.Sub();
+		jitter.PullRel(offsetof(CONTEXT, innerCounter));
+
+		jitter.PushRel(offsetof(CONTEXT, innerCounter));
+		jitter.PushCst(0);
+		jitter.BeginIf(Jitter::CONDITION_NE);
+		{
+			jitter.Goto(innerLoopLabel);
+		}
+		jitter.EndIf();
+
+		jitter.PushRel(offsetof(CONTEXT, counter));
+		jitter.PushCst(1);
+		jitter.Sub();
+		jitter.PullRel(offsetof(CONTEXT, counter));
+
+		jitter.PushRel(offsetof(CONTEXT, counter));
+		jitter.PushCst(0);
+		jitter.BeginIf(Jitter::CONDITION_NE);
+		{
+			jitter.Goto(loopLabel);
+		}
+		jitter.EndIf();
+	}
+	jitter.End();
+
+	m_function = FunctionType(codeStream.GetBuffer(), codeStream.GetSize());
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Test.h"
+#include "Align16.h"
+
+class CLoopInvariantTest : public CTest
+{
+public:
+	void Run() override;
+	void Compile(Jitter::CJitter&) override;
+
+private:
+	struct CONTEXT
+	{
+		ALIGN16
+
+		uint32 vectorTotal[4];
+
+		void* memory;
+		uint32 counter;
+		uint32 innerCounter;
+		uint32 base;
+		uint32 scale;
+		uint32 step;
+
+		uint32 total;
+		uint32 memoryTotal;
+		uint32 stepTotal;
+		uint32 innerTotal;
+		uint32 evenCount;
+	};
+
+	enum
+	{
+		MEMORY_SIZE = 0x10,
+	};
+
+	CONTEXT m_context;
+	uint32 m_memory[MEMORY_SIZE];
+	FunctionType m_function;
+};
@@ -1,22 +1,29 @@
 #include "Jitter_CodeGenFactory.h"
 
 #include "Crc32Test.h"
+#include "LookupTest.h"
 #include "CursorTest.h"
 #include "MultTest.h"
 #include "DivTest.h"
+#include "StrengthReductionTest.h"
+#include "AlgebraicSimplificationTest.h"
 #include "RandomAluTest.h"
 #include "RandomAluTest2.h"
 #include "RandomAluTest3.h"
 #include "ShiftTest.h"
 #include "LogicTest.h"
 #include "SelectTest.h"
+#include "Select64Test.h"
 #include "LoopTest.h"
+#include "LoopInvariantTest.h"
 #include "AliasTest.h"
 #include "AliasTest2.h"
 #include "FpSingleTest.h"
+#include "FpDoubleTest.h"
 #include "FpIntMixTest.h"
 #include "FpRoundModeTest.h"
 #include "FpClampTest.h"
+#include "FmaTest.h"
 #include "SimpleMdTest.h"
 #include "MdLogicTest.h"
 #include "MdTest.h"
@@ -24,28 +31,39 @@
 #include "MdSubTest.h"
 #include "MdCmpTest.h"
 #include "MdMinMaxTest.h"
+#include "MdMulTest.h"
 #include "MdUnpackTest.h"
 #include "MdFpTest.h"
+#include "MdFpMathTest.h"
 #include "MdFpFlagTest.h"
 #include "MdCallTest.h"
+#include "MdClampTest.h"
 #include "MdMemAccessTest.h"
+#include "MdAvx512Test.h"
 #include "MdManipTest.h"
 #include "MdShiftTest.h"
+#include "MdShuffleTest.h"
 #include "CompareTest.h"
 #include "CompareTest2.h"
 #include "RegAllocTest.h"
 #include "RegAllocTempTest.h"
+#include "RegAlloc64Test.h"
+#include "NonDestructiveAluTest.h"
 #include "ReorderAddTest.h"
 #include "MemAccessTest.h"
 #include "MemAccessIdxTest.h"
+#include "AddressFoldingTest.h"
 #include "MemAccess8Test.h"
 #include "MemAccess16Test.h"
 #include "MemAccessRefTest.h"
 #include "GotoTest.h"
+#include "SwitchTest.h"
 #include "HugeJumpTest.h"
 #include "HugeJumpTestLiteral.h"
 #include "Alu64Test.h"
 #include "ConditionTest.h"
+#include "TestJumpTest.h"
+#include "IfConversionTest.h"
 #include "Cmp64Test.h"
 #include "Shift64Test.h"
 #include "Logic64Test.h"
@@ -53,8 +71,11 @@
 #include "Merge64Test.h"
 #include "MemAccess64Test.h"
 #include "LzcTest.h"
+#include "BitManipTest.h"
+#include "RotateTest.h"
 #include "NestedIfTest.h"
 #include "ExternJumpTest.h"
+#include "LeafFunctionTest.h"
 
 typedef std::function<CTest*()> TestFactoryFunction;
 
@@ -79,6 +100,9 @@ static const TestFactoryFunction s_factories[] =
 	[] () { return new CCompareTest2(true,  true,  0, 0xFFFFFF80U); },
 	[] () { return new CRegAllocTest(); },
 	[] () { return new CRegAllocTempTest(); },
+	[] () { return new CLeafFunctionTest(); },
+	[] () { return new CRegAlloc64Test(); },
+	[] () { return new CNonDestructiveAluTest(); },
 	[] () { return new CRandomAluTest(true); },
 	[] () { return new CRandomAluTest(false); },
 	[] () { return new CRandomAluTest2(true); },
@@ -92,6 +116,7 @@ static const TestFactoryFunction s_factories[] =
 	[] () { return new CShiftTest(44); },
 	[] () { return new CReorderAddTest(); },
 	[] () { return new CCrc32Test("Hello World!", 0x67FCDACC); },
+	[] () { return new CLookupTest(); },
 	[] () { return new CCursorTest(); },
 	[] () { return new CLogicTest(0, false, ~0, false); },
 	[] () { return new CLogicTest(0, false, ~0, true); },
@@ -104,29 +129,52 @@ static const TestFactoryFunction s_factories[] =
 	[] () { return new CSelectTest(true, false); },
 	[] () { return new CSelectTest(false, true); },
 	[] () { return new CSelectTest(true, true); },
+	[] () { return new CSelect64Test(); },
 	[] () { return new CMultTest(true); },
 	[] () { return new CMultTest(false); },
 	[] () { return new CDivTest(true); },
 	[] () { return new CDivTest(false); },
+	[] () { return new CStrengthReductionTest(true); },
+	[] () { return new CStrengthReductionTest(false); },
+	[] () { return new CAlgebraicSimplificationTest(); },
 	[] () { return new CMemAccessTest(); },
 	[] () { return new CMemAccessIdxTest(true); },
 	[] () { return new CMemAccessIdxTest(false); },
+	[] () { return new CAddressFoldingTest(); },
 	[] () { return new CMemAccess8Test(true); },
 	[] () { return new CMemAccess8Test(false); },
 	[] () { return new CMemAccess16Test(true); },
 	[] () { return new CMemAccess16Test(false); },
 	[] () { return new CMemAccessRefTest(); },
 	[] () { return new CGotoTest(); },
+	[] () { return new CSwitchTest(0); },
+	[] () { return new CSwitchTest(2); },
+	[] () { return new CSwitchTest(4); },
+	[] () { return new CSwitchTest(5); },
+	[] () { return new CSwitchTest(0xFFFFFFFF); },
 	[] () { return new CHugeJumpTest(); },
 	[] () { return new CHugeJumpTestLiteral(); },
 	[] () { return new CLoopTest(); },
+	[] () { return new CLoopInvariantTest(); },
 	[] () { return new CNestedIfTest(); },
 	[] () { return new CLzcTest(); },
+	[] () { return new CBitManipTest(); },
+	[] () { return new CRotateTest(0); },
+	[] () { return new CRotateTest(1); },
+	[] () { return new CRotateTest(8); },
+	[] () { return new CRotateTest(31); },
+	[] () { return new CRotateTest(32); },
+	[] () { return new CRotateTest(40); },
+	[] () { return new CRotateTest(63); },
+	[] () { return new CRotateTest(64); },
+	[] () { return new CRotateTest(76); },
 	[] () { return new CAliasTest(); },
 	[] () { return new CAliasTest2(); },
 	[] () { return new CFpRoundModeTest(); },
 	[] () { return new CFpSingleTest(); },
+	[] () { return new CFpDoubleTest(); },
 	[] () { return new CFpIntMixTest(); },
+	[] () { return new CFmaTest(); },
 	[] () { return new CSimpleMdTest(); },
 	[] () { return new CMdTest(); },
 	[] () { return new CMdLogicTest(); },
@@ -135,11 +183,17 @@ static const TestFactoryFunction s_factories[] =
 	[] () { return new CMdUnpackTest(); },
 	[] () { return new CMdCmpTest(); },
 	[] () { return new CMdMinMaxTest(); },
+	[] () { return new CMdMulTest(); },
 	[] () { return new CMdFpTest(); },
+	[] () { return new CMdFpMathTest(); },
 	[] () { return new CMdFpFlagTest(); },
 	[] () { return new CMdCallTest(); },
 	[] () { return new CMdMemAccessTest(); },
+#if defined(_M_X64) || defined(__x86_64__) || defined(_M_IX86) || defined(__i386__)
+	[] () { return new CMdAvx512Test(); },
+#endif
 	[] () { return new CMdManipTest(); },
+	[] () { return new CMdShuffleTest(); },
 	[] () { return new CMdShiftTest(0); },
 	[] () { return new CMdShiftTest(15); },
 	[] () { return new CMdShiftTest(16); },
@@ -147,6 +201,8 @@ static const TestFactoryFunction s_factories[] =
 	[] () { return new CMdShiftTest(32); },
 	[] () { return new CMdShiftTest(38); },
 	[] () { return new CFpClampTest(); },
+	[] () { return new CMdClampTest(false); },
+	[] () { return new CMdClampTest(true); },
 	[] () { return new CAlu64Test(); },
 	//negative / positive
 	[] () { return new CConditionTest(false, 0xFFFFFFFE, 0xFFFFFFFE); },
@@ -175,6 +231,15 @@ static const TestFactoryFunction s_factories[] =
 	[]() { return new CConditionTest(true,  0x000000FF, 0x0000000F); },
 	[]() { return new CConditionTest(true,  0x0000000F, 0x000000FF); },
 	[]() { return new CConditionTest(true,  0x000000FF, 0x000000FF); },
+	//disjoint bits
+	[]() { return new CConditionTest(false, 0x0000000F, 0x000000F0); },
+	[]() { return new CConditionTest(true,  0x0000000F, 0x000000F0); },
+	[] () { return new CTestJumpTest(0x0000000F, 0x000000F0); },
+	[] () { return new CTestJumpTest(0x0000000F, 0x000000FF); },
+	[] () { return new CIfConversionTest(0x00000002, 0xFFFFFFFE); },
+	[] () { return new CIfConversionTest(0xFFFFFFFE, 0x00000002); },
+	[] () { return new CIfConversionTest(0x00001000, 0x00000010); },
+	[] () { return new CIfConversionTest(0x00000000, 0x00000010); },
 	[] () { return new CCmp64Test(false, false, 0xFEDCBA9876543210ULL, 0x012389AB4567CDEFULL); },
 	[] () { return new CCmp64Test(false, true,  0xFEDCBA9876543210ULL, 0x012389AB4567CDEFULL); },
 	[] () { return new CCmp64Test(true,  true,  0xFEDCBA9876543210ULL, 0x012389AB4567CDEFULL); },
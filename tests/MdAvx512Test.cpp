@@ -0,0 +1,148 @@
+#include "MdAvx512Test.h"
+#include "Jitter_CodeGen_x86_32.h"
+#include "Jitter_CodeGen_x86_64.h"
+
+void CMdAvx512Test::Run()
+{
+	//Nothing to run if the host can't execute the AVX-512 code
+	if(!CX86CpuFeatures::AutoDetect().hasAvx512)
+	{
+		return;
+	}
+
+	//Make sure forcing the feature set had an effect on the generated code
+	TEST_VERIFY(m_codeDiffers);
+
+	RunFunction(m_avxFunction);
+	RunFunction(m_avx512Function);
+}
+
+void CMdAvx512Test::RunFunction(FunctionType& function)
+{
+	m_context = {};
+	m_context.array = m_memory;
+
+	static const uint32 op0[4] = {0x7FFFFFF0, 0x80000010, 0x12345678, 0xFFFFFFFF};
+	static const uint32 op1[4] = {0x00000020, 0xFFFFFFE0, 0x11111111, 0x80000000};
+	static const uint32 op2[4] = {0x80000000, 0x7FFFFFFF, 0x00000005, 0x00000000};
+	static const uint32 op3[4] = {0x00000001, 0xFFFFFFFF, 0x00000007, 0x80000000};
+	for(unsigned int i = 0; i < 4; i++)
+	{
+		m_context.op0.nV[i] = op0[i];
+		m_context.op1.nV[i] = op1[i];
+		m_context.op2.nV[i] = op2[i];
+		m_context.op3.nV[i] = op3[i];
+	}
+
+	for(unsigned int i = 0; i < MASK_COUNT; i++)
+	{
+		m_context.storeIdx[i] = i * sizeof(uint128);
+		for(unsigned int j = 0; j < 4; j++)
+		{
+			m_memory[i].nV[j] = 0xCCCCCCC0 | j;
+		}
+	}
+
+	function(&m_context);
+
+	TEST_VERIFY(m_context.notResult.nV[0] == 0x8000000F);
+	TEST_VERIFY(m_context.notResult.nV[1] == 0x7FFFFFEF);
+	TEST_VERIFY(m_context.notResult.nV[2] == 0xEDCBA987);
+	TEST_VERIFY(m_context.notResult.nV[3] == 0x00000000);
+
+	TEST_VERIFY(m_context.addSsResult.nV[0] == 0x7FFFFFFF);
+	TEST_VERIFY(m_context.addSsResult.nV[1] == 0x80000000);
+	TEST_VERIFY(m_context.addSsResult.nV[2] == 0x23456789);
+	TEST_VERIFY(m_context.addSsResult.nV[3] == 0x80000000);
+
+	TEST_VERIFY(m_context.subSsResult.nV[0] == 0x80000000);
+	TEST_VERIFY(m_context.subSsResult.nV[1] == 0x7FFFFFFF);
+	TEST_VERIFY(m_context.subSsResult.nV[2] == 0xFFFFFFFE);
+	TEST_VERIFY(m_context.subSsResult.nV[3] == 0x7FFFFFFF);
+
+	for(unsigned int i = 0; i < MASK_COUNT; i++)
+	{
+		if((i == 0) || (i == 0xF)) continue;
+		for(unsigned int j = 0; j < 4; j++)
+		{
+			uint32 expected = (i & (1 << j)) ? op0[j] : (0xCCCCCCC0 | j);
+			TEST_VERIFY(m_memory[i].nV[j] == expected);
+		}
+	}
+}
+
+void CMdAvx512Test::Compile(Jitter::CJitter&)
+{
+	//The suite's jitter isn't used, its code generator was created with the host's feature set
+	auto avx512Features = CX86CpuFeatures::AutoDetect();
+	avx512Features.hasAvx = true;
+	avx512Features.hasAvx512 = true;
+
+	auto avxFeatures = avx512Features;
+	avxFeatures.hasAvx512 = false;
+
+	Framework::CMemStream avxCodeStream;
+	Framework::CMemStream avx512CodeStream;
+	CompileWithFeatures(avxFeatures, avxCodeStream);
+	CompileWithFeatures(avx512Features, avx512CodeStream);
+
+	m_codeDiffers = (avxCodeStream.GetSize() != avx512CodeStream.GetSize()) ||
+	                (memcmp(avxCodeStream.GetBuffer(), avx512CodeStream.GetBuffer(), avxCodeStream.GetSize()) != 0);
+
+	m_avxFunction = FunctionType(avxCodeStream.GetBuffer(), avxCodeStream.GetSize());
+	m_avx512Function = FunctionType(avx512CodeStream.GetBuffer(), avx512CodeStream.GetSize());
+}
+
+void CMdAvx512Test::CompileWithFeatures(const CX86CpuFeatures& features, Framework::CMemStream& codeStream)
+{
+#if defined(_M_X64) || defined(__x86_64__)
+	auto codeGen = new Jitter::CCodeGen_x86_64(features);
+#if defined(_WIN32)
+	codeGen->SetPlatformAbi(Jitter::CCodeGen_x86_64::PLATFORM_ABI_WIN32);
+#endif
+#else
+	auto codeGen = new Jitter::CCodeGen_x86_32(features);
+#if !defined(_WIN32)
+	codeGen->SetImplicitRetValueParamFixUpRequired(true);
+#endif
+#endif
+
+	Jitter::CJitter jitter(codeGen);
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		//MD_NOT and saturated adds/subs combine their logic with vpternlogd
+		jitter.MD_PushRel(offsetof(CONTEXT, op0));
+		jitter.MD_Not();
+		jitter.MD_PullRel(offsetof(CONTEXT, notResult));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, op0));
+		jitter.MD_PushRel(offsetof(CONTEXT, op1));
+		jitter.MD_AddWSS();
+		jitter.MD_PullRel(offsetof(CONTEXT, addSsResult));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, op2));
+		jitter.MD_PushRel(offsetof(CONTEXT, op3));
+		jitter.MD_SubWSS();
+		jitter.MD_PullRel(offsetof(CONTEXT, subSsResult));
+
+		//Masked stores go through a k register, index is alternatively constant and variable
+		for(unsigned int i = 0; i < MASK_COUNT; i++)
+		{
+			if((i == 0) || (i == 0xF)) continue;
+			jitter.PushRelRef(offsetof(CONTEXT, array));
+			if(i & 1)
+			{
+				jitter.PushRel(offsetof(CONTEXT, storeIdx[i]));
+			}
+			else
+			{
+				jitter.PushCst(i * sizeof(uint128));
+			}
+			jitter.MD_PushRel(offsetof(CONTEXT, op0));
+			jitter.MD_StoreAtRefIdxMasked((i & 1) != 0, (i & 2) != 0, (i & 4) != 0, (i & 8) != 0);
+		}
+	}
+	jitter.End();
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Test.h"
+#include "Align16.h"
+#include "uint128.h"
+#include "MemStream.h"
+#include "X86CpuFeatures.h"
+
+//Compiles the same block with the AVX and AVX-512 feature sets forced on x86 code generators
+class CMdAvx512Test : public CTest
+{
+public:
+	void Run() override;
+	void Compile(Jitter::CJitter&) override;
+
+private:
+	static constexpr size_t MASK_COUNT = 0x10;
+
+	struct CONTEXT
+	{
+		ALIGN16
+
+		uint128 op0;
+		uint128 op1;
+		uint128 op2;
+		uint128 op3;
+		uint128 notResult;
+		uint128 addSsResult;
+		uint128 subSsResult;
+
+		uint32 storeIdx[MASK_COUNT];
+
+		uint128* array;
+	};
+
+	static void CompileWithFeatures(const CX86CpuFeatures&, Framework::CMemStream&);
+	void RunFunction(FunctionType&);
+
+	bool m_codeDiffers = false;
+	CONTEXT m_context;
+	uint128 m_memory[MASK_COUNT];
+	FunctionType m_avxFunction;
+	FunctionType m_avx512Function;
+};
@@ -0,0 +1,69 @@
+#include "MdClampTest.h"
+#include "MemStream.h"
+
+CMdClampTest::CMdClampTest(bool condition)
+    : m_condition(condition)
+{
+}
+
+void CMdClampTest::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	auto emitClamp =
+	    [&jitter](unsigned int resultIndex) {
+		    jitter.MD_PushRel(offsetof(CONTEXT, value));
+		    jitter.MD_ClampS();
+		    jitter.MD_PullRel(offsetof(CONTEXT, result) + (resultIndex * 16));
+	    };
+
+	jitter.Begin();
+	{
+		emitClamp(0);
+
+		//Clamp constants are used more than once in this block only
+		jitter.PushRel(offsetof(CONTEXT, condition));
+		jitter.PushCst(0);
+		jitter.BeginIf(Jitter::CONDITION_NE);
+		{
+			emitClamp(1);
+			emitClamp(2);
+		}
+		jitter.EndIf();
+
+		emitClamp(3);
+		emitClamp(4);
+		emitClamp(5);
+	}
+	jitter.End();
+
+	m_function = FunctionType(codeStream.GetBuffer(), codeStream.GetSize());
+}
+
+void CMdClampTest::Run()
+{
+	CONTEXT context;
+	memset(&context, 0, sizeof(CONTEXT));
+
+	context.value[0] = 0x3F800000;
+	context.value[1] = 0x7FC00000;
+	context.value[2] = 0xFFC00000;
+	context.value[3] = 0xFF800000;
+	context.condition = m_condition ? 1 : 0;
+
+	m_function(&context);
+
+	for(unsigned int i = 0; i < RESULT_COUNT; i++)
+	{
+		if(!m_condition && ((i == 1) || (i == 2)))
+		{
+			TEST_VERIFY(context.result[i][0] == 0);
+			continue;
+		}
+		TEST_VERIFY(context.result[i][0] == 0x3F800000);
+		TEST_VERIFY(context.result[i][1] == 0x7F7FFFFF);
+		TEST_VERIFY(context.result[i][2] == 0xFF7FFFFF);
+		TEST_VERIFY(context.result[i][3] == 0xFF7FFFFF);
+	}
+}
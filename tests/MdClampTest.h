@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Test.h"
+#include "Align16.h"
+
+class CMdClampTest : public CTest
+{
+public:
+	CMdClampTest(bool);
+
+	void Compile(Jitter::CJitter&) override;
+	void Run() override;
+
+private:
+	enum
+	{
+		RESULT_COUNT = 6,
+	};
+
+	struct CONTEXT
+	{
+		ALIGN16
+
+		uint32 value[4];
+		uint32 result[RESULT_COUNT][4];
+
+		uint32 condition;
+	};
+
+	bool m_condition = false;
+	FunctionType m_function;
+};
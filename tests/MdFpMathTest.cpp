@@ -0,0 +1,112 @@
+#include "MdFpMathTest.h"
+#include "MemStream.h"
+
+void CMdFpMathTest::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		jitter.MD_PushRel(offsetof(CONTEXT, src0));
+		jitter.MD_SqrtS();
+		jitter.MD_PullRel(offsetof(CONTEXT, dstSqrt));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, src0));
+		jitter.MD_RsqrtS();
+		jitter.MD_PullRel(offsetof(CONTEXT, dstRsqrt));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, src1));
+		jitter.MD_RcplS();
+		jitter.MD_PullRel(offsetof(CONTEXT, dstRcpl));
+
+		//All lanes summed, result in lane 0
+		jitter.MD_PushRel(offsetof(CONTEXT, src2));
+		jitter.MD_PushRel(offsetof(CONTEXT, src3));
+		jitter.MD_DotS(0xF1);
+		jitter.MD_PullRel(offsetof(CONTEXT, dstDotF1));
+
+		//Lanes 1-3 summed, result in lanes 1-3
+		jitter.MD_PushRel(offsetof(CONTEXT, src2));
+		jitter.MD_PushRel(offsetof(CONTEXT, src3));
+		jitter.MD_DotS(0x7E);
+		jitter.MD_PullRel(offsetof(CONTEXT, dstDot7E));
+
+		//Lanes 0 and 2 summed, result in all lanes
+		jitter.MD_PushRel(offsetof(CONTEXT, src2));
+		jitter.MD_PushRel(offsetof(CONTEXT, src3));
+		jitter.MD_DotS(0x5F);
+		jitter.MD_PullRel(offsetof(CONTEXT, dstDot5F));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, src2));
+		jitter.MD_PushRel(offsetof(CONTEXT, src3));
+		jitter.MD_HaddS();
+		jitter.MD_PullRel(offsetof(CONTEXT, dstHadd));
+	}
+	jitter.End();
+
+	m_function = FunctionType(codeStream.GetBuffer(), codeStream.GetSize());
+}
+
+void CMdFpMathTest::Run()
+{
+	CONTEXT ALIGN16 context;
+	memset(&context, 0, sizeof(CONTEXT));
+
+	context.src0[0] = 4.0f;
+	context.src0[1] = 16.0f;
+	context.src0[2] = 0.25f;
+	context.src0[3] = 64.0f;
+
+	context.src1[0] = 2.0f;
+	context.src1[1] = 0.5f;
+	context.src1[2] = -4.0f;
+	context.src1[3] = 8.0f;
+
+	context.src2[0] = 1.0f;
+	context.src2[1] = 2.0f;
+	context.src2[2] = 3.0f;
+	context.src2[3] = 4.0f;
+
+	context.src3[0] = 5.0f;
+	context.src3[1] = 6.0f;
+	context.src3[2] = 7.0f;
+	context.src3[3] = 8.0f;
+
+	m_function(&context);
+
+	TEST_VERIFY(context.dstSqrt[0] == 2.0f);
+	TEST_VERIFY(context.dstSqrt[1] == 4.0f);
+	TEST_VERIFY(context.dstSqrt[2] == 0.5f);
+	TEST_VERIFY(context.dstSqrt[3] == 8.0f);
+
+	TEST_VERIFY(fabs(0.5f - context.dstRsqrt[0]) < 0.001f);
+	TEST_VERIFY(fabs(0.25f - context.dstRsqrt[1]) < 0.001f);
+	TEST_VERIFY(fabs(2.0f - context.dstRsqrt[2]) < 0.001f);
+	TEST_VERIFY(fabs(0.125f - context.dstRsqrt[3]) < 0.001f);
+
+	TEST_VERIFY(fabs(0.5f - context.dstRcpl[0]) < 0.001f);
+	TEST_VERIFY(fabs(2.0f - context.dstRcpl[1]) < 0.001f);
+	TEST_VERIFY(fabs(-0.25f - context.dstRcpl[2]) < 0.001f);
+	TEST_VERIFY(fabs(0.125f - context.dstRcpl[3]) < 0.001f);
+
+	TEST_VERIFY(context.dstDotF1[0] == 70.0f);
+	TEST_VERIFY(context.dstDotF1[1] == 0.0f);
+	TEST_VERIFY(context.dstDotF1[2] == 0.0f);
+	TEST_VERIFY(context.dstDotF1[3] == 0.0f);
+
+	TEST_VERIFY(context.dstDot7E[0] == 0.0f);
+	TEST_VERIFY(context.dstDot7E[1] == 38.0f);
+	TEST_VERIFY(context.dstDot7E[2] == 38.0f);
+	TEST_VERIFY(context.dstDot7E[3] == 38.0f);
+
+	TEST_VERIFY(context.dstDot5F[0] == 26.0f);
+	TEST_VERIFY(context.dstDot5F[1] == 26.0f);
+	TEST_VERIFY(context.dstDot5F[2] == 26.0f);
+	TEST_VERIFY(context.dstDot5F[3] == 26.0f);
+
+	TEST_VERIFY(context.dstHadd[0] == 3.0f);
+	TEST_VERIFY(context.dstHadd[1] == 7.0f);
+	TEST_VERIFY(context.dstHadd[2] == 11.0f);
+	TEST_VERIFY(context.dstHadd[3] == 15.0f);
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Test.h"
+#include "Align16.h"
+
+class CMdFpMathTest : public CTest
+{
+public:
+	void Compile(Jitter::CJitter&) override;
+	void Run() override;
+
+private:
+	struct CONTEXT
+	{
+		ALIGN16
+
+		float src0[4];
+		float src1[4];
+		float src2[4];
+		float src3[4];
+
+		float dstSqrt[4];
+		float dstRsqrt[4];
+		float dstRcpl[4];
+
+		float dstDotF1[4];
+		float dstDot7E[4];
+		float dstDot5F[4];
+
+		float dstHadd[4];
+	};
+
+	FunctionType m_function;
+};
@@ -0,0 +1,93 @@
+#include "MdMulTest.h"
+#include "MemStream.h"
+
+void CMdMulTest::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		jitter.MD_PushRel(offsetof(CONTEXT, srcH0));
+		jitter.MD_PushRel(offsetof(CONTEXT, srcH1));
+		jitter.MD_MulH();
+		jitter.MD_PullRel(offsetof(CONTEXT, dstMulH));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, srcH0));
+		jitter.MD_PushRel(offsetof(CONTEXT, srcH1));
+		jitter.MD_MulHiHS();
+		jitter.MD_PullRel(offsetof(CONTEXT, dstMulHiHS));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, srcH0));
+		jitter.MD_PushRel(offsetof(CONTEXT, srcH1));
+		jitter.MD_MulHiHU();
+		jitter.MD_PullRel(offsetof(CONTEXT, dstMulHiHU));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, srcW0));
+		jitter.MD_PushRel(offsetof(CONTEXT, srcW1));
+		jitter.MD_MulW();
+		jitter.MD_PullRel(offsetof(CONTEXT, dstMulW));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, srcW0));
+		jitter.MD_PushRel(offsetof(CONTEXT, srcW1));
+		jitter.MD_MulWDS();
+		jitter.MD_PullRel(offsetof(CONTEXT, dstMulWDS));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, srcW0));
+		jitter.MD_PushRel(offsetof(CONTEXT, srcW1));
+		jitter.MD_MulWDU();
+		jitter.MD_PullRel(offsetof(CONTEXT, dstMulWDU));
+
+		//Result stays in a temporary before being added
+		jitter.MD_PushRel(offsetof(CONTEXT, srcW0));
+		jitter.MD_PushRel(offsetof(CONTEXT, srcW0));
+		jitter.MD_MulW();
+		jitter.MD_PushRel(offsetof(CONTEXT, srcW1));
+		jitter.MD_AddW();
+		jitter.MD_PullRel(offsetof(CONTEXT, dstMulAddW));
+	}
+	jitter.End();
+
+	m_function = FunctionType(codeStream.GetBuffer(), codeStream.GetSize());
+}
+
+void CMdMulTest::Run()
+{
+	CONTEXT ALIGN16 context;
+	memset(&context, 0, sizeof(CONTEXT));
+
+	static const int16 srcH0[8] = {3, -3, 0x7FFF, -0x8000, 0x1234, -0x1234, 0x4000, -1};
+	static const int16 srcH1[8] = {5, 7, 0x7FFF, -0x8000, 0x5678, 0x5678, -4, -1};
+	static const int32 srcW0[4] = {3, -0x12345678, 0x7FFFFFFF, -1};
+	static const int32 srcW1[4] = {-5, 0x1000, static_cast<int32>(0x80000000), -1};
+
+	memcpy(context.srcH0, srcH0, sizeof(srcH0));
+	memcpy(context.srcH1, srcH1, sizeof(srcH1));
+	memcpy(context.srcW0, srcW0, sizeof(srcW0));
+	memcpy(context.srcW1, srcW1, sizeof(srcW1));
+
+	m_function(&context);
+
+	for(unsigned int i = 0; i < 8; i++)
+	{
+		int32 productS = static_cast<int32>(srcH0[i]) * static_cast<int32>(srcH1[i]);
+		uint32 productU = static_cast<uint32>(static_cast<uint16>(srcH0[i])) * static_cast<uint32>(static_cast<uint16>(srcH1[i]));
+		TEST_VERIFY(context.dstMulH[i] == static_cast<int16>(productS));
+		TEST_VERIFY(context.dstMulHiHS[i] == static_cast<int16>(productS >> 16));
+		TEST_VERIFY(context.dstMulHiHU[i] == static_cast<uint16>(productU >> 16));
+	}
+
+	for(unsigned int i = 0; i < 4; i++)
+	{
+		uint32 product = static_cast<uint32>(srcW0[i]) * static_cast<uint32>(srcW1[i]);
+		uint32 square = static_cast<uint32>(srcW0[i]) * static_cast<uint32>(srcW0[i]);
+		TEST_VERIFY(context.dstMulW[i] == static_cast<int32>(product));
+		TEST_VERIFY(context.dstMulAddW[i] == static_cast<int32>(square + static_cast<uint32>(srcW1[i])));
+	}
+
+	for(unsigned int i = 0; i < 2; i++)
+	{
+		TEST_VERIFY(context.dstMulWDS[i] == static_cast<int64>(srcW0[i * 2]) * static_cast<int64>(srcW1[i * 2]));
+		TEST_VERIFY(context.dstMulWDU[i] == static_cast<uint64>(static_cast<uint32>(srcW0[i * 2])) * static_cast<uint64>(static_cast<uint32>(srcW1[i * 2])));
+	}
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Test.h"
+#include "Align16.h"
+
+class CMdMulTest : public CTest
+{
+public:
+	void Compile(Jitter::CJitter&) override;
+	void Run() override;
+
+private:
+	struct CONTEXT
+	{
+		ALIGN16
+
+		int16 srcH0[8];
+		int16 srcH1[8];
+		int32 srcW0[4];
+		int32 srcW1[4];
+
+		int16 dstMulH[8];
+		int16 dstMulHiHS[8];
+		uint16 dstMulHiHU[8];
+		int32 dstMulW[4];
+		int64 dstMulWDS[2];
+		uint64 dstMulWDU[2];
+		int32 dstMulAddW[4];
+	};
+
+	FunctionType m_function;
+};
@@ -0,0 +1,136 @@
+#include "MdShuffleTest.h"
+#include "MemStream.h"
+
+//Reverse bytes in first two words, clear two bytes, then gather a few others
+const uint64 CMdShuffleTest::g_shuffleBPatternLow = 0x0405060700010203ULL;
+const uint64 CMdShuffleTest::g_shuffleBPatternHigh = 0x0F0F0F0F0908FF80ULL;
+
+void CMdShuffleTest::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		//Reverse lanes
+		jitter.MD_PushRel(offsetof(CONTEXT, src0));
+		jitter.MD_ShuffleW(0x1B);
+		jitter.MD_PullRel(offsetof(CONTEXT, dstShuffleW));
+
+		//Swizzle .xzyw, result written back to source
+		jitter.MD_PushRel(offsetof(CONTEXT, dstShuffleWInPlace));
+		jitter.MD_ShuffleW(0xD8);
+		jitter.MD_PullRel(offsetof(CONTEXT, dstShuffleWInPlace));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, src1));
+		jitter.MD_ShuffleB(g_shuffleBPatternLow, g_shuffleBPatternHigh);
+		jitter.MD_PullRel(offsetof(CONTEXT, dstShuffleB));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, src0));
+		jitter.PushRel(offsetof(CONTEXT, valueW));
+		jitter.MD_InsertW(2);
+		jitter.PushCst(0xCAFEBABE);
+		jitter.MD_InsertW(0);
+		jitter.MD_PullRel(offsetof(CONTEXT, dstInsertW));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, src2));
+		jitter.FP_PushRel32(offsetof(CONTEXT, valueS));
+		jitter.MD_InsertW(3);
+		jitter.FP_PushCst32(-1.0f);
+		jitter.MD_InsertW(1);
+		jitter.MD_PullRel(offsetof(CONTEXT, dstInsertS));
+
+		//Broadcast a computed lane
+		jitter.MD_PushRel(offsetof(CONTEXT, src2));
+		jitter.MD_PushRel(offsetof(CONTEXT, src2));
+		jitter.MD_AddS();
+		jitter.MD_ShuffleW(0xAA);
+		jitter.MD_PullRel(offsetof(CONTEXT, dstBroadcastS));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, src0));
+		jitter.MD_ExtractW(0);
+		jitter.PullRel(offsetof(CONTEXT, dstExtractW0));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, src0));
+		jitter.MD_ExtractW(3);
+		jitter.PullRel(offsetof(CONTEXT, dstExtractW3));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, src0));
+		jitter.MD_ShuffleW(0x1B);
+		jitter.MD_ExtractW(1);
+		jitter.PushCst(1);
+		jitter.Add();
+		jitter.PullRel(offsetof(CONTEXT, dstExtractChain));
+
+		jitter.MD_PushRel(offsetof(CONTEXT, src2));
+		jitter.MD_ExtractS(2);
+		jitter.FP_PullRel32(offsetof(CONTEXT, dstExtractS2));
+	}
+	jitter.End();
+
+	m_function = FunctionType(codeStream.GetBuffer(), codeStream.GetSize());
+}
+
+void CMdShuffleTest::Run()
+{
+	CONTEXT ALIGN16 context;
+	memset(&context, 0, sizeof(CONTEXT));
+
+	for(unsigned int i = 0; i < 4; i++)
+	{
+		context.src0[i] = 0x11111111 * (i + 1);
+		context.dstShuffleWInPlace[i] = 0x10 + i;
+	}
+	for(unsigned int i = 0; i < 16; i++)
+	{
+		context.src1[i] = static_cast<uint8>(0xA0 + i);
+	}
+
+	context.src2[0] = 1.0f;
+	context.src2[1] = 2.0f;
+	context.src2[2] = 3.0f;
+	context.src2[3] = 4.0f;
+
+	context.valueW = 0x12345678;
+	context.valueS = 8.5f;
+
+	m_function(&context);
+
+	TEST_VERIFY(context.dstShuffleW[0] == 0x44444444);
+	TEST_VERIFY(context.dstShuffleW[1] == 0x33333333);
+	TEST_VERIFY(context.dstShuffleW[2] == 0x22222222);
+	TEST_VERIFY(context.dstShuffleW[3] == 0x11111111);
+
+	TEST_VERIFY(context.dstShuffleWInPlace[0] == 0x10);
+	TEST_VERIFY(context.dstShuffleWInPlace[1] == 0x12);
+	TEST_VERIFY(context.dstShuffleWInPlace[2] == 0x11);
+	TEST_VERIFY(context.dstShuffleWInPlace[3] == 0x13);
+
+	for(unsigned int i = 0; i < 16; i++)
+	{
+		uint64 pattern = (i < 8) ? g_shuffleBPatternLow : g_shuffleBPatternHigh;
+		uint8 index = static_cast<uint8>(pattern >> ((i & 7) * 8));
+		uint8 expected = (index < 16) ? context.src1[index] : 0;
+		TEST_VERIFY(context.dstShuffleB[i] == expected);
+	}
+
+	TEST_VERIFY(context.dstInsertW[0] == 0xCAFEBABE);
+	TEST_VERIFY(context.dstInsertW[1] == 0x22222222);
+	TEST_VERIFY(context.dstInsertW[2] == 0x12345678);
+	TEST_VERIFY(context.dstInsertW[3] == 0x44444444);
+
+	TEST_VERIFY(context.dstInsertS[0] == 1.0f);
+	TEST_VERIFY(context.dstInsertS[1] == -1.0f);
+	TEST_VERIFY(context.dstInsertS[2] == 3.0f);
+	TEST_VERIFY(context.dstInsertS[3] == 8.5f);
+
+	TEST_VERIFY(context.dstBroadcastS[0] == 6.0f);
+	TEST_VERIFY(context.dstBroadcastS[1] == 6.0f);
+	TEST_VERIFY(context.dstBroadcastS[2] == 6.0f);
+	TEST_VERIFY(context.dstBroadcastS[3] == 6.0f);
+
+	TEST_VERIFY(context.dstExtractW0 == 0x11111111);
+	TEST_VERIFY(context.dstExtractW3 == 0x44444444);
+	TEST_VERIFY(context.dstExtractChain == 0x33333334);
+	TEST_VERIFY(context.dstExtractS2 == 3.0f);
+}
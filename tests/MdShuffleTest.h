@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Test.h"
+#include "Align16.h"
+
+class CMdShuffleTest : public CTest
+{
+public:
+	void Compile(Jitter::CJitter&) override;
+	void Run() override;
+
+private:
+	struct CONTEXT
+	{
+		ALIGN16
+
+		uint32 src0[4];
+		uint8 src1[16];
+		float src2[4];
+
+		uint32 dstShuffleW[4];
+		uint32 dstShuffleWInPlace[4];
+		uint8 dstShuffleB[16];
+		uint32 dstInsertW[4];
+		float dstInsertS[4];
+		float dstBroadcastS[4];
+
+		uint32 valueW;
+		float valueS;
+
+		uint32 dstExtractW0;
+		uint32 dstExtractW3;
+		uint32 dstExtractChain;
+		float dstExtractS2;
+	};
+
+	static const uint64 g_shuffleBPatternLow;
+	static const uint64 g_shuffleBPatternHigh;
+
+	FunctionType m_function;
+};
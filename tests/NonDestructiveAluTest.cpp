@@ -0,0 +1,97 @@
+#include "NonDestructiveAluTest.h"
+#include "MemStream.h"
+
+#define TEST_VALUE0 (0x89ABCDEF)
+#define TEST_VALUE1 (0x01234567)
+#define TEST_CST (0x1234)
+#define TEST_VALUE64 (0xFEDCBA9876543210ULL)
+#define TEST_MASK64 (0x0F0F0F0F0F0F0F0FULL)
+#define TEST_CST64 (0x12345678ULL)
+
+void CNonDestructiveAluTest::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	//Results of each operation go in a temporary, while the source
+	//is still needed by the operations that follow
+	jitter.Begin();
+	{
+		jitter.PushRel(offsetof(CONTEXT, value0));
+		jitter.PushCst(TEST_CST);
+		jitter.Add();
+		jitter.PushRel(offsetof(CONTEXT, value1));
+		jitter.Xor();
+		jitter.PullRel(offsetof(CONTEXT, addCstResult));
+
+		jitter.PushRel(offsetof(CONTEXT, value0));
+		jitter.PushCst(TEST_CST);
+		jitter.Sub();
+		jitter.PushRel(offsetof(CONTEXT, value1));
+		jitter.Xor();
+		jitter.PullRel(offsetof(CONTEXT, subCstResult));
+
+		jitter.PushRel(offsetof(CONTEXT, value0));
+		jitter.Shl(1);
+		jitter.PushRel(offsetof(CONTEXT, value1));
+		jitter.Xor();
+		jitter.PullRel(offsetof(CONTEXT, shlResult));
+
+		jitter.PushRel(offsetof(CONTEXT, value0));
+		jitter.PushRel(offsetof(CONTEXT, value1));
+		jitter.Add();
+		jitter.PushRel(offsetof(CONTEXT, value1));
+		jitter.Xor();
+		jitter.PullRel(offsetof(CONTEXT, addResult));
+
+		jitter.PushRel(offsetof(CONTEXT, value0));
+		jitter.PullRel(offsetof(CONTEXT, sourceResult));
+
+		jitter.PushRel64(offsetof(CONTEXT, value64));
+		jitter.PushCst64(TEST_CST64);
+		jitter.Add64();
+		jitter.PushRel64(offsetof(CONTEXT, mask64));
+		jitter.Xor64();
+		jitter.PullRel64(offsetof(CONTEXT, add64Result));
+
+		jitter.PushRel64(offsetof(CONTEXT, value64));
+		jitter.PushCst64(TEST_CST64);
+		jitter.Sub64();
+		jitter.PushRel64(offsetof(CONTEXT, mask64));
+		jitter.Xor64();
+		jitter.PullRel64(offsetof(CONTEXT, sub64Result));
+
+		jitter.PushRel64(offsetof(CONTEXT, value64));
+		jitter.Shl64(1);
+		jitter.PushRel64(offsetof(CONTEXT, mask64));
+		jitter.Xor64();
+		jitter.PullRel64(offsetof(CONTEXT, shl64Result));
+
+		jitter.PushRel64(offsetof(CONTEXT, value64));
+		jitter.PullRel64(offsetof(CONTEXT, source64Result));
+	}
+	jitter.End();
+
+	m_function = FunctionType(codeStream.GetBuffer(), codeStream.GetSize());
+}
+
+void CNonDestructiveAluTest::Run()
+{
+	memset(&m_context, 0, sizeof(CONTEXT));
+	m_context.value0 = TEST_VALUE0;
+	m_context.value1 = TEST_VALUE1;
+	m_context.value64 = TEST_VALUE64;
+	m_context.mask64 = TEST_MASK64;
+	m_function(&m_context);
+
+	TEST_VERIFY(m_context.addCstResult == ((TEST_VALUE0 + TEST_CST) ^ TEST_VALUE1));
+	TEST_VERIFY(m_context.subCstResult == ((TEST_VALUE0 - TEST_CST) ^ TEST_VALUE1));
+	TEST_VERIFY(m_context.shlResult == (static_cast<uint32>(TEST_VALUE0 << 1) ^ TEST_VALUE1));
+	TEST_VERIFY(m_context.addResult == (static_cast<uint32>(TEST_VALUE0 + TEST_VALUE1) ^ TEST_VALUE1));
+	TEST_VERIFY(m_context.sourceResult == TEST_VALUE0);
+
+	TEST_VERIFY(m_context.add64Result == ((TEST_VALUE64 + TEST_CST64) ^ TEST_MASK64));
+	TEST_VERIFY(m_context.sub64Result == ((TEST_VALUE64 - TEST_CST64) ^ TEST_MASK64));
+	TEST_VERIFY(m_context.shl64Result == ((TEST_VALUE64 << 1) ^ TEST_MASK64));
+	TEST_VERIFY(m_context.source64Result == TEST_VALUE64);
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Test.h"
+
+class CNonDestructiveAluTest : public CTest
+{
+public:
+	void Compile(Jitter::CJitter&) override;
+	void Run() override;
+
+private:
+	struct CONTEXT
+	{
+		uint32 value0;
+		uint32 value1;
+		uint32 addCstResult;
+		uint32 subCstResult;
+		uint32 shlResult;
+		uint32 addResult;
+		uint32 sourceResult;
+		uint32 padding;
+
+		uint64 value64;
+		uint64 mask64;
+		uint64 add64Result;
+		uint64 sub64Result;
+		uint64 shl64Result;
+		uint64 source64Result;
+	};
+
+	CONTEXT m_context;
+	FunctionType m_function;
+};
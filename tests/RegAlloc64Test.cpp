@@ -0,0 +1,145 @@
+#include "RegAlloc64Test.h"
+#include "MemStream.h"
+#include "offsetof_def.h"
+
+#define TEST_NUMBER1 (0xDEADDEADCAFECAFEULL)
+#define TEST_NUMBER2 (0x0123456789ABCDEFULL)
+#define TEST_OP1 (0x89ABCDEF)
+#define TEST_OP2 (0xFEDCBA98)
+#define TEST_ADDCST (0x12345678ULL)
+#define TEST_ADDNEGCST (0xFFFFFFFFFFFFFFF0ULL)
+
+void CRegAlloc64Test::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		for(unsigned int i = 2; i < MAX_VARS; i++)
+		{
+			jitter.PushRel64(offsetof(CONTEXT, number[i - 2]));
+			jitter.PushRel64(offsetof(CONTEXT, number[i - 1]));
+			if(i & 1)
+			{
+				jitter.Sub64();
+			}
+			else
+			{
+				jitter.Add64();
+			}
+			jitter.PullRel64(offsetof(CONTEXT, number[i - 0]));
+		}
+
+		jitter.PushRel(offsetof(CONTEXT, op1));
+		jitter.PushRel(offsetof(CONTEXT, op2));
+		jitter.Mult();
+		jitter.PullRel64(offsetof(CONTEXT, resultMul));
+
+		jitter.PushRel(offsetof(CONTEXT, op1));
+		jitter.PushRel(offsetof(CONTEXT, op2));
+		jitter.MultS();
+		jitter.PullRel64(offsetof(CONTEXT, resultMulS));
+
+		jitter.PushRel(offsetof(CONTEXT, op1));
+		jitter.PushRel(offsetof(CONTEXT, op2));
+		jitter.MergeTo64();
+		jitter.PullRel64(offsetof(CONTEXT, resultMerge));
+
+		//resultMix = ((resultMul ^ resultMerge) >> 3) * resultMerge
+		jitter.PushRel64(offsetof(CONTEXT, resultMul));
+		jitter.PushRel64(offsetof(CONTEXT, resultMerge));
+		jitter.Xor64();
+		jitter.Srl64(3);
+		jitter.PushRel64(offsetof(CONTEXT, resultMerge));
+		jitter.Mult64();
+		jitter.PullRel64(offsetof(CONTEXT, resultMix));
+
+		jitter.PushRel64(offsetof(CONTEXT, resultMix));
+		jitter.ExtLow64();
+		jitter.PullRel(offsetof(CONTEXT, resultLow));
+
+		jitter.PushRel64(offsetof(CONTEXT, resultMix));
+		jitter.ExtHigh64();
+		jitter.PullRel(offsetof(CONTEXT, resultHigh));
+
+		jitter.PushRel64(offsetof(CONTEXT, resultMix));
+		jitter.PushRel64(offsetof(CONTEXT, resultMul));
+		jitter.Cmp64(Jitter::CONDITION_BL);
+		jitter.PullRel(offsetof(CONTEXT, resultCmp));
+
+		//New block with few live values so that adds get register operands
+		jitter.PushRel(offsetof(CONTEXT, op1));
+		jitter.PushCst(0);
+		jitter.BeginIf(Jitter::CONDITION_NE);
+		{
+			jitter.PushRel64(offsetof(CONTEXT, resultMul));
+			jitter.PushCst64(TEST_ADDCST);
+			jitter.Add64();
+			jitter.PullRel64(offsetof(CONTEXT, resultAddCst));
+
+			jitter.PushRel64(offsetof(CONTEXT, resultMul));
+			jitter.PushCst64(TEST_ADDNEGCST);
+			jitter.Add64();
+			jitter.PullRel64(offsetof(CONTEXT, resultAddNegCst));
+
+			jitter.PushRel64(offsetof(CONTEXT, resultAddCst));
+			jitter.PushRel64(offsetof(CONTEXT, resultAddNegCst));
+			jitter.Add64();
+			jitter.PullRel64(offsetof(CONTEXT, resultAddVar));
+
+			//resultAddMix = (resultAddVar + resultAddCst) ^ (resultAddVar + resultAddNegCst) ^ resultMul
+			jitter.PushRel64(offsetof(CONTEXT, resultAddVar));
+			jitter.PushRel64(offsetof(CONTEXT, resultAddCst));
+			jitter.Add64();
+			jitter.PushRel64(offsetof(CONTEXT, resultAddVar));
+			jitter.PushRel64(offsetof(CONTEXT, resultAddNegCst));
+			jitter.Add64();
+			jitter.Xor64();
+			jitter.PushRel64(offsetof(CONTEXT, resultMul));
+			jitter.Xor64();
+			jitter.PullRel64(offsetof(CONTEXT, resultAddMix));
+		}
+		jitter.EndIf();
+	}
+	jitter.End();
+
+	m_function = FunctionType(codeStream.GetBuffer(), codeStream.GetSize());
+}
+
+void CRegAlloc64Test::Run()
+{
+	memset(&m_context, 0, sizeof(CONTEXT));
+	m_context.number[0] = TEST_NUMBER1;
+	m_context.number[1] = TEST_NUMBER2;
+	m_context.op1 = TEST_OP1;
+	m_context.op2 = TEST_OP2;
+	m_function(&m_context);
+	TEST_VERIFY(m_context.number[0] == TEST_NUMBER1);
+	TEST_VERIFY(m_context.number[1] == TEST_NUMBER2);
+	for(unsigned int i = 2; i < MAX_VARS; i++)
+	{
+		uint64 expected = (i & 1) ? (m_context.number[i - 2] - m_context.number[i - 1]) : (m_context.number[i - 2] + m_context.number[i - 1]);
+		TEST_VERIFY(m_context.number[i] == expected);
+	}
+
+	uint64 mul = static_cast<uint64>(TEST_OP1) * static_cast<uint64>(TEST_OP2);
+	uint64 mulS = static_cast<uint64>(static_cast<int64>(static_cast<int32>(TEST_OP1)) * static_cast<int64>(static_cast<int32>(TEST_OP2)));
+	uint64 merge = (static_cast<uint64>(TEST_OP2) << 32) | TEST_OP1;
+	uint64 mix = ((mul ^ merge) >> 3) * merge;
+	TEST_VERIFY(m_context.resultMul == mul);
+	TEST_VERIFY(m_context.resultMulS == mulS);
+	TEST_VERIFY(m_context.resultMerge == merge);
+	TEST_VERIFY(m_context.resultMix == mix);
+	TEST_VERIFY(m_context.resultLow == static_cast<uint32>(mix));
+	TEST_VERIFY(m_context.resultHigh == static_cast<uint32>(mix >> 32));
+	TEST_VERIFY(m_context.resultCmp == ((mix < mul) ? 1 : 0));
+
+	uint64 addCst = mul + TEST_ADDCST;
+	uint64 addNegCst = mul + TEST_ADDNEGCST;
+	uint64 addVar = addCst + addNegCst;
+	TEST_VERIFY(m_context.resultAddCst == addCst);
+	TEST_VERIFY(m_context.resultAddNegCst == addNegCst);
+	TEST_VERIFY(m_context.resultAddVar == addVar);
+	TEST_VERIFY(m_context.resultAddMix == ((addVar + addCst) ^ (addVar + addNegCst) ^ mul));
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Test.h"
+
+class CRegAlloc64Test : public CTest
+{
+public:
+	void Compile(Jitter::CJitter&) override;
+	void Run() override;
+
+private:
+	enum MAX_VARS
+	{
+		MAX_VARS = 16,
+	};
+
+	struct CONTEXT
+	{
+		uint64 number[MAX_VARS];
+
+		uint32 op1;
+		uint32 op2;
+
+		uint64 resultMul;
+		uint64 resultMulS;
+		uint64 resultMerge;
+		uint64 resultMix;
+		uint32 resultLow;
+		uint32 resultHigh;
+		uint32 resultCmp;
+
+		uint64 resultAddCst;
+		uint64 resultAddNegCst;
+		uint64 resultAddVar;
+		uint64 resultAddMix;
+	};
+
+	CONTEXT m_context;
+	FunctionType m_function;
+};
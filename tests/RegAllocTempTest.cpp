@@ -12,9 +12,15 @@ extern "C" void RegAllocTempTest_DummyFunction(uint32 value1, uint32 value2, uin
 {
 }
 
+extern "C" uint32 RegAllocTempTest_CombineFunction(uint32 value1, uint32 value2, uint32 value3, uint32 value4)
+{
+	return ((value1 - value2) ^ value3) + (value4 * 3);
+}
+
 void CRegAllocTempTest::PrepareExternalFunctions()
 {
 	Jitter::CWasmFunctionRegistry::RegisterFunction(reinterpret_cast<uintptr_t>(&RegAllocTempTest_DummyFunction), "_RegAllocTempTest_DummyFunction", "viii");
+	Jitter::CWasmFunctionRegistry::RegisterFunction(reinterpret_cast<uintptr_t>(&RegAllocTempTest_CombineFunction), "_RegAllocTempTest_CombineFunction", "iiiii");
 }
 
 void CRegAllocTempTest::Compile(Jitter::CJitter& jitter)
@@ -45,6 +51,23 @@ void CRegAllocTempTest::Compile(Jitter::CJitter& jitter)
 
 		//Temp is still in stack, pulling it into outValue
 		jitter.PullRel(offsetof(CONTEXT, outValue));
+
+		//Parameters computed in the same range as the call
+		jitter.PushRel(offsetof(CONTEXT, inValue));
+		jitter.PushCst(TEST_NUMBER3);
+		jitter.Xor();
+		jitter.PullRel(offsetof(CONTEXT, xorValue));
+
+		jitter.PushRel(offsetof(CONTEXT, inValue));
+		jitter.PushCst(TEST_NUMBER4);
+		jitter.Sub();
+		jitter.PushRel(offsetof(CONTEXT, xorValue));
+		jitter.PushRel(offsetof(CONTEXT, inValue));
+		jitter.PushCst(TEST_NUMBER5);
+		jitter.Or();
+		jitter.PushRel(offsetof(CONTEXT, inValue));
+		jitter.Call(reinterpret_cast<void*>(&RegAllocTempTest_CombineFunction), 4, Jitter::CJitter::RETURN_VALUE_32);
+		jitter.PullRel(offsetof(CONTEXT, combineValue));
 	}
 	jitter.End();
 
@@ -56,4 +79,7 @@ void CRegAllocTempTest::Run()
 	m_context.inValue = TEST_NUMBER1;
 	m_function(&m_context);
 	TEST_VERIFY(m_context.outValue == (TEST_NUMBER1 + TEST_NUMBER2));
+	TEST_VERIFY(m_context.xorValue == (TEST_NUMBER1 ^ TEST_NUMBER3));
+	uint32 combineValue = RegAllocTempTest_CombineFunction(TEST_NUMBER1 - TEST_NUMBER4, TEST_NUMBER1 ^ TEST_NUMBER3, TEST_NUMBER1 | TEST_NUMBER5, TEST_NUMBER1);
+	TEST_VERIFY(m_context.combineValue == combineValue);
 }
@@ -15,6 +15,8 @@ private:
 	{
 		uint32 inValue = 0;
 		uint32 outValue = 0;
+		uint32 xorValue = 0;
+		uint32 combineValue = 0;
 	};
 
 	CONTEXT m_context;
@@ -0,0 +1,118 @@
+#include "RotateTest.h"
+#include "MemStream.h"
+
+#define CONSTANT_1 (0x8000FFF1U)
+#define CONSTANT_2 (0x0123456789ABCDEFULL)
+
+static uint32 Rotl32(uint32 value, uint32 amount)
+{
+	amount &= 0x1F;
+	return (amount == 0) ? value : (value << amount) | (value >> (32 - amount));
+}
+
+static uint32 Rotr32(uint32 value, uint32 amount)
+{
+	return Rotl32(value, 32 - (amount & 0x1F));
+}
+
+static uint64 Rotl64(uint64 value, uint32 amount)
+{
+	amount &= 0x3F;
+	return (amount == 0) ? value : (value << amount) | (value >> (64 - amount));
+}
+
+static uint64 Rotr64(uint64 value, uint32 amount)
+{
+	return Rotl64(value, 64 - (amount & 0x3F));
+}
+
+CRotateTest::CRotateTest(uint32 rotateAmount)
+    : m_rotateAmount(rotateAmount)
+{
+}
+
+void CRotateTest::Run()
+{
+	memset(&m_context, 0, sizeof(m_context));
+
+	m_context.value = CONSTANT_1;
+	m_context.value64 = CONSTANT_2;
+	m_context.rotateAmount = m_rotateAmount;
+
+	m_function(&m_context);
+
+	//Rotate amounts are masked to the operand size
+	TEST_VERIFY(m_context.resultRotl == Rotl32(CONSTANT_1, m_rotateAmount));
+	TEST_VERIFY(m_context.resultRotr == Rotr32(CONSTANT_1, m_rotateAmount));
+	TEST_VERIFY(m_context.resultRotlVar == Rotl32(CONSTANT_1, m_rotateAmount));
+	TEST_VERIFY(m_context.resultRotrVar == Rotr32(CONSTANT_1, m_rotateAmount));
+	TEST_VERIFY(m_context.resultRotlCst == Rotl32(CONSTANT_1, m_rotateAmount));
+
+	TEST_VERIFY(m_context.resultRotl64 == Rotl64(CONSTANT_2, m_rotateAmount));
+	TEST_VERIFY(m_context.resultRotr64 == Rotr64(CONSTANT_2, m_rotateAmount));
+	TEST_VERIFY(m_context.resultRotl64Var == Rotl64(CONSTANT_2, m_rotateAmount));
+	TEST_VERIFY(m_context.resultRotr64Var == Rotr64(CONSTANT_2, m_rotateAmount));
+	TEST_VERIFY(m_context.resultRotr64Cst == Rotr64(CONSTANT_2, m_rotateAmount));
+}
+
+void CRotateTest::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		//------------------
+		//32-bits
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.Rotl(m_rotateAmount);
+		jitter.PullRel(offsetof(CONTEXT, resultRotl));
+
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.Rotr(m_rotateAmount);
+		jitter.PullRel(offsetof(CONTEXT, resultRotr));
+
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.PushRel(offsetof(CONTEXT, rotateAmount));
+		jitter.Rotl();
+		jitter.PullRel(offsetof(CONTEXT, resultRotlVar));
+
+		jitter.PushRel(offsetof(CONTEXT, value));
+		jitter.PushRel(offsetof(CONTEXT, rotateAmount));
+		jitter.Rotr();
+		jitter.PullRel(offsetof(CONTEXT, resultRotrVar));
+
+		//Folded
+		jitter.PushCst(CONSTANT_1);
+		jitter.Rotl(m_rotateAmount);
+		jitter.PullRel(offsetof(CONTEXT, resultRotlCst));
+
+		//------------------
+		//64-bits
+		jitter.PushRel64(offsetof(CONTEXT, value64));
+		jitter.Rotl64(m_rotateAmount);
+		jitter.PullRel64(offsetof(CONTEXT, resultRotl64));
+
+		jitter.PushRel64(offsetof(CONTEXT, value64));
+		jitter.Rotr64(m_rotateAmount);
+		jitter.PullRel64(offsetof(CONTEXT, resultRotr64));
+
+		jitter.PushRel64(offsetof(CONTEXT, value64));
+		jitter.PushRel(offsetof(CONTEXT, rotateAmount));
+		jitter.Rotl64();
+		jitter.PullRel64(offsetof(CONTEXT, resultRotl64Var));
+
+		jitter.PushRel64(offsetof(CONTEXT, value64));
+		jitter.PushRel(offsetof(CONTEXT, rotateAmount));
+		jitter.Rotr64();
+		jitter.PullRel64(offsetof(CONTEXT, resultRotr64Var));
+
+		//Folded
+		jitter.PushCst64(CONSTANT_2);
+		jitter.Rotr64(m_rotateAmount);
+		jitter.PullRel64(offsetof(CONTEXT, resultRotr64Cst));
+	}
+	jitter.End();
+
+	m_function = FunctionType(codeStream.GetBuffer(), codeStream.GetSize());
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Test.h"
+
+class CRotateTest : public CTest
+{
+public:
+	CRotateTest(uint32);
+
+	void Run() override;
+	void Compile(Jitter::CJitter&) override;
+
+private:
+	struct CONTEXT
+	{
+		uint32 value;
+		uint32 rotateAmount;
+
+		uint64 value64;
+
+		uint32 resultRotl;
+		uint32 resultRotr;
+		uint32 resultRotlVar;
+		uint32 resultRotrVar;
+		uint32 resultRotlCst;
+
+		uint64 resultRotl64;
+		uint64 resultRotr64;
+		uint64 resultRotl64Var;
+		uint64 resultRotr64Var;
+		uint64 resultRotr64Cst;
+	};
+
+	CONTEXT m_context;
+	FunctionType m_function;
+	uint32 m_rotateAmount = 0;
+};
@@ -0,0 +1,62 @@
+#include "Select64Test.h"
+#include "MemStream.h"
+
+constexpr uint64 VALUE_TRUE = 0x00FF00FF12345678ULL;
+constexpr uint64 VALUE_FALSE = 0xFF00FF0087654321ULL;
+constexpr uint64 VALUE_CST = 0x8000000000000001ULL;
+
+void CSelect64Test::Run()
+{
+	m_context = {};
+
+	m_context.valueFalse = VALUE_FALSE;
+	m_context.valueTrue = VALUE_TRUE;
+
+	{
+		m_context.cmp0 = 1;
+		m_context.cmp1 = 2;
+
+		m_function(&m_context);
+
+		TEST_VERIFY(m_context.result == VALUE_TRUE);
+		TEST_VERIFY(m_context.resultCst == VALUE_CST);
+	}
+
+	{
+		m_context.cmp0 = 2;
+		m_context.cmp1 = 1;
+
+		m_function(&m_context);
+
+		TEST_VERIFY(m_context.result == VALUE_FALSE);
+		TEST_VERIFY(m_context.resultCst == VALUE_FALSE);
+	}
+}
+
+void CSelect64Test::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		jitter.PushRel(offsetof(CONTEXT, cmp0));
+		jitter.PushRel(offsetof(CONTEXT, cmp1));
+		jitter.Cmp(Jitter::CONDITION_LE);
+		jitter.PushRel64(offsetof(CONTEXT, valueTrue));
+		jitter.PushRel64(offsetof(CONTEXT, valueFalse));
+		jitter.Select64();
+		jitter.PullRel64(offsetof(CONTEXT, result));
+
+		jitter.PushRel(offsetof(CONTEXT, cmp0));
+		jitter.PushRel(offsetof(CONTEXT, cmp1));
+		jitter.Cmp(Jitter::CONDITION_LE);
+		jitter.PushCst64(VALUE_CST);
+		jitter.PushRel64(offsetof(CONTEXT, valueFalse));
+		jitter.Select64();
+		jitter.PullRel64(offsetof(CONTEXT, resultCst));
+	}
+	jitter.End();
+
+	m_function = FunctionType(codeStream.GetBuffer(), codeStream.GetSize());
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Test.h"
+
+class CSelect64Test : public CTest
+{
+public:
+	void Run() override;
+	void Compile(Jitter::CJitter&) override;
+
+private:
+	struct CONTEXT
+	{
+		uint32 cmp0;
+		uint32 cmp1;
+
+		uint64 valueFalse;
+		uint64 valueTrue;
+
+		uint64 result;
+		uint64 resultCst;
+	};
+
+	CONTEXT m_context = {};
+	FunctionType m_function;
+};
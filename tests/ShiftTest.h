@@ -35,6 +35,10 @@ private:
 
 		uint32 resultShlVar0;
 		uint32 resultShlVar1;
+
+		uint32 resultSraCstVar;
+		uint32 resultSrlCstVar;
+		uint32 resultShlCstVar;
 	};
 
 	CONTEXT m_context;
@@ -0,0 +1,154 @@
+#include "StrengthReductionTest.h"
+#include "MemStream.h"
+
+// clang-format off
+const uint32 CStrengthReductionTest::g_inputs[INPUT_COUNT] =
+{
+	0, 1, 0x12345678, 0x7FFFFFFF, 0x80000000, 0xFFFF8001
+};
+
+const uint32 CStrengthReductionTest::g_constants[CONSTANT_COUNT] =
+{
+	1, 2, 3, 7, 10, 16, 641, 0x80000000, 0xFFFFFFFF, 0xFFFFFFF8, 0xFFFFFFF9, 0x40408000
+};
+// clang-format on
+
+CStrengthReductionTest::CStrengthReductionTest(bool isSigned)
+    : m_isSigned(isSigned)
+{
+}
+
+void CStrengthReductionTest::Run()
+{
+	memset(&m_context, 0, sizeof(m_context));
+
+	for(unsigned int i = 0; i < INPUT_COUNT; i++)
+	{
+		m_context.input[i] = g_inputs[i];
+	}
+
+	m_function(&m_context);
+
+	for(unsigned int i = 0; i < INPUT_COUNT; i++)
+	{
+		const auto& result = m_context.result[i];
+		uint32 input = g_inputs[i];
+		for(unsigned int j = 0; j < CONSTANT_COUNT; j++)
+		{
+			uint32 constant = g_constants[j];
+			uint64 product = 0;
+			uint32 quotient = 0;
+			uint32 remainder = 0;
+			if(m_isSigned)
+			{
+				int32 dividend = static_cast<int32>(input);
+				int32 divisor = static_cast<int32>(constant);
+				product = static_cast<uint64>(static_cast<int64>(dividend) * static_cast<int64>(divisor));
+				if((dividend == INT32_MIN) && (divisor == -1))
+				{
+					quotient = input;
+					remainder = 0;
+				}
+				else
+				{
+					quotient = dividend / divisor;
+					remainder = dividend % divisor;
+				}
+			}
+			else
+			{
+				product = static_cast<uint64>(input) * static_cast<uint64>(constant);
+				quotient = input / constant;
+				remainder = input % constant;
+			}
+			TEST_VERIFY(result.divLo[j] == quotient);
+			TEST_VERIFY(result.divHi[j] == remainder);
+			TEST_VERIFY(result.mulLo[j] == static_cast<uint32>(product));
+			TEST_VERIFY(result.mulHi[j] == static_cast<uint32>(product >> 32));
+			TEST_VERIFY(result.mulLoOnly[j] == static_cast<uint32>(product));
+		}
+	}
+}
+
+void CStrengthReductionTest::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		for(unsigned int i = 0; i < INPUT_COUNT; i++)
+		{
+			for(unsigned int j = 0; j < CONSTANT_COUNT; j++)
+			{
+				uint32 constant = g_constants[j];
+
+				//Skip the case that would trap on most platforms
+				if(!(m_isSigned && (g_inputs[i] == 0x80000000) && (constant == 0xFFFFFFFF)))
+				{
+					jitter.PushRel(offsetof(CONTEXT, input[i]));
+					jitter.PushCst(constant);
+					if(m_isSigned)
+					{
+						jitter.DivS();
+					}
+					else
+					{
+						jitter.Div();
+					}
+
+					jitter.PushTop();
+
+					jitter.ExtLow64();
+					jitter.PullRel(offsetof(CONTEXT, result[i].divLo[j]));
+
+					jitter.ExtHigh64();
+					jitter.PullRel(offsetof(CONTEXT, result[i].divHi[j]));
+				}
+				else
+				{
+					jitter.PushCst(0x80000000);
+					jitter.PullRel(offsetof(CONTEXT, result[i].divLo[j]));
+				}
+
+				//Full product
+				jitter.PushRel(offsetof(CONTEXT, input[i]));
+				jitter.PushCst(constant);
+				if(m_isSigned)
+				{
+					jitter.MultS();
+				}
+				else
+				{
+					jitter.Mult();
+				}
+
+				jitter.PushTop();
+
+				jitter.ExtLow64();
+				jitter.PullRel(offsetof(CONTEXT, result[i].mulLo[j]));
+
+				jitter.ExtHigh64();
+				jitter.PullRel(offsetof(CONTEXT, result[i].mulHi[j]));
+
+				//Only lower part of product
+				jitter.PushCst(constant);
+				jitter.PushRel(offsetof(CONTEXT, input[i]));
+				if(m_isSigned)
+				{
+					jitter.MultS();
+				}
+				else
+				{
+					jitter.Mult();
+				}
+
+				jitter.ExtLow64();
+				jitter.PullRel(offsetof(CONTEXT, result[i].mulLoOnly[j]));
+			}
+		}
+	}
+	jitter.End();
+
+	m_function = FunctionType(codeStream.GetBuffer(), codeStream.GetSize());
+}
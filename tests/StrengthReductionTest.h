@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Test.h"
+
+class CStrengthReductionTest : public CTest
+{
+public:
+	CStrengthReductionTest(bool);
+
+	void Run() override;
+	void Compile(Jitter::CJitter&) override;
+
+private:
+	enum
+	{
+		INPUT_COUNT = 6,
+		CONSTANT_COUNT = 12,
+	};
+
+	struct RESULT
+	{
+		uint32 divLo[CONSTANT_COUNT];
+		uint32 divHi[CONSTANT_COUNT];
+		uint32 mulLo[CONSTANT_COUNT];
+		uint32 mulHi[CONSTANT_COUNT];
+		uint32 mulLoOnly[CONSTANT_COUNT];
+	};
+
+	struct CONTEXT
+	{
+		uint32 input[INPUT_COUNT];
+		RESULT result[INPUT_COUNT];
+	};
+
+	static const uint32 g_inputs[INPUT_COUNT];
+	static const uint32 g_constants[CONSTANT_COUNT];
+
+	bool m_isSigned;
+	CONTEXT m_context;
+	FunctionType m_function;
+};
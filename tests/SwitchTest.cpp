@@ -0,0 +1,164 @@
+#include "SwitchTest.h"
+#include "MemStream.h"
+#include "offsetof_def.h"
+
+#define CASE_COUNT (5)
+#define DEFAULT_VALUE (0xDEADBEEF)
+#define CST_INDEX (3)
+#define LOOP_COUNT (10)
+
+CSwitchTest::CSwitchTest(uint32 index)
+    : m_index(index)
+{
+}
+
+uint32 CSwitchTest::GetCaseValue(uint32 index)
+{
+	return (index < CASE_COUNT) ? ((index + 1) * 0x1111) : DEFAULT_VALUE;
+}
+
+void CSwitchTest::Compile(Jitter::CJitter& jitter)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		//Dispatch on a value from the context
+		{
+			std::vector<Jitter::CJitter::LABEL> caseLabels;
+			for(uint32 i = 0; i < CASE_COUNT; i++)
+			{
+				caseLabels.push_back(jitter.CreateLabel());
+			}
+			auto defaultLabel = jitter.CreateLabel();
+			auto doneLabel = jitter.CreateLabel();
+
+			jitter.PushRel(offsetof(CONTEXT, index));
+			jitter.Switch(caseLabels, defaultLabel);
+
+			//Cases are marked in reverse order to make sure targets aren't expected to follow the table
+			for(uint32 i = 0; i < CASE_COUNT; i++)
+			{
+				uint32 caseIndex = CASE_COUNT - i - 1;
+				jitter.MarkLabel(caseLabels[caseIndex]);
+				jitter.PushCst(GetCaseValue(caseIndex));
+				jitter.PullRel(offsetof(CONTEXT, result));
+				jitter.Goto(doneLabel);
+			}
+
+			jitter.MarkLabel(defaultLabel);
+			jitter.PushCst(DEFAULT_VALUE);
+			jitter.PullRel(offsetof(CONTEXT, result));
+
+			jitter.MarkLabel(doneLabel);
+		}
+
+		//Dispatch on a constant, should be resolved at compile time
+		{
+			std::vector<Jitter::CJitter::LABEL> caseLabels;
+			for(uint32 i = 0; i < CASE_COUNT; i++)
+			{
+				caseLabels.push_back(jitter.CreateLabel());
+			}
+			auto doneLabel = jitter.CreateLabel();
+
+			jitter.PushCst(CST_INDEX);
+			jitter.Switch(caseLabels, doneLabel);
+
+			for(uint32 i = 0; i < CASE_COUNT; i++)
+			{
+				jitter.MarkLabel(caseLabels[i]);
+				jitter.PushCst(GetCaseValue(i));
+				jitter.PullRel(offsetof(CONTEXT, resultCst));
+				jitter.Goto(doneLabel);
+			}
+
+			jitter.MarkLabel(doneLabel);
+		}
+
+		//Dispatch inside a loop, cases share targets
+		{
+			auto loopLabel = jitter.CreateLabel();
+			auto addLabel = jitter.CreateLabel();
+			auto shiftLabel = jitter.CreateLabel();
+			auto xorLabel = jitter.CreateLabel();
+			auto nextLabel = jitter.CreateLabel();
+
+			std::vector<Jitter::CJitter::LABEL> caseLabels = {addLabel, shiftLabel, addLabel, xorLabel};
+
+			jitter.MarkLabel(loopLabel);
+
+			jitter.PushRel(offsetof(CONTEXT, counter));
+			jitter.PushCst(3);
+			jitter.And();
+			jitter.Switch(caseLabels, nextLabel);
+
+			jitter.MarkLabel(addLabel);
+			jitter.PushRel(offsetof(CONTEXT, resultLoop));
+			jitter.PushRel(offsetof(CONTEXT, counter));
+			jitter.Add();
+			jitter.PullRel(offsetof(CONTEXT, resultLoop));
+			jitter.Goto(nextLabel);
+
+			jitter.MarkLabel(shiftLabel);
+			jitter.PushRel(offsetof(CONTEXT, resultLoop));
+			jitter.Shl(1);
+			jitter.PullRel(offsetof(CONTEXT, resultLoop));
+			jitter.Goto(nextLabel);
+
+			jitter.MarkLabel(xorLabel);
+			jitter.PushRel(offsetof(CONTEXT, resultLoop));
+			jitter.PushCst(0x5A5A);
+			jitter.Xor();
+			jitter.PullRel(offsetof(CONTEXT, resultLoop));
+
+			jitter.MarkLabel(nextLabel);
+			jitter.PushRel(offsetof(CONTEXT, counter));
+			jitter.PushCst(1);
+			jitter.Add();
+			jitter.PullRel(offsetof(CONTEXT, counter));
+
+			jitter.PushRel(offsetof(CONTEXT, counter));
+			jitter.PushCst(LOOP_COUNT);
+			jitter.BeginIf(Jitter::CONDITION_BL);
+			{
+				jitter.Goto(loopLabel);
+			}
+			jitter.EndIf();
+		}
+	}
+	jitter.End();
+
+	m_function = FunctionType(codeStream.GetBuffer(), codeStream.GetSize());
+}
+
+void CSwitchTest::Run()
+{
+	memset(&m_context, 0, sizeof(CONTEXT));
+	m_context.index = m_index;
+	m_function(&m_context);
+
+	uint32 resultLoop = 0;
+	for(uint32 i = 0; i < LOOP_COUNT; i++)
+	{
+		switch(i & 3)
+		{
+		case 0:
+		case 2:
+			resultLoop += i;
+			break;
+		case 1:
+			resultLoop <<= 1;
+			break;
+		case 3:
+			resultLoop ^= 0x5A5A;
+			break;
+		}
+	}
+
+	TEST_VERIFY(m_context.result == GetCaseValue(m_index));
+	TEST_VERIFY(m_context.resultCst == GetCaseValue(CST_INDEX));
+	TEST_VERIFY(m_context.counter == LOOP_COUNT);
+	TEST_VERIFY(m_context.resultLoop == resultLoop);
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Test.h"
+
+class CSwitchTest : public CTest
+{
+public:
+	CSwitchTest(uint32);
+
+	void Compile(Jitter::CJitter&) override;
+	void Run() override;
+
+private:
+	struct CONTEXT
+	{
+		uint32 index;
+		uint32 counter;
+
+		uint32 result;
+		uint32 resultCst;
+		uint32 resultLoop;
+	};
+
+	static uint32 GetCaseValue(uint32);
+
+	uint32 m_index = 0;
+
+	CONTEXT m_context;
+	FunctionType m_function;
+};
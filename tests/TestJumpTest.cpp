@@ -0,0 +1,83 @@
+#include "TestJumpTest.h"
+#include "MemStream.h"
+
+CTestJumpTest::CTestJumpTest(uint32 value0, uint32 value1)
+    : m_value0(value0)
+    , m_value1(value1)
+{
+}
+
+void CTestJumpTest::Run()
+{
+	memset(&m_context, 0, sizeof(m_context));
+
+	m_context.self = &m_context;
+	m_context.value0 = m_value0;
+	m_context.value1 = m_value1;
+
+	m_context.result = 0xdeadbeef;
+	m_andFunction(&m_context);
+	TEST_VERIFY(m_context.result == (((m_value0 & m_value1) != 0) ? 1 : 0));
+
+	m_context.result = 0xdeadbeef;
+	m_xorFunction(&m_context);
+	TEST_VERIFY(m_context.result == (((m_value0 ^ m_value1) != 0) ? 1 : 0));
+
+	//(a ^ b) != 0 branches on a compare of a and b. If test jumps are supported,
+	//(a & b) != 0 should branch on a test of a and b and not need more code than that.
+	if(m_codeGenSupportsTestJumps)
+	{
+		TEST_VERIFY(m_andFunctionSize <= m_xorFunctionSize);
+	}
+}
+
+void CTestJumpTest::Compile(Jitter::CJitter& jitter)
+{
+	m_codeGenSupportsTestJumps = jitter.GetCodeGen()->SupportsTestJumps();
+	m_andFunction = CompileBranch(jitter, true, m_andFunctionSize);
+	m_xorFunction = CompileBranch(jitter, false, m_xorFunctionSize);
+}
+
+CTest::FunctionType CTestJumpTest::CompileBranch(Jitter::CJitter& jitter, bool useAnd, size_t& functionSize)
+{
+	Framework::CMemStream codeStream;
+	jitter.SetStream(&codeStream);
+
+	jitter.Begin();
+	{
+		jitter.PushRel(offsetof(CONTEXT, value0));
+		jitter.PushRel(offsetof(CONTEXT, value1));
+		if(useAnd)
+		{
+			jitter.And();
+		}
+		else
+		{
+			jitter.Xor();
+		}
+		jitter.PushCst(0);
+
+		//Store through a reference so the arms aren't turned into selects
+		jitter.BeginIf(Jitter::CONDITION_NE);
+		{
+			jitter.PushRelRef(offsetof(CONTEXT, self));
+			jitter.PushCst(offsetof(CONTEXT, result));
+			jitter.AddRef();
+			jitter.PushCst(1);
+			jitter.StoreAtRef();
+		}
+		jitter.Else();
+		{
+			jitter.PushRelRef(offsetof(CONTEXT, self));
+			jitter.PushCst(offsetof(CONTEXT, result));
+			jitter.AddRef();
+			jitter.PushCst(0);
+			jitter.StoreAtRef();
+		}
+		jitter.EndIf();
+	}
+	jitter.End();
+
+	functionSize = codeStream.GetSize();
+	return FunctionType(codeStream.GetBuffer(), codeStream.GetSize());
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "Test.h"
+
+class CTestJumpTest : public CTest
+{
+public:
+	CTestJumpTest(uint32, uint32);
+
+	void Run() override;
+	void Compile(Jitter::CJitter&) override;
+
+private:
+	struct CONTEXT
+	{
+		//Points back to this context, used to store results through a reference
+		void* self;
+
+		uint32 value0;
+		uint32 value1;
+
+		uint32 result;
+	};
+
+	FunctionType CompileBranch(Jitter::CJitter&, bool, size_t&);
+
+	uint32 m_value0 = 0;
+	uint32 m_value1 = 0;
+	bool m_codeGenSupportsTestJumps = false;
+	size_t m_andFunctionSize = 0;
+	size_t m_xorFunctionSize = 0;
+	CONTEXT m_context;
+	FunctionType m_andFunction;
+	FunctionType m_xorFunction;
+};